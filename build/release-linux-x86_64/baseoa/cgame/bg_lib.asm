@@ -0,0 +1,8306 @@
+code
+proc swapfunc 24 0
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GTI4 $28
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $30
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $31
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $30
+ADDRGP4 $29
+JUMPV
+LABELV $28
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $33
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $34
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $33
+LABELV $29
+LABELV $27
+endproc swapfunc 24 0
+proc med3 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $42
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $44
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $45
+JUMPV
+LABELV $44
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $46
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $47
+JUMPV
+LABELV $46
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $47
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $45
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $43
+JUMPV
+LABELV $42
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $48
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $49
+JUMPV
+LABELV $48
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $50
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $51
+JUMPV
+LABELV $50
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $51
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $49
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $43
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $36
+endproc med3 40 8
+export qsort
+proc qsort 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $53
+ADDRLP4 52
+CNSTU4 3
+ASGNU4
+ADDRLP4 56
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CVUI4 4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+NEU4 $58
+ADDRFP4 8
+INDIRU4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+EQU4 $56
+LABELV $58
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRGP4 $57
+JUMPV
+LABELV $56
+ADDRFP4 8
+INDIRU4
+CNSTU4 4
+NEU4 $59
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 $60
+JUMPV
+LABELV $59
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+LABELV $60
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $57
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRU4
+CNSTU4 7
+GEU4 $61
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $66
+JUMPV
+LABELV $63
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $70
+JUMPV
+LABELV $67
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $71
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $72
+JUMPV
+LABELV $71
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $72
+LABELV $68
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $70
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $73
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+GTI4 $67
+LABELV $73
+LABELV $64
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $66
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $63
+ADDRGP4 $52
+JUMPV
+LABELV $61
+ADDRLP4 32
+ADDRFP4 4
+INDIRU4
+CNSTI4 1
+RSHU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRU4
+CNSTU4 7
+LEU4 $74
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRU4
+CNSTU4 40
+LEU4 $76
+ADDRLP4 40
+ADDRFP4 4
+INDIRU4
+CNSTI4 3
+RSHU4
+ADDRFP4 8
+INDIRU4
+MULU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 88
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $76
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $74
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $78
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $79
+ADDRLP4 72
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $87
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $89
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $90
+ADDRLP4 20
+ADDRFP4 8
+INDIRU4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $87
+ADDRLP4 4
+ADDRFP4 8
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $85
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $91
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LEI4 $84
+LABELV $91
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $97
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $98
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $95
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $93
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $99
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $92
+LABELV $99
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+LEU4 $100
+ADDRGP4 $82
+JUMPV
+LABELV $100
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRLP4 96
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $103
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 8
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+ADDRGP4 $85
+JUMPV
+LABELV $82
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $104
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $106
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $114
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $115
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ASGNP4
+LABELV $113
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $116
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRU4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GTI4 $110
+LABELV $116
+LABELV $107
+ADDRLP4 32
+ADDRFP4 8
+INDIRU4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $109
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $106
+ADDRGP4 $52
+JUMPV
+LABELV $104
+ADDRLP4 36
+ADDRFP4 4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 88
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+SUBU4
+CVUI4 4
+GEI4 $118
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+LABELV $119
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $120
+ADDRLP4 100
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 100
+INDIRU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+SUBU4
+GEU4 $123
+ADDRLP4 96
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 96
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+SUBU4
+ASGNU4
+LABELV $124
+ADDRLP4 12
+ADDRLP4 96
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $125
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $125
+ADDRLP4 108
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+LEU4 $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+DIVU4
+ARGU4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $127
+ADDRLP4 116
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+LEU4 $129
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRFP4 8
+INDIRU4
+DIVU4
+ASGNU4
+ADDRGP4 $53
+JUMPV
+LABELV $129
+LABELV $52
+endproc qsort 124 16
+export strlen
+proc strlen 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $133
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $132
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+RETU4
+LABELV $131
+endproc strlen 4 0
+export strcat
+proc strcat 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $137
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $136
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $140
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $139
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $135
+endproc strcat 16 0
+export strcpy
+proc strcpy 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $144
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $143
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $142
+endproc strcpy 16 0
+export strcmp
+proc strcmp 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $148
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $151
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $151
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $147
+LABELV $151
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+SUBI4
+RETI4
+LABELV $146
+endproc strcmp 12 0
+export strchr
+proc strchr 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $156
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $152
+JUMPV
+LABELV $156
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $154
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $153
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $158
+CNSTP4 0
+RETP4
+ADDRGP4 $152
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $152
+endproc strchr 0 0
+export strrchr
+proc strrchr 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $164
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $164
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $162
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $161
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $166
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $160
+JUMPV
+LABELV $166
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $160
+endproc strrchr 4 0
+export strstr
+proc strstr 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $172
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $176
+ADDRGP4 $174
+JUMPV
+LABELV $176
+LABELV $173
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $172
+LABELV $174
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $178
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $168
+JUMPV
+LABELV $178
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $170
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $169
+CNSTP4 0
+RETP4
+LABELV $168
+endproc strstr 8 0
+export tolower
+proc tolower 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $181
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $181
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $181
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $180
+endproc tolower 4 0
+export toupper
+proc toupper 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $184
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $184
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32
+ADDI4
+ASGNI4
+LABELV $184
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $183
+endproc toupper 4 0
+export memmove
+proc memmove 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $187
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+LEU4 $189
+ADDRLP4 0
+ADDRFP4 8
+INDIRU4
+ASGNU4
+LABELV $191
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+SUBU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $192
+ADDRLP4 0
+INDIRU4
+CNSTU4 0
+NEU4 $191
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRGP4 $197
+JUMPV
+LABELV $194
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $195
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $197
+ADDRLP4 0
+INDIRU4
+ADDRFP4 8
+INDIRU4
+LTU4 $194
+LABELV $190
+LABELV $187
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $186
+endproc memmove 8 0
+proc powN 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $199
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 1
+NEI4 $204
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $204
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $202
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $201
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRFP4 4
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $206
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+DIVF4
+RETF4
+ADDRGP4 $198
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+NEGI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 powN
+CALLF4
+ASGNF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $198
+endproc powN 8 8
+export tan
+proc tan 8 4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $208
+endproc tan 8 4
+data
+align 4
+LABELV randSeed
+byte 4 0
+export srand
+code
+proc srand 0 0
+ADDRGP4 randSeed
+ADDRFP4 0
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $209
+endproc srand 0 0
+export rand
+proc rand 4 0
+ADDRLP4 0
+ADDRGP4 randSeed
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 69069
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32767
+BANDI4
+RETI4
+LABELV $210
+endproc rand 4 0
+export atof
+proc atof 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $215
+CNSTF4 0
+RETF4
+ADDRGP4 $211
+JUMPV
+LABELV $215
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $213
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $212
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $220
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $221
+ADDRGP4 $217
+JUMPV
+LABELV $220
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $218
+JUMPV
+LABELV $221
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $218
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+EQI4 $222
+LABELV $224
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $229
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $227
+LABELV $229
+ADDRGP4 $223
+JUMPV
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $225
+ADDRGP4 $224
+JUMPV
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $223
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $230
+ADDRLP4 20
+CNSTF4 1036831949
+ASGNF4
+LABELV $232
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $237
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $235
+LABELV $237
+ADDRGP4 $234
+JUMPV
+LABELV $235
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $233
+ADDRGP4 $232
+JUMPV
+LABELV $234
+LABELV $230
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+RETF4
+LABELV $211
+endproc atof 36 0
+export _atof
+proc _atof 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $242
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTF4 0
+RETF4
+ADDRGP4 $238
+JUMPV
+LABELV $242
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $240
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $239
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $247
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $248
+ADDRGP4 $244
+JUMPV
+LABELV $247
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $245
+JUMPV
+LABELV $248
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $245
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+EQI4 $249
+LABELV $251
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $256
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $254
+LABELV $256
+ADDRGP4 $253
+JUMPV
+LABELV $254
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1092616192
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $252
+ADDRGP4 $251
+JUMPV
+LABELV $253
+LABELV $249
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $257
+ADDRLP4 24
+CNSTF4 1036831949
+ASGNF4
+LABELV $259
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $262
+LABELV $264
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1036831949
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $260
+ADDRGP4 $259
+JUMPV
+LABELV $261
+LABELV $257
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+RETF4
+LABELV $238
+endproc _atof 40 0
+export strtod
+proc strtod 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $267
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+EQI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+EQI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $271
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $269
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $272
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 41
+NEI4 $276
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CNSTI4 8388607
+BANDI4
+CNSTI4 2139095040
+BORI4
+CVIU4 4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $278
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $278
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $276
+LABELV $274
+ADDRLP4 16
+CNSTU4 2147483647
+ASGNU4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 16
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRLP4 20
+CNSTU4 2139095040
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $283
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $285
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $286
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $288
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $290
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $290
+LABELV $289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $292
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 48
+LTI4 $298
+ADDRLP4 32
+INDIRI4
+CNSTI4 57
+GTI4 $298
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $300
+ADDRLP4 40
+INDIRI4
+CNSTI4 70
+GTI4 $300
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1115815936
+SUBF4
+ASGNF4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 97
+LTI4 $297
+ADDRLP4 48
+INDIRI4
+CNSTI4 102
+GTI4 $297
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 52
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1120010240
+SUBF4
+ASGNF4
+LABELV $303
+LABELV $301
+LABELV $299
+LABELV $296
+ADDRGP4 $295
+JUMPV
+LABELV $297
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $304
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $304
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $306
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1031798784
+ASGNF4
+LABELV $308
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $312
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $312
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 65
+LTI4 $314
+ADDRLP4 44
+INDIRI4
+CNSTI4 70
+GTI4 $314
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 97
+LTI4 $310
+ADDRLP4 52
+INDIRI4
+CNSTI4 102
+GTI4 $310
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 56
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $317
+LABELV $315
+LABELV $313
+LABELV $309
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRGP4 $308
+JUMPV
+LABELV $310
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $318
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $318
+LABELV $306
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+EQU4 $320
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 112
+NEI4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $322
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $324
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $324
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $322
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $320
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $326
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $326
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $292
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $331
+JUMPV
+LABELV $328
+LABELV $329
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1092616192
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+LABELV $331
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $332
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+LEI4 $328
+LABELV $332
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $333
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $333
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $335
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $340
+JUMPV
+LABELV $337
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $338
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ASGNF4
+LABELV $340
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 48
+LTI4 $341
+ADDRLP4 48
+INDIRI4
+CNSTI4 57
+LEI4 $337
+LABELV $341
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $342
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $342
+LABELV $335
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+EQU4 $344
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 101
+NEI4 $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 48
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $346
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $348
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $348
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $265
+JUMPV
+LABELV $346
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $344
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $350
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $350
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $265
+endproc strtod 60 12
+export atoi
+proc atoi 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $356
+CNSTI4 0
+RETI4
+ADDRGP4 $352
+JUMPV
+LABELV $356
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $354
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $353
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $361
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $362
+ADDRGP4 $358
+JUMPV
+LABELV $361
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $362
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $359
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $363
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $368
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $366
+LABELV $368
+ADDRGP4 $365
+JUMPV
+LABELV $366
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $364
+ADDRGP4 $363
+JUMPV
+LABELV $365
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+RETI4
+LABELV $352
+endproc atoi 28 0
+export _atoi
+proc _atoi 32 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $373
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $373
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $371
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $370
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $378
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $379
+ADDRGP4 $375
+JUMPV
+LABELV $378
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $379
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $376
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $385
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $383
+LABELV $385
+ADDRGP4 $382
+JUMPV
+LABELV $383
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $381
+ADDRGP4 $380
+JUMPV
+LABELV $382
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+RETI4
+LABELV $369
+endproc _atoi 32 0
+export strtol
+proc strtol 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $387
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $387
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $392
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $392
+ADDRFP4 8
+INDIRI4
+CNSTI4 36
+LEI4 $394
+LABELV $392
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $393
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $394
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+EQI4 $393
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+EQI4 $393
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $393
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+EQI4 $393
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $393
+ADDRLP4 12
+INDIRI4
+CNSTI4 11
+EQI4 $393
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $396
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $398
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $398
+LABELV $397
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $400
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $402
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $402
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 120
+EQI4 $406
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+NEI4 $404
+LABELV $406
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $407
+ADDRFP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $407
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $409
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $409
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $407
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $404
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $401
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $413
+ADDRFP4 8
+CNSTI4 10
+ASGNI4
+LABELV $413
+LABELV $401
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $418
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $418
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $420
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+GTI4 $420
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 65
+LTI4 $417
+ADDRLP4 28
+INDIRI4
+CNSTI4 90
+GTI4 $417
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+ASGNI4
+LABELV $423
+LABELV $421
+LABELV $419
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $424
+ADDRGP4 $417
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 -2147483648
+ADDI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+GEI4 $426
+ADDRLP4 0
+CNSTI4 -2147483648
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $427
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $428
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $428
+LABELV $416
+ADDRGP4 $415
+JUMPV
+LABELV $417
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $432
+ADDRLP4 0
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $433
+LABELV $430
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $386
+endproc strtol 32 0
+export abs
+proc abs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $436
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $437
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $434
+endproc abs 4 0
+export fabs
+proc fabs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $440
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+LABELV $441
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $438
+endproc fabs 4 0
+proc dopr 276 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $446
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $446
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $449
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $449
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $556
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $556
+address $450
+address $453
+address $463
+address $468
+address $471
+address $478
+address $489
+address $494
+address $449
+code
+LABELV $450
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $451
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $452
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 60
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $453
+ADDRLP4 64
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $459
+ADDRLP4 64
+INDIRI4
+CNSTI4 35
+EQI4 $460
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $454
+LABELV $462
+ADDRLP4 64
+INDIRI4
+CNSTI4 43
+EQI4 $458
+ADDRLP4 64
+INDIRI4
+CNSTI4 45
+EQI4 $457
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+EQI4 $461
+ADDRGP4 $454
+JUMPV
+LABELV $457
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $458
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $459
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $460
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 96
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $461
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $454
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $463
+ADDRLP4 80
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 80
+INDIRI4
+GTI4 $464
+ADDRLP4 80
+INDIRI4
+CNSTI4 57
+GTI4 $464
+ADDRLP4 16
+CNSTI4 10
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $464
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $466
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 88
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $466
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $468
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $469
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $469
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $471
+ADDRLP4 84
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 84
+INDIRI4
+GTI4 $472
+ADDRLP4 84
+INDIRI4
+CNSTI4 57
+GTI4 $472
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $474
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $449
+JUMPV
+LABELV $472
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $476
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $476
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $478
+ADDRLP4 88
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 96
+CNSTI4 104
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $482
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GTI4 $486
+LABELV $485
+ADDRLP4 88
+INDIRI4
+CNSTI4 76
+EQI4 $484
+ADDRGP4 $480
+JUMPV
+LABELV $486
+ADDRLP4 88
+INDIRI4
+CNSTI4 108
+EQI4 $483
+ADDRGP4 $480
+JUMPV
+LABELV $482
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $480
+JUMPV
+LABELV $483
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 108
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $480
+JUMPV
+LABELV $484
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $480
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $487
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $487
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $489
+ADDRLP4 100
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 108
+EQI4 $493
+ADDRGP4 $491
+JUMPV
+LABELV $493
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 104
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 104
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $491
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $494
+ADDRLP4 104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 69
+EQI4 $530
+ADDRLP4 112
+CNSTI4 71
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $534
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $551
+LABELV $550
+ADDRLP4 104
+INDIRI4
+CNSTI4 37
+EQI4 $548
+ADDRGP4 $496
+JUMPV
+LABELV $551
+ADDRLP4 120
+CNSTI4 88
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $519
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $496
+LABELV $552
+ADDRLP4 104
+INDIRI4
+CNSTI4 99
+LTI4 $496
+ADDRLP4 104
+INDIRI4
+CNSTI4 120
+GTI4 $496
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $553-396
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $553
+address $538
+address $498
+address $531
+address $527
+address $535
+address $496
+address $498
+address $496
+address $496
+address $496
+address $496
+address $541
+address $505
+address $540
+address $496
+address $496
+address $539
+address $496
+address $512
+address $496
+address $549
+address $520
+code
+LABELV $498
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $499
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 128
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII2 4
+CVII4 2
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $501
+ADDRLP4 132
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 132
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $503
+ADDRLP4 136
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 140
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $504
+LABELV $502
+LABELV $500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $505
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $506
+ADDRLP4 148
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 148
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $508
+ADDRLP4 152
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 152
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $510
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 156
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 160
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 160
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $511
+LABELV $509
+LABELV $507
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $512
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $513
+ADDRLP4 168
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $515
+ADDRLP4 172
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 172
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $517
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 176
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $518
+JUMPV
+LABELV $517
+ADDRLP4 180
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 180
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $518
+LABELV $516
+LABELV $514
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $519
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $520
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $521
+ADDRLP4 188
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 188
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $523
+ADDRLP4 192
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 192
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $525
+ADDRLP4 196
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 196
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRLP4 200
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 200
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $526
+LABELV $524
+LABELV $522
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $527
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $528
+ADDRLP4 208
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 208
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 212
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $529
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 216
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $530
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $531
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $532
+ADDRLP4 220
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 220
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 224
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 224
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $534
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $535
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $536
+ADDRLP4 232
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 232
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 236
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $537
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 240
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 244
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 248
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 248
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $539
+ADDRLP4 252
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 252
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 fmtstr
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 256
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $540
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 260
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CVUI4 4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 264
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $541
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $542
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+CVII2 4
+ASGNI2
+ADDRGP4 $496
+JUMPV
+LABELV $542
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $544
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $544
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $546
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $546
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $549
+ADDRLP4 272
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 272
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $496
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+LABELV $449
+LABELV $444
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $443
+ADDRFP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $557
+ADDRLP4 28
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $557
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $442
+endproc dopr 276 32
+proc fmtstr 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $560
+ADDRFP4 12
+ADDRGP4 $562
+ASGNP4
+LABELV $560
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $566
+JUMPV
+LABELV $563
+LABELV $564
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $566
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $563
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $567
+ADDRFP4 24
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $567
+ADDRLP4 8
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $567
+ADDRLP4 0
+ADDRFP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $569
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $569
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $574
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 20
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $574
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $573
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $577
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $579
+ADDRFP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $576
+ADDRLP4 12
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $576
+LABELV $579
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 28
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $581
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $580
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $559
+endproc fmtstr 32 16
+proc fmtint 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $584
+ADDRFP4 24
+CNSTI4 0
+ASGNI4
+LABELV $584
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRFP4 28
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $586
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $588
+ADDRLP4 48
+CNSTI4 45
+ASGNI4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+NEGI4
+CVIU4 4
+ASGNU4
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $590
+ADDRLP4 48
+CNSTI4 43
+ASGNI4
+ADDRGP4 $591
+JUMPV
+LABELV $590
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $592
+ADDRLP4 48
+CNSTI4 32
+ASGNI4
+LABELV $592
+LABELV $591
+LABELV $589
+LABELV $586
+ADDRFP4 28
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $594
+ADDRLP4 44
+ADDRGP4 $596
+ASGNP4
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRLP4 44
+ADDRGP4 $597
+ASGNP4
+LABELV $595
+LABELV $598
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+MODU4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+DIVU4
+ASGNU4
+LABELV $599
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $601
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+LTU4 $598
+LABELV $601
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+NEU4 $602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $602
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 40
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $606
+ADDRLP4 52
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $607
+JUMPV
+LABELV $606
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $607
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $609
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $610
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $610
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $612
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $612
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $614
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $617
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $618
+ADDRLP4 40
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $614
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $622
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $622
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $621
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 48
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $624
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $632
+ADDRGP4 $629
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 72
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $629
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GTI4 $628
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $632
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $631
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 80
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $635
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $634
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $583
+endproc fmtint 84 16
+proc abs_val 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $638
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $638
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $637
+endproc abs_val 4 0
+proc round 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+LTF4 $641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $641
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $640
+endproc round 8 0
+proc fmtfp 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $644
+ADDRFP4 20
+CNSTI4 6
+ASGNI4
+LABELV $644
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 abs_val
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $646
+ADDRLP4 72
+CNSTI4 45
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $648
+ADDRLP4 72
+CNSTI4 43
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $650
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+LABELV $650
+LABELV $649
+LABELV $647
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 9
+LEI4 $652
+ADDRFP4 20
+CNSTI4 9
+ASGNI4
+LABELV $652
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 92
+INDIRF4
+LTF4 $654
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $654
+LABELV $656
+ADDRLP4 100
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 96
+ADDRGP4 $596
+ASGNP4
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRLP4 96
+ADDRGP4 $597
+ASGNP4
+LABELV $661
+ADDRLP4 100
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $657
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $662
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+LTI4 $656
+LABELV $662
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+NEI4 $663
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $663
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $665
+ADDRLP4 100
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRLP4 96
+ADDRGP4 $596
+ASGNP4
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRLP4 96
+ADDRGP4 $597
+ASGNP4
+LABELV $670
+ADDRLP4 100
+INDIRI4
+ADDRLP4 48
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $666
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $671
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $665
+LABELV $671
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+NEI4 $672
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $672
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $675
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $676
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRFP4 20
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GEI4 $677
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $677
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $679
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $679
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $681
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $681
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $691
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LEI4 $691
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $688
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $688
+JUMPV
+LABELV $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $688
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $687
+ADDRGP4 $691
+JUMPV
+LABELV $690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $691
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $690
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $696
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 112
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $696
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $695
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 46
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $701
+JUMPV
+LABELV $700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 48
+ARGI4
+ADDRLP4 120
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $701
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+GTI4 $700
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 128
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $704
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $703
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+CNSTI4 32
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $707
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $706
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $643
+endproc fmtfp 136 16
+proc dopr_outch 8 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRFP4 8
+INDIRU4
+GEU4 $710
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRI1
+ASGNI1
+LABELV $710
+CNSTI4 1
+RETI4
+LABELV $709
+endproc dopr_outch 8 0
+export Q_vsnprintf
+proc Q_vsnprintf 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRU4
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 dopr
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $712
+endproc Q_vsnprintf 4 16
+export sscanf
+proc sscanf 84 4
+ADDRLP4 8
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $716
+JUMPV
+LABELV $715
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+EQI4 $718
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $716
+JUMPV
+LABELV $718
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $720
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+GTI4 $720
+ADDRFP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $721
+JUMPV
+LABELV $720
+ADDRLP4 4
+CNSTU4 1023
+ASGNU4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $721
+ADDRLP4 24
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $724
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $725
+ADDRLP4 0
+INDIRI4
+CNSTI4 105
+EQI4 $724
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $722
+LABELV $735
+ADDRLP4 0
+INDIRI4
+CNSTI4 115
+EQI4 $726
+ADDRLP4 0
+INDIRI4
+CNSTI4 117
+EQI4 $724
+ADDRGP4 $722
+JUMPV
+LABELV $724
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $725
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 _atof
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $723
+JUMPV
+LABELV $726
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $728
+JUMPV
+LABELV $727
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $728
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+EQI4 $727
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+EQI4 $727
+ADDRLP4 56
+INDIRI4
+CNSTI4 10
+EQI4 $727
+ADDRLP4 56
+INDIRI4
+CNSTI4 13
+EQI4 $727
+ADDRLP4 56
+INDIRI4
+CNSTI4 9
+EQI4 $727
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+EQI4 $727
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 60
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+ADDRLP4 60
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $731
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRLP4 76
+INDIRI4
+CNSTI4 32
+EQI4 $734
+ADDRLP4 76
+INDIRI4
+CNSTI4 12
+EQI4 $734
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+EQI4 $734
+ADDRLP4 76
+INDIRI4
+CNSTI4 13
+EQI4 $734
+ADDRLP4 76
+INDIRI4
+CNSTI4 9
+EQI4 $734
+ADDRLP4 76
+INDIRI4
+CNSTI4 11
+EQI4 $734
+ADDRLP4 72
+ADDRLP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 72
+INDIRU4
+CNSTU4 1
+SUBU4
+ASGNU4
+ADDRLP4 72
+INDIRU4
+CNSTU4 0
+NEU4 $730
+LABELV $734
+ADDRLP4 80
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $722
+LABELV $723
+LABELV $716
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $715
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $713
+endproc sscanf 84 4
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import strncpy
+lit
+align 1
+LABELV $597
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $596
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 0
+align 1
+LABELV $562
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $294
+byte 1 48
+byte 1 120
+byte 1 0
+align 1
+LABELV $287
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $282
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 0
+align 1
+LABELV $271
+byte 1 110
+byte 1 97
+byte 1 110
+byte 1 0
@@ -0,0 +1,9698 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+code
+proc CG_DrawField 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $76
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRFP4 8
+INDIRI4
+CNSTI4 5
+LEI4 $78
+ADDRFP4 8
+CNSTI4 5
+ASGNI4
+LABELV $78
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $80
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+GTI4 $80
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $110-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $110
+address $82
+address $89
+address $96
+address $103
+code
+LABELV $82
+ADDRFP4 12
+INDIRI4
+CNSTI4 9
+LEI4 $84
+ADDRLP4 32
+CNSTI4 9
+ASGNI4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 32
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $85
+ADDRFP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $87
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 36
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $88
+ADDRFP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $89
+ADDRFP4 12
+INDIRI4
+CNSTI4 99
+LEI4 $91
+ADDRLP4 40
+CNSTI4 99
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $92
+ADDRFP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -9
+GEI4 $94
+ADDRLP4 44
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 44
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $95
+ADDRFP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $96
+ADDRFP4 12
+INDIRI4
+CNSTI4 999
+LEI4 $98
+ADDRLP4 48
+CNSTI4 999
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $99
+ADDRFP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -99
+GEI4 $101
+ADDRLP4 52
+CNSTI4 -99
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRLP4 52
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $102
+ADDRFP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $103
+ADDRFP4 12
+INDIRI4
+CNSTI4 9999
+LEI4 $105
+ADDRLP4 56
+CNSTI4 9999
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 56
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $106
+ADDRFP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -999
+GEI4 $108
+ADDRLP4 60
+CNSTI4 -999
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 60
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $109
+ADDRFP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $80
+LABELV $81
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $112
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 32
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $113
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $113
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 5
+LSHI4
+CNSTI4 2
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $118
+ADDRLP4 8
+CNSTI4 10
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $119
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1111490560
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152852+284
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $116
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $122
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $115
+LABELV $122
+LABELV $75
+endproc CG_DrawField 64 20
+export CG_Draw3DModel
+proc CG_Draw3DModel 512 16
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+EQI4 $128
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $124
+LABELV $128
+ADDRGP4 $123
+JUMPV
+LABELV $124
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 368
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $123
+endproc CG_Draw3DModel 512 16
+export CG_DrawHead
+proc CG_DrawHead 56 32
+ADDRLP4 0
+CNSTI4 1716
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $145
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $148
+ADDRGP4 $143
+JUMPV
+LABELV $148
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $162
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $162
+LABELV $146
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $165
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+116
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $165
+LABELV $143
+endproc CG_DrawHead 56 32
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 72 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $170
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $170
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+152852+20
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $187
+ADDRLP4 56
+ADDRGP4 cgs+152852+20
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $191
+ADDRLP4 56
+ADDRGP4 cgs+152852+24
+INDIRI4
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRLP4 56
+ADDRGP4 cgs+152852+28
+INDIRI4
+ASGNI4
+LABELV $196
+LABELV $192
+LABELV $188
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $202
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $204
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $169
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $207
+LABELV $205
+LABELV $203
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $208
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $208
+LABELV $199
+LABELV $171
+LABELV $169
+endproc CG_DrawFlagModel 72 32
+proc CG_DrawStatusBarHead 60 24
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+116724
+INDIRF4
+CNSTF4 0
+EQF4 $214
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+116724
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $214
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+116724
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+116728
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+116760
+CNSTF4 1110704128
+ADDRGP4 cg+116728
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+116748
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+116744
+CNSTF4 1084227584
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+116764
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+116752
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+116752
+INDIRI4
+LTI4 $230
+ADDRGP4 cg+116760
+ADDRGP4 cg+116748
+INDIRF4
+ASGNF4
+ADDRGP4 cg+116756
+ADDRGP4 cg+116744
+INDIRF4
+ASGNF4
+ADDRGP4 cg+116764
+ADDRGP4 cg+116752
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+116752
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+116748
+CNSTF4 1101004800
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+116744
+CNSTF4 1084227584
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $230
+ADDRLP4 16
+CNSTF4 1114636288
+ASGNF4
+LABELV $215
+ADDRGP4 cg+116764
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $244
+ADDRGP4 cg+116764
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $244
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+116764
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+116752
+INDIRI4
+ADDRGP4 cg+116764
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+116760
+INDIRF4
+ADDRGP4 cg+116748
+INDIRF4
+ADDRGP4 cg+116760
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+116756
+INDIRF4
+ADDRGP4 cg+116744
+INDIRF4
+ADDRGP4 cg+116756
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1139802112
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $211
+endproc CG_DrawStatusBarHead 60 24
+proc CG_DrawStatusBarFlag 4 24
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 0
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $262
+endproc CG_DrawStatusBarFlag 4 24
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $265
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $263
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $270
+LABELV $266
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+152852+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $263
+endproc CG_DrawTeamBackground 20 20
+data
+align 4
+LABELV $276
+byte 4 1065353216
+byte 4 1060152279
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawStatusBar 80 32
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $277
+ADDRGP4 $275
+JUMPV
+LABELV $277
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 716
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $285
+CNSTI4 132
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $285
+ADDRLP4 24
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1101004800
+ADDRLP4 68
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 72
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $285
+CNSTF4 1133412352
+ARGF4
+ADDRGP4 CG_DrawStatusBarHead
+CALLV
+pop
+ADDRGP4 cg+107636+312+28
+INDIRI4
+CNSTI4 0
+EQI4 $293
+CNSTF4 1134985216
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRGP4 cg+107636+312+32
+INDIRI4
+CNSTI4 0
+EQI4 $298
+CNSTF4 1134985216
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRGP4 cg+107636+312+36
+INDIRI4
+CNSTI4 0
+EQI4 $303
+CNSTF4 1134985216
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+LABELV $303
+LABELV $299
+LABELV $294
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRLP4 24
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 8+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 68
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+104
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $308
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $316
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+LEI4 $318
+ADDRGP4 cg+107636+148
+INDIRI4
+CNSTI4 3
+NEI4 $320
+ADDRGP4 cg+107636+44
+INDIRI4
+CNSTI4 100
+LEI4 $320
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $326
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+LABELV $327
+LABELV $321
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $276
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 0
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $328
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $328
+ADDRLP4 72
+CNSTI4 132
+ADDRGP4 cg+107636+144
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $335
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 76
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $335
+LABELV $328
+LABELV $318
+LABELV $316
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LEI4 $337
+ADDRGP4 $276+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LEI4 $340
+ADDRGP4 $276
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $342
+ADDRLP4 52
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $276
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRGP4 $276+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $343
+LABELV $341
+LABELV $338
+CNSTI4 185
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $346
+ADDRGP4 $276
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 370
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $348
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $348
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 72
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+108
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $348
+LABELV $346
+LABELV $275
+endproc CG_DrawStatusBar 80 32
+proc CG_DrawAttacker 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $355
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $354
+JUMPV
+LABELV $355
+ADDRGP4 cg+116464
+INDIRI4
+CNSTI4 0
+NEI4 $359
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $354
+JUMPV
+LABELV $359
+ADDRLP4 0
+ADDRGP4 cg+107636+248+24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $369
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $369
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $365
+LABELV $369
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $354
+JUMPV
+LABELV $365
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+116464
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10000
+LEI4 $372
+ADDRGP4 cg+116464
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $354
+JUMPV
+LABELV $372
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $377
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $354
+endproc CG_DrawAttacker 52 24
+proc CG_DrawSnapshot 16 16
+ADDRGP4 $379
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31444
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $378
+endproc CG_DrawSnapshot 16 16
+bss
+align 4
+LABELV $384
+skip 16
+align 4
+LABELV $385
+skip 4
+align 4
+LABELV $386
+skip 4
+code
+proc CG_DrawFPS 56 16
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $386
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $385
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $384
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 $385
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $387
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $389
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $384
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $389
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $393
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $393
+ADDRLP4 24
+CNSTI4 4000
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $387
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $383
+endproc CG_DrawFPS 56 16
+proc CG_DrawTimer 56 16
+ADDRLP4 20
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+34796
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $396
+endproc CG_DrawTimer 56 16
+proc CG_DrawTeamOverlay 152 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $401
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $400
+JUMPV
+LABELV $401
+ADDRLP4 92
+CNSTI4 304
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $404
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $404
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $400
+JUMPV
+LABELV $404
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $409
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 96
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $410
+ADDRLP4 48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $411
+ADDRLP4 4
+CNSTI4 1716
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $416
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $419
+ADDRLP4 56
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $419
+LABELV $416
+LABELV $412
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $414
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $411
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $421
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $400
+JUMPV
+LABELV $421
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+LEI4 $423
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+LABELV $423
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $425
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $429
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $429
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $431
+ADDRLP4 44
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $431
+LABELV $429
+LABELV $426
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $425
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LEI4 $433
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+LABELV $433
+ADDRLP4 80
+ADDRLP4 56
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+CNSTI4 32
+ADDI4
+CNSTI4 56
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $435
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 80
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $436
+ADDRLP4 84
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $438
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $439
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $440
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+152852+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $453
+JUMPV
+LABELV $450
+ADDRLP4 4
+CNSTI4 1716
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $455
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $465
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $463
+LABELV $465
+ADDRLP4 20
+ADDRGP4 $466
+ASGNP4
+LABELV $463
+ADDRLP4 128
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 128
+INDIRI4
+ADDI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 8
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $461
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 128
+CNSTI4 3
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 8
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $468
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+CNSTI4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+116
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $469
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $474
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CNSTI4 8
+SUBI4
+ASGNI4
+LABELV $475
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $476
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $480
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $482
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 148
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $484
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $485
+LABELV $482
+LABELV $480
+LABELV $477
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $476
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $455
+LABELV $451
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $453
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $450
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $400
+endproc CG_DrawTeamOverlay 152 36
+proc CG_DrawUpperRight 16 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $487
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 1
+NEI4 $487
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $487
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $491
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $491
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $494
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $497
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $494
+LABELV $497
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $494
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $498
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $498
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawAttacker
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $501
+LABELV $486
+endproc CG_DrawUpperRight 16 12
+proc CG_DrawScores 92 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cgs+34800
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+34804
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $507
+ADDRLP4 16
+CNSTI4 640
+ASGNI4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $513
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $514
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152852+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $514
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $519
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $522
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34812
+INDIRI4
+CNSTI4 0
+LTI4 $524
+ADDRGP4 cgs+34812
+INDIRI4
+CNSTI4 2
+GTI4 $524
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+34812
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152852+44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $524
+LABELV $522
+LABELV $519
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $513
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $534
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152852+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $534
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $539
+CNSTI4 7
+ARGI4
+ADDRLP4 80
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $542
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+LTI4 $544
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 2
+GTI4 $544
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152852+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $544
+LABELV $542
+LABELV $539
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $551
+ADDRLP4 44
+ADDRGP4 cgs+31472
+INDIRI4
+ASGNI4
+ADDRGP4 $552
+JUMPV
+LABELV $551
+ADDRLP4 44
+ADDRGP4 cgs+31468
+INDIRI4
+ASGNI4
+LABELV $552
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRGP4 $513
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 84
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 16
+CNSTI4 640
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $561
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $562
+ADDRLP4 52
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $563
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $563
+ADDRLP4 32
+INDIRI4
+CNSTI4 -9999
+EQI4 $565
+ADDRGP4 $513
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $567
+ADDRLP4 68
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $567
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152852+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRLP4 72
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $568
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $565
+ADDRLP4 28
+INDIRI4
+CNSTI4 -9999
+EQI4 $577
+ADDRGP4 $513
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $579
+ADDRLP4 40
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $579
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152852+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 68
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $580
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $577
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 0
+EQI4 $589
+ADDRGP4 $513
+ARGP4
+ADDRGP4 cgs+31468
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $589
+LABELV $508
+ADDRLP4 36
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+RETF4
+LABELV $504
+endproc CG_DrawScores 92 20
+data
+align 4
+LABELV $594
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+code
+proc CG_DrawPowerups 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $596
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $593
+JUMPV
+LABELV $596
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $598
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $602
+ADDRGP4 $599
+JUMPV
+LABELV $602
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $607
+ADDRLP4 140
+INDIRI4
+CNSTI4 999000
+LEI4 $605
+LABELV $607
+ADDRGP4 $599
+JUMPV
+LABELV $605
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $608
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $612
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $617
+JUMPV
+LABELV $614
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $617
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $614
+ADDRGP4 $610
+JUMPV
+LABELV $612
+LABELV $609
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $611
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $608
+LABELV $610
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $599
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $598
+ADDRLP4 168
+CNSTI4 528
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $620
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $624
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $594
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 180
+CNSTI4 2
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $626
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 160
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 188+12
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $627
+ADDRGP4 cg+116456
+INDIRI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+NEI4 $633
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+116460
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $633
+ADDRLP4 188
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 160
+ADDRLP4 188
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+116460
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1111490560
+CNSTF4 1056964608
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDRLP4 188
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRLP4 156
+CNSTF4 1111490560
+ASGNF4
+LABELV $634
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTF4 1142947840
+ADDRLP4 156
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $624
+LABELV $621
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $623
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $620
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $593
+endproc CG_DrawPowerups 212 20
+proc CG_DrawLowerRight 12 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $641
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 2
+NEI4 $641
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $641
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawScores
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawPowerups
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $640
+endproc CG_DrawLowerRight 12 12
+proc CG_DrawPickupItem 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $646
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $645
+JUMPV
+LABELV $646
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+116700
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $650
+ADDRGP4 cg+116704
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $653
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1090519040
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $653
+LABELV $650
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $645
+endproc CG_DrawPickupItem 16 20
+proc CG_DrawLowerLeft 16 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $658
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $658
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $658
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawPickupItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $657
+endproc CG_DrawLowerLeft 16 12
+proc CG_DrawTeamInfo 48 36
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $663
+ADDRLP4 20
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+LABELV $664
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $667
+ADDRGP4 $662
+JUMPV
+LABELV $667
+ADDRGP4 cgs+152760
+INDIRI4
+ADDRGP4 cgs+152756
+INDIRI4
+EQI4 $669
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+152760
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152724
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+LEI4 $673
+ADDRLP4 28
+ADDRGP4 cgs+152760
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $673
+ADDRLP4 24
+ADDRGP4 cgs+152756
+INDIRI4
+ADDRGP4 cgs+152760
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $682
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $688
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $689
+LABELV $683
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 420
+ADDRLP4 28
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+152852+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cgs+152756
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $705
+JUMPV
+LABELV $702
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 420
+ADDRGP4 cgs+152756
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+150796
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $703
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $705
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+152760
+INDIRI4
+GEI4 $702
+LABELV $669
+LABELV $662
+endproc CG_DrawTeamInfo 48 36
+proc CG_DrawHoldableItem 8 20
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+CNSTF4 1142161408
+ARGF4
+CNSTF4 1129840640
+ARGF4
+ADDRLP4 4
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $712
+LABELV $710
+endproc CG_DrawHoldableItem 8 20
+proc CG_DrawReward 68 36
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $716
+ADDRGP4 $715
+JUMPV
+LABELV $716
+ADDRGP4 cg+116476
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $720
+ADDRGP4 cg+116472
+INDIRI4
+CNSTI4 0
+LEI4 $715
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $728
+JUMPV
+LABELV $725
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+116560
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+116560+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+116520
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+116520+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+116480
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+116480+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $726
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $728
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+116472
+INDIRI4
+LTI4 $725
+ADDRGP4 cg+116476
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cg+116472
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+116476
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 cg+116560
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $723
+LABELV $720
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+116480
+INDIRI4
+CNSTI4 10
+LTI4 $744
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133772800
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+116520
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $748
+ARGP4
+ADDRGP4 cg+116480
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $745
+JUMPV
+LABELV $744
+ADDRLP4 12
+ADDRGP4 cg+116480
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $754
+JUMPV
+LABELV $751
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+116520
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $752
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $754
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $751
+LABELV $745
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $715
+endproc CG_DrawReward 68 36
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $757
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $763
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $762
+JUMPV
+LABELV $763
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $762
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $778
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $774
+LABELV $778
+ADDRGP4 $773
+JUMPV
+LABELV $774
+ADDRLP4 24
+ADDRGP4 $779
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $780
+ADDRGP4 $773
+JUMPV
+LABELV $780
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 $783
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $773
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_lagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $789
+ADDRGP4 cgs+31452
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $785
+LABELV $789
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $784
+JUMPV
+LABELV $785
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 432
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+248
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $792
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $797
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $799
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $799
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $802
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $802
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $806
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $808
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $808
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $811
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $811
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $806
+LABELV $798
+LABELV $793
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $795
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $792
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $818
+JUMPV
+LABELV $815
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $821
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $823
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $824
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $824
+JUMPV
+LABELV $823
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $829
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $829
+LABELV $824
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $832
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $832
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $822
+JUMPV
+LABELV $821
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $836
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $838
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $838
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152852+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $836
+LABELV $822
+LABELV $816
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $818
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $815
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $847
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $843
+LABELV $847
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 $848
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $843
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $784
+endproc CG_DrawLagometer 76 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+115416
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+115404
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+115412
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+115408
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+116440
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+115416
+ASGNP4
+ADDRGP4 $859
+JUMPV
+LABELV $858
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $861
+ADDRLP4 4
+ADDRGP4 cg+116440
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $861
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $859
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $858
+LABELV $849
+endproc CG_CenterPrint 8 12
+proc CG_DrawCenterString 1064 36
+ADDRGP4 cg+115404
+INDIRI4
+CNSTI4 0
+NEI4 $865
+ADDRGP4 $864
+JUMPV
+LABELV $865
+ADDRGP4 cg+115404
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $870
+ADDRGP4 $864
+JUMPV
+LABELV $870
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+115416
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+115412
+INDIRI4
+ADDRGP4 cg+116440
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $875
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $878
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $884
+ADDRLP4 1052
+INDIRI4
+CNSTI4 10
+NEI4 $882
+LABELV $884
+ADDRGP4 $880
+JUMPV
+LABELV $882
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $879
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LTI4 $878
+LABELV $880
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ARGP4
+ADDRLP4 1052
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+115408
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+115408
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+115408
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1069547520
+ADDRGP4 cg+115408
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $890
+JUMPV
+LABELV $889
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $890
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRLP4 1060
+INDIRI4
+CNSTI4 10
+NEI4 $889
+LABELV $892
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $893
+ADDRGP4 $877
+JUMPV
+LABELV $893
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $876
+ADDRGP4 $875
+JUMPV
+LABELV $877
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $864
+endproc CG_DrawCenterString 1064 36
+proc CG_DrawCrosshair 56 36
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $896
+ADDRGP4 $895
+JUMPV
+LABELV $896
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $899
+ADDRGP4 $895
+JUMPV
+LABELV $899
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRGP4 $895
+JUMPV
+LABELV $902
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $905
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $906
+JUMPV
+LABELV $905
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $906
+ADDRLP4 28
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+116708
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $911
+ADDRLP4 8
+INDIRF4
+CNSTF4 1128792064
+GEF4 $911
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $911
+ADDRLP4 16
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $916
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $916
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152852+208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+109032
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+109032+8
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 44
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+109032+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+109032+12
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $895
+endproc CG_DrawCrosshair 56 36
+proc CG_DrawCrosshair3D 392 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $928
+ADDRGP4 $927
+JUMPV
+LABELV $928
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $931
+ADDRGP4 $927
+JUMPV
+LABELV $931
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $934
+ADDRGP4 $927
+JUMPV
+LABELV $934
+ADDRLP4 356
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+116708
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 0
+LEF4 $940
+ADDRLP4 276
+INDIRF4
+CNSTF4 1128792064
+GEF4 $940
+ADDRLP4 276
+ADDRLP4 276
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 356
+INDIRF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $940
+ADDRLP4 292
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+GEI4 $943
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+LABELV $943
+ADDRLP4 360
+ADDRLP4 292
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152852+208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $947
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 372
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $948
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 376
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 268
+INDIRF4
+ADDRLP4 376
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg+109032+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 380
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 352
+ADDRLP4 268
+INDIRF4
+ADDRLP4 380
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+ADDRLP4 364
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 352
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 280
+ADDRGP4 cg+109032+24
+INDIRF4
+ADDRGP4 cg+109032+36
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280+4
+ADDRGP4 cg+109032+24+4
+INDIRF4
+ADDRGP4 cg+109032+36+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280+8
+ADDRGP4 cg+109032+24+8
+INDIRF4
+ADDRGP4 cg+109032+36+8
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRGP4 cg+109032+24
+ARGP4
+ADDRLP4 388
+CNSTP4 0
+ASGNP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 388
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 140
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 296+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+ADDRLP4 356
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 352
+INDIRF4
+MULF4
+ADDRLP4 296+8
+INDIRF4
+MULF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+112
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $927
+endproc CG_DrawCrosshair3D 392 28
+proc CG_ScanForCrosshairEntity 96 28
+ADDRLP4 56
+ADDRGP4 cg+109032+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109032+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109032+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+109032+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $995
+ADDRGP4 $979
+JUMPV
+LABELV $995
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $999
+ADDRGP4 $979
+JUMPV
+LABELV $999
+CNSTI4 716
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1001
+ADDRGP4 $979
+JUMPV
+LABELV $1001
+ADDRGP4 cg+116448
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+116452
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $979
+endproc CG_ScanForCrosshairEntity 96 28
+proc CG_DrawCrosshairNames 20 16
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1010
+ADDRGP4 $1009
+JUMPV
+LABELV $1010
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $1013
+ADDRGP4 $1009
+JUMPV
+LABELV $1013
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1016
+ADDRGP4 $1009
+JUMPV
+LABELV $1016
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+116452
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1020
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1009
+JUMPV
+LABELV $1020
+ADDRLP4 4
+CNSTI4 1716
+ADDRGP4 cg+116448
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 170
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1009
+endproc CG_DrawCrosshairNames 20 16
+proc CG_DrawSpectator 0 16
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $1026
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1027
+CNSTI4 200
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1030
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $1028
+JUMPV
+LABELV $1027
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1031
+CNSTI4 8
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1034
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1031
+LABELV $1028
+LABELV $1025
+endproc CG_DrawSpectator 0 16
+proc CG_DrawVote 12 20
+ADDRGP4 cgs+31676
+INDIRI4
+CNSTI4 0
+NEI4 $1036
+ADDRGP4 $1035
+JUMPV
+LABELV $1036
+ADDRGP4 cgs+31688
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+ADDRGP4 cgs+31688
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+152852+696
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1039
+ADDRLP4 0
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+31676
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1047
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1047
+ADDRGP4 $1049
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31692
+ARGP4
+ADDRGP4 cgs+31680
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31684
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1035
+endproc CG_DrawVote 12 20
+proc CG_DrawTeamVote 24 20
+CNSTI4 1716
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1054
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1054
+CNSTI4 1716
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1053
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1060
+LABELV $1055
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32716
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1064
+ADDRGP4 $1053
+JUMPV
+LABELV $1064
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1067
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+152852+696
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1067
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32716
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1075
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1075
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32748
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32724
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32732
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1053
+endproc CG_DrawTeamVote 24 20
+proc CG_DrawScoreboard 4 0
+ADDRLP4 0
+ADDRGP4 CG_DrawOldScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1081
+endproc CG_DrawScoreboard 4 0
+proc CG_DrawIntermission 4 0
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $1083
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1082
+JUMPV
+LABELV $1083
+ADDRGP4 cg+114316
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114312
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1082
+endproc CG_DrawIntermission 4 0
+proc CG_DrawFollow 36 36
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1090
+CNSTI4 0
+RETI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1090
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 248
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 $1096
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 1716
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1089
+endproc CG_DrawFollow 36 36
+proc CG_DrawAmmoWarning 12 16
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1101
+ADDRGP4 $1100
+JUMPV
+LABELV $1101
+ADDRGP4 cg+116444
+INDIRI4
+CNSTI4 0
+NEI4 $1104
+ADDRGP4 $1100
+JUMPV
+LABELV $1104
+ADDRGP4 cg+116444
+INDIRI4
+CNSTI4 2
+NEI4 $1107
+ADDRLP4 0
+ADDRGP4 $1110
+ASGNP4
+ADDRGP4 $1108
+JUMPV
+LABELV $1107
+ADDRLP4 0
+ADDRGP4 $1111
+ASGNP4
+LABELV $1108
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1100
+endproc CG_DrawAmmoWarning 12 16
+proc CG_DrawWarmup 56 36
+ADDRLP4 4
+ADDRGP4 cg+116692
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1114
+ADDRGP4 $1112
+JUMPV
+LABELV $1114
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1116
+ADDRLP4 8
+ADDRGP4 $1118
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+116696
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1112
+JUMPV
+LABELV $1116
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1120
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1123
+ADDRLP4 32
+CNSTI4 1716
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+40972
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1128
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1128
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1133
+ADDRLP4 20
+CNSTI4 1716
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRGP4 $1134
+JUMPV
+LABELV $1133
+ADDRLP4 24
+CNSTI4 1716
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+LABELV $1134
+LABELV $1128
+LABELV $1124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1126
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $1123
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1121
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1121
+ADDRGP4 $1139
+ARGP4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1140
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1140
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1141
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1121
+JUMPV
+LABELV $1120
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 0
+NEI4 $1142
+ADDRLP4 8
+ADDRGP4 $1145
+ASGNP4
+ADDRGP4 $1143
+JUMPV
+LABELV $1142
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+NEI4 $1146
+ADDRLP4 8
+ADDRGP4 $1149
+ASGNP4
+ADDRGP4 $1147
+JUMPV
+LABELV $1146
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $1150
+ADDRLP4 8
+ADDRGP4 $1153
+ASGNP4
+ADDRGP4 $1151
+JUMPV
+LABELV $1150
+ADDRLP4 8
+ADDRGP4 $1154
+ASGNP4
+LABELV $1151
+LABELV $1147
+LABELV $1143
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1155
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1155
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1156
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1066192077
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1121
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1158
+ADDRGP4 cg+116692
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1158
+ADDRGP4 $1161
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+116696
+INDIRI4
+EQI4 $1162
+ADDRGP4 cg+116696
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1168
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1171
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1174
+ADDRGP4 $1167
+JUMPV
+LABELV $1168
+ADDRGP4 cgs+152852+912
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1167
+JUMPV
+LABELV $1171
+ADDRGP4 cgs+152852+908
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1167
+JUMPV
+LABELV $1174
+ADDRGP4 cgs+152852+904
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1167
+LABELV $1162
+ADDRLP4 32
+ADDRGP4 cg+116696
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1180
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+EQI4 $1181
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+EQI4 $1182
+ADDRGP4 $1177
+JUMPV
+LABELV $1180
+ADDRLP4 12
+CNSTI4 28
+ASGNI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1181
+ADDRLP4 12
+CNSTI4 24
+ASGNI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1182
+ADDRLP4 12
+CNSTI4 20
+ASGNI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1177
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $1178
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1112
+endproc CG_DrawWarmup 56 36
+proc CG_Draw2D 8 4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+ADDRGP4 $1183
+JUMPV
+LABELV $1184
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1187
+ADDRGP4 $1183
+JUMPV
+LABELV $1187
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1190
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1183
+JUMPV
+LABELV $1190
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1193
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1196
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1196
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1194
+JUMPV
+LABELV $1193
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114308
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1198
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1198
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1202
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1202
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawHoldableItem
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+LABELV $1198
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1204
+ADDRGP4 CG_DrawTeamInfo
+CALLV
+pop
+LABELV $1204
+LABELV $1194
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1207
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+LABELV $1207
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114312
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+114312
+INDIRI4
+CNSTI4 0
+NEI4 $1210
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1210
+LABELV $1183
+endproc CG_Draw2D 8 4
+proc CG_DrawTourneyScoreboard 0 0
+ADDRGP4 CG_DrawOldTourneyScoreboard
+CALLV
+pop
+LABELV $1213
+endproc CG_DrawTourneyScoreboard 0 0
+export CG_DrawActive
+proc CG_DrawActive 0 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1215
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1214
+JUMPV
+LABELV $1215
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1218
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1218
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1214
+JUMPV
+LABELV $1218
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1222
+ADDRGP4 CG_DrawCrosshair3D
+CALLV
+pop
+LABELV $1222
+ADDRGP4 cg+109032
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+LABELV $1214
+endproc CG_DrawActive 0 4
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TraceBatch
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1161
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1154
+byte 1 0
+align 1
+LABELV $1153
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1149
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1145
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1139
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1118
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1111
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1110
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1096
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1077
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1049
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1034
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1030
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1026
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $948
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $947
+byte 1 114
+byte 1 95
+byte 1 122
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 0
+align 1
+LABELV $848
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $783
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $779
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $748
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $513
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $467
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $466
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $399
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $395
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $379
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $377
+byte 1 110
+byte 1 0
+align 1
+LABELV $112
+byte 1 37
+byte 1 105
+byte 1 0
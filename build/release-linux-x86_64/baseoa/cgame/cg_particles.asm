@@ -0,0 +1,13667 @@
+data
+align 4
+LABELV shaderAnimNames
+address $76
+byte 4 0
+skip 120
+align 4
+LABELV shaderAnimCounts
+byte 4 23
+skip 124
+align 4
+LABELV shaderAnimSTRatio
+byte 4 1065353216
+skip 124
+export cl_numparticles
+align 4
+LABELV cl_numparticles
+byte 4 1024
+export initparticles
+align 4
+LABELV initparticles
+byte 4 0
+export CG_ClearParticles
+code
+proc CG_ClearParticles 28 12
+ADDRGP4 particles
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 126976
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 free_particles
+ADDRGP4 particles
+ASGNP4
+ADDRGP4 active_particles
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $78
+ADDRLP4 4
+CNSTI4 124
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 particles
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 particles+124
+ADDP4
+ASGNP4
+CNSTI4 124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 particles+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $79
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $81
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cl_numparticles
+INDIRI4
+LTI4 $78
+CNSTI4 124
+ADDRGP4 cl_numparticles
+INDIRI4
+MULI4
+ADDRGP4 particles-124
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 oldtime
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $86
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $93
+JUMPV
+LABELV $90
+ADDRGP4 $94
+ARGP4
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 shaderAnims
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $91
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $93
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimCounts
+ADDP4
+INDIRI4
+LTI4 $90
+LABELV $87
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $86
+ADDRGP4 numShaderAnims
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 initparticles
+CNSTI4 1
+ASGNI4
+LABELV $77
+endproc CG_ClearParticles 28 12
+export CG_AddParticleToScene
+proc CG_AddParticleToScene 476 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 240
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+EQI4 $101
+ADDRLP4 240
+INDIRI4
+CNSTI4 5
+EQI4 $101
+ADDRLP4 240
+INDIRI4
+CNSTI4 11
+EQI4 $101
+ADDRLP4 240
+INDIRI4
+CNSTI4 13
+EQI4 $101
+ADDRLP4 240
+INDIRI4
+CNSTI4 14
+NEI4 $96
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 11
+EQI4 $102
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 13
+EQI4 $106
+ADDRLP4 244
+INDIRI4
+CNSTI4 14
+NEI4 $104
+LABELV $106
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+LEF4 $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 248
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 248
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $105
+ADDRLP4 256
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 256
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+GEF4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 252
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+LTF4 $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $118
+ADDRLP4 252
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 252
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 256
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 256
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $118
+LABELV $112
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRGP4 $95
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $102
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1149239296
+LEF4 $122
+ADDRGP4 $95
+JUMPV
+LABELV $122
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 13
+EQI4 $127
+ADDRLP4 248
+INDIRI4
+CNSTI4 14
+NEI4 $125
+LABELV $127
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 268
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $149
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $150
+ADDRLP4 12+20+3
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 292
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $179
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $180
+ADDRLP4 12+24+20+3
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $209
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $210
+ADDRLP4 12+48+20+3
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 328
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 328
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 332
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 332
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 340
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+LTF4 $239
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $240
+ADDRLP4 12+72+20+3
+ADDRLP4 336
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $97
+JUMPV
+LABELV $125
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 268
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $262
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $263
+ADDRLP4 108+20+3
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 292
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $292
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $293
+ADDRLP4 108+24+20+3
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+48+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $322
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $323
+ADDRLP4 108+48+20+3
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $324
+ADDRLP4 280
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 300
+INDIRF4
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRGP4 cg+109032+36
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 268+8
+ADDRLP4 268+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $334
+ADDRLP4 308
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 256+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 256+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 308
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $335
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $367
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 256+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 256+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $398
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 304
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 304
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $429
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 3
+EQI4 $461
+ADDRLP4 244
+INDIRI4
+CNSTI4 12
+NEI4 $459
+LABELV $461
+ADDRLP4 248
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $462
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1149239296
+LEF4 $462
+ADDRGP4 $95
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $465
+ADDRLP4 184
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 184+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $469
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 0
+NEF4 $472
+ADDRLP4 260
+CNSTF4 1065353216
+ASGNF4
+LABELV $472
+ADDRLP4 264
+CNSTF4 1166016512
+ADDRLP4 260
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1048576000
+ADDRLP4 264
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1056964608
+LEF4 $474
+ADDRLP4 256
+CNSTF4 1056964608
+ASGNF4
+LABELV $474
+ADDRLP4 272
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRLP4 256
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $470
+LABELV $466
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+LEF4 $481
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1065353216
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 272
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $485
+ADDRLP4 280
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 0
+GEF4 $487
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+LABELV $487
+ADDRLP4 284
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 276
+INDIRF4
+ASGNF4
+LABELV $485
+ADDRLP4 204
+ADDRLP4 204
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRLP4 204
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $482
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+NEI4 $491
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+LABELV $491
+ADDRLP4 204
+INDIRF4
+CNSTF4 1065353216
+LEF4 $495
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+LABELV $495
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 280
+INDIRF4
+ADDRLP4 276
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $497
+ADDRGP4 rforward
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 284+8
+ADDRLP4 284+8
+INDIRF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 208
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $497
+ADDRLP4 208
+ADDRGP4 rright
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRGP4 rup
+INDIRB
+ASGNB 12
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRLP4 288
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $501
+JUMPV
+LABELV $500
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $501
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 292
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+LTF4 $527
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $528
+ADDRLP4 12+20
+ADDRLP4 284
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 300
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 304
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 300
+INDIRF4
+ADDRLP4 304
+INDIRF4
+LTF4 $533
+ADDRLP4 296
+ADDRLP4 300
+INDIRF4
+ADDRLP4 304
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRLP4 296
+ADDRLP4 300
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $534
+ADDRLP4 12+20+1
+ADDRLP4 296
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 312
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 316
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+LTF4 $539
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $540
+ADDRLP4 12+20+2
+ADDRLP4 308
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 324
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 328
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+LTF4 $544
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $545
+ADDRLP4 12+20+3
+ADDRLP4 320
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 336
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $547
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 336
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 340
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+LTF4 $577
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $578
+ADDRLP4 12+24+20
+ADDRLP4 332
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 348
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 352
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+LTF4 $584
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $585
+ADDRLP4 12+24+20+1
+ADDRLP4 344
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 360
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 364
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 364
+INDIRF4
+LTF4 $591
+ADDRLP4 356
+ADDRLP4 360
+INDIRF4
+ADDRLP4 364
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 356
+ADDRLP4 360
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $592
+ADDRLP4 12+24+20+2
+ADDRLP4 356
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 372
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 376
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 372
+INDIRF4
+ADDRLP4 376
+INDIRF4
+LTF4 $597
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+ADDRLP4 376
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $598
+ADDRLP4 12+24+20+3
+ADDRLP4 368
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $599
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 388
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 388
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 388
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 384
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 384
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 384
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 388
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $600
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 384
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 388
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 388
+INDIRF4
+LTF4 $630
+ADDRLP4 380
+ADDRLP4 384
+INDIRF4
+ADDRLP4 388
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRLP4 380
+ADDRLP4 384
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $631
+ADDRLP4 12+48+20
+ADDRLP4 380
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 396
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 400
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+LTF4 $637
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $638
+JUMPV
+LABELV $637
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $638
+ADDRLP4 12+48+20+1
+ADDRLP4 392
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 408
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 412
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+LTF4 $644
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $645
+JUMPV
+LABELV $644
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $645
+ADDRLP4 12+48+20+2
+ADDRLP4 404
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 420
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 424
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+LTF4 $650
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $651
+ADDRLP4 12+48+20+3
+ADDRLP4 416
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $652
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 436
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 436
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 436
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRLP4 432
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 432
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 432
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 436
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 436
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 436
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $653
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 432
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 436
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 432
+INDIRF4
+ADDRLP4 436
+INDIRF4
+LTF4 $683
+ADDRLP4 428
+ADDRLP4 432
+INDIRF4
+ADDRLP4 436
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRLP4 428
+ADDRLP4 432
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $684
+ADDRLP4 12+72+20
+ADDRLP4 428
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 444
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 448
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 444
+INDIRF4
+ADDRLP4 448
+INDIRF4
+LTF4 $690
+ADDRLP4 440
+ADDRLP4 444
+INDIRF4
+ADDRLP4 448
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $691
+JUMPV
+LABELV $690
+ADDRLP4 440
+ADDRLP4 444
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $691
+ADDRLP4 12+72+20+1
+ADDRLP4 440
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 456
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 460
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 456
+INDIRF4
+ADDRLP4 460
+INDIRF4
+LTF4 $697
+ADDRLP4 452
+ADDRLP4 456
+INDIRF4
+ADDRLP4 460
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 452
+ADDRLP4 456
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $698
+ADDRLP4 12+72+20+2
+ADDRLP4 452
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 468
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 472
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 472
+INDIRF4
+LTF4 $703
+ADDRLP4 464
+ADDRLP4 468
+INDIRF4
+ADDRLP4 472
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 464
+ADDRLP4 468
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $704
+ADDRLP4 12+72+20+3
+ADDRLP4 464
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $705
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+NEI4 $707
+ADDRLP4 272
+CNSTF4 1065353216
+ASGNF4
+LABELV $707
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRGP4 cg+109032+36
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 276+8
+ADDRLP4 276+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 276
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $712
+JUMPV
+LABELV $711
+ADDRLP4 260
+ADDRGP4 vup
+INDIRB
+ASGNB 12
+ADDRLP4 248
+ADDRGP4 vright
+INDIRB
+ASGNB 12
+LABELV $712
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 304
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $737
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $738
+JUMPV
+LABELV $737
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $738
+ADDRLP4 12+20+3
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 328
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $767
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $768
+ADDRLP4 12+24+20+3
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 352
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $797
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $798
+ADDRLP4 12+48+20+3
+ADDRLP4 348
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 376
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 380
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+LTF4 $827
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $828
+JUMPV
+LABELV $827
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $828
+ADDRLP4 12+72+20+3
+ADDRLP4 372
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $706
+JUMPV
+LABELV $705
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $831
+ADDRLP4 264
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $832
+JUMPV
+LABELV $831
+ADDRLP4 268
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 184
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1056964608
+ASGNF4
+LABELV $832
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 256
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 292
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+LEF4 $838
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $838
+ADDRLP4 260
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $840
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $840
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 sin
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 300
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 248
+ADDRLP4 260
+INDIRF4
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDRLP4 300
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 304
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 308
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $848
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $849
+JUMPV
+LABELV $848
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $849
+ADDRLP4 12+20
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $854
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $855
+ADDRLP4 12+20+1
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 340
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+LTF4 $860
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $861
+JUMPV
+LABELV $860
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $861
+ADDRLP4 12+20+2
+ADDRLP4 336
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+24
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+24+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 352
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $876
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $877
+JUMPV
+LABELV $876
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $877
+ADDRLP4 12+24+20
+ADDRLP4 348
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 364
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 368
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 368
+INDIRF4
+LTF4 $883
+ADDRLP4 360
+ADDRLP4 364
+INDIRF4
+ADDRLP4 368
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $884
+JUMPV
+LABELV $883
+ADDRLP4 360
+ADDRLP4 364
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $884
+ADDRLP4 12+24+20+1
+ADDRLP4 360
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 376
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 380
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+LTF4 $890
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $891
+JUMPV
+LABELV $890
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $891
+ADDRLP4 12+24+20+2
+ADDRLP4 372
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+48
+ADDRLP4 12+48
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+4
+ADDRLP4 12+48+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 388
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 392
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+LTF4 $907
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $908
+ADDRLP4 12+48+20
+ADDRLP4 384
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 400
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 404
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+LTF4 $914
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $915
+JUMPV
+LABELV $914
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $915
+ADDRLP4 12+48+20+1
+ADDRLP4 396
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 412
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 416
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+LTF4 $921
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $922
+ADDRLP4 12+48+20+2
+ADDRLP4 408
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+72
+ADDRLP4 12+72
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 424
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 428
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+LTF4 $938
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $939
+ADDRLP4 12+72+20
+ADDRLP4 420
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 436
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 440
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+LTF4 $945
+ADDRLP4 432
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $946
+JUMPV
+LABELV $945
+ADDRLP4 432
+ADDRLP4 436
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $946
+ADDRLP4 12+72+20+1
+ADDRLP4 432
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 448
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 452
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+LTF4 $952
+ADDRLP4 444
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $953
+JUMPV
+LABELV $952
+ADDRLP4 444
+ADDRLP4 448
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $953
+ADDRLP4 12+72+20+2
+ADDRLP4 444
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $830
+JUMPV
+LABELV $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $957
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+24
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+24+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+48
+ADDRLP4 12+48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+4
+ADDRLP4 12+48+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+72
+ADDRLP4 12+72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $958
+JUMPV
+LABELV $957
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1030
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1033
+ADDRLP4 200
+CNSTF4 1065351538
+ASGNF4
+LABELV $1033
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 312
+INDIRF4
+ADDRLP4 308
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 1069547520
+DIVF4
+GEF4 $1035
+ADDRGP4 $95
+JUMPV
+LABELV $1035
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 320
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimCounts
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 324
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 shaderAnims
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1038
+ADDRGP4 cg+109032+36
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 280+8
+ADDRLP4 280+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1038
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1043
+ADDRLP4 332
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1044
+JUMPV
+LABELV $1043
+ADDRLP4 332
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1044
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1076
+JUMPV
+LABELV $1075
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1076
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1107
+JUMPV
+LABELV $1106
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vright
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vright+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vright+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1107
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1137
+ADDRLP4 328
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1138
+JUMPV
+LABELV $1137
+ADDRLP4 328
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 vup
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 vup+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 vup+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1138
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+LABELV $1030
+LABELV $958
+LABELV $830
+LABELV $706
+LABELV $460
+LABELV $325
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1168
+ADDRGP4 $95
+JUMPV
+LABELV $1168
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+EQI4 $1173
+ADDRLP4 248
+INDIRI4
+CNSTI4 5
+EQI4 $1173
+ADDRLP4 248
+INDIRI4
+CNSTI4 11
+NEI4 $1170
+LABELV $1173
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 $1171
+JUMPV
+LABELV $1170
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1171
+LABELV $95
+endproc CG_AddParticleToScene 476 16
+data
+align 4
+LABELV roll
+byte 4 0
+export CG_AddParticles
+code
+proc CG_AddParticles 92 16
+ADDRGP4 initparticles
+INDIRI4
+CNSTI4 0
+NEI4 $1175
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $1175
+ADDRGP4 vforward
+ADDRGP4 cg+109032+36
+INDIRB
+ASGNB 12
+ADDRGP4 vright
+ADDRGP4 cg+109032+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 vup
+ADDRGP4 cg+109032+36+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109032+36
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 roll
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1036831949
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 oldtime
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 40+8
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRGP4 rforward
+ARGP4
+ADDRGP4 rright
+ARGP4
+ADDRGP4 rup
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 oldtime
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1193
+JUMPV
+LABELV $1190
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1195
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1191
+JUMPV
+LABELV $1195
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+EQI4 $1201
+ADDRLP4 64
+INDIRI4
+CNSTI4 6
+EQI4 $1201
+ADDRLP4 64
+INDIRI4
+CNSTI4 8
+EQI4 $1201
+ADDRLP4 64
+INDIRI4
+CNSTI4 12
+NEI4 $1197
+LABELV $1201
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1202
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1191
+JUMPV
+LABELV $1202
+LABELV $1197
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $1205
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1207
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1191
+JUMPV
+LABELV $1207
+LABELV $1205
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $1210
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1212
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1191
+JUMPV
+LABELV $1212
+LABELV $1210
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 7
+EQI4 $1217
+ADDRLP4 68
+INDIRI4
+CNSTI4 15
+NEI4 $1215
+LABELV $1217
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1215
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddParticleToScene
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1191
+JUMPV
+LABELV $1215
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1218
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1219
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1220
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1220
+ADDRLP4 12
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddParticleToScene
+CALLV
+pop
+LABELV $1191
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $1193
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1190
+ADDRGP4 active_particles
+ADDRLP4 36
+INDIRP4
+ASGNP4
+LABELV $1174
+endproc CG_AddParticles 92 16
+export CG_ParticleSnowFlurry
+proc CG_ParticleSnowFlurry 80 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1225
+ADDRGP4 $1227
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1225
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1228
+ADDRGP4 $1224
+JUMPV
+LABELV $1228
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1063675494
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 100
+MODI4
+CNSTI4 90
+LEI4 $1233
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $1234
+JUMPV
+LABELV $1233
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1234
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1235
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3240099840
+ASGNF4
+LABELV $1235
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1237
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1237
+LABELV $1224
+endproc CG_ParticleSnowFlurry 80 4
+export CG_ParticleSnow
+proc CG_ParticleSnow 68 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1240
+ADDRGP4 $1242
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1240
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1243
+ADDRGP4 $1239
+JUMPV
+LABELV $1243
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3259498496
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1246
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3263299584
+ASGNF4
+ADDRGP4 $1247
+JUMPV
+LABELV $1246
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1247
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1248
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1248
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1239
+endproc CG_ParticleSnow 68 4
+export CG_ParticleBubble
+proc CG_ParticleBubble 80 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1251
+ADDRGP4 $1242
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1251
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1253
+ADDRGP4 $1250
+JUMPV
+LABELV $1253
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1256
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1115815936
+ASGNF4
+ADDRGP4 $1257
+JUMPV
+LABELV $1256
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 13
+ASGNI4
+LABELV $1257
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1258
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1258
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1250
+endproc CG_ParticleBubble 80 4
+export CG_ParticleSmoke
+proc CG_ParticleSmoke 40 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1261
+ADDRGP4 $1263
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1261
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1264
+ADDRGP4 $1260
+JUMPV
+LABELV $1264
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1269
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTF4 3212836864
+ADDRLP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1269
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $1260
+endproc CG_ParticleSmoke 40 4
+export CG_ParticleBulletDebris
+proc CG_ParticleBulletDebris 28 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1272
+ADDRGP4 $1271
+JUMPV
+LABELV $1272
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152852+204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3262119936
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 3248488448
+ADDF4
+ASGNF4
+LABELV $1271
+endproc CG_ParticleBulletDebris 28 0
+export CG_ParticleExplosion
+proc CG_ParticleExplosion 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 10
+GEU4 $1280
+ADDRGP4 $1282
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1280
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1286
+JUMPV
+LABELV $1283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1287
+ADDRGP4 $1285
+JUMPV
+LABELV $1287
+LABELV $1284
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1286
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1283
+LABELV $1285
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1289
+ADDRGP4 $1291
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1279
+JUMPV
+LABELV $1289
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1292
+ADDRGP4 $1279
+JUMPV
+LABELV $1292
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1295
+ADDRFP4 12
+CNSTI4 -1
+ADDRFP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1296
+JUMPV
+LABELV $1295
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1127415808
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1296
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimSTRatio
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimSTRatio
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $1279
+endproc CG_ParticleExplosion 28 8
+export CG_AddParticleShrapnel
+proc CG_AddParticleShrapnel 0 0
+LABELV $1298
+endproc CG_AddParticleShrapnel 0 0
+export CG_NewParticleArea
+proc CG_NewParticleArea 92 24
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1300
+CNSTI4 0
+RETI4
+ADDRGP4 $1299
+JUMPV
+LABELV $1300
+ADDRLP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+NEI4 $1302
+ADDRLP4 40
+CNSTF4 1124073472
+ASGNF4
+ADDRGP4 $1303
+JUMPV
+LABELV $1302
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+NEI4 $1304
+ADDRLP4 40
+CNSTF4 1115684864
+ASGNF4
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+NEI4 $1306
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 $1307
+JUMPV
+LABELV $1306
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1308
+ADDRLP4 40
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 $1309
+JUMPV
+LABELV $1308
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+NEI4 $1310
+ADDRLP4 40
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $1311
+JUMPV
+LABELV $1310
+ADDRLP4 36
+INDIRI4
+CNSTI4 5
+NEI4 $1312
+ADDRLP4 40
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $1313
+JUMPV
+LABELV $1312
+ADDRLP4 36
+INDIRI4
+CNSTI4 6
+NEI4 $1314
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 $1315
+JUMPV
+LABELV $1314
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+NEI4 $1316
+ADDRLP4 40
+CNSTF4 1115684864
+ASGNF4
+LABELV $1316
+LABELV $1315
+LABELV $1313
+LABELV $1311
+LABELV $1309
+LABELV $1307
+LABELV $1305
+LABELV $1303
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1318
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $1319
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1318
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1322
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $1323
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1322
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 76
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 84
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1326
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LTI4 $1330
+ADDRGP4 cgs+152852+276
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParticleBubble
+CALLV
+pop
+ADDRGP4 $1331
+JUMPV
+LABELV $1330
+ADDRGP4 cgs+152852+276
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParticleSnow
+CALLV
+pop
+LABELV $1331
+LABELV $1327
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1329
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $1326
+CNSTI4 1
+RETI4
+LABELV $1299
+endproc CG_NewParticleArea 92 24
+export CG_SnowLink
+proc CG_SnowLink 16 0
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1340
+JUMPV
+LABELV $1337
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $1343
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+NEI4 $1341
+LABELV $1343
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1344
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1346
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1347
+JUMPV
+LABELV $1346
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1347
+LABELV $1344
+LABELV $1341
+LABELV $1338
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1340
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1337
+LABELV $1336
+endproc CG_SnowLink 16 0
+export CG_ParticleImpactSmokePuff
+proc CG_ParticleImpactSmokePuff 36 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1349
+ADDRGP4 $1351
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1349
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1352
+ADDRGP4 $1348
+JUMPV
+LABELV $1352
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1127415808
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 500
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1348
+endproc CG_ParticleImpactSmokePuff 36 4
+export CG_Particle_Bleed
+proc CG_Particle_Bleed 36 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1359
+ADDRGP4 $1361
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1359
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1362
+ADDRGP4 $1358
+JUMPV
+LABELV $1362
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1366
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1367
+JUMPV
+LABELV $1366
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1367
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1358
+endproc CG_Particle_Bleed 36 4
+export CG_Particle_OilParticle
+proc CG_Particle_OilParticle 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1153138688
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRGP4 $1375
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1373
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1376
+ADDRGP4 $1370
+JUMPV
+LABELV $1376
+ADDRLP4 20
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1370
+endproc CG_Particle_OilParticle 48 4
+export CG_Particle_OilSlick
+proc CG_Particle_OilSlick 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1381
+ADDRGP4 $1383
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1381
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1384
+ADDRGP4 $1380
+JUMPV
+LABELV $1384
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1387
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1388
+JUMPV
+LABELV $1387
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 60000
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1388
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+NEF4 $1393
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+EQF4 $1391
+LABELV $1393
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1392
+JUMPV
+LABELV $1391
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $1392
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1057803469
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1380
+endproc CG_Particle_OilSlick 48 4
+export CG_OilSlickRemove
+proc CG_OilSlickRemove 20 4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1395
+ADDRGP4 $1397
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1395
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1401
+JUMPV
+LABELV $1398
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1402
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1404
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 10
+ASGNI4
+LABELV $1404
+LABELV $1402
+LABELV $1399
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1401
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1398
+LABELV $1394
+endproc CG_OilSlickRemove 20 4
+export ValidBloodPool
+proc ValidBloodPool 200 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTI4 16
+ASGNI4
+ADDRLP4 152
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 180
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 152
+INDIRI4
+NEGI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 $1417
+JUMPV
+LABELV $1414
+ADDRLP4 184
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 128
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 120
+INDIRI4
+NEGI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 $1427
+JUMPV
+LABELV $1424
+ADDRLP4 188
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 84
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 96+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+CNSTP4 0
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+52
+INDIRI4
+CNSTI4 1022
+GEI4 $1440
+CNSTI4 0
+RETI4
+ADDRGP4 $1407
+JUMPV
+LABELV $1440
+ADDRLP4 28+4
+INDIRI4
+CNSTI4 0
+NEI4 $1447
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1443
+LABELV $1447
+CNSTI4 0
+RETI4
+ADDRGP4 $1407
+JUMPV
+LABELV $1443
+LABELV $1425
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1427
+ADDRLP4 12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $1424
+LABELV $1415
+ADDRLP4 124
+ADDRLP4 124
+INDIRI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1417
+ADDRLP4 124
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LTI4 $1414
+CNSTI4 1
+RETI4
+LABELV $1407
+endproc ValidBloodPool 200 28
+export CG_BloodPool
+proc CG_BloodPool 60 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1449
+ADDRGP4 $1451
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1449
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1452
+ADDRGP4 $1448
+JUMPV
+LABELV $1452
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 ValidBloodPool
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1454
+ADDRGP4 $1448
+JUMPV
+LABELV $1454
+ADDRLP4 28
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 3000
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1058642330
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $1448
+endproc CG_BloodPool 60 4
+export CG_ParticleBloodCloud
+proc CG_ParticleBloodCloud 96 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+EQF4 $1459
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $1459
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1461
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+LABELV $1461
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1463
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1473
+ADDRGP4 $1458
+JUMPV
+LABELV $1473
+ADDRLP4 68
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152852+260
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 350
+ADDI4
+CVIF4 4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 88
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1464
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1466
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+LTF4 $1463
+LABELV $1458
+endproc CG_ParticleBloodCloud 96 16
+export CG_ParticleSparks
+proc CG_ParticleSparks 72 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1481
+ADDRGP4 $1480
+JUMPV
+LABELV $1481
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152852+204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1480
+endproc CG_ParticleSparks 72 0
+export CG_ParticleDust
+proc CG_ParticleDust 132 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $1489
+ADDRLP4 40
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $1489
+ADDRLP4 40
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1491
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+LABELV $1491
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1493
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1503
+ADDRGP4 $1488
+JUMPV
+LABELV $1503
+ADDRLP4 80
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152852+260
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $1508
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4500
+ADDI4
+CVIF4 4
+CNSTF4 1163575296
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1509
+JUMPV
+LABELV $1508
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 750
+ADDI4
+CVIF4 4
+CNSTF4 1140457472
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1509
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $1513
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CNSTF4 1045220557
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1045220557
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $1513
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 128
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1494
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1496
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+LTF4 $1493
+LABELV $1488
+endproc CG_ParticleDust 132 16
+export CG_ParticleMisc
+proc CG_ParticleMisc 20 4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1516
+ADDRGP4 $1351
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1516
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1518
+ADDRGP4 $1515
+JUMPV
+LABELV $1518
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $1521
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1522
+JUMPV
+LABELV $1521
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1522
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 15
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1515
+endproc CG_ParticleMisc 20 4
+bss
+export oldtime
+align 4
+LABELV oldtime
+skip 4
+export rup
+align 4
+LABELV rup
+skip 12
+export rright
+align 4
+LABELV rright
+skip 12
+export rforward
+align 4
+LABELV rforward
+skip 12
+export vup
+align 4
+LABELV vup
+skip 12
+export vright
+align 4
+LABELV vright
+skip 12
+export vforward
+align 4
+LABELV vforward
+skip 12
+export particles
+align 4
+LABELV particles
+skip 126976
+export free_particles
+align 4
+LABELV free_particles
+skip 4
+export active_particles
+align 4
+LABELV active_particles
+skip 4
+align 4
+LABELV numShaderAnims
+skip 4
+align 4
+LABELV shaderAnims
+skip 8192
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TraceBatch
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1451
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1397
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 118
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1383
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1375
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1361
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1351
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1291
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1282
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1263
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1242
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1227
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $94
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $76
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 0
@@ -0,0 +1,23339 @@
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $58
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $60
+CNSTI4 0
+RETI4
+ADDRGP4 $59
+JUMPV
+LABELV $60
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $62
+CNSTI4 1
+RETI4
+ADDRGP4 $59
+JUMPV
+LABELV $62
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $64
+CNSTI4 2
+RETI4
+ADDRGP4 $59
+JUMPV
+LABELV $64
+CNSTI4 0
+RETI4
+LABELV $59
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $69
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $67
+LABELV $69
+CNSTI4 0
+RETI4
+ADDRGP4 $66
+JUMPV
+LABELV $67
+CNSTI4 776
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $70
+CNSTI4 1
+RETI4
+ADDRGP4 $66
+JUMPV
+LABELV $70
+CNSTI4 776
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $72
+CNSTI4 2
+RETI4
+ADDRGP4 $66
+JUMPV
+LABELV $72
+CNSTI4 0
+RETI4
+LABELV $66
+endproc BotTeam 4 0
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $78
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $79
+ADDRGP4 $75
+JUMPV
+LABELV $78
+CNSTI4 2
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $79
+CNSTI4 1
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $75
+CNSTI4 0
+RETI4
+LABELV $74
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $81
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $80
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $84
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $84
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $83
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 472 8
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+LTI4 $87
+ADDRLP4 468
+INDIRI4
+CNSTI4 64
+GEI4 $87
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $89
+CNSTI4 1
+RETI4
+ADDRGP4 $86
+JUMPV
+LABELV $89
+LABELV $87
+CNSTI4 0
+RETI4
+LABELV $86
+endproc EntityIsDead 472 8
+export EntityCarriesFlag
+proc EntityCarriesFlag 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $93
+CNSTI4 1
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $95
+CNSTI4 1
+RETI4
+ADDRGP4 $92
+JUMPV
+LABELV $95
+CNSTI4 0
+RETI4
+LABELV $92
+endproc EntityCarriesFlag 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $98
+CNSTI4 0
+RETI4
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $100
+CNSTI4 1
+RETI4
+ADDRGP4 $97
+JUMPV
+LABELV $100
+CNSTI4 0
+RETI4
+LABELV $97
+endproc EntityIsInvisible 4 4
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $103
+CNSTI4 1
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $103
+CNSTI4 0
+RETI4
+LABELV $102
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+CNSTI4 0
+RETI4
+LABELV $105
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $109
+CNSTI4 1
+RETI4
+ADDRGP4 $108
+JUMPV
+LABELV $109
+CNSTI4 0
+RETI4
+LABELV $108
+endproc EntityHasQuad 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $112
+ADDRGP4 $111
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $111
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 0 0
+LABELV $114
+endproc BotSetTeamStatus 0 0
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $124
+LABELV $121
+LABELV $118
+LABELV $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $132
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $132
+LABELV $130
+LABELV $128
+CNSTI4 1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $126
+CNSTI4 0
+RETI4
+LABELV $115
+endproc BotSetLastOrderedTask 60 16
+export BotRefuseOrder
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRGP4 $134
+JUMPV
+LABELV $135
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $137
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $137
+LABELV $134
+endproc BotRefuseOrder 8 12
+export BotCTFSeekGoals
+proc BotCTFSeekGoals 240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $141
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $143
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+EQI4 $148
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+EQI4 $153
+ADDRGP4 $145
+JUMPV
+LABELV $148
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $146
+JUMPV
+LABELV $153
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRLP4 200
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 160
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $146
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1124073472
+GEF4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $161
+ADDRGP4 $163
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $140
+JUMPV
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+NEI4 $167
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $140
+JUMPV
+LABELV $141
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $173
+LABELV $171
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+NEI4 $175
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $176
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $185
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $140
+LABELV $185
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+LTI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $140
+LABELV $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $189
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $177
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $190
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $194
+LABELV $194
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 4
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+CNSTI4 6
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+CNSTI4 8
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+CNSTI4 9
+EQI4 $140
+ADDRLP4 196
+INDIRI4
+CNSTI4 10
+EQI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $140
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+EQI4 $140
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $189
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7008
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $140
+JUMPV
+LABELV $200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRGP4 $140
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $210
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $210
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 4
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 5
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 6
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 8
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 9
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 10
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 14
+EQI4 $225
+ADDRLP4 204
+INDIRI4
+CNSTI4 15
+NEI4 $214
+LABELV $225
+ADDRGP4 $140
+JUMPV
+LABELV $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $226
+ADDRGP4 $140
+JUMPV
+LABELV $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $228
+ADDRGP4 $140
+JUMPV
+LABELV $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $230
+ADDRGP4 $140
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1112014848
+GEF4 $232
+ADDRGP4 $140
+JUMPV
+LABELV $232
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $236
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $237
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $235
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $238
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $238
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $238
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $242
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $242
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+NEI4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $243
+LABELV $239
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $140
+endproc BotCTFSeekGoals 240 12
+export BotCTFRetreatGoals
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $251
+LABELV $249
+LABELV $248
+endproc BotCTFRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $254
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+LABELV $258
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $253
+endproc BotTeamGoals 0 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $260
+JUMPV
+LABELV $261
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $264
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $260
+JUMPV
+LABELV $264
+CNSTI4 0
+RETI4
+LABELV $260
+endproc BotPointAreaNum 68 20
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $269
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $267
+LABELV $269
+CNSTI4 3
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $271
+RETP4
+ADDRGP4 $266
+JUMPV
+LABELV $267
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $266
+endproc ClientName 1032 12
+export ClientSkin
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $276
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $274
+LABELV $276
+CNSTI4 3
+ARGI4
+ADDRGP4 $277
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $271
+RETP4
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $273
+endproc ClientSkin 1032 12
+bss
+align 4
+LABELV $280
+skip 4
+export ClientFromName
+code
+proc ClientFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $280
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $280
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $281
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $288
+LABELV $285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $287
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $280
+INDIRI4
+GEI4 $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $284
+LABELV $290
+CNSTI4 -1
+RETI4
+LABELV $279
+endproc ClientFromName 1040 12
+bss
+align 4
+LABELV $292
+skip 4
+export ClientOnSameTeamFromName
+code
+proc ClientOnSameTeamFromName 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $292
+INDIRI4
+CNSTI4 0
+NEI4 $293
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $292
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $293
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRGP4 $296
+JUMPV
+LABELV $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $291
+JUMPV
+LABELV $301
+LABELV $296
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $298
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $292
+INDIRI4
+GEI4 $303
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $295
+LABELV $303
+CNSTI4 -1
+RETI4
+LABELV $291
+endproc ClientOnSameTeamFromName 1044 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $308
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $312
+ADDRGP4 $310
+JUMPV
+LABELV $312
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $311
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $314
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $308
+LABELV $314
+LABELV $310
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $315
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $304
+JUMPV
+LABELV $315
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $306
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $305
+CNSTP4 0
+RETP4
+LABELV $304
+endproc stristr 12 4
+export EasyClientName
+proc EasyClientName 196 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $318
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $319
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $321
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $318
+ADDRLP4 5
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $325
+JUMPV
+LABELV $322
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $323
+ADDRLP4 5
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $325
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $322
+ADDRLP4 5
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $329
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $329
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $331
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $332
+LABELV $329
+ADDRLP4 172
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 109
+EQI4 $337
+ADDRLP4 172
+INDIRI4
+CNSTI4 77
+NEI4 $333
+LABELV $337
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $338
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $333
+LABELV $338
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $333
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $347
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $348
+LABELV $347
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $349
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $348
+LABELV $349
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $344
+LABELV $348
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $350
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $350
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $351
+LABELV $345
+LABELV $342
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $341
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $317
+endproc EasyClientName 196 12
+export BotSynonymContext
+proc BotSynonymContext 8 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $356
+LABELV $353
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $352
+endproc BotSynonymContext 8 4
+export BotChooseWeapon
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $360
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $358
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 6188
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $359
+LABELV $357
+endproc BotChooseWeapon 20 8
+export BotSetupForMovement
+proc BotSetupForMovement 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 68
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $375
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $375
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $378
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $378
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $381
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $384
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $388
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $388
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $363
+endproc BotSetupForMovement 92 12
+export BotCheckItemPickup
+proc BotCheckItemPickup 0 0
+LABELV $392
+endproc BotCheckItemPickup 0 0
+export BotUpdateInventory
+proc BotUpdateInventory 1224 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $395
+ADDRLP4 1028
+CNSTI4 1
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+LABELV $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 1036
+CNSTI4 1
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+LABELV $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $407
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $410
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $413
+ADDRLP4 1076
+CNSTI4 1
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 1084
+CNSTI4 1
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 1092
+CNSTI4 1
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 1100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 1100
+CNSTI4 0
+ASGNI4
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 5008
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $425
+ADDRLP4 1144
+CNSTI4 1
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 1144
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+ADDRLP4 1144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $428
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+ADDRLP4 1152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 1160
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $434
+ADDRLP4 1168
+CNSTI4 1
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRLP4 1168
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 1176
+CNSTI4 1
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 1176
+CNSTI4 0
+ASGNI4
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+ADDRLP4 1176
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 1184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 1192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 1208
+CNSTI4 0
+ASGNI4
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $452
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $453
+JUMPV
+LABELV $452
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $393
+endproc BotUpdateInventory 1224 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5756
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5752
+ADDP4
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $454
+endproc BotUpdateBattleInventory 160 8
+export BotBattleUseItems
+proc BotBattleUseItems 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $469
+LABELV $467
+LABELV $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $473
+LABELV $471
+LABELV $464
+endproc BotBattleUseItems 4 4
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $475
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $480
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $481
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $478
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $483
+CNSTI4 1
+RETI4
+ADDRGP4 $482
+JUMPV
+LABELV $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $485
+CNSTI4 1
+RETI4
+ADDRGP4 $482
+JUMPV
+LABELV $485
+CNSTI4 0
+RETI4
+LABELV $482
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $489
+CNSTI4 1
+RETI4
+ADDRGP4 $488
+JUMPV
+LABELV $489
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $495
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $493
+LABELV $495
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $494
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $488
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $496
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $499
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $500
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $499
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $500
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $501
+CNSTI4 2
+ARGI4
+ADDRGP4 $503
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $498
+JUMPV
+LABELV $501
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $498
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $504
+JUMPV
+LABELV $509
+LABELV $506
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $508
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $505
+CNSTP4 0
+RETP4
+LABELV $504
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $515
+JUMPV
+LABELV $512
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $513
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $515
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $512
+LABELV $511
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $517
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $518
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $517
+LABELV $516
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $524
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $525
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $522
+endproc TeamPlayIsOn 4 0
+export BotAggression
+proc BotAggression 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $527
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 5752
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $529
+LABELV $531
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $529
+LABELV $527
+ADDRFP4 0
+INDIRP4
+CNSTI4 5756
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $532
+CNSTF4 0
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $534
+CNSTF4 0
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $538
+CNSTF4 0
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $538
+LABELV $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $540
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $542
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $544
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $546
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $548
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $550
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $550
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $552
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $552
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $526
+JUMPV
+LABELV $552
+CNSTF4 0
+RETF4
+LABELV $526
+endproc BotAggression 28 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $555
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $554
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $557
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $554
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $559
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $554
+JUMPV
+LABELV $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $561
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $554
+JUMPV
+LABELV $561
+CNSTF4 0
+RETF4
+LABELV $554
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $564
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $566
+CNSTI4 1
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $566
+LABELV $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $570
+CNSTI4 0
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $570
+LABELV $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $572
+CNSTI4 1
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $572
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $574
+CNSTI4 1
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $574
+CNSTI4 0
+RETI4
+LABELV $563
+endproc BotWantsToRetreat 144 8
+export BotWantsToChase
+proc BotWantsToChase 148 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $577
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $579
+CNSTI4 0
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $581
+CNSTI4 1
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $581
+LABELV $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $583
+CNSTI4 0
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+LEF4 $585
+CNSTI4 1
+RETI4
+ADDRGP4 $576
+JUMPV
+LABELV $585
+CNSTI4 0
+RETI4
+LABELV $576
+endproc BotWantsToChase 148 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $587
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $589
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $592
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $594
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $596
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $598
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $598
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 90
+GEI4 $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $602
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $602
+LABELV $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $604
+CNSTI4 0
+RETI4
+ADDRGP4 $588
+JUMPV
+LABELV $604
+CNSTI4 1
+RETI4
+LABELV $588
+endproc BotCanAndWantsToRocketJump 8 16
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $607
+CNSTI4 0
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $611
+CNSTI4 0
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $611
+LABELV $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $613
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $615
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $617
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $619
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $621
+ADDRFP4 0
+INDIRP4
+CNSTI4 5056
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $621
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 5060
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $623
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $625
+ADDRFP4 0
+INDIRP4
+CNSTI4 5064
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $625
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $625
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $627
+CNSTI4 1
+RETI4
+ADDRGP4 $606
+JUMPV
+LABELV $627
+CNSTI4 0
+RETI4
+LABELV $606
+endproc BotHasPersistantPowerupAndWeapon 32 0
+export BotGoCamp
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $630
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $629
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 172 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $633
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $633
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $643
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+NEI4 $635
+LABELV $643
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $635
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $644
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $644
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $646
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $648
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $650
+LABELV $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $650
+LABELV $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $650
+LABELV $654
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $650
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $660
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $660
+LABELV $656
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $658
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $655
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $662
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $662
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $632
+endproc BotWantsToCamp 172 16
+export BotDontAvoid
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $665
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $666
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $665
+LABELV $664
+endproc BotDontAvoid 68 12
+export BotGoForPowerups
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $670
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $671
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $672
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $673
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $674
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $669
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $676
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1048576000
+LEF4 $680
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $682
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $683
+LABELV $680
+ADDRLP4 112
+INDIRF4
+CNSTF4 1061158912
+GEF4 $684
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $686
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $687
+LABELV $684
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1128792064
+LEF4 $698
+ADDRLP4 164
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $715
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $721
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $675
+JUMPV
+LABELV $721
+LABELV $715
+LABELV $698
+LABELV $677
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 10
+LTI4 $676
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $675
+endproc BotRoamGoal 180 28
+lit
+align 4
+LABELV $725
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 400 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $725
+INDIRB
+ASGNB 12
+ADDRLP4 332
+ADDRFP4 4
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6124
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $726
+ADDRLP4 136+40
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 136+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $723
+JUMPV
+LABELV $726
+ADDRLP4 80
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 356
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $740
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $723
+JUMPV
+LABELV $740
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 192+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 192+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 192+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 368
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $753
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 340
+INDIRF4
+GEF4 $755
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $756
+JUMPV
+LABELV $755
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $757
+ADDRLP4 376
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 344
+INDIRF4
+GEF4 $757
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 344
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $757
+LABELV $756
+LABELV $753
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $759
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $759
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $761
+ADDRFP4 4
+INDIRP4
+CNSTI4 6128
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $763
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $764
+JUMPV
+LABELV $763
+ADDRFP4 4
+INDIRP4
+CNSTI4 6128
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $764
+LABELV $761
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $765
+ADDRLP4 372
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRLP4 72
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 76
+CNSTF4 1109393408
+ASGNF4
+LABELV $766
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $767
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $769
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $771
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $723
+JUMPV
+LABELV $771
+LABELV $769
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $773
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $775
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $723
+JUMPV
+LABELV $775
+LABELV $773
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $723
+JUMPV
+LABELV $767
+ADDRLP4 376
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $777
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 336
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $777
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+LEF4 $779
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $781
+ADDRLP4 392
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $781
+LABELV $779
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $783
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $790
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $790
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $796
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $797
+JUMPV
+LABELV $796
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $804
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $805
+JUMPV
+LABELV $804
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $812
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $812
+LABELV $805
+LABELV $797
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $723
+JUMPV
+LABELV $820
+ADDRLP4 396
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ADDRLP4 396
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $784
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $783
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+LABELV $723
+endproc BotAttackMove 400 16
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $825
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $823
+LABELV $825
+CNSTI4 0
+RETI4
+ADDRGP4 $822
+JUMPV
+LABELV $823
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $828
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $826
+LABELV $828
+CNSTI4 0
+RETI4
+ADDRGP4 $822
+JUMPV
+LABELV $826
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $829
+ADDRLP4 8
+CNSTI4 776
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 616
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $831
+CNSTI4 1
+RETI4
+ADDRGP4 $822
+JUMPV
+LABELV $831
+LABELV $829
+CNSTI4 0
+RETI4
+LABELV $822
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $834
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $838
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $839
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $842
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $842
+LABELV $839
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $844
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $845
+CNSTI4 0
+RETI4
+ADDRGP4 $833
+JUMPV
+LABELV $844
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $848
+CNSTI4 0
+RETI4
+ADDRGP4 $833
+JUMPV
+LABELV $848
+LABELV $845
+LABELV $835
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $834
+CNSTI4 1
+RETI4
+LABELV $833
+endproc InFieldOfVision 32 4
+proc BotVisibilityRequest 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 65537
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $851
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $851
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $853
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $855
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $855
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $853
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $850
+endproc BotVisibilityRequest 28 4
+export BotEntityVisible
+proc BotEntityVisible 844 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 268
+ADDRLP4 616+72
+INDIRF4
+ADDRLP4 616+84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 616+72+4
+INDIRF4
+ADDRLP4 616+84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 616+72+8
+INDIRF4
+ADDRLP4 616+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 796
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 268
+ADDRLP4 796
+INDIRF4
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 796
+INDIRF4
+ADDRLP4 268+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 268+8
+CNSTF4 1056964608
+ADDRLP4 268+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 616+24
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 616+24+4
+INDIRF4
+ADDRLP4 268+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 616+24+8
+INDIRF4
+ADDRLP4 268+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 268
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 268+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 268+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 784
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 784
+ARGP4
+ADDRLP4 804
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 804
+INDIRI4
+CNSTI4 0
+NEI4 $887
+CNSTF4 0
+RETF4
+ADDRGP4 $857
+JUMPV
+LABELV $887
+ADDRLP4 268+12
+ADDRLP4 268
+INDIRB
+ASGNB 12
+ADDRLP4 268+12+8
+ADDRLP4 268+12+8
+INDIRF4
+ADDRLP4 616+72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 268+24
+ADDRLP4 268
+INDIRB
+ASGNB 12
+ADDRLP4 268+24+8
+ADDRLP4 268+24+8
+INDIRF4
+ADDRLP4 616+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 808
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 768
+ADDRLP4 808
+INDIRI4
+ASGNI4
+ADDRLP4 764
+ADDRLP4 768
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 760
+ADDRLP4 768
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 588
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $899
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $903
+ADDRLP4 88
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 760
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 268
+ARGP4
+ADDRLP4 816
+ADDRGP4 BotVisibilityRequest
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 816
+INDIRI4
+ASGNI4
+ADDRLP4 336
+ARGP4
+ADDRLP4 88
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_TraceBatch
+CALLV
+pop
+ADDRGP4 $904
+JUMPV
+LABELV $903
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $905
+ADDRLP4 88+60
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 760
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 268+12
+ARGP4
+ADDRLP4 816
+ADDRGP4 BotVisibilityRequest
+CALLI4
+ASGNI4
+ADDRLP4 316+4
+ADDRLP4 816
+INDIRI4
+ASGNI4
+ADDRLP4 88+120
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 760
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 268+24
+ARGP4
+ADDRLP4 820
+ADDRGP4 BotVisibilityRequest
+CALLI4
+ASGNI4
+ADDRLP4 316+8
+ADDRLP4 820
+INDIRI4
+ASGNI4
+ADDRLP4 336+84
+ARGP4
+ADDRLP4 88+60
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotAI_TraceBatch
+CALLV
+pop
+LABELV $905
+LABELV $904
+ADDRLP4 4
+CNSTI4 84
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 336
+ADDP4
+INDIRB
+ASGNB 84
+ADDRLP4 820
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 604
+ADDRLP4 820
+INDIRI4
+ADDRLP4 88+52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 612
+ADDRLP4 820
+INDIRI4
+ADDRLP4 88+48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 592
+ADDRLP4 820
+INDIRI4
+ADDRLP4 88+36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 328
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $918
+ADDRLP4 604
+ADDRLP4 604
+INDIRI4
+CNSTI4 -57
+BANDI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 824
+CNSTP4 0
+ASGNP4
+ADDRLP4 824
+INDIRP4
+ARGP4
+ADDRLP4 824
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRLP4 612
+INDIRI4
+ARGI4
+ADDRLP4 604
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 328
+CNSTF4 1056964608
+ASGNF4
+LABELV $921
+LABELV $918
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $928
+ADDRLP4 4+80
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRI4
+NEI4 $924
+LABELV $928
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 268
+ADDP4
+ARGP4
+ADDRLP4 824
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 756
+ADDRLP4 824
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 828
+CNSTI4 0
+ASGNI4
+ADDRLP4 764
+INDIRI4
+ADDRLP4 828
+INDIRI4
+EQI4 $929
+ADDRLP4 756
+INDIRI4
+ADDRLP4 828
+INDIRI4
+EQI4 $929
+ADDRLP4 304
+ADDRLP4 4+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 4+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 4+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 836
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 608
+ADDRLP4 836
+INDIRF4
+ASGNF4
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRLP4 764
+INDIRI4
+CNSTI4 0
+EQI4 $938
+ADDRLP4 772
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ARGP4
+ADDRLP4 772
+ARGP4
+ADDRLP4 832
+CNSTP4 0
+ASGNP4
+ADDRLP4 832
+INDIRP4
+ARGP4
+ADDRLP4 832
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 304
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 840
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 608
+ADDRLP4 840
+INDIRF4
+ASGNF4
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRLP4 756
+INDIRI4
+CNSTI4 0
+EQI4 $948
+ADDRLP4 592
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 832
+CNSTP4 0
+ASGNP4
+ADDRLP4 832
+INDIRP4
+ARGP4
+ADDRLP4 832
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 304
+ADDRLP4 592
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 592+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 592+8
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 836
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 608
+ADDRLP4 836
+INDIRF4
+ASGNF4
+ADDRGP4 $949
+JUMPV
+LABELV $948
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+LABELV $949
+LABELV $939
+LABELV $930
+ADDRLP4 836
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDRLP4 836
+INDIRF4
+GEF4 $961
+ADDRLP4 832
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $962
+JUMPV
+LABELV $961
+ADDRLP4 832
+CNSTF4 981668463
+ADDRLP4 608
+INDIRF4
+MULF4
+ASGNF4
+LABELV $962
+ADDRLP4 332
+ADDRLP4 836
+INDIRF4
+ADDRLP4 832
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 332
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 588
+INDIRF4
+LEF4 $963
+ADDRLP4 588
+ADDRLP4 332
+INDIRF4
+ASGNF4
+LABELV $963
+ADDRLP4 588
+INDIRF4
+CNSTF4 1064514355
+LTF4 $965
+ADDRLP4 588
+INDIRF4
+RETF4
+ADDRGP4 $857
+JUMPV
+LABELV $965
+LABELV $924
+LABELV $900
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $899
+ADDRLP4 588
+INDIRF4
+RETF4
+LABELV $857
+endproc BotEntityVisible 844 28
+export BotFindEnemy
+proc BotFindEnemy 432 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 336
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $969
+ADDRLP4 344
+CNSTI4 1
+ASGNI4
+ADDRGP4 $970
+JUMPV
+LABELV $969
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+LABELV $970
+ADDRLP4 160
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $971
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $973
+CNSTI4 0
+RETI4
+ADDRGP4 $967
+JUMPV
+LABELV $973
+ADDRLP4 144
+ADDRLP4 196+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 196+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 196+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 364
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRGP4 $972
+JUMPV
+LABELV $971
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+LABELV $972
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $985
+JUMPV
+LABELV $982
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $986
+ADDRGP4 $983
+JUMPV
+LABELV $986
+ADDRLP4 140
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $988
+ADDRGP4 $983
+JUMPV
+LABELV $988
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $990
+ADDRGP4 $983
+JUMPV
+LABELV $990
+ADDRLP4 0
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $995
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $992
+LABELV $995
+ADDRGP4 $983
+JUMPV
+LABELV $992
+ADDRLP4 0
+ARGP4
+ADDRLP4 360
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $996
+ADDRLP4 0
+ARGP4
+ADDRLP4 364
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $996
+ADDRGP4 $983
+JUMPV
+LABELV $996
+ADDRLP4 176
+INDIRF4
+CNSTF4 1056964608
+GEF4 $998
+ADDRLP4 0
+ARGP4
+ADDRLP4 368
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $998
+ADDRGP4 $983
+JUMPV
+LABELV $998
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $1000
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1167663104
+GEF4 $1011
+ADDRGP4 $983
+JUMPV
+LABELV $1011
+LABELV $1000
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 380
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $1020
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1022
+ADDRLP4 156
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LEF4 $1022
+ADDRGP4 $983
+JUMPV
+LABELV $1022
+LABELV $1020
+ADDRLP4 384
+CNSTF4 1165623296
+ADDRLP4 164
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 384
+INDIRF4
+MULF4
+LEF4 $1024
+ADDRGP4 $983
+JUMPV
+LABELV $1024
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $1026
+ADDRGP4 $983
+JUMPV
+LABELV $1026
+ADDRLP4 392
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 392
+INDIRI4
+GEI4 $1028
+ADDRLP4 160
+INDIRI4
+ADDRLP4 392
+INDIRI4
+NEI4 $1030
+ADDRLP4 0
+ARGP4
+ADDRLP4 396
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $1028
+LABELV $1030
+ADDRLP4 168
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1029
+JUMPV
+LABELV $1028
+ADDRLP4 156
+INDIRF4
+CNSTF4 1226845760
+LEF4 $1032
+ADDRLP4 400
+CNSTF4 1226845760
+ASGNF4
+ADDRGP4 $1033
+JUMPV
+LABELV $1032
+ADDRLP4 400
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $1033
+ADDRLP4 168
+CNSTF4 1127481344
+CNSTF4 1119092736
+ADDRLP4 400
+INDIRF4
+CNSTF4 1172557824
+DIVF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $1029
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 0
+GTF4 $1034
+ADDRGP4 $983
+JUMPV
+LABELV $1034
+ADDRLP4 412
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 412
+INDIRI4
+GEI4 $1036
+ADDRLP4 156
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1036
+ADDRLP4 160
+INDIRI4
+ADDRLP4 412
+INDIRI4
+NEI4 $1036
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $1036
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+36
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 428
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRGP4 $983
+JUMPV
+LABELV $1048
+LABELV $1045
+LABELV $1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+ADDRLP4 0+20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1051
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1052
+JUMPV
+LABELV $1051
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $967
+JUMPV
+LABELV $983
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $985
+ADDRLP4 140
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1053
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $982
+LABELV $1053
+CNSTI4 0
+RETI4
+LABELV $967
+endproc BotFindEnemy 432 20
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1058
+JUMPV
+LABELV $1055
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1059
+ADDRGP4 $1056
+JUMPV
+LABELV $1059
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRGP4 $1056
+JUMPV
+LABELV $1061
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1063
+ADDRGP4 $1056
+JUMPV
+LABELV $1063
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1065
+ADDRGP4 $1056
+JUMPV
+LABELV $1065
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1067
+ADDRGP4 $1056
+JUMPV
+LABELV $1067
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1056
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1058
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1069
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1055
+LABELV $1069
+CNSTI4 -1
+RETI4
+LABELV $1054
+endproc BotTeamFlagCarrierVisible 164 20
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 152 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1074
+JUMPV
+LABELV $1071
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1075
+ADDRGP4 $1072
+JUMPV
+LABELV $1075
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1077
+ADDRGP4 $1072
+JUMPV
+LABELV $1077
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $1079
+ADDRGP4 $1072
+JUMPV
+LABELV $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1081
+ADDRGP4 $1072
+JUMPV
+LABELV $1081
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1070
+JUMPV
+LABELV $1072
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1074
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1083
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1071
+LABELV $1083
+CNSTI4 -1
+RETI4
+LABELV $1070
+endproc BotTeamFlagCarrier 152 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1088
+JUMPV
+LABELV $1085
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1089
+ADDRGP4 $1086
+JUMPV
+LABELV $1089
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1091
+ADDRGP4 $1086
+JUMPV
+LABELV $1091
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1093
+ADDRGP4 $1086
+JUMPV
+LABELV $1093
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+ADDRGP4 $1086
+JUMPV
+LABELV $1095
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1097
+ADDRGP4 $1086
+JUMPV
+LABELV $1097
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1084
+JUMPV
+LABELV $1086
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1088
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1099
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1085
+LABELV $1099
+CNSTI4 -1
+RETI4
+LABELV $1084
+endproc BotEnemyFlagCarrierVisible 164 20
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1101
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1101
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1103
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1103
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1105
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1109
+ADDRGP4 $1106
+JUMPV
+LABELV $1109
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1111
+ADDRGP4 $1106
+JUMPV
+LABELV $1111
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $1113
+ADDRGP4 $1106
+JUMPV
+LABELV $1113
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1122
+ADDRGP4 $1106
+JUMPV
+LABELV $1122
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1124
+ADDRGP4 $1106
+JUMPV
+LABELV $1124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1126
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1127
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1127
+JUMPV
+LABELV $1126
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1130
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1130
+LABELV $1127
+LABELV $1106
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1108
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1132
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1105
+LABELV $1132
+LABELV $1100
+endproc BotVisibleTeamMatesAndEnemies 192 20
+lit
+align 4
+LABELV $1134
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1135
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1148 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 860
+ADDRGP4 $1134
+INDIRB
+ASGNB 12
+ADDRLP4 872
+ADDRGP4 $1135
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1136
+ADDRGP4 $1133
+JUMPV
+LABELV $1136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1138
+ADDRLP4 828
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ADDRLP4 828
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 828+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 828+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+ADDRLP4 828
+INDIRB
+ASGNB 12
+ADDRGP4 $1133
+JUMPV
+LABELV $1138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 984
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 988
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 992
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 856
+CNSTF4 1056964608
+ADDRLP4 992
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1147
+ADDRGP4 $1133
+JUMPV
+LABELV $1147
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1149
+ADDRGP4 $1133
+JUMPV
+LABELV $1149
+LABELV $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+NEI4 $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1152
+JUMPV
+LABELV $1151
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+NEI4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1155
+JUMPV
+LABELV $1154
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1158
+JUMPV
+LABELV $1157
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+NEI4 $1160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1161
+JUMPV
+LABELV $1160
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+NEI4 $1163
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1164
+JUMPV
+LABELV $1163
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $1166
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1167
+JUMPV
+LABELV $1166
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 8
+NEI4 $1169
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1170
+JUMPV
+LABELV $1169
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+NEI4 $1172
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+LABELV $1172
+LABELV $1170
+LABELV $1167
+LABELV $1164
+LABELV $1161
+LABELV $1158
+LABELV $1155
+LABELV $1152
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1175
+ADDRLP4 156
+CNSTF4 953267991
+ASGNF4
+LABELV $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 996
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+EQI4 $1177
+ADDRLP4 1000
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $1179
+ADDRLP4 156
+CNSTF4 1053609165
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1179
+LABELV $1177
+ADDRLP4 712
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1000
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+LABELV $1200
+ADDRLP4 736
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1203
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1008
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1008
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1212
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRF4
+ADDRLP4 712+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRF4
+ADDRLP4 712+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1214
+ADDRLP4 156
+CNSTF4 1060320051
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1214
+LABELV $1212
+LABELV $1203
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 824
+ADDRLP4 1008
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 824
+INDIRI4
+CNSTI4 0
+EQI4 $1218
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 844
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRLP4 160+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 860
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1226
+ADDRLP4 740+80
+INDIRI4
+ADDRLP4 0+20
+INDIRI4
+EQI4 $1226
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1226
+ADDRLP4 160+272
+INDIRF4
+CNSTF4 0
+EQF4 $1232
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1020
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1020
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1248
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1246
+LABELV $1248
+ADDRLP4 736
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1249
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1249
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1132
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1132
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 1032+8
+ADDRLP4 1032+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1140
+CNSTF4 0
+ASGNF4
+ADDRLP4 968+8
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968+4
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1144
+CNSTI4 0
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 968
+ARGP4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 840
+INDIRF4
+MULF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 724
+ADDRLP4 1044
+INDIRB
+ASGNB 12
+ADDRGP4 $1250
+JUMPV
+LABELV $1249
+ADDRLP4 736
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1282
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1036
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1040
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 980
+ADDRLP4 1040
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 840
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 980
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1282
+LABELV $1250
+LABELV $1246
+LABELV $1232
+ADDRLP4 736
+INDIRF4
+CNSTF4 1058642330
+LEF4 $1317
+ADDRLP4 160+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1317
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $1321
+ADDRLP4 956
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 956+8
+ADDRLP4 956+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 956
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 944
+ADDRLP4 724
+INDIRB
+ASGNB 12
+ADDRLP4 740+4
+INDIRI4
+CNSTI4 0
+EQI4 $1329
+ADDRLP4 944+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $1330
+JUMPV
+LABELV $1329
+ADDRLP4 944+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $1330
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 1020
+CNSTP4 0
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 944
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 1024
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1338
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 944
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 944+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1163984896
+GEF4 $1352
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 844
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 844+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 844+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1032
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1032
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1363
+ADDRLP4 740+12+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 740+12
+ARGP4
+ADDRLP4 1036
+CNSTP4 0
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1370
+ADDRLP4 724
+ADDRLP4 944
+INDIRB
+ASGNB 12
+LABELV $1370
+LABELV $1363
+LABELV $1352
+LABELV $1338
+LABELV $1321
+LABELV $1317
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724
+ADDRLP4 724
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+4
+ADDRLP4 724+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1020
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 1024
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRLP4 724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1376
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+EQI4 $1384
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+EQI4 $1384
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1378
+LABELV $1384
+ADDRLP4 884+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 884+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 828
+ARGP4
+ADDRLP4 1016
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 1016
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRLP4 140
+ADDRLP4 828
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 828+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 828+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1024
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1170735104
+LEF4 $1403
+ADDRLP4 724
+ADDRLP4 828
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $1403
+LABELV $1397
+ADDRLP4 156
+CNSTF4 1065353216
+ASGNF4
+LABELV $1378
+LABELV $1376
+LABELV $1219
+ADDRLP4 824
+INDIRI4
+CNSTI4 0
+EQI4 $1406
+ADDRLP4 740
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+ADDRLP4 740+12
+INDIRB
+ASGNB 12
+ADDRGP4 $1407
+JUMPV
+LABELV $1406
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+ADDRLP4 724
+INDIRB
+ASGNB 12
+LABELV $1407
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+EQI4 $1421
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+EQI4 $1421
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+EQI4 $1421
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $1413
+LABELV $1421
+ADDRLP4 140
+ARGP4
+ADDRLP4 1016
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1016
+INDIRF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+LEF4 $1422
+ADDRLP4 840
+CNSTF4 1125515264
+ASGNF4
+LABELV $1422
+ADDRLP4 940
+CNSTF4 1053609165
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 940
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1413
+ADDRLP4 156
+INDIRF4
+CNSTF4 1061997773
+GEF4 $1424
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $1426
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 140
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1427
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 3
+LTI4 $1426
+LABELV $1424
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1028
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRP4
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1036
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1032
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1044
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $1432
+ADDRLP4 156
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1435
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1437
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1437
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $1435
+LABELV $1432
+LABELV $1133
+endproc BotAimAtEnemy 1148 52
+lit
+align 4
+LABELV $1440
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1441
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 1032 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 808
+ADDRGP4 $1440
+INDIRB
+ASGNB 12
+ADDRLP4 820
+ADDRGP4 $1441
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 832
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $1442
+LABELV $1442
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 976
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 700
+ADDRLP4 976
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $1444
+ADDRGP4 $1439
+JUMPV
+LABELV $1444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $1446
+ADDRGP4 $1439
+JUMPV
+LABELV $1446
+ADDRFP4 0
+INDIRP4
+CNSTI4 6188
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $1448
+ADDRGP4 $1439
+JUMPV
+LABELV $1448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1450
+ADDRGP4 $1439
+JUMPV
+LABELV $1450
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 792
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1452
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 792
+INDIRF4
+LEF4 $1454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 792
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1455
+JUMPV
+LABELV $1454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 792
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1455
+LABELV $1452
+ADDRLP4 580
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1458
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1163984896
+LEF4 $1460
+ADDRGP4 $1439
+JUMPV
+LABELV $1460
+LABELV $1458
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1176256512
+GEF4 $1462
+ADDRLP4 788
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $1463
+JUMPV
+LABELV $1462
+ADDRLP4 788
+CNSTF4 1112014848
+ASGNF4
+LABELV $1463
+ADDRLP4 580
+ARGP4
+ADDRLP4 796
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+ADDRLP4 788
+INDIRF4
+ARGF4
+ADDRLP4 796
+ARGP4
+ADDRLP4 996
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+NEI4 $1464
+ADDRGP4 $1439
+JUMPV
+LABELV $1464
+ADDRLP4 704
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1004
+CNSTP4 0
+ASGNP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 704+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1466
+ADDRLP4 704+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1466
+ADDRGP4 $1439
+JUMPV
+LABELV $1466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 676
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 1016
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 688
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 820
+ARGP4
+ADDRLP4 688
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 0
+LTI4 $1500
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 64
+GEI4 $1500
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1504
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592+80
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+EQI4 $1507
+ADDRGP4 $1439
+JUMPV
+LABELV $1507
+LABELV $1504
+LABELV $1500
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $1513
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $1510
+LABELV $1513
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1514
+CNSTF4 1148846080
+ADDRLP4 592+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $1518
+ADDRLP4 1028
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 972
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 592+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 972
+INDIRF4
+CNSTF4 0
+LEF4 $1526
+ADDRGP4 $1439
+JUMPV
+LABELV $1526
+LABELV $1518
+LABELV $1514
+LABELV $1510
+ADDRLP4 24+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1529
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $1529
+JUMPV
+LABELV $1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $1529
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $1439
+endproc BotCheckAttack 1032 28
+lit
+align 4
+LABELV $1539
+byte 4 1143930880
+byte 4 1129054208
+byte 4 1143472128
+align 4
+LABELV $1540
+byte 4 1148256256
+byte 4 1139408896
+byte 4 1143603200
+align 4
+LABELV $1541
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 1428 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 $1534
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTU4 127
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 144+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 144
+ARGP4
+ADDRGP4 $1538
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $1536
+ADDRLP4 1324
+ADDRGP4 $1539
+INDIRB
+ASGNB 12
+ADDRLP4 1336
+ADDRGP4 $1540
+INDIRB
+ASGNB 12
+ADDRLP4 1348
+ADDRGP4 $1541
+INDIRB
+ASGNB 12
+ADDRLP4 1360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+ADDRLP4 1360
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1324
+INDIRF4
+LEF4 $1542
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1336
+INDIRF4
+GEF4 $1542
+ADDRLP4 1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1324+4
+INDIRF4
+LEF4 $1544
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1336+4
+INDIRF4
+GEF4 $1544
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 1324+8
+INDIRF4
+GEF4 $1548
+ADDRGP4 $1533
+JUMPV
+LABELV $1548
+LABELV $1544
+LABELV $1542
+ADDRLP4 1368
+CNSTI4 0
+ASGNI4
+ADDRLP4 1296
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRGP4 $1554
+JUMPV
+LABELV $1551
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1555
+ADDRGP4 $1552
+JUMPV
+LABELV $1555
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1557
+ADDRGP4 $1552
+JUMPV
+LABELV $1557
+ADDRLP4 0
+ARGP4
+ADDRLP4 1372
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $1562
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1559
+LABELV $1562
+ADDRGP4 $1552
+JUMPV
+LABELV $1559
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1324
+INDIRF4
+LEF4 $1563
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1336
+INDIRF4
+GEF4 $1563
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1324+4
+INDIRF4
+LEF4 $1567
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1336+4
+INDIRF4
+GEF4 $1567
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1324+8
+INDIRF4
+GEF4 $1575
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+EQI4 $1580
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1553
+JUMPV
+LABELV $1580
+ADDRLP4 1296
+CNSTI4 1
+ASGNI4
+LABELV $1575
+LABELV $1567
+LABELV $1563
+LABELV $1552
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1554
+ADDRLP4 140
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1582
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $1551
+LABELV $1582
+LABELV $1553
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $1537
+ADDRLP4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ADDRLP4 1376
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1348
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+4
+ADDRLP4 1348+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+8
+ADDRLP4 1348+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1384
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1312
+ADDRLP4 1384
+INDIRF4
+ASGNF4
+ADDRLP4 1388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1392
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1396
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ASGNP4
+ADDRLP4 1396
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1400
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1396
+INDIRP4
+ADDRLP4 1400
+INDIRF4
+ASGNF4
+ADDRLP4 1404
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+ADDRLP4 1408
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1404
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1412
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1412
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1416
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1412
+INDIRP4
+ADDRLP4 1416
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6572
+ADDP4
+ARGP4
+ADDRLP4 1424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1424
+INDIRI4
+CNSTI4 0
+EQI4 $1537
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $1537
+JUMPV
+LABELV $1536
+ADDRLP4 144
+ARGP4
+ADDRGP4 $1593
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $1591
+ADDRLP4 1328
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ADDRLP4 1328
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+LABELV $1591
+LABELV $1537
+LABELV $1533
+endproc BotMapScripts 1428 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1595
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $1596
+JUMPV
+LABELV $1595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1597
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $1598
+JUMPV
+LABELV $1597
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1598
+LABELV $1596
+LABELV $1594
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1600
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1605
+ADDRGP4 $1601
+JUMPV
+LABELV $1605
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1607
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1607
+ADDRGP4 $1601
+JUMPV
+LABELV $1607
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1609
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $1609
+ADDRGP4 $1601
+JUMPV
+LABELV $1609
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1611
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1613
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1613
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1615
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1615
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1611
+LABELV $1601
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+LABELV $1603
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1600
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1617
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $1617
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1619
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $1619
+CNSTI4 0
+RETI4
+LABELV $1599
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $1622
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1623
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 648 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ADDRGP4 $1622
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRGP4 $1623
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 564
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 160
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 160
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1624
+CNSTI4 0
+RETI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1624
+ADDRLP4 160+1
+ARGP4
+ADDRLP4 568
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $1627
+CNSTI4 0
+RETI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1627
+ADDRLP4 572
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 576
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 328
+INDIRF4
+CNSTF4 0
+NEF4 $1632
+ADDRLP4 328
+CNSTF4 1082130432
+ASGNF4
+LABELV $1632
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1634
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 112
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 584
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1657
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $1658
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 600
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 604
+CNSTP4 0
+ASGNP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1670
+ADDRLP4 356+80
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1666
+LABELV $1670
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1666
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1671
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1675
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1676
+JUMPV
+LABELV $1675
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1676
+LABELV $1672
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1671
+ADDRLP4 608
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1688
+JUMPV
+LABELV $1685
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 0
+EQI4 $1689
+ADDRGP4 $1687
+JUMPV
+LABELV $1689
+LABELV $1686
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1688
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1685
+LABELV $1687
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1691
+LABELV $1691
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1693
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1695
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1699
+ADDRLP4 616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 628
+ADDRLP4 616
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 628
+INDIRP4
+INDIRF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1700
+JUMPV
+LABELV $1699
+ADDRLP4 632
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 636
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 640
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 644
+ADDRLP4 632
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1700
+LABELV $1696
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1695
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1693
+CNSTI4 0
+RETI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1658
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1701
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1705
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1706
+JUMPV
+LABELV $1705
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1706
+LABELV $1702
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1701
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1718
+JUMPV
+LABELV $1715
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+EQI4 $1719
+ADDRGP4 $1717
+JUMPV
+LABELV $1719
+LABELV $1716
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1718
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1715
+LABELV $1717
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $1721
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1731
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1735
+ADDRLP4 604
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 616
+ADDRLP4 604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1736
+JUMPV
+LABELV $1735
+ADDRLP4 620
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 628
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 632
+ADDRLP4 620
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 632
+INDIRP4
+ADDRLP4 632
+INDIRP4
+INDIRF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1736
+LABELV $1732
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1731
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1721
+CNSTI4 0
+RETI4
+LABELV $1621
+endproc BotFuncButtonActivateGoal 648 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1096 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1738
+CNSTI4 0
+RETI4
+ADDRGP4 $1737
+JUMPV
+LABELV $1738
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1741
+CNSTI4 0
+RETI4
+ADDRGP4 $1737
+JUMPV
+LABELV $1741
+ADDRLP4 1084
+CNSTF4 0
+ASGNF4
+ADDRLP4 1064+8
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064+4
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1088
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1092
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $1737
+endproc BotFuncDoorActivateGoal 1096 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 300 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1756
+CNSTI4 0
+RETI4
+ADDRGP4 $1755
+JUMPV
+LABELV $1756
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1759
+CNSTI4 0
+RETI4
+ADDRGP4 $1755
+JUMPV
+LABELV $1759
+ADDRLP4 280
+CNSTF4 0
+ASGNF4
+ADDRLP4 240+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1778
+JUMPV
+LABELV $1775
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1779
+ADDRGP4 $1777
+JUMPV
+LABELV $1779
+LABELV $1776
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1778
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1775
+LABELV $1777
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1781
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1755
+JUMPV
+LABELV $1781
+CNSTI4 0
+RETI4
+LABELV $1755
+endproc BotTriggerMultipleActivateGoal 300 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1792
+CNSTI4 0
+RETI4
+ADDRGP4 $1791
+JUMPV
+LABELV $1792
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $1791
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1795
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1799
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $1801
+ADDRLP4 4
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1801
+LABELV $1799
+LABELV $1796
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1795
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1803
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 244
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+CNSTI4 240
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1794
+JUMPV
+LABELV $1803
+CNSTI4 0
+RETI4
+LABELV $1794
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1807
+JUMPV
+LABELV $1806
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $1807
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1806
+LABELV $1805
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1813
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1814
+JUMPV
+LABELV $1813
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1814
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1810
+ADDRGP4 $1809
+JUMPV
+LABELV $1810
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1818
+JUMPV
+LABELV $1815
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $1816
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1818
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $1815
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1820
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1821
+JUMPV
+LABELV $1820
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1821
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1809
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1826
+JUMPV
+LABELV $1823
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1827
+ADDRGP4 $1824
+JUMPV
+LABELV $1827
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1829
+CNSTI4 1
+RETI4
+ADDRGP4 $1822
+JUMPV
+LABELV $1829
+LABELV $1824
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1826
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1823
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1831
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1835
+ADDRGP4 $1832
+JUMPV
+LABELV $1835
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1837
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7016
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1839
+CNSTI4 1
+RETI4
+ADDRGP4 $1822
+JUMPV
+LABELV $1839
+LABELV $1837
+LABELV $1832
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $1831
+CNSTI4 0
+RETI4
+LABELV $1822
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3320 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 244
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3052
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1842
+ARGP4
+ADDRLP4 3052+104
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRGP4 $1847
+JUMPV
+LABELV $1844
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $1848
+ADDRGP4 $1845
+JUMPV
+LABELV $1848
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $1850
+ADDRGP4 $1846
+JUMPV
+LABELV $1850
+LABELV $1845
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+LABELV $1847
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1844
+LABELV $1846
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1852
+CNSTI4 3
+ARGI4
+ADDRGP4 $1854
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1852
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1855
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1856
+CNSTI4 3
+ARGI4
+ADDRGP4 $1858
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1856
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1861
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $1859
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1657
+ARGP4
+ADDRLP4 3208
+ARGP4
+ADDRLP4 3264
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+EQI4 $1862
+ADDRLP4 3208
+INDIRF4
+CNSTF4 0
+EQF4 $1864
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1864
+LABELV $1862
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1866
+ARGP4
+ADDRLP4 3204
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3204
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1867
+CNSTI4 0
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1867
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1871
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $1869
+ADDRLP4 3272
+CNSTF4 0
+ASGNF4
+ADDRLP4 3192+8
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192+4
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+LABELV $1869
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3052+24
+ARGP4
+ADDRLP4 3272
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+NEI4 $1874
+CNSTI4 0
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1874
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1877
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3212
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+EQI4 $1880
+ADDRLP4 3280
+CNSTF4 0
+ASGNF4
+ADDRLP4 3216+8
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216+4
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3048
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1887
+JUMPV
+LABELV $1884
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $1888
+ADDRGP4 $1886
+JUMPV
+LABELV $1888
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $1890
+ADDRGP4 $1885
+JUMPV
+LABELV $1890
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1892
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1892
+LABELV $1885
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1887
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $1884
+LABELV $1886
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1897
+JUMPV
+LABELV $1894
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $1898
+ADDRGP4 $1896
+JUMPV
+LABELV $1898
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+EQI4 $1900
+ADDRGP4 $1895
+JUMPV
+LABELV $1900
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1902
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1902
+LABELV $1895
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1897
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $1894
+LABELV $1896
+LABELV $1880
+LABELV $1877
+LABELV $1859
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1906
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $1904
+CNSTI4 0
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1904
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1909
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $1907
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1910
+CNSTI4 3
+ARGI4
+ADDRGP4 $1913
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1910
+CNSTI4 0
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1907
+CNSTI4 0
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3272
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1917
+JUMPV
+LABELV $1914
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1921
+JUMPV
+LABELV $1918
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1924
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $1922
+ADDRGP4 $1919
+JUMPV
+LABELV $1922
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $1925
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRGP4 $1920
+JUMPV
+LABELV $1925
+LABELV $1919
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+LABELV $1921
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1918
+LABELV $1920
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1927
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1929
+CNSTI4 3
+ARGI4
+ADDRGP4 $1932
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1929
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1915
+JUMPV
+LABELV $1927
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1855
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $1933
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1915
+CNSTI4 3
+ARGI4
+ADDRGP4 $1938
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1915
+JUMPV
+LABELV $1933
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1906
+ARGP4
+ADDRLP4 3284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+NEI4 $1939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3288
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $1941
+ADDRGP4 $1915
+JUMPV
+LABELV $1941
+ADDRLP4 3292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1943
+ADDRLP4 3292
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1943
+ADDRLP4 3296
+CNSTI4 44
+ASGNI4
+ADDRLP4 3292
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1943
+ADDRLP4 3300
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3292
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+LEF4 $1943
+ADDRLP4 3292
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $1943
+ADDRGP4 $1915
+JUMPV
+LABELV $1943
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $1945
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3312
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3312
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $1947
+ADDRGP4 $1915
+JUMPV
+LABELV $1947
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $1945
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1939
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1951
+ARGP4
+ADDRLP4 3288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $1949
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3292
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $1952
+ADDRGP4 $1915
+JUMPV
+LABELV $1952
+ADDRLP4 3296
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1954
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1954
+ADDRLP4 3300
+CNSTI4 44
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1954
+ADDRLP4 3304
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3296
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+LEF4 $1954
+ADDRLP4 3296
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $1954
+ADDRGP4 $1915
+JUMPV
+LABELV $1954
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3308
+INDIRI4
+CNSTI4 0
+EQI4 $1956
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3316
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3316
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $1958
+ADDRGP4 $1915
+JUMPV
+LABELV $1958
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $1956
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1841
+JUMPV
+LABELV $1949
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1962
+ARGP4
+ADDRLP4 3292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $1960
+ADDRGP4 $1915
+JUMPV
+LABELV $1960
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1965
+ARGP4
+ADDRLP4 3296
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3296
+INDIRI4
+CNSTI4 0
+EQI4 $1967
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1966
+ARGP4
+ADDRLP4 3300
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3300
+INDIRI4
+CNSTI4 0
+NEI4 $1963
+LABELV $1967
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1909
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $1968
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3308
+INDIRI4
+ASGNI4
+LABELV $1968
+LABELV $1963
+LABELV $1915
+LABELV $1917
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $1971
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $1914
+LABELV $1971
+CNSTI4 0
+RETI4
+LABELV $1841
+endproc BotGetActivateGoal 3320 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 144 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1973
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $1973
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1978
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1972
+JUMPV
+LABELV $1976
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1972
+endproc BotGoForActivateGoal 144 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1855
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1980
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $1982
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1981
+JUMPV
+LABELV $1980
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $1983
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1981
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $1979
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 32 16
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1984
+endproc BotRandomMove 32 16
+lit
+align 4
+LABELV $1988
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 472 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRGP4 $1988
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1989
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $1987
+JUMPV
+LABELV $1989
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1991
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $1987
+JUMPV
+LABELV $1991
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 440
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 440
+INDIRI4
+EQI4 $1993
+ADDRLP4 28+104
+INDIRI4
+ADDRLP4 440
+INDIRI4
+LEI4 $1993
+ADDRLP4 28+104
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $1993
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28+20
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRLP4 444
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 436
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $1998
+ADDRLP4 448
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 448
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2000
+ADDRLP4 448
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2000
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2000
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192+4+40
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 0
+NEI4 $2002
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $2002
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1999
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+EQI4 $1999
+ADDRGP4 $1987
+JUMPV
+LABELV $1998
+ADDRLP4 192
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $1999
+LABELV $1993
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 448
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 448
+INDIRF4
+CNSTF4 1036831949
+GEF4 $2010
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168+4
+CNSTF4 1135869952
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 168
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 456
+CNSTP4 0
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2010
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2014
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2014
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+NEI4 $2022
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $2020
+LABELV $2022
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $2023
+ADDRLP4 464
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 464
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 468
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $2023
+LABELV $2020
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2031
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2033
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2034
+JUMPV
+LABELV $2033
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2035
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2035
+LABELV $2034
+LABELV $2031
+LABELV $1987
+endproc BotAIBlocked 472 16
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 324 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2038
+CNSTI4 0
+RETI4
+ADDRGP4 $2037
+JUMPV
+LABELV $2038
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2041
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+LEF4 $2041
+CNSTI4 0
+RETI4
+ADDRGP4 $2037
+JUMPV
+LABELV $2041
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2043
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2044
+ADDRLP4 300
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 300
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 300
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2044
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2044
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2044
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2056
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2056
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2056
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2058
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2037
+JUMPV
+LABELV $2058
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2044
+JUMPV
+LABELV $2043
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2062
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2065
+LABELV $2065
+LABELV $2062
+LABELV $2044
+CNSTI4 0
+RETI4
+LABELV $2037
+endproc BotAIPredictObstacles 324 44
+export BotCheckConsoleMessages
+proc BotCheckConsoleMessages 1012 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $2070
+JUMPV
+LABELV $2069
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 trap_BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 10
+GEI4 $2072
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2074
+ADDRLP4 952
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 952
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $2074
+ADDRGP4 $2071
+JUMPV
+LABELV $2074
+LABELV $2072
+ADDRLP4 276
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2079
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 952
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $2082
+ADDRLP4 276
+ADDRLP4 288+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $2082
+LABELV $2079
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 trap_BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $2088
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2091
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $2091
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 960
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $2095
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2070
+JUMPV
+LABELV $2095
+ADDRLP4 288+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2098
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2070
+JUMPV
+LABELV $2098
+ADDRLP4 288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 872
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 616
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 872
+ARGP4
+ADDRLP4 964
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 964
+INDIRI4
+NEI4 $2101
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2070
+JUMPV
+LABELV $2101
+ADDRLP4 616
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2103
+ADDRGP4 $2106
+ARGP4
+ADDRGP4 $2107
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 968
+CNSTP4 0
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2108
+CNSTI4 1
+ARGI4
+ADDRGP4 $2110
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2104
+JUMPV
+LABELV $2108
+CNSTI4 1
+ARGI4
+ADDRGP4 $2111
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2104
+JUMPV
+LABELV $2103
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $2112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2112
+ADDRLP4 976
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $2112
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 944
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 988
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $2114
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 944
+INDIRF4
+GEF4 $2114
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 996
+CNSTP4 0
+ASGNP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 0
+EQI4 $2116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1008
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1008
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2118
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $2071
+JUMPV
+LABELV $2116
+LABELV $2114
+LABELV $2112
+LABELV $2104
+LABELV $2091
+LABELV $2088
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2070
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+NEI4 $2069
+LABELV $2071
+LABELV $2068
+endproc BotCheckConsoleMessages 1012 48
+export BotCheckForGrenades
+proc BotCheckForGrenades 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2122
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2120
+LABELV $2122
+ADDRGP4 $2119
+JUMPV
+LABELV $2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $2119
+endproc BotCheckForGrenades 8 16
+export BotCheckEvents
+proc BotCheckEvents 168 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 804
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+NEI4 $2124
+ADDRGP4 $2123
+JUMPV
+LABELV $2124
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+CNSTI4 804
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $2128
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $2129
+JUMPV
+LABELV $2128
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $2129
+ADDRLP4 140
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+LTI4 $2130
+ADDRLP4 140
+INDIRI4
+CNSTI4 76
+GTI4 $2130
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2179-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2179
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2131
+address $2130
+address $2130
+address $2130
+address $2164
+address $2130
+address $2130
+address $2165
+address $2143
+address $2151
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2132
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2130
+address $2131
+code
+LABELV $2132
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2133
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 148
+INDIRI4
+EQI4 $2138
+ADDRLP4 160
+INDIRI4
+CNSTI4 1023
+EQI4 $2138
+ADDRLP4 160
+INDIRI4
+CNSTI4 1022
+NEI4 $2135
+LABELV $2138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2136
+JUMPV
+LABELV $2135
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2136
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2133
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2139
+ADDRLP4 160
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+NEI4 $2131
+ADDRLP4 144
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $2131
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2143
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2146
+ADDRLP4 144
+INDIRI4
+CNSTI4 256
+LTI4 $2144
+LABELV $2146
+CNSTI4 3
+ARGI4
+ADDRGP4 $2147
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2131
+JUMPV
+LABELV $2144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2150
+ARGP4
+ADDRLP4 148
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $2131
+JUMPV
+LABELV $2151
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $2131
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2131
+ADDRLP4 144
+INDIRI4
+CNSTI4 5
+GTI4 $2131
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2163
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2163
+address $2157
+address $2158
+address $2159
+address $2160
+address $2161
+address $2162
+code
+LABELV $2157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2158
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2159
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2162
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2164
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2131
+JUMPV
+LABELV $2165
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2131
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2170
+ADDRLP4 144
+INDIRI4
+CNSTI4 256
+LTI4 $2168
+LABELV $2170
+CNSTI4 3
+ARGI4
+ADDRGP4 $2171
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2131
+JUMPV
+LABELV $2168
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2174
+ARGP4
+ADDRLP4 148
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2131
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2131
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $2130
+LABELV $2131
+LABELV $2123
+endproc BotCheckEvents 168 12
+export BotCheckSnapshot
+proc BotCheckSnapshot 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6252
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2183
+JUMPV
+LABELV $2182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+LABELV $2183
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 208
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 -1
+NEI4 $2182
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+180
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+184
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $2181
+endproc BotCheckSnapshot 216 16
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2188
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $2190
+ADDRGP4 $2187
+JUMPV
+LABELV $2190
+LABELV $2188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2187
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2193
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2195
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $2192
+JUMPV
+LABELV $2195
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6688
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2197
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $2197
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2197
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+RETP4
+ADDRGP4 $2192
+JUMPV
+LABELV $2193
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $2192
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2200
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $2201
+JUMPV
+LABELV $2200
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $2201
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2202
+CNSTI4 0
+RETI4
+ADDRGP4 $2199
+JUMPV
+LABELV $2202
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2204
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2204
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6676
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6732
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2199
+endproc BotGetAlternateRouteGoal 28 0
+export BotSetupAlternativeRouteGoals
+proc BotSetupAlternativeRouteGoals 0 0
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $2207
+ADDRGP4 $2206
+JUMPV
+LABELV $2207
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $2206
+endproc BotSetupAlternativeRouteGoals 0 0
+export BotDeathmatchAI
+proc BotDeathmatchAI 1492 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2210
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2212
+ADDRGP4 $2209
+JUMPV
+LABELV $2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $2214
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6020
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2215
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $2215
+ADDRLP4 1316
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $2218
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4756
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $2215
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $2219
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2220
+JUMPV
+LABELV $2219
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $2221
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2222
+JUMPV
+LABELV $2221
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $2222
+LABELV $2220
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $2210
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1464
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1464
+INDIRI4
+CNSTI4 0
+NEI4 $2223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $2223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1468
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1468
+INDIRI4
+CNSTI4 0
+NEI4 $2225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1472
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 0
+NEI4 $2225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $2225
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2229
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $2227
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2230
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $2230
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1480
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 1480
+INDIRI4
+CNSTI4 0
+EQI4 $2232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1488
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1488
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2234
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $2232
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2230
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1484
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1484
+INDIRI4
+CNSTI4 0
+EQI4 $2239
+ADDRGP4 $2237
+JUMPV
+LABELV $2239
+LABELV $2236
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2235
+LABELV $2237
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2241
+ADDRGP4 $2209
+JUMPV
+LABELV $2241
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2243
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $2245
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2243
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2209
+endproc BotDeathmatchAI 1492 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2250
+JUMPV
+LABELV $2247
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2252
+ADDRGP4 $2248
+JUMPV
+LABELV $2252
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2254
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2254
+ADDRGP4 $2248
+JUMPV
+LABELV $2254
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2256
+ADDRGP4 $2248
+JUMPV
+LABELV $2256
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2260
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2246
+JUMPV
+LABELV $2260
+LABELV $2248
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+LABELV $2250
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2247
+LABELV $2246
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2266
+JUMPV
+LABELV $2263
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2268
+ADDRGP4 $2264
+JUMPV
+LABELV $2268
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2270
+ADDRGP4 $2264
+JUMPV
+LABELV $2270
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2274
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2262
+JUMPV
+LABELV $2274
+LABELV $2264
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+LABELV $2266
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2263
+LABELV $2262
+endproc BotSetEntityNumForGoal 36 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $2280
+JUMPV
+LABELV $2277
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1855
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $2281
+ADDRGP4 $2278
+JUMPV
+LABELV $2281
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $2283
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1871
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $2285
+CNSTI4 0
+RETI4
+ADDRGP4 $2276
+JUMPV
+LABELV $2285
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2289
+CNSTI4 0
+RETI4
+ADDRGP4 $2276
+JUMPV
+LABELV $2289
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2276
+JUMPV
+LABELV $2283
+LABELV $2278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $2280
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2277
+CNSTI4 0
+RETI4
+LABELV $2276
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 160 16
+ADDRGP4 $2292
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 maxclients
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 $2293
+ARGP4
+ADDRGP4 $2107
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 $2294
+ARGP4
+ADDRGP4 $2295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $2296
+ARGP4
+ADDRGP4 $2295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $2297
+ARGP4
+ADDRGP4 $2295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $2106
+ARGP4
+ADDRGP4 $2295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $2298
+ARGP4
+ADDRGP4 $2295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $2299
+ARGP4
+ADDRGP4 $2107
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $2300
+ARGP4
+ADDRGP4 $2301
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $2302
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2306
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $2304
+CNSTI4 2
+ARGI4
+ADDRGP4 $2307
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2304
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2310
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $2308
+CNSTI4 2
+ARGI4
+ADDRGP4 $2311
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2308
+LABELV $2302
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $2315
+JUMPV
+LABELV $2312
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2316
+ADDRGP4 $2313
+JUMPV
+LABELV $2316
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $2318
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $2321
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $2321
+LABELV $2318
+LABELV $2313
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+LABELV $2315
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2312
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $2291
+endproc BotSetupDeathmatchAI 160 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $2323
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+import bot_developer
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export bot_predictobstacles
+align 4
+LABELV bot_predictobstacles
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export bot_rocketjump
+align 4
+LABELV bot_rocketjump
+skip 272
+export bot_grapple
+align 4
+LABELV bot_grapple
+skip 272
+export maxclients
+align 4
+LABELV maxclients
+skip 4
+export gametype
+align 4
+LABELV gametype
+skip 4
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_TraceBatch
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2311
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2310
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2307
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2306
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2301
+byte 1 50
+byte 1 0
+align 1
+LABELV $2300
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2299
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2298
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2297
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2296
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2295
+byte 1 48
+byte 1 0
+align 1
+LABELV $2294
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2293
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $2292
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2245
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2234
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2229
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2218
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2214
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2174
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2171
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2150
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2147
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2118
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2111
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $2110
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $2107
+byte 1 49
+byte 1 0
+align 1
+LABELV $2106
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1983
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1982
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1978
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1966
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1965
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1962
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1951
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1938
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1932
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1924
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1913
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1909
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1906
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1871
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1866
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1861
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1858
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1855
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1854
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1842
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1657
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1634
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1631
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $1593
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $1538
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $1534
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $674
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $673
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $672
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $671
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $670
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $503
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $487
+byte 1 116
+byte 1 0
+align 1
+LABELV $328
+byte 1 93
+byte 1 0
+align 1
+LABELV $327
+byte 1 91
+byte 1 0
+align 1
+LABELV $326
+byte 1 32
+byte 1 0
+align 1
+LABELV $283
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $278
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $277
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $272
+byte 1 110
+byte 1 0
+align 1
+LABELV $271
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $270
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $189
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $164
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $163
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $162
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $139
+byte 1 110
+byte 1 111
+byte 1 0
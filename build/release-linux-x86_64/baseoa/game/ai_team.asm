@@ -0,0 +1,6518 @@
+export BotValidTeamLeader
+code
+proc BotValidTeamLeader 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 0
+NEU4 $59
+CNSTI4 0
+RETI4
+ADDRGP4 $58
+JUMPV
+LABELV $59
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $61
+CNSTI4 0
+RETI4
+ADDRGP4 $58
+JUMPV
+LABELV $61
+CNSTI4 1
+RETI4
+LABELV $58
+endproc BotValidTeamLeader 8 4
+bss
+align 4
+LABELV $64
+skip 4
+export BotNumTeamMates
+code
+proc BotNumTeamMates 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $64
+INDIRI4
+CNSTI4 0
+NEI4 $65
+ADDRGP4 $67
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $64
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $65
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $71
+JUMPV
+LABELV $68
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+CNSTU4 0
+EQU4 $75
+ADDRLP4 4
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRU4
+CNSTU4 0
+NEU4 $72
+LABELV $75
+ADDRGP4 $69
+JUMPV
+LABELV $72
+ADDRLP4 4
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $76
+ADDRGP4 $69
+JUMPV
+LABELV $76
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $79
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $79
+LABELV $69
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $71
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $64
+INDIRI4
+GEI4 $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $68
+LABELV $81
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $63
+endproc BotNumTeamMates 1064 12
+export BotClientTravelTimeToGoal
+proc BotClientTravelTimeToGoal 480 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $84
+CNSTI4 1
+RETI4
+ADDRGP4 $82
+JUMPV
+LABELV $84
+ADDRLP4 468
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+RETI4
+LABELV $82
+endproc BotClientTravelTimeToGoal 480 16
+bss
+align 4
+LABELV $88
+skip 4
+export BotSortTeamMatesByBaseTravelTime
+code
+proc BotSortTeamMatesByBaseTravelTime 1352 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+CNSTP4 0
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $89
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 1
+NEI4 $91
+ADDRLP4 1300
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 1300
+ADDRGP4 ctf_blueflag
+ASGNP4
+LABELV $92
+LABELV $89
+ADDRGP4 $88
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRGP4 $67
+ARGP4
+ADDRLP4 1304
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $88
+ADDRLP4 1304
+INDIRI4
+ASGNI4
+LABELV $93
+ADDRLP4 1308
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $95
+ADDRLP4 268
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1312
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1312
+INDIRU4
+CNSTU4 0
+EQU4 $101
+ADDRLP4 276
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+ADDRLP4 1320
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1320
+INDIRU4
+CNSTU4 0
+NEU4 $99
+LABELV $101
+ADDRGP4 $96
+JUMPV
+LABELV $99
+ADDRLP4 276
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 3
+NEI4 $102
+ADDRGP4 $96
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1332
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+EQI4 $104
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1336
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $106
+ADDRLP4 272
+INDIRI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+GEI4 $110
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRLP4 1340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1340
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $112
+ADDRGP4 $108
+JUMPV
+LABELV $110
+LABELV $107
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $109
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $106
+LABELV $108
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $117
+ADDRGP4 $97
+JUMPV
+LABELV $117
+LABELV $104
+LABELV $96
+ADDRLP4 268
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $98
+ADDRLP4 268
+INDIRI4
+ADDRGP4 $88
+INDIRI4
+GEI4 $119
+ADDRLP4 268
+INDIRI4
+CNSTI4 64
+LTI4 $95
+LABELV $119
+LABELV $97
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $87
+endproc BotSortTeamMatesByBaseTravelTime 1352 12
+export BotSetTeamMateTaskPreference
+proc BotSetTeamMateTaskPreference 36 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $120
+endproc BotSetTeamMateTaskPreference 36 12
+export BotGetTeamMateTaskPreference
+proc BotGetTeamMateTaskPreference 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $123
+CNSTI4 0
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $123
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $126
+CNSTI4 0
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $126
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+RETI4
+LABELV $122
+endproc BotGetTeamMateTaskPreference 40 12
+export BotSortTeamMatesByTaskPreference
+proc BotSortTeamMatesByTaskPreference 804 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 788
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 792
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $134
+ADDRLP4 796
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $136
+ADDRLP4 796
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 276
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 796
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 532
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $137
+LABELV $135
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $130
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 792
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 792
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 792
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 796
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 796
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 532
+ARGP4
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+ADDRLP4 796
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 272
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 268
+INDIRI4
+CVIU4 4
+ADDRLP4 800
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+RETI4
+LABELV $129
+endproc BotSortTeamMatesByTaskPreference 804 12
+export BotSayTeamOrderAlways
+proc BotSayTeamOrderAlways 548 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $140
+LABELV $138
+endproc BotSayTeamOrderAlways 548 20
+export BotSayTeamOrder
+proc BotSayTeamOrder 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $142
+endproc BotSayTeamOrder 0 8
+export BotVoiceChat
+proc BotVoiceChat 0 0
+LABELV $143
+endproc BotVoiceChat 0 0
+export BotVoiceChatOnly
+proc BotVoiceChatOnly 0 0
+LABELV $144
+endproc BotVoiceChatOnly 0 0
+export BotSayVoiceTeamOrder
+proc BotSayVoiceTeamOrder 0 0
+LABELV $145
+endproc BotSayVoiceTeamOrder 0 0
+export BotCTFOrders_BothFlagsNotAtBase
+proc BotCTFOrders_BothFlagsNotAtBase 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+EQI4 $148
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+EQI4 $151
+ADDRLP4 352
+INDIRI4
+CNSTI4 3
+EQI4 $157
+ADDRGP4 $147
+JUMPV
+LABELV $151
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+EQI4 $152
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $153
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $148
+JUMPV
+LABELV $157
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+EQI4 $158
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $159
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $166
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $168
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+EQI4 $169
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $170
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $175
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $175
+ADDRLP4 360
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 360
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 360
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $177
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $179
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $181
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $185
+ADDRGP4 $182
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $166
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $168
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $184
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $181
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $193
+ADDRGP4 $190
+JUMPV
+LABELV $193
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $190
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $189
+LABELV $180
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $195
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $199
+ADDRGP4 $196
+JUMPV
+LABELV $199
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $196
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $198
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $195
+LABELV $148
+LABELV $146
+endproc BotCTFOrders_BothFlagsNotAtBase 368 20
+export BotCTFOrders_FlagNotAtBase
+proc BotCTFOrders_FlagNotAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $206
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $207
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $212
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $218
+ADDRGP4 $208
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $208
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $225
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $225
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $227
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $227
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $229
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $230
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $232
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $229
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $233
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $234
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $236
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $233
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $240
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $243
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $247
+ADDRGP4 $239
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $240
+JUMPV
+LABELV $247
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $254
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $254
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $256
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $256
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $261
+JUMPV
+LABELV $258
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $259
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $261
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $258
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $262
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $263
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $265
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $262
+LABELV $240
+LABELV $207
+LABELV $205
+endproc BotCTFOrders_FlagNotAtBase 320 16
+export BotCTFOrders_EnemyFlagNotAtBase
+proc BotCTFOrders_EnemyFlagNotAtBase 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $271
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $273
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $277
+ADDRGP4 $270
+JUMPV
+LABELV $273
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $274
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $275
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $277
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+EQI4 $278
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $279
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+EQI4 $281
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $282
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRLP4 300
+CNSTF4 1058642330
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 6
+LEI4 $286
+ADDRLP4 300
+CNSTI4 6
+ASGNI4
+LABELV $286
+ADDRLP4 304
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 3
+LEI4 $288
+ADDRLP4 304
+CNSTI4 3
+ASGNI4
+LABELV $288
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $294
+ADDRGP4 $291
+JUMPV
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $291
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $293
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $296
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $298
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $302
+ADDRGP4 $299
+JUMPV
+LABELV $302
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $166
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $168
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $299
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $301
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $298
+ADDRGP4 $271
+JUMPV
+LABELV $296
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $314
+JUMPV
+LABELV $311
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+NEI4 $315
+ADDRGP4 $312
+JUMPV
+LABELV $315
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $312
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $314
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $311
+LABELV $271
+LABELV $269
+endproc BotCTFOrders_EnemyFlagNotAtBase 360 20
+export BotCTFOrders_BothFlagsAtBase
+proc BotCTFOrders_BothFlagsAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $322
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $323
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $327
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $331
+ADDRGP4 $324
+JUMPV
+LABELV $327
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $331
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $324
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $338
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $338
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $340
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $340
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $342
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $343
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $345
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $342
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $346
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $347
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $349
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $346
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $354
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $356
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $360
+ADDRGP4 $353
+JUMPV
+LABELV $356
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $360
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $367
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $367
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $369
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $369
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $371
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $372
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $374
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $371
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $375
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $376
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $378
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $375
+LABELV $354
+LABELV $323
+LABELV $321
+endproc BotCTFOrders_BothFlagsAtBase 320 16
+export BotCTFOrders
+proc BotCTFOrders 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $383
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $384
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $385
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $385
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $391
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $391
+address $387
+address $388
+address $389
+address $390
+code
+LABELV $387
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsAtBase
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_EnemyFlagNotAtBase
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $389
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_FlagNotAtBase
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsNotAtBase
+CALLV
+pop
+LABELV $385
+LABELV $386
+LABELV $382
+endproc BotCTFOrders 20 4
+export BotCreateGroup
+proc BotCreateGroup 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $393
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $396
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $393
+LABELV $392
+endproc BotCreateGroup 76 20
+bss
+align 4
+LABELV $400
+skip 4
+export BotTeamOrders
+code
+proc BotTeamOrders 1320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $400
+INDIRI4
+CNSTI4 0
+NEI4 $401
+ADDRGP4 $67
+ARGP4
+ADDRLP4 1288
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $400
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRGP4 $406
+JUMPV
+LABELV $403
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1296
+INDIRU4
+CNSTU4 0
+EQU4 $409
+ADDRLP4 4
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1304
+INDIRU4
+CNSTU4 0
+NEU4 $407
+LABELV $409
+ADDRGP4 $404
+JUMPV
+LABELV $407
+ADDRLP4 4
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 3
+NEI4 $410
+ADDRGP4 $404
+JUMPV
+LABELV $410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1032
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $412
+LABELV $404
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $406
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $400
+INDIRI4
+GEI4 $414
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $403
+LABELV $414
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $415
+ADDRLP4 1028
+INDIRI4
+CNSTI4 5
+GTI4 $415
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $430-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $430
+address $416
+address $416
+address $419
+address $420
+address $422
+code
+LABELV $419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 1028
+INDIRI4
+CNSTI4 10
+GTI4 $416
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1304
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1304
+INDIRI4
+LSHI4
+ADDRLP4 1032
+ADDP4
+ARGP4
+ADDRLP4 1304
+INDIRI4
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+LABELV $427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $429
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $426
+LABELV $416
+LABELV $399
+endproc BotTeamOrders 1320 12
+export FindHumanTeamLeader
+proc FindHumanTeamLeader 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $433
+CNSTI4 804
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $437
+CNSTI4 804
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $440
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $448
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotVoiceChat_Defend
+CALLV
+pop
+LABELV $448
+CNSTI4 1
+RETI4
+ADDRGP4 $432
+JUMPV
+LABELV $446
+LABELV $444
+LABELV $440
+LABELV $437
+LABELV $434
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $433
+CNSTI4 0
+RETI4
+LABELV $432
+endproc FindHumanTeamLeader 12 12
+export BotTeamAI
+proc BotTeamAI 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $451
+ADDRGP4 $450
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotValidTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 FindHumanTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6928
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $459
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6928
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $460
+LABELV $457
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6928
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $461
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $461
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $463
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6928
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $461
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $450
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $466
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $450
+JUMPV
+LABELV $455
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6928
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $468
+ADDRGP4 $450
+JUMPV
+LABELV $468
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotNumTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+EQI4 $472
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+EQI4 $478
+ADDRGP4 $470
+JUMPV
+LABELV $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $473
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $473
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $471
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $471
+JUMPV
+LABELV $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $482
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $479
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $485
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $485
+LABELV $483
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $471
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $470
+LABELV $471
+LABELV $450
+endproc BotTeamAI 72 12
+bss
+export ctftaskpreferences
+align 4
+LABELV ctftaskpreferences
+skip 2560
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_TraceBatch
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_TraceBatch
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MoveClientToIntermission
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $467
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $466
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $463
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $214
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $213
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $174
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $168
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $167
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $166
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $156
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $141
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $78
+byte 1 116
+byte 1 0
+align 1
+LABELV $74
+byte 1 110
+byte 1 0
+align 1
+LABELV $67
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
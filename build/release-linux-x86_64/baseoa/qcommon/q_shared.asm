@@ -0,0 +1,5962 @@
+export Com_Clamp
+code
+proc Com_Clamp 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $28
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $27
+JUMPV
+LABELV $28
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $30
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $27
+JUMPV
+LABELV $30
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $27
+endproc Com_Clamp 0 0
+export COM_SkipPath
+proc COM_SkipPath 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $34
+JUMPV
+LABELV $33
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $36
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $34
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $33
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $32
+endproc COM_SkipPath 4 0
+export COM_GetExtension
+proc COM_GetExtension 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $39
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $41
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $39
+LABELV $41
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+RETP4
+ADDRGP4 $38
+JUMPV
+LABELV $39
+ADDRGP4 $42
+RETP4
+LABELV $38
+endproc COM_GetExtension 16 8
+export COM_StripExtension
+proc COM_StripExtension 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $44
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $46
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $44
+LABELV $46
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+GEI4 $48
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $49
+JUMPV
+LABELV $48
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $49
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $45
+JUMPV
+LABELV $44
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $45
+LABELV $43
+endproc COM_StripExtension 24 12
+export COM_CompareExtension
+proc COM_CompareExtension 20 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $51
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $53
+CNSTI4 1
+RETI4
+ADDRGP4 $50
+JUMPV
+LABELV $53
+LABELV $51
+CNSTI4 0
+RETI4
+LABELV $50
+endproc COM_CompareExtension 20 8
+export COM_DefaultExtension
+proc COM_DefaultExtension 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $56
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $58
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $56
+LABELV $58
+ADDRGP4 $55
+JUMPV
+LABELV $56
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $55
+endproc COM_DefaultExtension 16 12
+export CopyShortSwap
+proc CopyShortSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $59
+endproc CopyShortSwap 8 0
+export CopyLongSwap
+proc CopyLongSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $60
+endproc CopyLongSwap 8 0
+export ShortSwap
+proc ShortSwap 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 4
+ADDRFP4 0
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $61
+endproc ShortSwap 16 0
+export ShortNoSwap
+proc ShortNoSwap 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRI2
+CVII4 2
+RETI4
+LABELV $62
+endproc ShortNoSwap 0 0
+export LongSwap
+proc LongSwap 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 2
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 3
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 2
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 3
+INDIRU1
+CVUI4 1
+ADDI4
+RETI4
+LABELV $63
+endproc LongSwap 24 0
+export LongNoSwap
+proc LongNoSwap 0 0
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $64
+endproc LongNoSwap 0 0
+export Long64Swap
+proc Long64Swap 12 0
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 7
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRP4
+CNSTI4 6
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+2
+ADDRFP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+3
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+5
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+6
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+7
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 8
+LABELV $65
+endproc Long64Swap 12 0
+export Long64NoSwap
+proc Long64NoSwap 0 0
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 8
+LABELV $74
+endproc Long64NoSwap 0 0
+export FloatSwap
+proc FloatSwap 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 LongSwap
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $76
+endproc FloatSwap 8 4
+export FloatNoSwap
+proc FloatNoSwap 0 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+RETF4
+LABELV $77
+endproc FloatNoSwap 0 0
+export COM_BeginParseSession
+proc COM_BeginParseSession 0 16
+ADDRGP4 com_lines
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_parsename
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $79
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $78
+endproc COM_BeginParseSession 0 16
+export COM_GetCurrentParseLine
+proc COM_GetCurrentParseLine 0 0
+ADDRGP4 com_lines
+INDIRI4
+RETI4
+LABELV $80
+endproc COM_GetCurrentParseLine 0 0
+export COM_Parse
+proc COM_Parse 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $81
+endproc COM_Parse 4 8
+bss
+align 1
+LABELV $83
+skip 4096
+export COM_ParseError
+code
+proc COM_ParseError 4 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $83
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $85
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRGP4 com_lines
+INDIRI4
+ARGI4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $82
+endproc COM_ParseError 4 16
+bss
+align 1
+LABELV $87
+skip 4096
+export COM_ParseWarning
+code
+proc COM_ParseWarning 4 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $87
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $89
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRGP4 com_lines
+INDIRI4
+ARGI4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $86
+endproc COM_ParseWarning 4 16
+proc SkipWhitespace 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $94
+CNSTP4 0
+RETP4
+ADDRGP4 $90
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $96
+ADDRLP4 4
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $96
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $92
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LEI4 $91
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $90
+endproc SkipWhitespace 12 0
+export COM_Compress
+proc COM_Compress 60 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $99
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 71
+NEI4 $104
+ADDRLP4 32
+CNSTI4 76
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 83
+NEI4 $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 6
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $106
+LABELV $108
+ADDRGP4 $103
+JUMPV
+LABELV $106
+LABELV $104
+ADDRLP4 36
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $109
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $109
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $112
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $114
+ADDRLP4 40
+INDIRI4
+CNSTI4 10
+NEI4 $111
+LABELV $114
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $115
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $115
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $118
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $120
+ADDRLP4 44
+INDIRI4
+CNSTI4 42
+NEI4 $117
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $117
+LABELV $120
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $116
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $125
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $123
+LABELV $125
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+EQI4 $128
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $126
+LABELV $128
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $129
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $131
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $131
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $133
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $137
+ADDRLP4 56
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 56
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $139
+LABELV $136
+ADDRGP4 $135
+JUMPV
+LABELV $137
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $134
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $134
+LABELV $127
+LABELV $124
+LABELV $116
+LABELV $110
+LABELV $102
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $101
+LABELV $103
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $99
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $98
+endproc COM_Compress 60 0
+export COM_ParseExt
+proc COM_ParseExt 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_token
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $146
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $142
+JUMPV
+LABELV $145
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ADDRGP4 SkipWhitespace
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $148
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $142
+JUMPV
+LABELV $148
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $150
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $150
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $142
+JUMPV
+LABELV $150
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $152
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $152
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 71
+NEI4 $152
+ADDRLP4 32
+CNSTI4 76
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $152
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 83
+NEI4 $152
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+NEI4 $152
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 6
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $154
+LABELV $156
+ADDRGP4 $147
+JUMPV
+LABELV $154
+LABELV $152
+ADDRLP4 36
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $157
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $160
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $162
+ADDRLP4 40
+INDIRI4
+CNSTI4 10
+NEI4 $159
+LABELV $162
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $147
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $166
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $168
+ADDRLP4 44
+INDIRI4
+CNSTI4 42
+NEI4 $165
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $165
+LABELV $168
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $164
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $164
+LABELV $158
+LABELV $146
+ADDRGP4 $145
+JUMPV
+LABELV $147
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $171
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $178
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $176
+LABELV $178
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $142
+JUMPV
+LABELV $176
+ADDRLP4 8
+INDIRI4
+CNSTI4 1023
+GEI4 $179
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $179
+LABELV $174
+ADDRGP4 $173
+JUMPV
+LABELV $171
+LABELV $181
+ADDRLP4 8
+INDIRI4
+CNSTI4 1023
+GEI4 $184
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $184
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+NEI4 $186
+ADDRLP4 16
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $186
+LABELV $182
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+GTI4 $181
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+LABELV $142
+endproc COM_ParseExt 48 8
+export COM_MatchToken
+proc COM_MatchToken 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $189
+CNSTI4 1
+ARGI4
+ADDRGP4 $191
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $189
+LABELV $188
+endproc COM_MatchToken 12 16
+export SkipBracedSection
+proc SkipBracedSection 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $193
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $196
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $198
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $200
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $200
+LABELV $199
+LABELV $196
+LABELV $194
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $202
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $193
+LABELV $202
+LABELV $192
+endproc SkipBracedSection 12 8
+export SkipRestOfLine
+proc SkipRestOfLine 16 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $207
+ADDRLP4 8
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $206
+JUMPV
+LABELV $207
+LABELV $205
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $204
+LABELV $206
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $203
+endproc SkipRestOfLine 16 0
+export Parse1DMatrix
+proc Parse1DMatrix 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $212
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $209
+endproc Parse1DMatrix 16 8
+export Parse2DMatrix
+proc Parse2DMatrix 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $220
+JUMPV
+LABELV $217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse1DMatrix
+CALLV
+pop
+LABELV $218
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $220
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $216
+endproc Parse2DMatrix 8 12
+export Parse3DMatrix
+proc Parse3DMatrix 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse2DMatrix
+CALLV
+pop
+LABELV $223
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $225
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $221
+endproc Parse3DMatrix 12 16
+export Com_HexStrToInt
+proc Com_HexStrToInt 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+LABELV $229
+CNSTI4 -1
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 120
+NEI4 $230
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $232
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 24
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $236
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+GTI4 $236
+ADDRLP4 16
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVII1 4
+ASGNI1
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRLP4 28
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 97
+LTI4 $238
+ADDRLP4 28
+INDIRI4
+CNSTI4 102
+GTI4 $238
+ADDRLP4 16
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+CNSTI4 10
+ADDI4
+CVII1 4
+ASGNI1
+ADDRGP4 $239
+JUMPV
+LABELV $238
+CNSTI4 -1
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $239
+LABELV $237
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+LABELV $233
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 16
+INDIRU4
+LTU4 $232
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $230
+CNSTI4 -1
+RETI4
+LABELV $226
+endproc Com_HexStrToInt 32 4
+export Q_isprint
+proc Q_isprint 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $241
+ADDRLP4 0
+INDIRI4
+CNSTI4 126
+GTI4 $241
+CNSTI4 1
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $241
+CNSTI4 0
+RETI4
+LABELV $240
+endproc Q_isprint 4 0
+export Q_islower
+proc Q_islower 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $244
+CNSTI4 1
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $244
+CNSTI4 0
+RETI4
+LABELV $243
+endproc Q_islower 4 0
+export Q_isupper
+proc Q_isupper 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $247
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $247
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $247
+CNSTI4 0
+RETI4
+LABELV $246
+endproc Q_isupper 4 0
+export Q_isalpha
+proc Q_isalpha 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $253
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+LEI4 $252
+LABELV $253
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $250
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $250
+LABELV $252
+CNSTI4 1
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $250
+CNSTI4 0
+RETI4
+LABELV $249
+endproc Q_isalpha 8 0
+export Q_isanumber
+proc Q_isanumber 16 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $255
+CNSTI4 0
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 strtod
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $258
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $259
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $254
+endproc Q_isanumber 16 8
+export Q_isintegral
+proc Q_isintegral 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+NEF4 $262
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $263
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $260
+endproc Q_isintegral 8 0
+export Q_strncpyz
+proc Q_strncpyz 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $265
+CNSTI4 0
+ARGI4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $265
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $268
+CNSTI4 0
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $268
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $271
+CNSTI4 0
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $271
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $264
+endproc Q_strncpyz 0 12
+export Q_stricmpn
+proc Q_stricmpn 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $275
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $277
+CNSTI4 0
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $277
+CNSTI4 -1
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $275
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $279
+CNSTI4 1
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $279
+LABELV $281
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $284
+CNSTI4 0
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $284
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $288
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $288
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+LTI4 $290
+ADDRLP4 4
+INDIRI4
+CNSTI4 122
+GTI4 $290
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $290
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $292
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $295
+ADDRLP4 32
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $296
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $292
+LABELV $286
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $281
+CNSTI4 0
+RETI4
+LABELV $274
+endproc Q_stricmpn 36 0
+export Q_strncmp
+proc Q_strncmp 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $298
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $301
+CNSTI4 0
+RETI4
+ADDRGP4 $297
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $303
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $306
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $307
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $297
+JUMPV
+LABELV $303
+LABELV $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $298
+CNSTI4 0
+RETI4
+LABELV $297
+endproc Q_strncmp 28 0
+export Q_stricmp
+proc Q_stricmp 12 12
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $310
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $311
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $308
+endproc Q_stricmp 12 12
+export Q_strlwr
+proc Q_strlwr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $314
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $313
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $312
+endproc Q_strlwr 12 4
+export Q_strupr
+proc Q_strupr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $318
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $317
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $316
+endproc Q_strupr 12 4
+export Q_strcat
+proc Q_strcat 12 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $321
+CNSTI4 0
+ARGI4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $321
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $320
+endproc Q_strcat 12 12
+export Q_stristr
+proc Q_stristr 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $325
+ADDRLP4 16
+ADDRLP4 1
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $327
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+GTI4 $327
+ADDRLP4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $327
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 20
+INDIRU4
+ASGNU4
+LABELV $329
+LABELV $332
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 28
+INDIRI1
+ASGNI1
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $335
+CNSTP4 0
+RETP4
+ADDRGP4 $324
+JUMPV
+LABELV $335
+ADDRLP4 32
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $337
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+GTI4 $337
+ADDRLP4 0
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $337
+LABELV $333
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+NEI4 $332
+LABELV $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $325
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $324
+endproc Q_stristr 36 12
+export Q_PrintStrlen
+proc Q_PrintStrlen 20 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $340
+CNSTI4 0
+RETI4
+ADDRGP4 $339
+JUMPV
+LABELV $340
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $345
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $345
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+LTI4 $345
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+GTI4 $345
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $343
+JUMPV
+LABELV $345
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $343
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $342
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $339
+endproc Q_PrintStrlen 20 0
+export Q_CleanStr
+proc Q_CleanStr 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $351
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $351
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $351
+ADDRLP4 20
+INDIRI4
+CNSTI4 56
+GTI4 $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $353
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+GTI4 $353
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $353
+LABELV $352
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $349
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $347
+endproc Q_CleanStr 32 0
+export Q_CountChar
+proc Q_CountChar 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $356
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $360
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $360
+LABELV $357
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $359
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $356
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $355
+endproc Q_CountChar 4 0
+export Com_sprintf
+proc Com_sprintf 12 16
+ADDRLP4 4
+ADDRFP4 8+4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $364
+ADDRGP4 $366
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $364
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $362
+endproc Com_sprintf 12 16
+bss
+align 1
+LABELV $368
+skip 64000
+data
+align 4
+LABELV $369
+byte 4 0
+export va
+code
+proc va 20 16
+ADDRLP4 8
+ADDRGP4 $369
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 32000
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+MULI4
+ADDRGP4 $368
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTU4 32000
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $367
+endproc va 20 16
+export Com_TruncateLongString
+proc Com_TruncateLongString 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GTI4 $372
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 29
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $374
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 -29
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $373
+LABELV $371
+endproc Com_TruncateLongString 8 12
+bss
+align 1
+LABELV $376
+skip 16384
+data
+align 4
+LABELV $377
+byte 4 0
+export Info_ValueForKey
+code
+proc Info_ValueForKey 8220 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8196
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+EQU4 $380
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+NEU4 $378
+LABELV $380
+ADDRGP4 $42
+RETP4
+ADDRGP4 $375
+JUMPV
+LABELV $378
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8200
+INDIRU4
+CNSTU4 8192
+LTU4 $381
+CNSTI4 1
+ARGI4
+ADDRGP4 $383
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $381
+ADDRLP4 8204
+ADDRGP4 $377
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $387
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $392
+ADDRGP4 $42
+RETP4
+ADDRGP4 $375
+JUMPV
+LABELV $392
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $390
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $389
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $377
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $376
+ADDP4
+ASGNP4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $395
+ADDRLP4 8208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 92
+EQI4 $397
+ADDRLP4 8208
+INDIRI4
+CNSTI4 0
+NEI4 $394
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8212
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRGP4 $377
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $376
+ADDP4
+RETP4
+ADDRGP4 $375
+JUMPV
+LABELV $398
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $400
+ADDRGP4 $388
+JUMPV
+LABELV $400
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $387
+ADDRGP4 $386
+JUMPV
+LABELV $388
+ADDRGP4 $42
+RETP4
+LABELV $375
+endproc Info_ValueForKey 8220 8
+export Info_NextPair
+proc Info_NextPair 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $403
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $403
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $408
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $402
+JUMPV
+LABELV $408
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $406
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $405
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $411
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 92
+EQI4 $413
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $410
+LABELV $413
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $402
+endproc Info_NextPair 20 0
+export Info_RemoveKey
+proc Info_RemoveKey 2080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2056
+INDIRU4
+CNSTU4 1024
+LTU4 $415
+CNSTI4 1
+ARGI4
+ADDRGP4 $417
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $415
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 2060
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $421
+ADDRGP4 $414
+JUMPV
+LABELV $420
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $423
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $423
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $428
+ADDRGP4 $414
+JUMPV
+LABELV $428
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $426
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $425
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $433
+ADDRGP4 $414
+JUMPV
+LABELV $433
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $431
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 92
+EQI4 $435
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $430
+LABELV $435
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $414
+JUMPV
+LABELV $436
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $438
+ADDRGP4 $414
+JUMPV
+LABELV $438
+LABELV $421
+ADDRGP4 $420
+JUMPV
+LABELV $414
+endproc Info_RemoveKey 2080 12
+export Info_RemoveKey_Big
+proc Info_RemoveKey_Big 16416 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16392
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16392
+INDIRU4
+CNSTU4 8192
+LTU4 $441
+CNSTI4 1
+ARGI4
+ADDRGP4 $443
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $441
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 16396
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $447
+ADDRGP4 $440
+JUMPV
+LABELV $446
+ADDRLP4 8196
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $449
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $449
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $454
+ADDRGP4 $440
+JUMPV
+LABELV $454
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $452
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $451
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8200
+ASGNP4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $459
+ADDRGP4 $440
+JUMPV
+LABELV $459
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $457
+ADDRLP4 16404
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16404
+INDIRI4
+CNSTI4 92
+EQI4 $461
+ADDRLP4 16404
+INDIRI4
+CNSTI4 0
+NEI4 $456
+LABELV $461
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16408
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+NEI4 $462
+ADDRLP4 8196
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $464
+ADDRGP4 $440
+JUMPV
+LABELV $464
+LABELV $447
+ADDRGP4 $446
+JUMPV
+LABELV $440
+endproc Info_RemoveKey_Big 16416 8
+export Info_Validate
+proc Info_Validate 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 0
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $467
+CNSTI4 0
+RETI4
+ADDRGP4 $466
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $469
+CNSTI4 0
+RETI4
+ADDRGP4 $466
+JUMPV
+LABELV $469
+CNSTI4 1
+RETI4
+LABELV $466
+endproc Info_Validate 8 8
+export Info_SetValueForKey
+proc Info_SetValueForKey 1048 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $472
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+INDIRU4
+CNSTU4 1024
+LTU4 $479
+CNSTI4 1
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $479
+JUMPV
+LABELV $476
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $482
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $480
+LABELV $482
+ADDRGP4 $483
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $480
+LABELV $477
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $479
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $476
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $486
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 0
+NEU4 $484
+LABELV $486
+ADDRGP4 $471
+JUMPV
+LABELV $484
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+ADDRLP4 1044
+INDIRU4
+ADDU4
+CNSTU4 1024
+LTU4 $488
+ADDRGP4 $490
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $488
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $471
+endproc Info_SetValueForKey 1048 20
+export Info_SetValueForKey_Big
+proc Info_SetValueForKey_Big 8208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $472
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8196
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8196
+INDIRU4
+CNSTU4 8192
+LTU4 $497
+CNSTI4 1
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $494
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8200
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8200
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $500
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8204
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+LABELV $500
+ADDRGP4 $483
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $498
+LABELV $495
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $497
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey_Big
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $501
+ADDRGP4 $491
+JUMPV
+LABELV $501
+ADDRLP4 4
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8200
+INDIRU4
+ADDRLP4 8204
+INDIRU4
+ADDU4
+CNSTU4 8192
+LTU4 $503
+ADDRGP4 $505
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $491
+endproc Info_SetValueForKey_Big 8208 20
+proc Com_CharIsOneOfCharset 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $507
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRFP4 0
+INDIRI1
+CVII4 1
+NEI4 $511
+CNSTI4 1
+RETI4
+ADDRGP4 $506
+JUMPV
+LABELV $511
+LABELV $508
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $510
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRU4
+LTU4 $507
+CNSTI4 0
+RETI4
+LABELV $506
+endproc Com_CharIsOneOfCharset 8 4
+export Com_SkipCharset
+proc Com_SkipCharset 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $518
+LABELV $515
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $514
+LABELV $516
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $513
+endproc Com_SkipCharset 8 8
+export Com_SkipTokens
+proc Com_SkipTokens 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $523
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $526
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $525
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $528
+ADDRGP4 $522
+JUMPV
+LABELV $528
+LABELV $524
+LABELV $521
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $520
+LABELV $522
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $530
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $519
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $519
+endproc Com_SkipTokens 20 8
+bss
+align 4
+LABELV com_lines
+skip 4
+align 1
+LABELV com_parsename
+skip 1024
+align 1
+LABELV com_token
+skip 1024
+import Com_Printf
+import Com_Error
+import Com_RandomBytes
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $505
+byte 1 66
+byte 1 73
+byte 1 71
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $490
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $487
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $483
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $475
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $472
+byte 1 92
+byte 1 59
+byte 1 34
+byte 1 0
+align 1
+LABELV $443
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $417
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $383
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $374
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $366
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $323
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $273
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $270
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 115
+byte 1 114
+byte 1 99
+byte 1 0
+align 1
+LABELV $267
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $215
+byte 1 41
+byte 1 0
+align 1
+LABELV $210
+byte 1 40
+byte 1 0
+align 1
+LABELV $191
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $89
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $85
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $79
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $42
+byte 1 0
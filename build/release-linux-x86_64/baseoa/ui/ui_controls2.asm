@@ -0,0 +1,6795 @@
+data
+align 4
+LABELV controls_binding_color
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV g_bindings
+address $75
+address $76
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $77
+address $78
+byte 4 1
+byte 4 0
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $79
+address $80
+byte 4 2
+byte 4 1
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $81
+address $82
+byte 4 3
+byte 4 2
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $83
+address $84
+byte 4 4
+byte 4 3
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $85
+address $86
+byte 4 5
+byte 4 6
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $87
+address $88
+byte 4 6
+byte 4 7
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $89
+address $90
+byte 4 7
+byte 4 4
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $91
+address $92
+byte 4 8
+byte 4 5
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $93
+address $94
+byte 4 9
+byte 4 8
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $95
+address $96
+byte 4 10
+byte 4 9
+byte 4 135
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $97
+address $98
+byte 4 11
+byte 4 0
+byte 4 136
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $99
+address $100
+byte 4 12
+byte 4 10
+byte 4 141
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $101
+address $102
+byte 4 13
+byte 4 11
+byte 4 140
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $103
+address $104
+byte 4 14
+byte 4 0
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $105
+address $106
+byte 4 15
+byte 4 0
+byte 4 144
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $107
+address $108
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $109
+address $110
+byte 4 17
+byte 4 12
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $111
+address $112
+byte 4 18
+byte 4 13
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $113
+address $114
+byte 4 19
+byte 4 14
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $115
+address $116
+byte 4 20
+byte 4 15
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $117
+address $118
+byte 4 21
+byte 4 16
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $119
+address $120
+byte 4 22
+byte 4 17
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $121
+address $122
+byte 4 23
+byte 4 18
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $123
+address $124
+byte 4 24
+byte 4 19
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $125
+address $126
+byte 4 25
+byte 4 20
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $127
+address $128
+byte 4 26
+byte 4 22
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $129
+address $130
+byte 4 27
+byte 4 0
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $131
+address $132
+byte 4 28
+byte 4 0
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $133
+address $134
+byte 4 29
+byte 4 23
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $135
+address $136
+byte 4 30
+byte 4 25
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $137
+address $138
+byte 4 31
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $139
+address $140
+byte 4 32
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $141
+address $142
+byte 4 33
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_configcvars
+address $143
+byte 4 0
+byte 4 0
+address $144
+byte 4 0
+byte 4 0
+address $145
+byte 4 0
+byte 4 0
+address $146
+byte 4 0
+byte 4 0
+address $147
+byte 4 0
+byte 4 0
+address $148
+byte 4 0
+byte 4 0
+address $149
+byte 4 0
+byte 4 0
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV g_movement_controls
+address s_controls+2860
+address s_controls+1452
+address s_controls+912
+address s_controls+972
+address s_controls+1032
+address s_controls+1092
+address s_controls+1152
+address s_controls+1212
+address s_controls+1272
+address s_controls+1332
+address s_controls+1392
+byte 4 0
+align 4
+LABELV g_weapons_controls
+address s_controls+2052
+address s_controls+2172
+address s_controls+2112
+address s_controls+2984
+address s_controls+1572
+address s_controls+1512
+address s_controls+1632
+address s_controls+1692
+address s_controls+1752
+address s_controls+1812
+address s_controls+1872
+address s_controls+1932
+address s_controls+1992
+byte 4 0
+align 4
+LABELV g_looking_controls
+address s_controls+2720
+address s_controls+2796
+address s_controls+2656
+address s_controls+2232
+address s_controls+2292
+address s_controls+2352
+address s_controls+2412
+address s_controls+2476
+address s_controls+2536
+address s_controls+4476
+address s_controls+4540
+byte 4 0
+align 4
+LABELV g_misc_controls
+address s_controls+2924
+address s_controls+3048
+address s_controls+2596
+address s_controls+4236
+address s_controls+4296
+address s_controls+4356
+address s_controls+4416
+byte 4 0
+align 4
+LABELV g_controls
+address g_movement_controls
+address g_looking_controls
+address g_weapons_controls
+address g_misc_controls
+code
+proc Controls_InitCvars 28 8
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $194
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $198
+ADDRGP4 $196
+JUMPV
+LABELV $198
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $195
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $194
+JUMPV
+LABELV $196
+LABELV $193
+endproc Controls_InitCvars 28 8
+proc Controls_GetCvarDefault 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $205
+CNSTF4 0
+RETF4
+ADDRGP4 $200
+JUMPV
+LABELV $205
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $207
+ADDRGP4 $203
+JUMPV
+LABELV $207
+LABELV $202
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $203
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+RETF4
+LABELV $200
+endproc Controls_GetCvarDefault 12 8
+proc Controls_GetCvarValue 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $210
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $214
+CNSTF4 0
+RETF4
+ADDRGP4 $209
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $216
+ADDRGP4 $212
+JUMPV
+LABELV $216
+LABELV $211
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $210
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+RETF4
+LABELV $209
+endproc Controls_GetCvarValue 12 8
+proc Controls_UpdateModel 20 28
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+4688+8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4688+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4688
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+4700+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4700+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4700
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4688+4
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 s_controls+4700+4
+ADDRGP4 s_controls+4688+4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+4712
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+4716
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+4720
+CNSTI4 -1
+ASGNI4
+ADDRGP4 s_controls+4724
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $240
+ADDRLP4 8
+INDIRI4
+CNSTI4 25
+GTI4 $240
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $303-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $303
+address $241
+address $243
+address $245
+address $247
+address $249
+address $257
+address $263
+address $251
+address $254
+address $269
+address $271
+address $273
+address $275
+address $277
+address $279
+address $281
+address $283
+address $285
+address $287
+address $289
+address $291
+address $293
+address $295
+address $297
+address $301
+code
+LABELV $241
+ADDRGP4 s_controls+4712
+CNSTI4 15
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $243
+ADDRGP4 s_controls+4712
+CNSTI4 14
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $245
+ADDRGP4 s_controls+4712
+CNSTI4 16
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $247
+ADDRGP4 s_controls+4712
+CNSTI4 18
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $249
+ADDRGP4 s_controls+4712
+CNSTI4 23
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $251
+ADDRLP4 12
+ADDRGP4 s_controls+4688+4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $254
+ADDRLP4 16
+ADDRGP4 s_controls+4688+4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $257
+ADDRGP4 s_controls+4712
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+4700+4
+ADDRGP4 s_controls+4688+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $263
+ADDRGP4 s_controls+4712
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+4700+4
+ADDRGP4 s_controls+4688+4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $269
+ADDRGP4 s_controls+4688
+CNSTF4 3258187776
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $271
+ADDRGP4 s_controls+4688
+CNSTF4 1110704128
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $273
+ADDRGP4 s_controls+4720
+CNSTI4 1
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $275
+ADDRGP4 s_controls+4720
+CNSTI4 2
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $277
+ADDRGP4 s_controls+4720
+CNSTI4 3
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $279
+ADDRGP4 s_controls+4720
+CNSTI4 4
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $281
+ADDRGP4 s_controls+4720
+CNSTI4 5
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $283
+ADDRGP4 s_controls+4720
+CNSTI4 6
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $285
+ADDRGP4 s_controls+4720
+CNSTI4 7
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $287
+ADDRGP4 s_controls+4720
+CNSTI4 8
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $289
+ADDRGP4 s_controls+4720
+CNSTI4 9
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $291
+ADDRGP4 s_controls+4720
+CNSTI4 10
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $293
+ADDRGP4 s_controls+4716
+CNSTI4 7
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $295
+ADDRGP4 s_controls+4716
+CNSTI4 6
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $297
+ADDRGP4 s_controls+4712
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+4716
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+4720
+CNSTI4 0
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $301
+ADDRGP4 s_controls+4724
+CNSTI4 1
+ASGNI4
+LABELV $240
+ADDRGP4 s_controls+3108
+ARGP4
+ADDRGP4 s_controls+4712
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+4716
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+4688
+ARGP4
+ADDRGP4 s_controls+4700
+ARGP4
+ADDRGP4 s_controls+4720
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+4724
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $218
+endproc Controls_UpdateModel 20 28
+proc Controls_Update 96 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $313
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $317
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $318
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $320
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $317
+LABELV $314
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $313
+ADDRLP4 8
+ADDRGP4 s_controls+4616
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $322
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294938623
+BANDU4
+ASGNU4
+LABELV $323
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $325
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $322
+ADDRLP4 16
+CNSTI4 480
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $329
+JUMPV
+LABELV $326
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 320
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 488
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $329
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $326
+ADDRGP4 s_controls+4620
+INDIRI4
+CNSTI4 0
+EQI4 $330
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $333
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $334
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $336
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $333
+ADDRLP4 28
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+4816+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $312
+JUMPV
+LABELV $330
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $342
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $343
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $345
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $342
+ADDRLP4 28
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 s_controls+4616
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $364
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+GTI4 $364
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $387
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $387
+address $367
+address $372
+address $377
+address $382
+code
+LABELV $367
+ADDRLP4 64
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $365
+JUMPV
+LABELV $372
+ADDRLP4 72
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $365
+JUMPV
+LABELV $377
+ADDRLP4 80
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 84
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $365
+JUMPV
+LABELV $382
+ADDRLP4 88
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 92
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+LABELV $364
+LABELV $365
+LABELV $312
+endproc Controls_Update 96 0
+proc Controls_DrawKeyBinding 120 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+NEU4 $390
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+LABELV $391
+ADDRLP4 48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 -1
+NEI4 $393
+ADDRLP4 12
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 -1
+EQI4 $397
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $397
+LABELV $394
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16400
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 s_controls+4620
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 61
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $406
+ARGP4
+CNSTI4 16401
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $403
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 374
+ARGI4
+ADDRGP4 $407
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 393
+ARGI4
+ADDRGP4 $408
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $409
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $410
+LABELV $401
+LABELV $388
+endproc Controls_DrawKeyBinding 120 20
+proc Controls_StatusBar 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $414
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $413
+endproc Controls_StatusBar 0 20
+proc Controls_DrawPlayer 76 24
+ADDRGP4 $416
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 s_controls+4624
+ARGP4
+ADDRLP4 68
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRGP4 s_controls+3108
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_controls+4624
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $417
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_controls+3108
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $415
+endproc Controls_DrawPlayer 76 24
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $425
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $429
+ADDRGP4 $426
+JUMPV
+LABELV $429
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $431
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $433
+ADDRGP4 $427
+JUMPV
+LABELV $433
+LABELV $431
+LABELV $426
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $425
+LABELV $427
+LABELV $424
+endproc Controls_GetKeyAssignment 280 12
+proc Controls_GetConfig 80 12
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $436
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $440
+ADDRGP4 $438
+JUMPV
+LABELV $440
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $437
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $436
+JUMPV
+LABELV $438
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $446
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRGP4 s_controls+2656+60
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2796+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2860+60
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2984+60
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 48
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1106247680
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2720+68
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 56
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+4476+60
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 64
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1028443341
+ARGF4
+CNSTF4 1061158912
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+4540+68
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 72
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2412+60
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $435
+endproc Controls_GetConfig 80 12
+proc Controls_SetConfig 24 8
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $463
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $467
+ADDRGP4 $465
+JUMPV
+LABELV $467
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $469
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $471
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $471
+LABELV $469
+LABELV $464
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $463
+JUMPV
+LABELV $465
+ADDRGP4 s_controls+2656+60
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRGP4 $144
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 12
+INDIRF4
+NEGF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRGP4 $144
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $474
+ADDRGP4 $149
+ARGP4
+ADDRGP4 s_controls+2796+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $143
+ARGP4
+ADDRGP4 s_controls+2860+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $145
+ARGP4
+ADDRGP4 s_controls+2984+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+ADDRGP4 s_controls+2720+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $147
+ARGP4
+ADDRGP4 s_controls+4476+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $148
+ARGP4
+ADDRGP4 s_controls+4540+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $150
+ARGP4
+ADDRGP4 s_controls+2412+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $462
+endproc Controls_SetConfig 24 8
+proc Controls_SetDefaults 44 4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $493
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $497
+ADDRGP4 $495
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $494
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $493
+JUMPV
+LABELV $495
+ADDRGP4 $144
+ARGP4
+ADDRLP4 12
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $502
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $503
+JUMPV
+LABELV $502
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $503
+ADDRGP4 s_controls+2656+60
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 16
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2796+60
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2860+60
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2984+60
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 28
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2720+68
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+4476+60
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 36
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+4540+68
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2412+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $492
+endproc Controls_SetDefaults 44 4
+proc Controls_MenuKey 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+4620
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $519
+ADDRLP4 24
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $524
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $531
+LABELV $530
+ADDRLP4 32
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $525
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $529
+LABELV $532
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+EQI4 $524
+ADDRGP4 $529
+JUMPV
+LABELV $531
+ADDRLP4 40
+CNSTI4 171
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $524
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $529
+LABELV $533
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $525
+ADDRGP4 $529
+JUMPV
+LABELV $524
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $520
+JUMPV
+LABELV $525
+ADDRGP4 s_controls+4232
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $519
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $534
+ADDRGP4 $529
+JUMPV
+LABELV $534
+ADDRLP4 24
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $538
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $536
+LABELV $541
+ADDRFP4 0
+INDIRI4
+CNSTI4 96
+EQI4 $529
+ADDRGP4 $536
+JUMPV
+LABELV $538
+ADDRGP4 s_controls+4620
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $518
+JUMPV
+LABELV $536
+LABELV $520
+ADDRGP4 s_controls+4232
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $543
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $545
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $549
+ADDRGP4 $547
+JUMPV
+LABELV $549
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $553
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $553
+LABELV $546
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $545
+JUMPV
+LABELV $547
+LABELV $543
+ADDRLP4 8
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $556
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $560
+ADDRGP4 $558
+JUMPV
+LABELV $560
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $562
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $564
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $566
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $566
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $558
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $564
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $571
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $571
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $573
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $573
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $573
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $562
+LABELV $557
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $556
+JUMPV
+LABELV $558
+ADDRGP4 s_controls+4620
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $518
+JUMPV
+LABELV $576
+LABELV $529
+ADDRGP4 s_controls
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $518
+endproc Controls_MenuKey 44 8
+proc Controls_ResetDefaults_Action 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $579
+ADDRGP4 $578
+JUMPV
+LABELV $579
+ADDRGP4 s_controls+4232
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $578
+endproc Controls_ResetDefaults_Action 0 0
+proc Controls_ResetDefaults_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $583
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $584
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $582
+endproc Controls_ResetDefaults_Draw 0 20
+proc Controls_MenuEvent 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 34
+LTI4 $586
+ADDRLP4 0
+INDIRI4
+CNSTI4 41
+GTI4 $625
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $626-136
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $626
+address $621
+address $621
+address $621
+address $621
+address $621
+address $621
+address $621
+address $621
+code
+LABELV $625
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $586
+ADDRLP4 0
+INDIRI4
+CNSTI4 107
+GTI4 $586
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $628-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $628
+address $589
+address $593
+address $597
+address $601
+address $605
+address $609
+address $615
+address $618
+code
+LABELV $589
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 s_controls+4616
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $593
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 s_controls+4616
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $597
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 s_controls+4616
+CNSTI4 2
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $601
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 s_controls+4616
+CNSTI4 3
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $605
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 $608
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Draw
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Action
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $609
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 s_controls+4232
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+LABELV $612
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $615
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $618
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $621
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $587
+ADDRGP4 s_controls+4232
+CNSTI4 1
+ASGNI4
+LABELV $586
+LABELV $587
+LABELV $585
+endproc Controls_MenuEvent 12 12
+proc Controls_ActionEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $631
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $633
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $636
+ADDRGP4 s_controls+4620
+INDIRI4
+CNSTI4 0
+NEI4 $636
+ADDRGP4 s_controls+4620
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $636
+LABELV $634
+LABELV $632
+LABELV $630
+endproc Controls_ActionEvent 0 4
+proc Controls_InitModel 4 12
+ADDRGP4 s_controls+3108
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1124
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $416
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_controls+3108
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $640
+endproc Controls_InitModel 4 12
+proc Controls_InitWeapons 4 4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $647
+JUMPV
+LABELV $644
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $649
+ADDRGP4 $645
+JUMPV
+LABELV $649
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+LABELV $645
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $647
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $644
+LABELV $643
+endproc Controls_InitWeapons 4 4
+bss
+align 1
+LABELV $652
+skip 32
+code
+proc Controls_MenuInit 0 12
+ADDRGP4 s_controls
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4888
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 s_controls+272
+ADDRGP4 Controls_MenuKey
+ASGNP4
+ADDRGP4 s_controls+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+288+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_controls+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+288+60
+ADDRGP4 $665
+ASGNP4
+ADDRGP4 s_controls+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_controls+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+360+4
+ADDRGP4 $673
+ASGNP4
+ADDRGP4 s_controls+360+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_controls+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_controls+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+448+4
+ADDRGP4 $687
+ASGNP4
+ADDRGP4 s_controls+448+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_controls+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_controls+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_controls+696
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+696+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+696+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_controls+696+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+696+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+696+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_controls+696+60
+ADDRGP4 $711
+ASGNP4
+ADDRGP4 s_controls+696+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+696+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+624
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+624+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+624+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_controls+624+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+624+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+624+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_controls+624+60
+ADDRGP4 $729
+ASGNP4
+ADDRGP4 s_controls+624+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+624+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+768
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+768+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+768+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_controls+768+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+768+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+768+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_controls+768+60
+ADDRGP4 $747
+ASGNP4
+ADDRGP4 s_controls+768+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+768+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+840
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+840+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+840+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_controls+840+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+840+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+840+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_controls+840+60
+ADDRGP4 $765
+ASGNP4
+ADDRGP4 s_controls+840+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+840+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_controls+4728
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+4728+4
+ADDRGP4 $773
+ASGNP4
+ADDRGP4 s_controls+4728+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_controls+4728+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+4728+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_controls+4728+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_controls+4728+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4728+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_controls+4728+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_controls+4728+60
+ADDRGP4 $790
+ASGNP4
+ADDRGP4 s_controls+536
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+536+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_controls+536+56
+ADDRGP4 Controls_DrawPlayer
+ASGNP4
+ADDRGP4 s_controls+536+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_controls+536+16
+CNSTI4 -40
+ASGNI4
+ADDRGP4 s_controls+536+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+536+80
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_controls+912
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+912+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+912+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+912+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+912+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+972
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+972+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+972+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+972+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+972+8
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_controls+1032
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1032+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1032+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1032+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1032+8
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+1092
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1092+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1092+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1092+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1092+8
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+1152
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1152+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1152+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1152+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1152+8
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_controls+1212
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1212+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1212+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1212+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1212+8
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_controls+1272
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1272+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1272+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1272+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1272+8
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+1332
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1332+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1332+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1332+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1332+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+1392
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1392+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1392+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1392+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1392+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+1452
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1452+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1452+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1452+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1452+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1572
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1572+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1572+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1572+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1572+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_controls+1512
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1512+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1512+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1512+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1512+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_controls+1632
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1632+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1632+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1632+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1632+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_controls+1692
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1692+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1692+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1692+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1692+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_controls+1752
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1752+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1752+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1752+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1752+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_controls+1812
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1812+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1812+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1812+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1812+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+1872
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1872+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1872+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1872+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1872+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_controls+1932
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1932+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1932+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1932+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1932+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_controls+1992
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1992+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1992+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1992+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1992+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 s_controls+2052
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2052+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2052+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2052+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2052+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_controls+2112
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2112+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2112+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2112+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2112+8
+CNSTI4 27
+ASGNI4
+ADDRGP4 s_controls+2172
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2172+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2172+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2172+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2172+8
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_controls+2232
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2232+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2232+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2232+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2232+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_controls+2292
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2292+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2292+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2292+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2292+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_controls+2352
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2352+44
+CNSTU4 12420
+ASGNU4
+ADDRGP4 s_controls+2352+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2352+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2352+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+2412
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2412+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2412+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2412+4
+ADDRGP4 $1036
+ASGNP4
+ADDRGP4 s_controls+2412+8
+CNSTI4 34
+ASGNI4
+ADDRGP4 s_controls+2412+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2412+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2476
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2476+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2476+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2476+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2476+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_controls+2536
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2536+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2536+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2536+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2536+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+3048
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3048+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3048+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3048+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3048+8
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+2924
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2924+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2924+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2924+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2924+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+2656
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2656+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2656+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2656+4
+ADDRGP4 $1086
+ASGNP4
+ADDRGP4 s_controls+2656+8
+CNSTI4 35
+ASGNI4
+ADDRGP4 s_controls+2656+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2656+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2796
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2796+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2796+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2796+4
+ADDRGP4 $1100
+ASGNP4
+ADDRGP4 s_controls+2796+8
+CNSTI4 41
+ASGNI4
+ADDRGP4 s_controls+2796+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2796+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2860
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2860+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2860+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2860+4
+ADDRGP4 $1114
+ASGNP4
+ADDRGP4 s_controls+2860+8
+CNSTI4 36
+ASGNI4
+ADDRGP4 s_controls+2860+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2860+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2984
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2984+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2984+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2984+4
+ADDRGP4 $1128
+ASGNP4
+ADDRGP4 s_controls+2984+8
+CNSTI4 37
+ASGNI4
+ADDRGP4 s_controls+2984+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2984+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2720
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+2720+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2720+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2720+4
+ADDRGP4 $1142
+ASGNP4
+ADDRGP4 s_controls+2720+8
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_controls+2720+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2720+60
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 s_controls+2720+64
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 s_controls+2720+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2596
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2596+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2596+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2596+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2596+8
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_controls+4236
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4236+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4236+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4236+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4236+8
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_controls+4296
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4296+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4296+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4296+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4296+8
+CNSTI4 31
+ASGNI4
+ADDRGP4 s_controls+4356
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4356+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4356+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4356+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4356+8
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_controls+4416
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4416+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4416+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4416+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4416+8
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_controls+4476
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+4476+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+4476+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+4476+4
+ADDRGP4 $1205
+ASGNP4
+ADDRGP4 s_controls+4476+8
+CNSTI4 39
+ASGNI4
+ADDRGP4 s_controls+4476+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4476+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+4540
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+4540+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+4540+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+4540+4
+ADDRGP4 $1219
+ASGNP4
+ADDRGP4 s_controls+4540+8
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+4540+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+4540+60
+CNSTF4 1028443341
+ASGNF4
+ADDRGP4 s_controls+4540+64
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 s_controls+4540+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+4816
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+4816+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_controls+4816+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+4816+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_controls+4816+60
+ADDRGP4 $652
+ASGNP4
+ADDRGP4 s_controls+4816+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+4816+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4816
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+696
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+624
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+840
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2720
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2796
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2656
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2232
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2292
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2352
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2412
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2476
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4476
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4540
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1452
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+912
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+972
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1032
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1092
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1152
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1212
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1272
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1332
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2052
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2172
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2984
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1572
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1692
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1812
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1932
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1992
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2924
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3048
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2596
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4236
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4356
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4728
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1295
+ARGP4
+ADDRGP4 s_controls+4816+60
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+4816+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 Controls_InitCvars
+CALLV
+pop
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 Controls_InitModel
+CALLV
+pop
+ADDRGP4 Controls_InitWeapons
+CALLV
+pop
+ADDRGP4 s_controls+4616
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $651
+endproc Controls_MenuInit 0 12
+export Controls_Cache
+proc Controls_Cache 0 4
+ADDRGP4 $773
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $790
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $673
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $687
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1301
+endproc Controls_Cache 0 4
+export UI_ControlsMenu
+proc UI_ControlsMenu 0 4
+ADDRGP4 Controls_MenuInit
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1302
+endproc UI_ControlsMenu 0 4
+bss
+align 4
+LABELV s_controls
+skip 4888
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1295
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1219
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $1205
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1142
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1128
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1114
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1100
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1086
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1036
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $790
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $773
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $765
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $747
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $729
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $711
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 75
+byte 1 0
+align 1
+LABELV $687
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $673
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $665
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 83
+byte 1 0
+align 1
+LABELV $608
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 79
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 83
+byte 1 63
+byte 1 0
+align 1
+LABELV $584
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $583
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $568
+byte 1 0
+align 1
+LABELV $491
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $416
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $414
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $408
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $407
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $406
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $399
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $395
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $149
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $148
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $147
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $146
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $144
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $143
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $141
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $139
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $138
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $137
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $135
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $134
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $133
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $132
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $131
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $130
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $129
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $128
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $127
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $126
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $125
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $124
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $123
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $122
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $121
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $119
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $118
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $117
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $116
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $115
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $114
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $112
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $111
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $110
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $109
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $108
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $107
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $104
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $103
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $102
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $101
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $100
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $99
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $98
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $97
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $96
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $95
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $93
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $92
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $91
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $90
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $89
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $88
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $87
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $86
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $85
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $84
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $83
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $82
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $81
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $80
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $79
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $78
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $77
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $76
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $75
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
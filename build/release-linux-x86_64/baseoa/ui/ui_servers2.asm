@@ -0,0 +1,7125 @@
+data
+align 4
+LABELV master_items
+address $72
+address $73
+address $74
+address $75
+address $76
+address $77
+address $78
+byte 4 0
+align 4
+LABELV servertype_items
+address $79
+address $80
+address $81
+address $82
+address $83
+byte 4 0
+align 4
+LABELV sortkey_items
+address $84
+address $85
+address $86
+address $87
+address $88
+byte 4 0
+align 4
+LABELV gamenames
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+address $98
+address $99
+address $100
+address $101
+byte 4 0
+align 4
+LABELV netnames
+address $102
+address $103
+address $104
+byte 4 0
+align 1
+LABELV quake3worldMessage
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 119
+byte 1 119
+byte 1 46
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+export punkbuster_items
+align 4
+LABELV punkbuster_items
+address $105
+address $106
+byte 4 0
+export punkbuster_msg
+align 4
+LABELV punkbuster_msg
+address $107
+address $108
+address $109
+address $110
+byte 4 0
+code
+proc ArenaServers_MaxPing 8 4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+GEI4 $116
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $116
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $114
+endproc ArenaServers_MaxPing 8 4
+proc ArenaServers_Compare 68 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $119
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+GTI4 $119
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $142
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $142
+address $121
+address $122
+address $123
+address $132
+address $137
+code
+LABELV $121
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $122
+ADDRLP4 28
+CNSTI4 89
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $123
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $124
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $124
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $126
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+LABELV $126
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $128
+CNSTI4 1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $128
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $130
+CNSTI4 0
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $130
+CNSTI4 -1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $132
+ADDRLP4 44
+CNSTI4 120
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $133
+CNSTI4 -1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $133
+ADDRLP4 48
+CNSTI4 120
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $135
+CNSTI4 0
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $135
+CNSTI4 1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $137
+ADDRLP4 52
+CNSTI4 116
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $138
+CNSTI4 -1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $138
+ADDRLP4 56
+CNSTI4 116
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $140
+CNSTI4 1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $140
+ADDRLP4 60
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $119
+CNSTI4 0
+RETI4
+LABELV $118
+endproc ArenaServers_Compare 68 8
+export ArenaServers_SourceForLAN
+proc ArenaServers_SourceForLAN 4 0
+ADDRLP4 0
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $149
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $149
+address $146
+address $147
+address $147
+address $147
+address $147
+address $147
+address $148
+code
+LABELV $144
+LABELV $146
+CNSTI4 0
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $147
+CNSTI4 2
+RETI4
+ADDRGP4 $143
+JUMPV
+LABELV $148
+CNSTI4 3
+RETI4
+LABELV $143
+endproc ArenaServers_SourceForLAN 4 0
+proc ArenaServers_Go 8 8
+ADDRLP4 0
+CNSTI4 72
+ADDRGP4 g_arenaservers+776+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072+68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRGP4 $157
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $155
+LABELV $150
+endproc ArenaServers_Go 8 8
+bss
+align 1
+LABELV $159
+skip 64
+code
+proc ArenaServers_UpdatePicture 4 16
+ADDRGP4 g_arenaservers+776+68
+INDIRI4
+CNSTI4 0
+NEI4 $160
+ADDRGP4 g_arenaservers+872+4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 0
+CNSTI4 72
+ADDRGP4 g_arenaservers+776+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072+68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $159
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+872+4
+ADDRGP4 $159
+ASGNP4
+LABELV $161
+ADDRGP4 g_arenaservers+872+68
+CNSTI4 0
+ASGNI4
+LABELV $158
+endproc ArenaServers_UpdatePicture 4 16
+proc ArenaServers_UpdateMenu 68 48
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+CNSTI4 0
+LEI4 $176
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $179
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+GTI4 $179
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $186
+ARGP4
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $191
+ASGNP4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 152
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $179
+ADDRLP4 28
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+776+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+1544+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1808+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+14860+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+LTI4 $212
+ADDRLP4 64
+INDIRI4
+CNSTI4 5
+GTI4 $212
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $177
+JUMPV
+LABELV $212
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $218
+ASGNP4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $219
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $191
+ASGNP4
+ADDRLP4 28
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+776+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+1544+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1808+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+14860+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+CNSTI4 0
+GEI4 $245
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $246
+ADDRLP4 28
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $254
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+GTI4 $254
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $218
+ASGNP4
+LABELV $255
+ADDRLP4 32
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+776+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1544+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+1808+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+14860+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $220
+ADDRGP4 g_arenaservers+776+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+776+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+776+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $175
+JUMPV
+LABELV $177
+ADDRLP4 0
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $286
+ADDRLP4 4
+CNSTI4 72
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $291
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $291
+ADDRGP4 $287
+JUMPV
+LABELV $291
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+NEI4 $293
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+NEI4 $293
+ADDRGP4 $287
+JUMPV
+LABELV $293
+ADDRLP4 40
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $295
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+GTI4 $295
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $310
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $310
+address $296
+address $298
+address $301
+address $304
+address $307
+code
+LABELV $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRGP4 $287
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $296
+ADDRGP4 $287
+JUMPV
+LABELV $304
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $296
+ADDRGP4 $287
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $296
+ADDRGP4 $287
+JUMPV
+LABELV $295
+LABELV $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+GEI4 $311
+ADDRLP4 20
+ADDRGP4 $313
+ASGNP4
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $314
+ADDRLP4 20
+ADDRGP4 $313
+ASGNP4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $316
+ADDRLP4 20
+ADDRGP4 $318
+ASGNP4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 400
+GEI4 $319
+ADDRLP4 20
+ADDRGP4 $321
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 20
+ADDRGP4 $322
+ASGNP4
+LABELV $320
+LABELV $317
+LABELV $315
+LABELV $312
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRLP4 56
+ADDRGP4 $324
+ASGNP4
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRLP4 56
+ADDRGP4 $325
+ASGNP4
+LABELV $328
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $287
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+LABELV $289
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $286
+ADDRGP4 g_arenaservers+776+68
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+776+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+776+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $175
+endproc ArenaServers_UpdateMenu 68 48
+proc ArenaServers_Remove 28 12
+ADDRGP4 g_arenaservers+776+68
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRGP4 $335
+JUMPV
+LABELV $336
+ADDRLP4 8
+CNSTI4 72
+ADDRGP4 g_arenaservers+776+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $343
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $351
+ADDRLP4 20
+CNSTI4 6
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+13832+64
+ADDP4
+ARGP4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+CNSTI4 64
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $351
+ADDRLP4 16
+ADDRGP4 g_arenaservers+14856
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $348
+LABELV $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+LTI4 $343
+LABELV $345
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $361
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $365
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $367
+ADDRLP4 16
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist+152
+ADDP4
+ARGP4
+CNSTU4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $367
+ADDRLP4 12
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 152
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 152
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $365
+LABELV $362
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $364
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $361
+LABELV $363
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13812
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ASGNI4
+LABELV $335
+endproc ArenaServers_Remove 28 12
+proc ArenaServers_Insert 88 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $375
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+EQI4 $375
+ADDRGP4 $374
+JUMPV
+LABELV $375
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ADDRGP4 g_arenaservers+13824
+INDIRI4
+LTI4 $377
+ADDRLP4 0
+CNSTI4 152
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ADDP4
+CNSTI4 -152
+ADDP4
+ASGNP4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 0
+CNSTI4 152
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $378
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $388
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $391
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LTI4 $396
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $394
+LABELV $396
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $398
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $399
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+LEI4 $401
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+LABELV $401
+LABELV $400
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $403
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamenames
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $404
+LABELV $374
+endproc ArenaServers_Insert 88 12
+export ArenaServers_InsertFavorites
+proc ArenaServers_InsertFavorites 1040 12
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRGP4 $406
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $407
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $412
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $414
+JUMPV
+LABELV $416
+LABELV $413
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $415
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $412
+LABELV $414
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $419
+ADDRLP4 1036
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+LABELV $419
+LABELV $408
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $410
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+LTI4 $407
+LABELV $405
+endproc ArenaServers_InsertFavorites 1040 12
+export ArenaServers_LoadFavorites
+proc ArenaServers_LoadFavorites 2532 12
+ADDRLP4 2508
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTU4 2432
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 68
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2432
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2512
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_numfavoriteservers
+ADDRLP4 2512
+INDIRI4
+ASGNI4
+ADDRLP4 2504
+ADDRLP4 2512
+INDIRI4
+ASGNI4
+LABELV $423
+ADDRGP4 $427
+ARGP4
+ADDRLP4 2504
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2516
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $428
+ADDRGP4 $424
+JUMPV
+LABELV $428
+ADDRLP4 2520
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2520
+INDIRI4
+CNSTI4 48
+LTI4 $432
+ADDRLP4 2520
+INDIRI4
+CNSTI4 57
+LEI4 $430
+LABELV $432
+ADDRGP4 $424
+JUMPV
+LABELV $430
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $437
+JUMPV
+LABELV $434
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2524
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2524
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRGP4 $436
+JUMPV
+LABELV $438
+LABELV $435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $437
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $434
+LABELV $436
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $440
+ADDRLP4 2528
+CNSTI4 152
+ASGNI4
+ADDRLP4 2528
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 2528
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+CNSTU4 152
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2508
+CNSTI4 1
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+CNSTI4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2528
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+CNSTI4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist+116
+ADDP4
+ADDRLP4 2528
+INDIRI4
+ASGNI4
+LABELV $441
+ADDRLP4 2528
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 2528
+INDIRP4
+ADDRLP4 2528
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $424
+ADDRLP4 2504
+ADDRLP4 2504
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2504
+INDIRI4
+CNSTI4 16
+LTI4 $423
+ADDRGP4 g_arenaservers+14856
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRLP4 2508
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRGP4 g_numfavoriteservers
+CNSTI4 0
+ASGNI4
+LABELV $444
+LABELV $422
+endproc ArenaServers_LoadFavorites 2532 12
+proc ArenaServers_StopRefresh 0 16
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+NEI4 $447
+ADDRGP4 $446
+JUMPV
+LABELV $447
+ADDRGP4 g_arenaservers+13816
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $451
+ADDRGP4 ArenaServers_InsertFavorites
+CALLV
+pop
+LABELV $451
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+CNSTI4 0
+LTI4 $453
+ADDRGP4 g_arenaservers+13812
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $453
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 152
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $446
+endproc ArenaServers_StopRefresh 0 16
+proc ArenaServers_DoRefresh 1120 16
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+13828
+INDIRI4
+GEI4 $463
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+EQI4 $467
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $469
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $471
+ADDRGP4 $462
+JUMPV
+LABELV $471
+LABELV $469
+ADDRLP4 1104
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+GEI4 $473
+ADDRGP4 $462
+JUMPV
+LABELV $473
+LABELV $467
+LABELV $463
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+13820
+INDIRI4
+GEI4 $475
+ADDRGP4 $462
+JUMPV
+LABELV $475
+ADDRGP4 g_arenaservers+13820
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $481
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_LAN_GetPing
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $485
+ADDRGP4 $482
+JUMPV
+LABELV $485
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $487
+ADDRLP4 4
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $491
+ADDRGP4 $489
+JUMPV
+LABELV $491
+LABELV $488
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $487
+LABELV $489
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $494
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 72
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896+64
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GEI4 $501
+ADDRGP4 $482
+JUMPV
+LABELV $501
+LABELV $496
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $503
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetPingInfo
+CALLV
+pop
+LABELV $504
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $494
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $482
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+LTI4 $481
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $506
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 1108
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $507
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $511
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 32
+LTI4 $517
+ADDRGP4 $513
+JUMPV
+LABELV $517
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $519
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $523
+ADDRGP4 $521
+JUMPV
+LABELV $523
+LABELV $520
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $519
+LABELV $521
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $526
+ADDRGP4 $513
+JUMPV
+LABELV $526
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $528
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 1112
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+LABELV $529
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896+64
+ADDP4
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1116
+ADDRGP4 g_arenaservers+13812
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ADDRLP4 1116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $512
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $514
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+GEI4 $539
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+LTI4 $511
+LABELV $539
+LABELV $513
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $540
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $540
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $462
+endproc ArenaServers_DoRefresh 1120 16
+proc ArenaServers_StartRefresh 88 16
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 72
+ADDRGP4 g_arenaservers+13824
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $545
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $546
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $545
+ADDRGP4 g_arenaservers+13816
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+13812
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13820
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13828
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $557
+CNSTI4 2
+ARGI4
+ADDRGP4 $559
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $542
+JUMPV
+LABELV $557
+ADDRLP4 68
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+LTI4 $560
+ADDRLP4 68
+INDIRI4
+CNSTI4 5
+GTI4 $560
+ADDRLP4 72
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LTI4 $562
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+GTI4 $562
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $575
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $575
+address $566
+address $567
+address $569
+address $571
+address $573
+code
+LABELV $562
+LABELV $566
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+ADDRGP4 $563
+JUMPV
+LABELV $567
+ADDRLP4 36
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $569
+ADDRLP4 36
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $571
+ADDRLP4 36
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $573
+ADDRLP4 36
+ARGP4
+ADDRGP4 $574
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $563
+ADDRGP4 g_emptyservers
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 36
+ARGP4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $576
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 36
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $579
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $582
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 76
+INDIRU4
+CNSTU4 0
+EQU4 $583
+ADDRGP4 $585
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRGP4 $587
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $586
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $584
+LABELV $560
+LABELV $542
+endproc ArenaServers_StartRefresh 88 16
+export ArenaServers_SaveChanges
+proc ArenaServers_SaveChanges 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $592
+JUMPV
+LABELV $589
+ADDRGP4 $427
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $590
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $592
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+LTI4 $589
+ADDRGP4 $598
+JUMPV
+LABELV $595
+ADDRGP4 $427
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $596
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $598
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $595
+LABELV $588
+endproc ArenaServers_SaveChanges 12 8
+export ArenaServers_Sort
+proc ArenaServers_Sort 0 16
+ADDRGP4 g_sortkey
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $600
+ADDRGP4 $599
+JUMPV
+LABELV $600
+ADDRGP4 g_sortkey
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 152
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $599
+endproc ArenaServers_Sort 0 16
+export ArenaServers_SetType
+proc ArenaServers_SetType 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $605
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $605
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRLP4 6
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $611
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $612
+ADDRGP4 $610
+JUMPV
+LABELV $612
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $609
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $608
+LABELV $610
+LABELV $605
+ADDRGP4 g_servertype
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $614
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $614
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $636
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $636
+address $616
+address $622
+address $622
+address $622
+address $622
+address $622
+address $630
+code
+LABELV $614
+LABELV $616
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1368+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+13808
+ADDRGP4 g_localserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+13804
+ADDRGP4 g_numlocalservers
+ASGNP4
+ADDRGP4 g_arenaservers+13824
+CNSTI4 128
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $622
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1368+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+13808
+CNSTI4 19456
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_globalserverlist-19456
+ADDP4
+ASGNP4
+ADDRGP4 g_arenaservers+13804
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_numglobalservers-4
+ADDP4
+ASGNP4
+ADDRGP4 g_arenaservers+13824
+CNSTI4 128
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $630
+ADDRLP4 16
+ADDRGP4 g_arenaservers+1368+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+13808
+ADDRGP4 g_favoriteserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+13804
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRGP4 g_arenaservers+13824
+CNSTI4 16
+ASGNI4
+LABELV $615
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $637
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $638
+JUMPV
+LABELV $637
+ADDRGP4 g_arenaservers+13812
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $646
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $638
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $604
+endproc ArenaServers_SetType 20 16
+proc Punkbuster_ConfirmEnable 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $648
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+LABELV $648
+ADDRGP4 $652
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+14860+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $647
+endproc Punkbuster_ConfirmEnable 8 12
+proc Punkbuster_ConfirmDisable 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $654
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+ADDRGP4 punkbuster_msg
+ARGP4
+ADDRGP4 UI_Message
+CALLV
+pop
+LABELV $654
+ADDRGP4 $652
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+14860+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $653
+endproc Punkbuster_ConfirmDisable 8 12
+proc ArenaServers_Event 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $659
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $659
+ADDRGP4 $658
+JUMPV
+LABELV $659
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $661
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $661
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $715-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $715
+address $663
+address $671
+address $677
+address $683
+address $689
+address $695
+address $698
+address $700
+address $702
+address $703
+address $704
+address $705
+address $706
+address $707
+address $708
+code
+LABELV $663
+ADDRGP4 g_arenaservers+360+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 g_arenaservers+360+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $671
+ADDRGP4 $672
+ARGP4
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_gametype
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $677
+ADDRGP4 $678
+ARGP4
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Sort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $683
+ADDRGP4 $684
+ARGP4
+ADDRGP4 g_arenaservers+648+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_fullservers
+ADDRGP4 g_arenaservers+648+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $689
+ADDRGP4 $690
+ARGP4
+ADDRGP4 g_arenaservers+712+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_emptyservers
+ADDRGP4 g_arenaservers+712+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $695
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $662
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $698
+ADDRGP4 g_arenaservers+776
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $700
+ADDRGP4 g_arenaservers+776
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $702
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $703
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $704
+ADDRGP4 UI_SpecifyServerMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $705
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $706
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $707
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $708
+ADDRGP4 g_arenaservers+14860+64
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRGP4 $713
+ARGP4
+CNSTI4 8209
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Punkbuster_ConfirmEnable
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+ADDRGP4 $662
+JUMPV
+LABELV $709
+ADDRGP4 $714
+ARGP4
+CNSTI4 8209
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Punkbuster_ConfirmDisable
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+LABELV $661
+LABELV $662
+LABELV $658
+endproc ArenaServers_Event 12 16
+proc ArenaServers_MenuDraw 0 4
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRGP4 ArenaServers_DoRefresh
+CALLV
+pop
+LABELV $718
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $717
+endproc ArenaServers_MenuDraw 0 4
+proc ArenaServers_MenuKey 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $722
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $721
+JUMPV
+LABELV $722
+ADDRFP4 0
+INDIRI4
+CNSTI4 140
+EQI4 $728
+ADDRFP4 0
+INDIRI4
+CNSTI4 171
+NEI4 $725
+LABELV $728
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $725
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRGP4 g_arenaservers+776
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $725
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $721
+JUMPV
+LABELV $725
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $731
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $729
+LABELV $731
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+LABELV $729
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $721
+endproc ArenaServers_MenuKey 16 8
+bss
+align 1
+LABELV $733
+skip 64
+code
+proc ArenaServers_MenuInit 48 16
+ADDRGP4 g_arenaservers
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 15044
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 g_arenaservers+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+268
+ADDRGP4 ArenaServers_MenuDraw
+ASGNP4
+ADDRGP4 g_arenaservers+272
+ADDRGP4 ArenaServers_MenuKey
+ASGNP4
+ADDRGP4 g_arenaservers+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+288+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 g_arenaservers+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+288+60
+ADDRGP4 $747
+ASGNP4
+ADDRGP4 g_arenaservers+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+360
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+360+4
+ADDRGP4 $755
+ASGNP4
+ADDRGP4 g_arenaservers+360+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+360+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+360+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+360+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+360+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+76
+ADDRGP4 master_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+456
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+456+4
+ADDRGP4 $771
+ASGNP4
+ADDRGP4 g_arenaservers+456+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+456+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+456+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+456+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+456+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+456+76
+ADDRGP4 servertype_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+552
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+552+4
+ADDRGP4 $787
+ASGNP4
+ADDRGP4 g_arenaservers+552+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+552+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+552+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+552+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+552+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+552+76
+ADDRGP4 sortkey_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+648
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+648+4
+ADDRGP4 $803
+ASGNP4
+ADDRGP4 g_arenaservers+648+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+648+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+648+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 g_arenaservers+648+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+648+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+712
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+712+4
+ADDRGP4 $817
+ASGNP4
+ADDRGP4 g_arenaservers+712+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+712+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+712+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 g_arenaservers+712+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+712+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 48
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+776
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+776+44
+CNSTU4 128
+ASGNU4
+ADDRGP4 g_arenaservers+776+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 g_arenaservers+776+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+776+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+776+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+776+80
+CNSTI4 68
+ASGNI4
+ADDRGP4 g_arenaservers+776+84
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+776+76
+ADDRGP4 g_arenaservers+13288
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $846
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaservers+13288
+ADDP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072
+ADDP4
+ASGNP4
+LABELV $847
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $846
+ADDRGP4 g_arenaservers+872
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+872+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+872+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+872+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+872+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+872+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+872+64
+ADDRGP4 $865
+ASGNP4
+ADDRGP4 g_arenaservers+960
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+960+4
+ADDRGP4 $869
+ASGNP4
+ADDRGP4 g_arenaservers+960+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+960+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+960+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+960+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+960+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+960+80
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1048
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1048+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1048+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1048+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1048+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1048+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+1048+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1048+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1048+60
+ADDRGP4 $899
+ASGNP4
+ADDRGP4 g_arenaservers+1136
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1136+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1136+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1136+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1136+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1136+16
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1136+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1136+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1136+60
+ADDRGP4 $917
+ASGNP4
+ADDRLP4 4
+CNSTI4 376
+ASGNI4
+ADDRGP4 g_arenaservers+1224
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1224+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1224+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1224+60
+ADDRGP4 $733
+ASGNP4
+ADDRGP4 g_arenaservers+1224+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1224+68
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1296
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1296+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1296+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $218
+ASGNP4
+ADDRGP4 g_arenaservers+1296+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1296+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 g_arenaservers+1368
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1368+4
+ADDRGP4 $943
+ASGNP4
+ADDRGP4 g_arenaservers+1368+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1368+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1368+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 g_arenaservers+1368+12
+CNSTI4 450
+ASGNI4
+ADDRGP4 g_arenaservers+1368+16
+CNSTI4 86
+ASGNI4
+ADDRGP4 g_arenaservers+1368+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1368+80
+CNSTI4 48
+ASGNI4
+ADDRGP4 g_arenaservers+1368+60
+ADDRGP4 $960
+ASGNP4
+ADDRGP4 g_arenaservers+1456
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1456+4
+ADDRGP4 $964
+ASGNP4
+ADDRGP4 g_arenaservers+1456+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1456+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1456+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 g_arenaservers+1456+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1456+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1456+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1456+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $981
+ASGNP4
+ADDRGP4 g_arenaservers+1632
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1632+4
+ADDRGP4 $985
+ASGNP4
+ADDRGP4 g_arenaservers+1632+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1632+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1632+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+1632+12
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1632+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1632+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1632+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1632+60
+ADDRGP4 $1002
+ASGNP4
+ADDRGP4 g_arenaservers+1544
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1544+4
+ADDRGP4 $1006
+ASGNP4
+ADDRGP4 g_arenaservers+1544+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1544+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1544+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 g_arenaservers+1544+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1544+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1544+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1544+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1544+60
+ADDRGP4 $1023
+ASGNP4
+ADDRGP4 g_arenaservers+1720
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1720+4
+ADDRGP4 $1027
+ASGNP4
+ADDRGP4 g_arenaservers+1720+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1720+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1720+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 g_arenaservers+1720+12
+CNSTI4 384
+ASGNI4
+ADDRGP4 g_arenaservers+1720+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1720+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1720+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1720+60
+ADDRGP4 $1044
+ASGNP4
+ADDRGP4 g_arenaservers+1808
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1808+4
+ADDRGP4 $1048
+ASGNP4
+ADDRGP4 g_arenaservers+1808+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 g_arenaservers+1808+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1808+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers+1808+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 g_arenaservers+1808+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1808+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1808+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1808+60
+ADDRGP4 $1065
+ASGNP4
+ADDRGP4 g_arenaservers+14860
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+14860+4
+ADDRGP4 $1069
+ASGNP4
+ADDRGP4 g_arenaservers+14860+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+14860+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+14860+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 g_arenaservers+14860+12
+CNSTI4 512
+ASGNI4
+ADDRGP4 g_arenaservers+14860+16
+CNSTI4 144
+ASGNI4
+ADDRGP4 g_arenaservers+14860+76
+ADDRGP4 punkbuster_items
+ASGNP4
+ADDRGP4 g_arenaservers+14956
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+14956+4
+ADDRGP4 $1085
+ASGNP4
+ADDRGP4 g_arenaservers+14956+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+14956+12
+CNSTI4 526
+ASGNI4
+ADDRGP4 g_arenaservers+14956+16
+CNSTI4 176
+ASGNI4
+ADDRGP4 g_arenaservers+14956+76
+CNSTI4 32
+ASGNI4
+ADDRGP4 g_arenaservers+14956+80
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+14956+64
+ADDRGP4 $865
+ASGNP4
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+552
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+648
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+712
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1224
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+960
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1048
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1720
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1808
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+14860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+14956
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 ui_browserMaster+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_servertype
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_gametype
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+456+64
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserSortKey+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_sortkey
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+552+64
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_fullservers
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+648+60
+ADDRGP4 g_fullservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_emptyservers
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+712+60
+ADDRGP4 g_emptyservers
+INDIRI4
+ASGNI4
+ADDRGP4 $652
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+14860+64
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 g_servertype
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRGP4 $218
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $732
+endproc ArenaServers_MenuInit 48 16
+export ArenaServers_Cache
+proc ArenaServers_Cache 0 4
+ADDRGP4 $964
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $981
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1027
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1044
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $985
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1002
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1006
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1023
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1048
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1065
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $869
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $899
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $917
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $865
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1085
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1138
+endproc ArenaServers_Cache 0 4
+export UI_ArenaServersMenu
+proc UI_ArenaServersMenu 0 4
+ADDRGP4 ArenaServers_MenuInit
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1139
+endproc UI_ArenaServersMenu 0 4
+bss
+align 4
+LABELV g_fullservers
+skip 4
+align 4
+LABELV g_emptyservers
+skip 4
+align 4
+LABELV g_sortkey
+skip 4
+align 4
+LABELV g_gametype
+skip 4
+align 4
+LABELV g_servertype
+skip 4
+align 4
+LABELV g_numfavoriteservers
+skip 4
+align 4
+LABELV g_favoriteserverlist
+skip 2432
+align 4
+LABELV g_numlocalservers
+skip 4
+align 4
+LABELV g_localserverlist
+skip 19456
+align 4
+LABELV g_numglobalservers
+skip 20
+align 4
+LABELV g_globalserverlist
+skip 97280
+align 4
+LABELV g_arenaservers
+skip 15044
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1085
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $1069
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1065
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1048
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1044
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1027
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1023
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1006
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1002
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $985
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $981
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $964
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $960
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $943
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $917
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $899
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $869
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $865
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $817
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $803
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $787
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $771
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $755
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $747
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $714
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 63
+byte 1 0
+align 1
+LABELV $713
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 63
+byte 1 0
+align 1
+LABELV $690
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $684
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $678
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $672
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $668
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $652
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $646
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $611
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $607
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $587
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $586
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $585
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $582
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $581
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $578
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $574
+byte 1 32
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $572
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $570
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $568
+byte 1 32
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $559
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $537
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $427
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $406
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $398
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $397
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $393
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $392
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $391
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $390
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $389
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $388
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $386
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $325
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $324
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $323
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 56
+byte 1 46
+byte 1 56
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $322
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $321
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $318
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $313
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $253
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $250
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $224
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $218
+byte 1 0
+align 1
+LABELV $191
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $186
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $170
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $110
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $109
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 73
+byte 1 73
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $108
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $107
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 66
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $105
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $104
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $103
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 32
+byte 1 0
+align 1
+LABELV $102
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 32
+byte 1 0
+align 1
+LABELV $101
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $100
+byte 1 79
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $99
+byte 1 85
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $98
+byte 1 81
+byte 1 51
+byte 1 70
+byte 1 0
+align 1
+LABELV $97
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $96
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $95
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $94
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $93
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $92
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $91
+byte 1 83
+byte 1 80
+byte 1 32
+byte 1 0
+align 1
+LABELV $90
+byte 1 49
+byte 1 118
+byte 1 49
+byte 1 0
+align 1
+LABELV $89
+byte 1 68
+byte 1 77
+byte 1 32
+byte 1 0
+align 1
+LABELV $88
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $87
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $86
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $85
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $82
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $81
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $80
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $79
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $78
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $77
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 53
+byte 1 0
+align 1
+LABELV $76
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 52
+byte 1 0
+align 1
+LABELV $75
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 51
+byte 1 0
+align 1
+LABELV $74
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 50
+byte 1 0
+align 1
+LABELV $73
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $72
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
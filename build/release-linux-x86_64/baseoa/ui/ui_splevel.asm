@@ -0,0 +1,4875 @@
+code
+proc PlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $74
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 0
+ADDRGP4 $76
+ASGNP4
+LABELV $75
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $78
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $78
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $78
+LABELV $73
+endproc PlayerIcon 80 20
+proc PlayerIconHandle 68 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+LABELV $81
+endproc PlayerIconHandle 68 12
+proc UI_SPLevelMenu_SetBots 1068 12
+ADDRGP4 levelMenuInfo+2512
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $84
+ADDRGP4 $82
+JUMPV
+LABELV $84
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $87
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $92
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $93
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRLP4 1040
+INDIRI4
+CNSTI4 32
+EQI4 $92
+LABELV $95
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $96
+ADDRGP4 $90
+JUMPV
+LABELV $96
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $99
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRLP4 1044
+INDIRI4
+CNSTI4 32
+NEI4 $98
+LABELV $101
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $102
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1048
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $102
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $104
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+LABELV $104
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 PlayerIconHandle
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+CNSTI4 10
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+CNSTI4 10
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $108
+CNSTI4 10
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 1052
+ADDRGP4 levelMenuInfo+2512
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $122
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 7
+LTI4 $93
+LABELV $122
+LABELV $90
+LABELV $82
+endproc UI_SPLevelMenu_SetBots 1068 12
+proc UI_SPLevelMenu_SetMenuArena 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2292
+ADDP4
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $130
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+CNSTI4 8
+ASGNI4
+LABELV $130
+ADDRGP4 $135
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRGP4 $140
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $136
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $143
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $144
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $123
+endproc UI_SPLevelMenu_SetMenuArena 84 12
+proc UI_SPLevelMenu_SetMenuItems 44 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $152
+ADDRGP4 selectedArena
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $154
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $154
+LABELV $153
+ADDRLP4 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $158
+ADDRLP4 12
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $156
+LABELV $158
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $156
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $159
+ADDRGP4 $161
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $159
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+NEI4 $162
+ADDRGP4 $164
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 levelMenuInfo+448+88+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 levelMenuInfo+448+176+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 levelMenuInfo+448+264+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 levelMenuInfo+1956+64
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+128
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+192
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+448+88+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $197
+ADDRGP4 $199
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 levelMenuInfo+448+88+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 levelMenuInfo+448+176+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 levelMenuInfo+448+264+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 levelMenuInfo+1956+64
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+128
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+192
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+448+88+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+LABELV $238
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $237
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $241
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $241
+LABELV $198
+LABELV $163
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $244
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+360+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+360+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $245
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $250
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+800+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+800+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $251
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+LABELV $151
+endproc UI_SPLevelMenu_SetMenuItems 44 12
+proc UI_SPLevelMenu_ResetDraw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $257
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $258
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 410
+ARGI4
+ADDRGP4 $259
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 437
+ARGI4
+ADDRGP4 $260
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $256
+endproc UI_SPLevelMenu_ResetDraw 0 20
+proc UI_SPLevelMenu_ResetAction 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRGP4 UI_NewGame
+CALLV
+pop
+ADDRGP4 $164
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $264
+ADDRGP4 $161
+ARGP4
+CNSTF4 3229614080
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRGP4 $161
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $265
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $261
+endproc UI_SPLevelMenu_ResetAction 4 8
+proc UI_SPLevelMenu_ResetEvent 0 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $267
+ADDRGP4 $266
+JUMPV
+LABELV $267
+ADDRGP4 $269
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetDraw
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+LABELV $266
+endproc UI_SPLevelMenu_ResetEvent 0 12
+proc UI_SPLevelMenu_LevelEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $271
+ADDRGP4 $270
+JUMPV
+LABELV $271
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $275
+ADDRLP4 0
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $273
+LABELV $275
+ADDRGP4 $270
+JUMPV
+LABELV $273
+ADDRLP4 4
+ADDRGP4 selectedArena
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+ADDRGP4 $161
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $270
+endproc UI_SPLevelMenu_LevelEvent 12 8
+proc UI_SPLevelMenu_LeftArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $278
+ADDRGP4 $277
+JUMPV
+LABELV $278
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $280
+ADDRGP4 $277
+JUMPV
+LABELV $280
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $277
+endproc UI_SPLevelMenu_LeftArrowEvent 4 0
+proc UI_SPLevelMenu_RightArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $283
+ADDRGP4 $282
+JUMPV
+LABELV $283
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $285
+ADDRGP4 $282
+JUMPV
+LABELV $285
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $282
+endproc UI_SPLevelMenu_RightArrowEvent 4 0
+proc UI_SPLevelMenu_PlayerEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $288
+ADDRGP4 $287
+JUMPV
+LABELV $288
+ADDRGP4 UI_PlayerSettingsMenu
+CALLV
+pop
+LABELV $287
+endproc UI_SPLevelMenu_PlayerEvent 0 0
+proc UI_SPLevelMenu_AwardEvent 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $291
+ADDRGP4 $290
+JUMPV
+LABELV $291
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 17
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2488
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $290
+endproc UI_SPLevelMenu_AwardEvent 4 8
+proc UI_SPLevelMenu_NextEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $295
+ADDRGP4 $294
+JUMPV
+LABELV $295
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $297
+ADDRGP4 $294
+JUMPV
+LABELV $297
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $299
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $299
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPSkillMenu
+CALLV
+pop
+LABELV $294
+endproc UI_SPLevelMenu_NextEvent 0 4
+proc UI_SPLevelMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $303
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $305
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $305
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $302
+endproc UI_SPLevelMenu_BackEvent 0 0
+proc UI_SPLevelMenu_CustomEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $308
+ADDRGP4 $307
+JUMPV
+LABELV $308
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+LABELV $307
+endproc UI_SPLevelMenu_CustomEvent 0 4
+proc UI_SPLevelMenu_MenuDraw 1160 20
+ADDRGP4 levelMenuInfo+1944
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRGP4 $114
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 314
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRGP4 levelMenuInfo+2400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+888+68
+CNSTI4 0
+ASGNI4
+LABELV $314
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 340
+ASGNI4
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+LABELV $324
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $329
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $331
+ADDRLP4 4
+CNSTI4 224
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $332
+ADDRLP4 1136
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+NEI4 $333
+ADDRGP4 $325
+JUMPV
+LABELV $333
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+LTI4 $335
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+LTI4 $338
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $339
+LABELV $336
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $329
+LABELV $325
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $324
+ADDRGP4 $342
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 18
+ARGI4
+CNSTI4 38
+ARGI4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $343
+ADDRLP4 1140
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+448+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+448+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+1952
+INDIRI4
+LTI4 $343
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $352
+CNSTI4 320
+ARGI4
+CNSTI4 216
+ARGI4
+ADDRGP4 $354
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $352
+ADDRLP4 88
+ADDRGP4 color_white
+INDIRF4
+ASGNF4
+ADDRLP4 88+4
+ADDRGP4 color_white+4
+INDIRF4
+ASGNF4
+ADDRLP4 88+8
+ADDRGP4 color_white+8
+INDIRF4
+ASGNF4
+ADDRLP4 88+12
+ADDRGP4 color_white+12
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 1140
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 88+12
+CNSTF4 1056964608
+ADDRLP4 1140
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $363
+ADDRLP4 1148
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+448+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+448+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $373
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1119879168
+ARGF4
+ADDRLP4 1152
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2292
+ADDP4
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2316-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $373
+ADDRLP4 0
+INDIRI4
+ADDRGP4 selectedArena
+INDIRI4
+NEI4 $379
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $381
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $381
+ADDRLP4 1156
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1124204544
+ARGF4
+CNSTF4 1122500608
+ARGF4
+ADDRGP4 levelMenuInfo+2308
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $385
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1132462080
+ARGF4
+CNSTF4 1130692608
+ARGF4
+ADDRGP4 levelMenuInfo+2312
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $385
+LABELV $380
+LABELV $364
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $366
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+1952
+INDIRI4
+LTI4 $363
+ADDRLP4 8
+CNSTI4 192
+ASGNI4
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 90
+CNSTI4 7
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $394
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+CNSTI4 18
+ADDI4
+CNSTI4 90
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $399
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 22
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRGP4 $403
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $400
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $395
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $397
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+LTI4 $394
+LABELV $310
+endproc UI_SPLevelMenu_MenuDraw 1160 20
+export UI_SPLevelMenu_Cache
+proc UI_SPLevelMenu_Cache 32 8
+ADDRGP4 $406
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $407
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $409
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $140
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $410
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $411
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $412
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $413
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $414
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $415
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $416
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $417
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $418
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $419
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $422
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $423
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ui_medalSounds
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 levelMenuInfo+2488
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $424
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $423
+ADDRGP4 $407
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2312
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $410
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $411
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $405
+endproc UI_SPLevelMenu_Cache 32 8
+proc UI_SPLevelMenu_Init 128 12
+ADDRGP4 $440
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+LTI4 $443
+ADDRLP4 80
+INDIRI4
+CNSTI4 5
+LEI4 $441
+LABELV $443
+ADDRGP4 $440
+ARGP4
+ADDRGP4 $444
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $441
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2616
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+268
+ADDRGP4 UI_SPLevelMenu_MenuDraw
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_Cache
+CALLV
+pop
+ADDRGP4 levelMenuInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 levelMenuInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+288+60
+ADDRGP4 $455
+ASGNP4
+ADDRGP4 levelMenuInfo+288+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 levelMenuInfo+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+360+4
+ADDRGP4 $408
+ASGNP4
+ADDRGP4 levelMenuInfo+360+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+360+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 levelMenuInfo+360+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+360+48
+ADDRGP4 UI_SPLevelMenu_LeftArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+360+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+360+76
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+360+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+360+60
+ADDRGP4 $409
+ASGNP4
+ADDRGP4 levelMenuInfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+4
+ADDRGP4 levelMenuInfo+1956
+ASGNP4
+ADDRGP4 levelMenuInfo+448+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+448+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 levelMenuInfo+448+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+4
+ADDRGP4 levelMenuInfo+1956+64
+ASGNP4
+ADDRGP4 levelMenuInfo+448+88+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+88+12
+CNSTI4 186
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+88+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+4
+ADDRGP4 levelMenuInfo+1956+128
+ASGNP4
+ADDRGP4 levelMenuInfo+448+176+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+176+12
+CNSTI4 326
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+176+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+4
+ADDRGP4 levelMenuInfo+1956+192
+ASGNP4
+ADDRGP4 levelMenuInfo+448+264+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+264+12
+CNSTI4 466
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+264+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+800
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+800+4
+ADDRGP4 $408
+ASGNP4
+ADDRGP4 levelMenuInfo+800+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+800+12
+CNSTI4 606
+ASGNI4
+ADDRGP4 levelMenuInfo+800+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+800+48
+ADDRGP4 UI_SPLevelMenu_RightArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+800+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 levelMenuInfo+800+76
+CNSTI4 -16
+ASGNI4
+ADDRGP4 levelMenuInfo+800+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+800+60
+ADDRGP4 $409
+ASGNP4
+ADDRGP4 $111
+ARGP4
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRGP4 levelMenuInfo+2400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+888
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+888+4
+ADDRGP4 levelMenuInfo+2400
+ASGNP4
+ADDRGP4 levelMenuInfo+888+44
+CNSTU4 2052
+ASGNU4
+ADDRGP4 levelMenuInfo+888+12
+CNSTI4 288
+ASGNI4
+ADDRGP4 levelMenuInfo+888+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 levelMenuInfo+888+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+888+48
+ADDRGP4 UI_SPLevelMenu_PlayerEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+888+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+888+80
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $623
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetAwardLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $623
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+ADDRGP4 levelMenuInfo+2464+16
+ADDRLP4 92
+INDIRI4
+ADDRGP4 levelMenuInfo+2464+16
+INDIRI4
+ADDRLP4 92
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 340
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $632
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $639
+ADDRLP4 8
+CNSTI4 224
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $640
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+44
+ADDP4
+CNSTU4 1050628
+ASGNU4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+16
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+48
+ADDP4
+ADDRGP4 UI_SPLevelMenu_AwardEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+76
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+80
+ADDP4
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $636
+LABELV $633
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $632
+ADDRGP4 levelMenuInfo+1504
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+4
+ADDRGP4 $415
+ASGNP4
+ADDRGP4 levelMenuInfo+1504+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1504+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+48
+ADDRGP4 UI_SPLevelMenu_BackEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1504+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+60
+ADDRGP4 $416
+ASGNP4
+ADDRGP4 levelMenuInfo+1592
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+4
+ADDRGP4 $419
+ASGNP4
+ADDRGP4 levelMenuInfo+1592+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1592+12
+CNSTI4 170
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+48
+ADDRGP4 UI_SPLevelMenu_ResetEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1592+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+60
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 levelMenuInfo+1680
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+4
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 levelMenuInfo+1680+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1680+12
+CNSTI4 342
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+48
+ADDRGP4 UI_SPLevelMenu_CustomEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1680+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+60
+ADDRGP4 $422
+ASGNP4
+ADDRGP4 levelMenuInfo+1768
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+4
+ADDRGP4 $417
+ASGNP4
+ADDRGP4 levelMenuInfo+1768+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 levelMenuInfo+1768+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+48
+ADDRGP4 UI_SPLevelMenu_NextEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1768+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+60
+ADDRGP4 $418
+ASGNP4
+ADDRGP4 levelMenuInfo+1856
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 levelMenuInfo+1856+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448+88
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448+176
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448+264
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 100
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 levelMenuInfo+448+88+32
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 levelMenuInfo+448+176+32
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 levelMenuInfo+448+264+32
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $770
+JUMPV
+LABELV $767
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $768
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $770
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $767
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1504
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1856
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $161
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $777
+ADDRLP4 16
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 4
+ASGNI4
+ADDRGP4 selectedArenaSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRGP4 selectedArenaSet
+ADDRGP4 currentSet
+INDIRI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRGP4 currentGame
+INDIRI4
+ASGNI4
+LABELV $778
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $439
+endproc UI_SPLevelMenu_Init 128 12
+export UI_SPLevelMenu
+proc UI_SPLevelMenu 36 8
+ADDRGP4 trainingTier
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $780
+ADDRGP4 minTier
+ADDRGP4 trainingTier
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRGP4 minTier
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 -2
+ASGNI4
+LABELV $781
+ADDRLP4 16
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRGP4 finalTier
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $782
+ADDRGP4 maxTier
+ADDRGP4 finalTier
+INDIRI4
+ASGNI4
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRLP4 24
+ADDRGP4 maxTier
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRGP4 finalTier
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+GEI4 $784
+ADDRGP4 maxTier
+ADDRGP4 minTier
+INDIRI4
+ASGNI4
+LABELV $784
+LABELV $783
+ADDRLP4 24
+ADDRGP4 UI_GetCurrentGame
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $786
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 maxTier
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $788
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $788
+LABELV $786
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $790
+ADDRGP4 currentSet
+CNSTI4 -1
+ASGNI4
+ADDRGP4 currentGame
+CNSTI4 0
+ASGNI4
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 currentSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 currentGame
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+ASGNI4
+LABELV $791
+ADDRGP4 UI_SPLevelMenu_Init
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1768
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $779
+endproc UI_SPLevelMenu 36 8
+export UI_SPLevelMenu_f
+proc UI_SPLevelMenu_f 0 4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $793
+endproc UI_SPLevelMenu_f 0 4
+export UI_SPLevelMenu_ReInit
+proc UI_SPLevelMenu_ReInit 0 0
+ADDRGP4 levelMenuInfo+1944
+CNSTI4 1
+ASGNI4
+LABELV $795
+endproc UI_SPLevelMenu_ReInit 0 0
+bss
+align 4
+LABELV maxTier
+skip 4
+align 4
+LABELV minTier
+skip 4
+align 4
+LABELV finalTier
+skip 4
+align 4
+LABELV trainingTier
+skip 4
+align 4
+LABELV currentGame
+skip 4
+align 4
+LABELV currentSet
+skip 4
+align 4
+LABELV selectedArena
+skip 4
+align 4
+LABELV selectedArenaSet
+skip 4
+align 4
+LABELV levelMenuInfo
+skip 2616
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $455
+byte 1 67
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 83
+byte 1 69
+byte 1 32
+byte 1 76
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 0
+align 1
+LABELV $444
+byte 1 50
+byte 1 0
+align 1
+LABELV $440
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $422
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $421
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $420
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $419
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $418
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $417
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $416
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $415
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $414
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $413
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $412
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $411
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $410
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $409
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $408
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $407
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $406
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $403
+byte 1 63
+byte 1 0
+align 1
+LABELV $392
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $390
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $354
+byte 1 65
+byte 1 67
+byte 1 67
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 78
+byte 1 73
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $342
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $341
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $340
+byte 1 37
+byte 1 105
+byte 1 107
+byte 1 0
+align 1
+LABELV $337
+byte 1 37
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $269
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 63
+byte 1 0
+align 1
+LABELV $260
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $259
+byte 1 68
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $258
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $257
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $199
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $165
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $164
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $161
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $140
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $135
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $124
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $87
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $76
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
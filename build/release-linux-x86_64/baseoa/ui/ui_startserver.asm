@@ -0,0 +1,9163 @@
+data
+align 4
+LABELV gametype_items
+address $73
+address $74
+address $75
+address $76
+byte 4 0
+align 4
+LABELV gametype_remap
+byte 4 0
+byte 4 3
+byte 4 1
+byte 4 4
+align 4
+LABELV gametype_remap2
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 1
+byte 4 3
+code
+proc GametypeBits 36 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $81
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $83
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $83
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $88
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $86
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $91
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $89
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $89
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $92
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $97
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $95
+LABELV $79
+ADDRGP4 $78
+JUMPV
+LABELV $80
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $77
+endproc GametypeBits 36 8
+bss
+align 1
+LABELV $99
+skip 256
+code
+proc StartServer_Update 52 16
+ADDRLP4 20
+ADDRGP4 s_startserver+1948
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $101
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 s_startserver+1944
+INDIRI4
+LTI4 $105
+ADDRGP4 $124
+JUMPV
+LABELV $105
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $99
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $99
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $102
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $101
+ADDRGP4 $124
+JUMPV
+LABELV $121
+ADDRLP4 28
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $122
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $121
+ADDRGP4 s_startserver+1944
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 28
+ADDRGP4 s_startserver+1688+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 28
+ADDRGP4 s_startserver+1688+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRGP4 s_startserver+1940
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $146
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $146
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 40
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+LABELV $146
+ADDRGP4 s_startserver+1940
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $136
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+LABELV $98
+endproc StartServer_Update 52 16
+proc StartServer_MapEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $159
+ADDRGP4 $158
+JUMPV
+LABELV $159
+ADDRGP4 s_startserver+1940
+ADDRGP4 s_startserver+1948
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $158
+endproc StartServer_MapEvent 0 0
+proc StartServer_GametypeEvent 48 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $164
+ADDRGP4 $163
+JUMPV
+LABELV $164
+ADDRLP4 20
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1944
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+ADDRGP4 gametype_remap
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ADDRGP4 s_startserver+536+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 s_startserver+536+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $173
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $178
+ADDRGP4 $174
+JUMPV
+LABELV $178
+ADDRGP4 s_startserver+1944
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 s_startserver+1944
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $176
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $173
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+1952
+ADDRGP4 s_startserver+1944
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 s_startserver+1948
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1940
+CNSTI4 0
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $163
+endproc StartServer_GametypeEvent 48 8
+proc StartServer_MenuEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $188
+ADDRGP4 $187
+JUMPV
+LABELV $188
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $210-60
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $210
+address $193
+address $198
+address $209
+address $204
+code
+LABELV $193
+ADDRGP4 s_startserver+1948
+INDIRI4
+CNSTI4 0
+LEI4 $191
+ADDRLP4 8
+ADDRGP4 s_startserver+1948
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $198
+ADDRGP4 s_startserver+1948
+INDIRI4
+ADDRGP4 s_startserver+1952
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $191
+ADDRLP4 8
+ADDRGP4 s_startserver+1948
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $204
+ADDRGP4 $205
+ARGP4
+ADDRGP4 s_startserver+536+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+1936
+INDIRI4
+ARGI4
+ADDRGP4 UI_ServerOptionsMenu
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $209
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $190
+LABELV $191
+LABELV $187
+endproc StartServer_MenuEvent 12 8
+proc StartServer_LevelshotDraw 64 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $213
+ADDRGP4 $212
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $217
+LABELV $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $219
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $221
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1105199104
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 48
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 s_startserver+1948
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 28
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 64
+BANDU4
+CNSTU4 0
+EQU4 $225
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $225
+LABELV $212
+endproc StartServer_LevelshotDraw 64 20
+bss
+align 1
+LABELV $228
+skip 64
+code
+proc StartServer_MenuInit 32 12
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6052
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 s_startserver+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+288+60
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 s_startserver+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_startserver+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+360+4
+ADDRGP4 $246
+ASGNP4
+ADDRGP4 s_startserver+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_startserver+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_startserver+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+448+4
+ADDRGP4 $260
+ASGNP4
+ADDRGP4 s_startserver+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_startserver+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_startserver+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_startserver+536
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+536+4
+ADDRGP4 $274
+ASGNP4
+ADDRGP4 s_startserver+536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_startserver+536+48
+ADDRGP4 StartServer_GametypeEvent
+ASGNP4
+ADDRGP4 s_startserver+536+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+536+12
+CNSTI4 296
+ASGNI4
+ADDRGP4 s_startserver+536+16
+CNSTI4 368
+ASGNI4
+ADDRGP4 s_startserver+536+76
+ADDRGP4 gametype_items
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRLP4 12
+CNSTI4 136
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+CNSTI4 188
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+CNSTI4 96
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+80
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+60
+ADDP4
+ADDRGP4 $306
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+64
+ADDP4
+ADDRGP4 $309
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+56
+ADDP4
+ADDRGP4 StartServer_LevelshotDraw
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+48
+ADDP4
+ADDRGP4 StartServer_MapEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+76
+ADDP4
+CNSTI4 256
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+80
+ADDP4
+CNSTI4 248
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+60
+ADDP4
+ADDRGP4 $337
+ASGNP4
+LABELV $288
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $287
+ADDRGP4 s_startserver+1336
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1336+4
+ADDRGP4 $341
+ASGNP4
+ADDRGP4 s_startserver+1336+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+1336+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+1336+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+1336+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+1336+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+1424
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1424+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+1424+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1424+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_startserver+1424+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+1424+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+1424+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1424+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+1424+60
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 s_startserver+1512
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1512+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+1512+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1512+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+1512+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 s_startserver+1512+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+1512+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1512+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+1512+60
+ADDRGP4 $387
+ASGNP4
+ADDRGP4 s_startserver+1776
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_startserver+1776+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_startserver+1776+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+1776+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_startserver+1776+60
+ADDRGP4 $228
+ASGNP4
+ADDRGP4 s_startserver+1776+64
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_startserver+1776+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_startserver+1600
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1600+4
+ADDRGP4 $404
+ASGNP4
+ADDRGP4 s_startserver+1600+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+1600+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1600+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_startserver+1600+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1600+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+1600+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+1600+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1600+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 s_startserver+1688
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1688+4
+ADDRGP4 $425
+ASGNP4
+ADDRGP4 s_startserver+1688+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_startserver+1688+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1688+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_startserver+1688+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+1688+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+1688+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+1688+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1688+60
+ADDRGP4 $442
+ASGNP4
+ADDRGP4 s_startserver+1848
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1848+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_startserver+1848+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1848+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1848+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+1848+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $458
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $459
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $458
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1336
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1424
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1600
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1688
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1848
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 StartServer_GametypeEvent
+CALLV
+pop
+LABELV $227
+endproc StartServer_MenuInit 32 12
+export StartServer_Cache
+proc StartServer_Cache 104 16
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $425
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $442
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $246
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $260
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $337
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $306
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $309
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $341
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $369
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $387
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $472
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $478
+JUMPV
+LABELV $475
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 68
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $476
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $478
+ADDRLP4 96
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $475
+LABELV $473
+LABELV $471
+endproc StartServer_Cache 104 16
+export UI_StartServerMenu
+proc UI_StartServerMenu 0 4
+ADDRGP4 StartServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_startserver+1936
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $479
+endproc UI_StartServerMenu 0 4
+data
+align 4
+LABELV dedicated_list
+address $482
+address $483
+address $484
+byte 4 0
+align 4
+LABELV playerType_list
+address $485
+address $486
+address $487
+byte 4 0
+align 4
+LABELV playerTeam_list
+address $488
+address $489
+byte 4 0
+align 4
+LABELV botSkill_list
+address $490
+address $491
+address $492
+address $493
+address $494
+byte 4 0
+code
+proc BotAlreadySelected 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $496
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $500
+ADDRGP4 $497
+JUMPV
+LABELV $500
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $504
+ADDRLP4 4
+CNSTI4 96
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_serveroptions+5924
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+INDIRI4
+EQI4 $504
+ADDRGP4 $497
+JUMPV
+LABELV $504
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $512
+CNSTI4 1
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $512
+LABELV $497
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $496
+CNSTI4 0
+RETI4
+LABELV $495
+endproc BotAlreadySelected 12 8
+proc ServerOptions_Start 172 24
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1296+60+12
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRGP4 s_serveroptions+536+64
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 s_serveroptions+1628+60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 s_serveroptions+2024+60
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 s_serveroptions+2088+64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $536
+JUMPV
+LABELV $533
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $537
+ADDRGP4 $534
+JUMPV
+LABELV $537
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $541
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $541
+ADDRGP4 $534
+JUMPV
+LABELV $541
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $534
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $536
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $533
+ADDRLP4 120
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+LTI4 $546
+ADDRLP4 120
+INDIRI4
+CNSTI4 4
+GTI4 $546
+ADDRLP4 120
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $563
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $563
+address $549
+address $552
+address $546
+address $555
+address $559
+code
+LABELV $549
+LABELV $546
+ADDRGP4 $550
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $551
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $552
+ADDRGP4 $553
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $554
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $555
+ADDRGP4 $556
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $557
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $558
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $559
+ADDRGP4 $560
+ARGP4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $561
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $562
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $547
+CNSTF4 0
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 128
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $565
+ARGP4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 132
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 140
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 148
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $569
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $570
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $571
+ARGP4
+ADDRGP4 s_serveroptions+1692+60+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $575
+ARGP4
+ADDRGP4 s_serveroptions+5944+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+1940
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 160
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $582
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $586
+ADDRGP4 $583
+JUMPV
+LABELV $586
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $590
+ADDRGP4 $583
+JUMPV
+LABELV $590
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $593
+ADDRGP4 $583
+JUMPV
+LABELV $593
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $596
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $597
+JUMPV
+LABELV $596
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $603
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $597
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $583
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $582
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $605
+ADDRGP4 $608
+ARGP4
+ADDRGP4 s_serveroptions+4272+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $605
+LABELV $515
+endproc ServerOptions_Start 172 24
+proc ServerOptions_InitPlayerItems 12 12
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $612
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $613
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $615
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $616
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $615
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+GEI4 $621
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $625
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $626
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $625
+LABELV $621
+ADDRGP4 s_serveroptions+536+64
+INDIRI4
+CNSTI4 0
+NEI4 $631
+ADDRLP4 8
+ADDRGP4 s_serveroptions+2256+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_serveroptions+2256+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+ARGP4
+ADDRGP4 s_serveroptions+5728
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+LABELV $631
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $643
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $646
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $647
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $646
+ADDRGP4 $655
+JUMPV
+LABELV $652
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $653
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $652
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $658
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $659
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $658
+LABELV $644
+LABELV $611
+endproc ServerOptions_InitPlayerItems 12 12
+proc ServerOptions_SetPlayerItems 12 0
+ADDRGP4 s_serveroptions+536+64
+INDIRI4
+CNSTI4 0
+NEI4 $665
+ADDRGP4 s_serveroptions+2184+60
+ADDRGP4 $671
+ASGNP4
+ADDRLP4 8
+ADDRGP4 s_serveroptions+3408+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294963199
+BANDU4
+ASGNU4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $665
+ADDRGP4 s_serveroptions+2184+60
+ADDRGP4 $485
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $666
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $676
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $680
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $681
+JUMPV
+LABELV $680
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $681
+LABELV $677
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $676
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+GEI4 $688
+ADDRGP4 $664
+JUMPV
+LABELV $688
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $695
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $696
+LABELV $692
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $694
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $691
+LABELV $664
+endproc ServerOptions_SetPlayerItems 12 0
+proc ServerOptions_Event 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $704
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $704
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $720-72
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $720
+address $714
+address $704
+address $707
+address $710
+address $710
+address $711
+address $717
+code
+LABELV $707
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $708
+ADDRGP4 $705
+JUMPV
+LABELV $708
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $705
+JUMPV
+LABELV $710
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $705
+JUMPV
+LABELV $711
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $712
+ADDRGP4 $705
+JUMPV
+LABELV $712
+ADDRGP4 ServerOptions_Start
+CALLV
+pop
+ADDRGP4 $705
+JUMPV
+LABELV $714
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $705
+ADDRGP4 $705
+JUMPV
+LABELV $717
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $718
+ADDRGP4 $705
+JUMPV
+LABELV $718
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $704
+LABELV $705
+LABELV $703
+endproc ServerOptions_Event 8 0
+proc ServerOptions_PlayerNameEvent 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $723
+ADDRGP4 $722
+JUMPV
+LABELV $723
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5924
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu
+CALLV
+pop
+LABELV $722
+endproc ServerOptions_PlayerNameEvent 4 4
+proc ServerOptions_StatusBar 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $728
+JUMPV
+LABELV $728
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $731
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $729
+LABELV $727
+endproc ServerOptions_StatusBar 4 20
+proc ServerOptions_LevelshotDraw 20 20
+ADDRGP4 s_serveroptions+5920
+INDIRI4
+CNSTI4 0
+EQI4 $733
+ADDRGP4 s_serveroptions+5924
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRGP4 s_serveroptions+5928
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5920
+CNSTI4 0
+ASGNI4
+LABELV $733
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_serveroptions+5696
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_remap2
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_items
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $732
+endproc ServerOptions_LevelshotDraw 20 20
+proc ServerOptions_InitBotNames 1072 12
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $743
+ADDRGP4 s_serveroptions+5728+16
+ARGP4
+ADDRGP4 $748
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728+32
+ARGP4
+ADDRGP4 $751
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+NEI4 $752
+ADDRGP4 s_serveroptions+5728+48
+ARGP4
+ADDRGP4 $757
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRGP4 s_serveroptions+2256+288+64
+CNSTI4 2
+ASGNI4
+LABELV $753
+ADDRGP4 s_serveroptions+2256+384+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+2256+480+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+5728+96
+ARGP4
+ADDRGP4 $769
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728+112
+ARGP4
+ADDRGP4 $748
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728+128
+ARGP4
+ADDRGP4 $751
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+NEI4 $774
+ADDRGP4 s_serveroptions+5728+144
+ARGP4
+ADDRGP4 $757
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRGP4 s_serveroptions+2256+864+64
+CNSTI4 2
+ASGNI4
+LABELV $775
+ADDRGP4 s_serveroptions+2256+960+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+2256+1056+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $743
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+5696
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $789
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $791
+JUMPV
+LABELV $793
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $794
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+EQI4 $793
+LABELV $796
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $797
+ADDRGP4 $792
+JUMPV
+LABELV $797
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $800
+JUMPV
+LABELV $799
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $800
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRLP4 1060
+INDIRI4
+CNSTI4 32
+NEI4 $799
+LABELV $802
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $803
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1064
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $803
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $805
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+LABELV $805
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $639
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $791
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $809
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $794
+LABELV $809
+LABELV $792
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $810
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRGP4 $815
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $811
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $813
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+LTI4 $810
+ADDRGP4 $819
+JUMPV
+LABELV $816
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $817
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $819
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $816
+ADDRGP4 $825
+JUMPV
+LABELV $822
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $826
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $826
+LABELV $823
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $825
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $822
+LABELV $742
+endproc ServerOptions_InitBotNames 1072 12
+bss
+align 1
+LABELV $833
+skip 64
+code
+proc ServerOptions_SetMenuItems 104 16
+ADDRLP4 20
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $834
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+GTI4 $834
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $870
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $870
+address $837
+address $845
+address $834
+address $852
+address $861
+code
+LABELV $837
+LABELV $834
+ADDRGP4 $550
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $551
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $835
+JUMPV
+LABELV $845
+ADDRGP4 $553
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $554
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $835
+JUMPV
+LABELV $852
+ADDRGP4 $556
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $557
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $558
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1628+60
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $835
+JUMPV
+LABELV $861
+ADDRGP4 $560
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1296+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $561
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $562
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1628+60
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $835
+ADDRGP4 $571
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+1692+60+12
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $570
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2024+60
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_startserver+1940
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 $833
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 s_serveroptions+360+4
+ADDRGP4 $833
+ASGNP4
+ADDRGP4 s_serveroptions+5696
+ARGP4
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_serveroptions+5696
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 ServerOptions_InitPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_InitBotNames
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+LABELV $832
+endproc ServerOptions_SetMenuItems 104 16
+proc PlayerName_Draw 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $889
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $890
+JUMPV
+LABELV $889
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $890
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $891
+ADDRLP4 4
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $893
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $895
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $896
+JUMPV
+LABELV $895
+ADDRLP4 4
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $896
+LABELV $894
+LABELV $892
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $897
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $897
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $887
+endproc PlayerName_Draw 52 20
+proc ServerOptions_MenuInit 52 12
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_serveroptions+5688
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $902
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5692
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $575
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5944+64
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 s_serveroptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_serveroptions+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_serveroptions+288+60
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 s_serveroptions+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_serveroptions+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+360+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_serveroptions+360+12
+CNSTI4 352
+ASGNI4
+ADDRGP4 s_serveroptions+360+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+360+76
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_serveroptions+360+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_serveroptions+360+64
+ADDRGP4 $309
+ASGNP4
+ADDRGP4 s_serveroptions+360+56
+ADDRGP4 ServerOptions_LevelshotDraw
+ASGNP4
+ADDRGP4 s_serveroptions+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+448+44
+CNSTU4 16452
+ASGNU4
+ADDRGP4 s_serveroptions+448+12
+CNSTI4 314
+ASGNI4
+ADDRGP4 s_serveroptions+448+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+448+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+448+80
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+448+60
+ADDRGP4 $337
+ASGNP4
+ADDRLP4 4
+CNSTI4 272
+ASGNI4
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 4
+EQI4 $946
+ADDRGP4 s_serveroptions+964
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+964+4
+ADDRGP4 $952
+ASGNP4
+ADDRGP4 s_serveroptions+964+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+964+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+964+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+964+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+964+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+964+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $946
+ADDRGP4 s_serveroptions+1296
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1296+4
+ADDRGP4 $970
+ASGNP4
+ADDRGP4 s_serveroptions+1296+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+1296+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1296+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1296+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+1296+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+1296+60+268
+CNSTI4 3
+ASGNI4
+LABELV $947
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+632
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+632+4
+ADDRGP4 $988
+ASGNP4
+ADDRGP4 s_serveroptions+632+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+632+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+632+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+632+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+632+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+632+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $1003
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+1628
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+1628+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+1628+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1628+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1628+4
+ADDRGP4 $1015
+ASGNP4
+LABELV $1003
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2024
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2024+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2024+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2024+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2024+4
+ADDRGP4 $1025
+ASGNP4
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1026
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+536
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+536+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_serveroptions+536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+536+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+536+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+536+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+536+4
+ADDRGP4 $1042
+ASGNP4
+ADDRGP4 s_serveroptions+536+76
+ADDRGP4 dedicated_list
+ASGNP4
+LABELV $1026
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1045
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+1692
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1692+4
+ADDRGP4 $1051
+ASGNP4
+ADDRGP4 s_serveroptions+1692+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+1692+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1692+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1692+60+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+1692+60+268
+CNSTI4 64
+ASGNI4
+LABELV $1045
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5944
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5944+4
+ADDRGP4 $1067
+ASGNP4
+ADDRGP4 s_serveroptions+5944+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5944+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+5944+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5944+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5944+76
+ADDRGP4 punkbuster_items
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+2088
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+2088+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2088+4
+ADDRGP4 $1083
+ASGNP4
+ADDRGP4 s_serveroptions+2088+4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 s_serveroptions+2088+12
+ADDRLP4 24
+INDIRU4
+CNSTU4 2
+ADDU4
+CNSTI4 3
+LSHU4
+CNSTU4 32
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+2088+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2088+76
+ADDRGP4 botSkill_list
+ASGNP4
+ADDRGP4 s_serveroptions+2088+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2184
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_serveroptions+2184+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+2184+12
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+2184+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2184+68
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_serveroptions+2184+64
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1105
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+8
+ADDP4
+CNSTI4 20
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+48
+ADDP4
+ADDRGP4 ServerOptions_Event
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+12
+ADDP4
+CNSTI4 32
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+76
+ADDP4
+ADDRGP4 playerType_list
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+12
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+48
+ADDP4
+ADDRGP4 ServerOptions_PlayerNameEvent
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+56
+ADDP4
+ADDRGP4 PlayerName_Draw
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+64
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+3408+24
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+3408+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+3408+32
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+3408+16
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+3408+20
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+3408+12
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+3408+28
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+3408+12
+ADDP4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+12
+ADDP4
+CNSTI4 240
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+76
+ADDP4
+ADDRGP4 playerTeam_list
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1106
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1105
+ADDRGP4 s_serveroptions+5600
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+5600+4
+ADDRGP4 $404
+ASGNP4
+ADDRGP4 s_serveroptions+5600+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_serveroptions+5600+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+5600+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_serveroptions+5600+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+5600+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+5600+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+5600+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+5600+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 s_serveroptions+5512
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+5512+4
+ADDRGP4 $425
+ASGNP4
+ADDRGP4 s_serveroptions+5512+44
+CNSTU4 28944
+ASGNU4
+ADDRGP4 s_serveroptions+5512+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+5512+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+5512+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+5512+16
+CNSTI4 344
+ASGNI4
+ADDRGP4 s_serveroptions+5512+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+5512+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+5512+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+5512+60
+ADDRGP4 $442
+ASGNP4
+ADDRGP4 s_serveroptions+5424
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+5424+4
+ADDRGP4 $1210
+ASGNP4
+ADDRGP4 s_serveroptions+5424+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_serveroptions+5424+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+5424+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_serveroptions+5424+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+5424+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+5424+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+5424+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+5424+60
+ADDRGP4 $1227
+ASGNP4
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2088
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2184
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1233
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1237
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1237
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $1241
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1241
+LABELV $1234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1233
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 4
+EQI4 $1245
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+964
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1246
+JUMPV
+LABELV $1245
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1246
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $1251
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1628
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1251
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2024
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1256
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1256
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1260
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1692
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1260
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5600
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5424
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5944
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ServerOptions_SetMenuItems
+CALLV
+pop
+LABELV $899
+endproc ServerOptions_MenuInit 52 12
+export ServerOptions_Cache
+proc ServerOptions_Cache 0 4
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1210
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1227
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $337
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $309
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1268
+endproc ServerOptions_Cache 0 4
+proc UI_ServerOptionsMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ServerOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1269
+endproc UI_ServerOptionsMenu 0 4
+proc UI_BotSelectMenu_SortCompare 44 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $639
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $639
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+LABELV $1271
+endproc UI_BotSelectMenu_SortCompare 44 8
+proc UI_BotSelectMenu_BuildList 12 16
+ADDRGP4 botSelectInfo+4772
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4768
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+4776
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $1277
+ADDRLP4 8
+ADDRGP4 botSelectInfo+4776
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1277
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1284
+JUMPV
+LABELV $1281
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1282
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1284
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1281
+ADDRGP4 botSelectInfo+4784
+ARGP4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 UI_BotSelectMenu_SortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $1272
+endproc UI_BotSelectMenu_BuildList 12 16
+proc ServerPlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1291
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1292
+JUMPV
+LABELV $1291
+ADDRLP4 0
+ADDRGP4 $1293
+ASGNP4
+LABELV $1292
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1294
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1295
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1293
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $1295
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1297
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1295
+LABELV $1290
+endproc ServerPlayerIcon 80 20
+proc UI_BotSelectMenu_UpdateGrid 36 12
+ADDRLP4 4
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1300
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+GEI4 $1304
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1308
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ServerPlayerIcon
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $639
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BotAlreadySelected
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1315
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $1316
+JUMPV
+LABELV $1315
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $1316
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1305
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1301
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1300
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+LEI4 $1340
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 0
+LEI4 $1343
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1344
+JUMPV
+LABELV $1343
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1344
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1350
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1341
+JUMPV
+LABELV $1350
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $1341
+JUMPV
+LABELV $1340
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1341
+LABELV $1298
+endproc UI_BotSelectMenu_UpdateGrid 36 12
+proc UI_BotSelectMenu_Default 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1366
+JUMPV
+LABELV $1363
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $639
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1368
+ADDRGP4 $1365
+JUMPV
+LABELV $1368
+LABELV $1364
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1366
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1363
+LABELV $1365
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+NEI4 $1370
+ADDRGP4 botSelectInfo+4780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1362
+JUMPV
+LABELV $1370
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1377
+JUMPV
+LABELV $1374
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1379
+ADDRGP4 $1376
+JUMPV
+LABELV $1379
+LABELV $1375
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1377
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1374
+LABELV $1376
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+NEI4 $1382
+ADDRGP4 botSelectInfo+4780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1362
+JUMPV
+LABELV $1382
+ADDRGP4 botSelectInfo+4780
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1362
+endproc UI_BotSelectMenu_Default 28 8
+proc UI_BotSelectMenu_LeftEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1388
+ADDRGP4 $1387
+JUMPV
+LABELV $1388
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 0
+LEI4 $1390
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4772
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1390
+LABELV $1387
+endproc UI_BotSelectMenu_LeftEvent 4 0
+proc UI_BotSelectMenu_RightEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1397
+ADDRGP4 $1396
+JUMPV
+LABELV $1397
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1399
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4772
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1399
+LABELV $1396
+endproc UI_BotSelectMenu_RightEvent 4 0
+proc UI_BotSelectMenu_BotEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1407
+ADDRGP4 $1406
+JUMPV
+LABELV $1407
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1409
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1409
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1406
+endproc UI_BotSelectMenu_BotEvent 12 0
+proc UI_BotSelectMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1424
+ADDRGP4 $1423
+JUMPV
+LABELV $1424
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $1423
+endproc UI_BotSelectMenu_BackEvent 0 0
+proc UI_BotSelectMenu_SelectEvent 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1427
+ADDRGP4 $1426
+JUMPV
+LABELV $1427
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 s_serveroptions+5920
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+5928
+ARGP4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1426
+endproc UI_BotSelectMenu_SelectEvent 4 12
+export UI_BotSelectMenu_Cache
+proc UI_BotSelectMenu_Cache 0 4
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1434
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1435
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1436
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1437
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $341
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $369
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $387
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1433
+endproc UI_BotSelectMenu_Cache 0 4
+proc UI_BotSelectMenu_Init 36 12
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 10160
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botSelectInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 botSelectInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 botSelectInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 botSelectInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+288+60
+ADDRGP4 $1448
+ASGNP4
+ADDRGP4 botSelectInfo+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 botSelectInfo+288+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1456
+JUMPV
+LABELV $1453
+ADDRLP4 4
+CNSTI4 180
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1457
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+60
+ADDP4
+ADDRGP4 $1437
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+48
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+60
+ADDP4
+ADDRGP4 $1436
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+64
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1458
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $1457
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 86
+ADDI4
+ASGNI4
+LABELV $1454
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1456
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $1453
+ADDRGP4 botSelectInfo+4328
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4328+4
+ADDRGP4 $341
+ASGNP4
+ADDRGP4 botSelectInfo+4328+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 botSelectInfo+4328+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4328+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4328+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4328+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4416
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4416+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4416+48
+ADDRGP4 UI_BotSelectMenu_LeftEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4416+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4416+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4416+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4416+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4416+60
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 botSelectInfo+4504
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4504+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4504+48
+ADDRGP4 UI_BotSelectMenu_RightEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4504+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 botSelectInfo+4504+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4504+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4504+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4504+60
+ADDRGP4 $387
+ASGNP4
+ADDRGP4 botSelectInfo+4680
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4680+4
+ADDRGP4 $404
+ASGNP4
+ADDRGP4 botSelectInfo+4680+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4680+48
+ADDRGP4 UI_BotSelectMenu_BackEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4680+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 botSelectInfo+4680+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4680+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4680+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4680+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 botSelectInfo+4592
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4592+4
+ADDRGP4 $1434
+ASGNP4
+ADDRGP4 botSelectInfo+4592+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 botSelectInfo+4592+48
+ADDRGP4 UI_BotSelectMenu_SelectEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4592+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+4592+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4592+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4592+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4592+60
+ADDRGP4 $1435
+ASGNP4
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1598
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 72
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1599
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $1598
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4328
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4504
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_BuildList
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Default
+CALLV
+pop
+ADDRGP4 botSelectInfo+4772
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1438
+endproc UI_BotSelectMenu_Init 36 12
+export UI_BotSelectMenu
+proc UI_BotSelectMenu 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Init
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1612
+endproc UI_BotSelectMenu 0 4
+bss
+align 4
+LABELV botSelectInfo
+skip 10160
+align 4
+LABELV s_serveroptions
+skip 6040
+import punkbuster_items
+align 4
+LABELV s_startserver
+skip 6052
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1448
+byte 1 83
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $1437
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1436
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1435
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1434
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1308
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1297
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1294
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1293
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1227
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1210
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1083
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1067
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1051
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1042
+byte 1 68
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $1025
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1015
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $988
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $970
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $952
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $902
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $841
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $815
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $789
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $769
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $757
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $751
+byte 1 109
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $748
+byte 1 103
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $731
+byte 1 48
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $671
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $639
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $608
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $603
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $599
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $581
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $580
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $575
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $571
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $570
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $569
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $568
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $567
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $566
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $565
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $564
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $562
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $561
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $560
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $558
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $557
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $556
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $554
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $553
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $551
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $550
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $494
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $493
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $492
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $491
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $490
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $489
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $488
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $487
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $486
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $485
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $484
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $483
+byte 1 76
+byte 1 65
+byte 1 78
+byte 1 0
+align 1
+LABELV $482
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $472
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $442
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $425
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $421
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $404
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $369
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $341
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $337
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $309
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $306
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $274
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $260
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $246
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $238
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $205
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $142
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 83
+byte 1 32
+byte 1 70
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $110
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $97
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $94
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $91
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $88
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $85
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $76
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $75
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $74
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $73
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
@@ -0,0 +1,5190 @@
+data
+align 4
+LABELV driverinfo_artlist
+address $72
+address $73
+address $74
+address $75
+byte 4 0
+code
+proc DriverInfo_Event 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $78
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $83
+ADDRGP4 $80
+JUMPV
+LABELV $83
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $80
+LABELV $81
+LABELV $77
+endproc DriverInfo_Event 4 0
+proc DriverInfo_MenuDraw 12 20
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRGP4 $85
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 $86
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 192
+ARGI4
+ADDRGP4 $87
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRGP4 uis+56+1024
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 uis+56+2048
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 128
+ARGI4
+ADDRGP4 uis+56
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $93
+ARGP4
+ADDRGP4 uis+56+11272
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+11276
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+11280
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 168
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 208
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $100
+CNSTI4 316
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 324
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $103
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $100
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $108
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $108
+LABELV $84
+endproc DriverInfo_MenuDraw 12 20
+export DriverInfo_Cache
+proc DriverInfo_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $119
+ADDRGP4 $117
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $116
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $117
+LABELV $114
+endproc DriverInfo_Cache 4 4
+proc UI_DriverInfo_Menu 36 12
+ADDRGP4 s_driverinfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1908
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 s_driverinfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+268
+ADDRGP4 DriverInfo_MenuDraw
+ASGNP4
+ADDRGP4 s_driverinfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_driverinfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_driverinfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_driverinfo+288+60
+ADDRGP4 $131
+ASGNP4
+ADDRGP4 s_driverinfo+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_driverinfo+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+448+4
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_driverinfo+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+448+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+448+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_driverinfo+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+448+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_driverinfo+536
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+536+4
+ADDRGP4 $73
+ASGNP4
+ADDRGP4 s_driverinfo+536+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+536+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_driverinfo+536+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_driverinfo+536+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+536+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_driverinfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+360+4
+ADDRGP4 $74
+ASGNP4
+ADDRGP4 s_driverinfo+360+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_driverinfo+360+48
+ADDRGP4 DriverInfo_Event
+ASGNP4
+ADDRGP4 s_driverinfo+360+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_driverinfo+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+360+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_driverinfo+360+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_driverinfo+360+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_driverinfo+360+60
+ADDRGP4 $75
+ASGNP4
+ADDRGP4 s_driverinfo+624
+ARGP4
+ADDRGP4 uis+56+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 s_driverinfo+624
+ASGNP4
+ADDRGP4 $186
+JUMPV
+LABELV $189
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $190
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $189
+LABELV $192
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $198
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+EQI4 $198
+ADDRLP4 28
+ADDRGP4 s_driverinfo+1904
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $198
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $200
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+NEI4 $197
+LABELV $200
+LABELV $186
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 40
+GEI4 $201
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $190
+LABELV $201
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $202
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $208
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 62
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $208
+LABELV $203
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $205
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+LTI4 $202
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $121
+endproc UI_DriverInfo_Menu 36 12
+data
+align 4
+LABELV s_ivo_templates
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 4
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+align 4
+LABELV builtinResolutions
+address $218
+address $219
+address $220
+address $221
+address $222
+address $223
+address $224
+address $225
+address $226
+address $227
+address $228
+address $229
+byte 4 0
+align 4
+LABELV knownRatios
+address $230
+address $231
+address $232
+address $233
+address $234
+address $235
+address $236
+address $237
+address $238
+address $239
+address $240
+address $241
+address $242
+address $243
+byte 4 0
+byte 4 0
+align 4
+LABELV resolutions
+address builtinResolutions
+align 4
+LABELV resolutionsDetected
+byte 4 0
+code
+proc GraphicsOptions_FindBuiltinResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $245
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $247
+CNSTI4 -1
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $247
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $249
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $253
+LABELV $250
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $252
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $249
+CNSTI4 -1
+RETI4
+LABELV $244
+endproc GraphicsOptions_FindBuiltinResolution 12 8
+proc GraphicsOptions_FindDetectedResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $256
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $258
+CNSTI4 -1
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $258
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $260
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $264
+LABELV $261
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $260
+CNSTI4 -1
+RETI4
+LABELV $255
+endproc GraphicsOptions_FindDetectedResolution 12 8
+proc GraphicsOptions_GetAspectRatios 48 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $275
+JUMPV
+LABELV $272
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $274
+JUMPV
+LABELV $276
+LABELV $273
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $272
+LABELV $274
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $279
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $283
+ADDRGP4 $281
+JUMPV
+LABELV $283
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $279
+LABELV $281
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $285
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $285
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $268
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $270
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $266
+endproc GraphicsOptions_GetAspectRatios 48 16
+proc GraphicsOptions_GetInitialVideo 0 0
+ADDRGP4 s_ivo+28
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+32
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+8
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_ivo+12
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+20
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+24
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+16
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+ASGNI4
+LABELV $287
+endproc GraphicsOptions_GetInitialVideo 0 0
+proc GraphicsOptions_GetResolutions 24 12
+ADDRGP4 $315
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 resbuf
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 resbuf
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $316
+ADDRLP4 4
+ADDRGP4 resbuf
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 16
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $321
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $321
+LABELV $319
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $323
+ADDRLP4 8
+INDIRU4
+CNSTU4 31
+LTU4 $318
+LABELV $323
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $324
+ADDRGP4 resolutions
+ADDRGP4 detectedResolutions
+ASGNP4
+ADDRGP4 resolutionsDetected
+CNSTI4 1
+ASGNI4
+LABELV $324
+LABELV $316
+LABELV $314
+endproc GraphicsOptions_GetResolutions 24 12
+proc GraphicsOptions_CheckConfig 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $327
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+28
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+EQI4 $331
+ADDRGP4 $328
+JUMPV
+LABELV $331
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+EQI4 $336
+ADDRGP4 $328
+JUMPV
+LABELV $336
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+4
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+EQI4 $340
+ADDRGP4 $328
+JUMPV
+LABELV $340
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+EQF4 $345
+ADDRGP4 $328
+JUMPV
+LABELV $345
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+12
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+EQI4 $350
+ADDRGP4 $328
+JUMPV
+LABELV $350
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+20
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+EQI4 $355
+ADDRGP4 $328
+JUMPV
+LABELV $355
+CNSTI4 36
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+24
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+EQI4 $360
+ADDRGP4 $328
+JUMPV
+LABELV $360
+ADDRGP4 s_graphicsoptions+824+64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $328
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $330
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 5
+LTU4 $327
+ADDRGP4 s_graphicsoptions+824+64
+CNSTI4 5
+ASGNI4
+LABELV $326
+endproc GraphicsOptions_CheckConfig 8 4
+proc GraphicsOptions_UpdateMenuItems 8 0
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+CNSTI4 1
+NEI4 $370
+ADDRGP4 s_graphicsoptions+1284+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1284+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1284+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $371
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+CNSTI4 0
+NEI4 $384
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 1
+ASGNI4
+LABELV $384
+LABELV $380
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_ivo
+INDIRI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+EQI4 $392
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $392
+ADDRGP4 s_ivo+4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+EQI4 $398
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $398
+ADDRGP4 s_ivo+32
+INDIRI4
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+EQI4 $405
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $405
+ADDRGP4 s_ivo+8
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+EQF4 $412
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $412
+ADDRGP4 s_ivo+12
+INDIRI4
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+EQI4 $419
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $419
+ADDRGP4 s_ivo+28
+INDIRI4
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+EQI4 $426
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $426
+ADDRGP4 s_ivo+16
+INDIRI4
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+EQI4 $433
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $433
+ADDRGP4 s_ivo+20
+INDIRI4
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+EQI4 $440
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $440
+ADDRGP4 s_ivo+24
+INDIRI4
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+EQI4 $447
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $447
+ADDRGP4 GraphicsOptions_CheckConfig
+CALLV
+pop
+LABELV $369
+endproc GraphicsOptions_UpdateMenuItems 8 0
+proc GraphicsOptions_ApplyChanges 52 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $455
+ADDRGP4 $454
+JUMPV
+LABELV $455
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $463
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $464
+ADDRGP4 $457
+JUMPV
+LABELV $461
+ADDRGP4 $462
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $458
+JUMPV
+LABELV $463
+ADDRGP4 $462
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $458
+JUMPV
+LABELV $464
+ADDRGP4 $462
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $457
+LABELV $458
+ADDRGP4 $465
+ARGP4
+CNSTF4 1077936128
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $468
+ARGP4
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $471
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 -1
+EQI4 $479
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $473
+LABELV $479
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 0
+ASGNI4
+LABELV $473
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 GraphicsOptions_FindBuiltinResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $484
+ADDRLP4 12
+ARGP4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 44
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 48
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $490
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $491
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $484
+ADDRGP4 $492
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRGP4 $492
+ARGP4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $472
+ADDRGP4 $495
+ARGP4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $498
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $499
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $500
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $501
+ARGP4
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+CNSTI4 2
+NEI4 $504
+ADDRGP4 $508
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $509
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+CNSTI4 1
+NEI4 $510
+ADDRGP4 $508
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $509
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRGP4 $508
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $509
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $511
+LABELV $505
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+CNSTI4 0
+EQI4 $514
+ADDRGP4 $518
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRGP4 $518
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $515
+CNSTI4 2
+ARGI4
+ADDRGP4 $521
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $454
+endproc GraphicsOptions_ApplyChanges 52 12
+proc GraphicsOptions_Event 16 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $523
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 101
+LTI4 $525
+ADDRLP4 4
+INDIRI4
+CNSTI4 110
+GTI4 $525
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $581-404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $581
+address $576
+address $525
+address $554
+address $533
+address $575
+address $526
+address $578
+address $579
+address $580
+address $528
+code
+LABELV $528
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $533
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+CNSTI4 1
+NEI4 $534
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+GEI4 $538
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 6
+LEI4 $544
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 6
+ASGNI4
+LABELV $544
+LABELV $539
+LABELV $534
+ADDRGP4 s_graphicsoptions+920+64
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $554
+ADDRLP4 0
+CNSTI4 36
+ADDRGP4 s_graphicsoptions+824+64
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+64
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1208+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1380+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $526
+JUMPV
+LABELV $575
+ADDRGP4 UI_DriverInfo_Menu
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $576
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $578
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $579
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $580
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+LABELV $525
+LABELV $526
+LABELV $522
+endproc GraphicsOptions_Event 16 4
+proc GraphicsOptions_TQEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $584
+ADDRGP4 $583
+JUMPV
+LABELV $584
+ADDRGP4 s_graphicsoptions+1208+68
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $583
+endproc GraphicsOptions_TQEvent 0 0
+export GraphicsOptions_MenuDraw
+proc GraphicsOptions_MenuDraw 0 4
+ADDRGP4 GraphicsOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $590
+endproc GraphicsOptions_MenuDraw 0 4
+proc GraphicsOptions_SetMenuItems 1056 12
+ADDRGP4 $492
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 0
+GEI4 $594
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRGP4 $490
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1022
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1036
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+ADDRLP4 12
+ADDP4
+CNSTI1 120
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 1044
+INDIRU4
+ADDRLP4 12
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1048
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $600
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $604
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $604
+LABELV $601
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $603
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $600
+LABELV $602
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 0
+GEI4 $599
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $599
+JUMPV
+LABELV $598
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 3
+ASGNI4
+LABELV $599
+LABELV $594
+ADDRGP4 s_graphicsoptions+920+64
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1284+64
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1476+64
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1208+68
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+CNSTF4 0
+GEF4 $626
+ADDRGP4 s_graphicsoptions+1208+68
+CNSTF4 0
+ASGNF4
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRGP4 s_graphicsoptions+1208+68
+INDIRF4
+CNSTF4 1077936128
+LEF4 $632
+ADDRGP4 s_graphicsoptions+1208+68
+CNSTF4 1077936128
+ASGNF4
+LABELV $632
+LABELV $627
+ADDRGP4 $501
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+EQF4 $641
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $642
+JUMPV
+LABELV $641
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $642
+ADDRGP4 s_graphicsoptions+1380+64
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+CNSTI4 16
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $649
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $656
+LABELV $655
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRGP4 $643
+JUMPV
+LABELV $656
+ADDRLP4 28
+INDIRI4
+CNSTI4 32
+EQI4 $652
+ADDRGP4 $643
+JUMPV
+LABELV $643
+LABELV $646
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $649
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $652
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 2
+ASGNI4
+LABELV $644
+ADDRGP4 $518
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $657
+ADDRGP4 s_graphicsoptions+1764+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRGP4 s_graphicsoptions+1764+64
+CNSTI4 1
+ASGNI4
+LABELV $658
+ADDRGP4 $508
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+LEF4 $663
+ADDRGP4 $509
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1101004800
+LTF4 $665
+ADDRGP4 s_graphicsoptions+1668+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $665
+ADDRGP4 s_graphicsoptions+1668+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRGP4 s_graphicsoptions+1668+64
+CNSTI4 2
+ASGNI4
+LABELV $664
+LABELV $591
+endproc GraphicsOptions_SetMenuItems 1056 12
+data
+align 4
+LABELV $674
+address $675
+address $676
+byte 4 0
+align 4
+LABELV $677
+address $675
+address $678
+address $679
+byte 4 0
+align 4
+LABELV $680
+address $681
+address $682
+address $683
+address $684
+address $685
+address $686
+byte 4 0
+align 4
+LABELV $687
+address $688
+address $689
+byte 4 0
+align 4
+LABELV $690
+address $691
+address $692
+byte 4 0
+align 4
+LABELV $693
+address $694
+address $695
+address $696
+byte 4 0
+align 4
+LABELV $697
+address $698
+address $699
+byte 4 0
+export GraphicsOptions_MenuInit
+code
+proc GraphicsOptions_MenuInit 12 12
+ADDRGP4 s_graphicsoptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2108
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 GraphicsOptions_GetResolutions
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetAspectRatios
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+268
+ADDRGP4 GraphicsOptions_MenuDraw
+ASGNP4
+ADDRGP4 s_graphicsoptions+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+60
+ADDRGP4 $710
+ASGNP4
+ADDRGP4 s_graphicsoptions+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_graphicsoptions+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+4
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_graphicsoptions+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_graphicsoptions+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+4
+ADDRGP4 $73
+ASGNP4
+ADDRGP4 s_graphicsoptions+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_graphicsoptions+536
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+44
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_graphicsoptions+536+8
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+536+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+60
+ADDRGP4 $754
+ASGNP4
+ADDRGP4 s_graphicsoptions+536+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+608
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+608+8
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+608+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+60
+ADDRGP4 $772
+ASGNP4
+ADDRGP4 s_graphicsoptions+608+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+680
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+680+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+60
+ADDRGP4 $790
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+752
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+752+8
+CNSTI4 109
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+752+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+60
+ADDRGP4 $808
+ASGNP4
+ADDRGP4 s_graphicsoptions+752+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+CNSTI4 114
+ASGNI4
+ADDRGP4 s_graphicsoptions+824
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+4
+ADDRGP4 $816
+ASGNP4
+ADDRGP4 s_graphicsoptions+824+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+824+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+824+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+76
+ADDRGP4 $680
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+4
+ADDRGP4 $832
+ASGNP4
+ADDRGP4 s_graphicsoptions+1112+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1112+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+76
+ADDRGP4 $674
+ASGNP4
+ADDRGP4 uis+56+11284
+INDIRI4
+CNSTI4 2
+NEI4 $846
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $847
+JUMPV
+LABELV $846
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $847
+ADDRGP4 s_graphicsoptions+1112+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+4
+ADDRGP4 $851
+ASGNP4
+ADDRGP4 s_graphicsoptions+1476+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1476+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+76
+ADDRGP4 $697
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+4
+ADDRGP4 $863
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+920+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+76
+ADDRGP4 ratios
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+8
+CNSTI4 110
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+4
+ADDRGP4 $879
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1016+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+76
+ADDRGP4 resolutions
+INDIRP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+8
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+4
+ADDRGP4 $895
+ASGNP4
+ADDRGP4 s_graphicsoptions+1284+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1284+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+76
+ADDRGP4 $697
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380+4
+ADDRGP4 $907
+ASGNP4
+ADDRGP4 s_graphicsoptions+1380+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1380+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380+76
+ADDRGP4 $687
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+4
+ADDRGP4 $919
+ASGNP4
+ADDRGP4 s_graphicsoptions+1668+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1668+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+76
+ADDRGP4 $693
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+1208+4
+ADDRGP4 $931
+ASGNP4
+ADDRGP4 s_graphicsoptions+1208+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1208+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1208+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1208+60
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_graphicsoptions+1208+64
+CNSTF4 1077936128
+ASGNF4
+ADDRGP4 s_graphicsoptions+1208+48
+ADDRGP4 GraphicsOptions_TQEvent
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+4
+ADDRGP4 $947
+ASGNP4
+ADDRGP4 s_graphicsoptions+1572+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1572+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+76
+ADDRGP4 $677
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+4
+ADDRGP4 $959
+ASGNP4
+ADDRGP4 s_graphicsoptions+1764+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1764+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+76
+ADDRGP4 $690
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_graphicsoptions+1860+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1860+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+60
+ADDRGP4 $981
+ASGNP4
+ADDRGP4 s_graphicsoptions+1860+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+4
+ADDRGP4 $74
+ASGNP4
+ADDRGP4 s_graphicsoptions+2020+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_graphicsoptions+2020+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2020+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+60
+ADDRGP4 $75
+ASGNP4
+ADDRGP4 s_graphicsoptions+1932
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+4
+ADDRGP4 $1008
+ASGNP4
+ADDRGP4 s_graphicsoptions+1932+44
+CNSTU4 20752
+ASGNU4
+ADDRGP4 s_graphicsoptions+1932+48
+ADDRGP4 GraphicsOptions_ApplyChanges
+ASGNP4
+ADDRGP4 s_graphicsoptions+1932+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+60
+ADDRGP4 $1023
+ASGNP4
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1476
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+920
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1016
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1284
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1380
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1668
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1572
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1764
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2020
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1932
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 GraphicsOptions_SetMenuItems
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetInitialVideo
+CALLV
+pop
+ADDRGP4 uis+56+11284
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+ADDRGP4 uis+56+11288
+INDIRI4
+CNSTI4 1
+NEI4 $1045
+ADDRLP4 8
+ADDRGP4 s_graphicsoptions+1112+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $1045
+LABELV $673
+endproc GraphicsOptions_MenuInit 12 12
+export GraphicsOptions_Cache
+proc GraphicsOptions_Cache 0 4
+ADDRGP4 $72
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $73
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $74
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $75
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1008
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1023
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1053
+endproc GraphicsOptions_Cache 0 4
+export UI_GraphicsOptionsMenu
+proc UI_GraphicsOptionsMenu 0 8
+ADDRGP4 GraphicsOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+536
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $1054
+endproc UI_GraphicsOptionsMenu 0 8
+bss
+align 4
+LABELV detectedResolutions
+skip 128
+align 1
+LABELV resbuf
+skip 1024
+align 4
+LABELV resToRatio
+skip 128
+align 4
+LABELV ratioToRes
+skip 128
+align 1
+LABELV ratioBuf
+skip 256
+align 4
+LABELV ratios
+skip 128
+align 4
+LABELV s_graphicsoptions
+skip 2108
+align 4
+LABELV s_ivo
+skip 36
+align 4
+LABELV s_driverinfo
+skip 1908
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Multiply
+import Matrix4Copy
+import Matrix4Compare
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1023
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1008
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $981
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $959
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $947
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $931
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $919
+byte 1 71
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $907
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $895
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $879
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $863
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 58
+byte 1 0
+align 1
+LABELV $851
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $832
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $816
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $808
+byte 1 78
+byte 1 69
+byte 1 84
+byte 1 87
+byte 1 79
+byte 1 82
+byte 1 75
+byte 1 0
+align 1
+LABELV $790
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $772
+byte 1 68
+byte 1 73
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 0
+align 1
+LABELV $754
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 72
+byte 1 73
+byte 1 67
+byte 1 83
+byte 1 0
+align 1
+LABELV $710
+byte 1 83
+byte 1 89
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $699
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $698
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $696
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $695
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $694
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $692
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $691
+byte 1 66
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $689
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $688
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $686
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $685
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $684
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $683
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $682
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $681
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $679
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $678
+byte 1 49
+byte 1 54
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $676
+byte 1 86
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 0
+align 1
+LABELV $675
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $521
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $520
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $519
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $518
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $509
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $508
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $501
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $500
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $499
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $498
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $495
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $492
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $491
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $490
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $468
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $465
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $462
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $315
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $271
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $243
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $242
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $241
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $240
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $239
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $238
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $237
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $236
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $235
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $234
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $233
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $232
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $231
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $230
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $229
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $228
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $227
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $226
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $225
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $224
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $223
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $222
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $221
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $220
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $219
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $218
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $131
+byte 1 68
+byte 1 82
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $93
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $87
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $86
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $85
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $75
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $74
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
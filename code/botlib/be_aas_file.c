@@ -287,7 +287,7 @@ void AAS_FileInfo(void)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-char *AAS_LoadAASLump(fileHandle_t fp, int offset, int length, int *lastoffset, int size)
+char *AAS_LoadAASLump(byte *data, int filelength, int offset, int length, int size)
 {
 	char *buf;
 	//
@@ -296,29 +296,32 @@ char *AAS_LoadAASLump(fileHandle_t fp, int offset, int length, int *lastoffset,
 		//just alloc a dummy
 		return (char *) GetClearedHunkMemory(size+1);
 	} //end if
-	//seek to the data
-	if (offset != *lastoffset)
+	//the data has to be in the file, the caller frees it on failure
+	if (offset < 0 || length < 0 || offset > filelength - length)
 	{
-		botimport.Print(PRT_WARNING, "AAS file not sequentially read\n");
-		if (botimport.FS_Seek(fp, offset, FS_SEEK_SET))
-		{
-			AAS_Error("can't seek to aas lump\n");
-			AAS_DumpAASData();
-			botimport.FS_FCloseFile(fp);
-			return NULL;
-		} //end if
+		AAS_Error("aas lump out of range\n");
+		return NULL;
 	} //end if
 	//allocate memory
 	buf = (char *) GetClearedHunkMemory(length+1);
-	//read the data
-	if (length)
-	{
-		botimport.FS_Read(buf, length, fp );
-		*lastoffset += length;
-	} //end if
+	//copy the data
+	Com_Memcpy(buf, data + offset, length);
 	return buf;
 } //end of the function AAS_LoadAASLump
 //===========================================================================
+// drop what was loaded of an AAS file and the file itself
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_LoadAASLumpFailed(byte *data)
+{
+	AAS_DumpAASData();
+	botimport.FS_FreeFile(data);
+	return BLERR_CANNOTREADAASLUMP;
+} //end of the function AAS_LoadAASLumpFailed
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -342,29 +345,34 @@ void AAS_DData(unsigned char *data, int size)
 //===========================================================================
 int AAS_LoadAASFile(char *filename)
 {
-	fileHandle_t fp;
+	byte *data;
 	aas_header_t header;
-	int offset, length, lastoffset;
+	int offset, length, filelength;
 
 	botimport.Print(PRT_MESSAGE, "trying to load %s\n", filename);
 	//dump current loaded aas file
 	AAS_DumpAASData();
-	//open the file
-	botimport.FS_FOpenFile( filename, &fp, FS_READ );
-	if (!fp)
+	//read the whole file, the server may have read it ahead
+	filelength = botimport.FS_ReadFile(filename, (void **) &data);
+	if (!data)
 	{
 		AAS_Error("can't open %s\n", filename);
 		return BLERR_CANNOTOPENAASFILE;
 	} //end if
+	if (filelength < (int) sizeof(aas_header_t))
+	{
+		AAS_Error("%s is not an AAS file\n", filename);
+		botimport.FS_FreeFile(data);
+		return BLERR_WRONGAASFILEID;
+	} //end if
 	//read the header
-	botimport.FS_Read(&header, sizeof(aas_header_t), fp );
-	lastoffset = sizeof(aas_header_t);
+	Com_Memcpy(&header, data, sizeof(aas_header_t));
 	//check header identification
 	header.ident = LittleLong(header.ident);
 	if (header.ident != AASID)
 	{
 		AAS_Error("%s is not an AAS file\n", filename);
-		botimport.FS_FCloseFile(fp);
+		botimport.FS_FreeFile(data);
 		return BLERR_WRONGAASFILEID;
 	} //end if
 	//check the version
@@ -373,7 +381,7 @@ int AAS_LoadAASFile(char *filename)
 	if (header.version != AASVERSION_OLD && header.version != AASVERSION)
 	{
 		AAS_Error("aas file %s is version %i, not %i\n", filename, header.version, AASVERSION);
-		botimport.FS_FCloseFile(fp);
+		botimport.FS_FreeFile(data);
 		return BLERR_WRONGAASFILEVERSION;
 	} //end if
 	//
@@ -386,100 +394,100 @@ int AAS_LoadAASFile(char *filename)
 	if (LittleLong(header.bspchecksum) != aasworld.bspchecksum)
 	{
 		AAS_Error("aas file %s is out of date\n", filename);
-		botimport.FS_FCloseFile(fp);
+		botimport.FS_FreeFile(data);
 		return BLERR_WRONGAASFILEVERSION;
 	} //end if
 	//load the lumps:
 	//bounding boxes
 	offset = LittleLong(header.lumps[AASLUMP_BBOXES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_BBOXES].filelen);
-	aasworld.bboxes = (aas_bbox_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_bbox_t));
+	aasworld.bboxes = (aas_bbox_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_bbox_t));
 	aasworld.numbboxes = length / sizeof(aas_bbox_t);
-	if (aasworld.numbboxes && !aasworld.bboxes) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.bboxes) return AAS_LoadAASLumpFailed(data);
 	//vertexes
 	offset = LittleLong(header.lumps[AASLUMP_VERTEXES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_VERTEXES].filelen);
-	aasworld.vertexes = (aas_vertex_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_vertex_t));
+	aasworld.vertexes = (aas_vertex_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_vertex_t));
 	aasworld.numvertexes = length / sizeof(aas_vertex_t);
-	if (aasworld.numvertexes && !aasworld.vertexes) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.vertexes) return AAS_LoadAASLumpFailed(data);
 	//planes
 	offset = LittleLong(header.lumps[AASLUMP_PLANES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_PLANES].filelen);
-	aasworld.planes = (aas_plane_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_plane_t));
+	aasworld.planes = (aas_plane_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_plane_t));
 	aasworld.numplanes = length / sizeof(aas_plane_t);
-	if (aasworld.numplanes && !aasworld.planes) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.planes) return AAS_LoadAASLumpFailed(data);
 	//edges
 	offset = LittleLong(header.lumps[AASLUMP_EDGES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_EDGES].filelen);
-	aasworld.edges = (aas_edge_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_edge_t));
+	aasworld.edges = (aas_edge_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_edge_t));
 	aasworld.numedges = length / sizeof(aas_edge_t);
-	if (aasworld.numedges && !aasworld.edges) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.edges) return AAS_LoadAASLumpFailed(data);
 	//edgeindex
 	offset = LittleLong(header.lumps[AASLUMP_EDGEINDEX].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_EDGEINDEX].filelen);
-	aasworld.edgeindex = (aas_edgeindex_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_edgeindex_t));
+	aasworld.edgeindex = (aas_edgeindex_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_edgeindex_t));
 	aasworld.edgeindexsize = length / sizeof(aas_edgeindex_t);
-	if (aasworld.edgeindexsize && !aasworld.edgeindex) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.edgeindex) return AAS_LoadAASLumpFailed(data);
 	//faces
 	offset = LittleLong(header.lumps[AASLUMP_FACES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_FACES].filelen);
-	aasworld.faces = (aas_face_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_face_t));
+	aasworld.faces = (aas_face_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_face_t));
 	aasworld.numfaces = length / sizeof(aas_face_t);
-	if (aasworld.numfaces && !aasworld.faces) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.faces) return AAS_LoadAASLumpFailed(data);
 	//faceindex
 	offset = LittleLong(header.lumps[AASLUMP_FACEINDEX].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_FACEINDEX].filelen);
-	aasworld.faceindex = (aas_faceindex_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_faceindex_t));
+	aasworld.faceindex = (aas_faceindex_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_faceindex_t));
 	aasworld.faceindexsize = length / sizeof(aas_faceindex_t);
-	if (aasworld.faceindexsize && !aasworld.faceindex) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.faceindex) return AAS_LoadAASLumpFailed(data);
 	//convex areas
 	offset = LittleLong(header.lumps[AASLUMP_AREAS].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_AREAS].filelen);
-	aasworld.areas = (aas_area_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_area_t));
+	aasworld.areas = (aas_area_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_area_t));
 	aasworld.numareas = length / sizeof(aas_area_t);
-	if (aasworld.numareas && !aasworld.areas) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.areas) return AAS_LoadAASLumpFailed(data);
 	//area settings
 	offset = LittleLong(header.lumps[AASLUMP_AREASETTINGS].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_AREASETTINGS].filelen);
-	aasworld.areasettings = (aas_areasettings_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_areasettings_t));
+	aasworld.areasettings = (aas_areasettings_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_areasettings_t));
 	aasworld.numareasettings = length / sizeof(aas_areasettings_t);
-	if (aasworld.numareasettings && !aasworld.areasettings) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.areasettings) return AAS_LoadAASLumpFailed(data);
 	//reachability list
 	offset = LittleLong(header.lumps[AASLUMP_REACHABILITY].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_REACHABILITY].filelen);
-	aasworld.reachability = (aas_reachability_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_reachability_t));
+	aasworld.reachability = (aas_reachability_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_reachability_t));
 	aasworld.reachabilitysize = length / sizeof(aas_reachability_t);
-	if (aasworld.reachabilitysize && !aasworld.reachability) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.reachability) return AAS_LoadAASLumpFailed(data);
 	//nodes
 	offset = LittleLong(header.lumps[AASLUMP_NODES].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_NODES].filelen);
-	aasworld.nodes = (aas_node_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_node_t));
+	aasworld.nodes = (aas_node_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_node_t));
 	aasworld.numnodes = length / sizeof(aas_node_t);
-	if (aasworld.numnodes && !aasworld.nodes) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.nodes) return AAS_LoadAASLumpFailed(data);
 	//cluster portals
 	offset = LittleLong(header.lumps[AASLUMP_PORTALS].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_PORTALS].filelen);
-	aasworld.portals = (aas_portal_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_portal_t));
+	aasworld.portals = (aas_portal_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_portal_t));
 	aasworld.numportals = length / sizeof(aas_portal_t);
-	if (aasworld.numportals && !aasworld.portals) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.portals) return AAS_LoadAASLumpFailed(data);
 	//cluster portal index
 	offset = LittleLong(header.lumps[AASLUMP_PORTALINDEX].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_PORTALINDEX].filelen);
-	aasworld.portalindex = (aas_portalindex_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_portalindex_t));
+	aasworld.portalindex = (aas_portalindex_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_portalindex_t));
 	aasworld.portalindexsize = length / sizeof(aas_portalindex_t);
-	if (aasworld.portalindexsize && !aasworld.portalindex) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.portalindex) return AAS_LoadAASLumpFailed(data);
 	//clusters
 	offset = LittleLong(header.lumps[AASLUMP_CLUSTERS].fileofs);
 	length = LittleLong(header.lumps[AASLUMP_CLUSTERS].filelen);
-	aasworld.clusters = (aas_cluster_t *) AAS_LoadAASLump(fp, offset, length, &lastoffset, sizeof(aas_cluster_t));
+	aasworld.clusters = (aas_cluster_t *) AAS_LoadAASLump(data, filelength, offset, length, sizeof(aas_cluster_t));
 	aasworld.numclusters = length / sizeof(aas_cluster_t);
-	if (aasworld.numclusters && !aasworld.clusters) return BLERR_CANNOTREADAASLUMP;
+	if (!aasworld.clusters) return AAS_LoadAASLumpFailed(data);
 	//swap everything
 	AAS_SwapAASData();
 	//aas file is loaded
 	aasworld.loaded = qtrue;
-	//close the file
-	botimport.FS_FCloseFile(fp);
+	//free the file
+	botimport.FS_FreeFile(data);
 	//
 #ifdef AASFILEDEBUG
 	AAS_FileInfo();
@@ -1539,6 +1539,9 @@ void		trap_CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const v
 					  const vec3_t mins, const vec3_t maxs,
 					  clipHandle_t model, int brushmask,
 					  const vec3_t origin, const vec3_t angles );
+// runs every request against the same model, passEntityNum is unused
+void		trap_CM_TraceBatch( trace_t *results, const traceRequest_t *requests, int numRequests,
+					  clipHandle_t model );
 
 // Returns the projection of a polygon onto the solid brushes in the world
 int			trap_CM_MarkFragments( int numPoints, const vec3_t *points, 
@@ -166,6 +166,7 @@ typedef enum {
 	CG_FS_SEEK,
 	CG_SET_AIMING_ANGLES,
 	CG_SET_CAMERA_ANGLES,
+	CG_CM_TRACEBATCH,
 
 /*
 	CG_LOADCAMERA,
@@ -179,6 +179,11 @@ void	trap_CM_TransformedCapsuleTrace( trace_t *results, const vec3_t start, cons
 	syscall( CG_CM_TRANSFORMEDCAPSULETRACE, results, start, end, mins, maxs, model, brushmask, origin, angles );
 }
 
+void	trap_CM_TraceBatch( trace_t *results, const traceRequest_t *requests, int numRequests,
+						  clipHandle_t model ) {
+	syscall( CG_CM_TRACEBATCH, results, requests, numRequests, model );
+}
+
 int		trap_CM_MarkFragments( int numPoints, const vec3_t *points, 
 				const vec3_t projection,
 				int maxPoints, vec3_t pointBuffer,
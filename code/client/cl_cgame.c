@@ -403,6 +403,23 @@ void CL_ShutdownCGame( void ) {
 	cgvm = NULL;
 }
 
+/*
+====================
+CL_CM_TraceBatch
+
+====================
+*/
+static void CL_CM_TraceBatch( trace_t *results, const traceRequest_t *requests, int numRequests, clipHandle_t model ) {
+	const traceRequest_t *req;
+	int		i;
+
+	for ( i = 0; i < numRequests; i++ ) {
+		req = &requests[i];
+		CM_BoxTrace( &results[i], req->start, req->end, (float *)req->mins, (float *)req->maxs,
+			model, req->contentmask, req->capsule );
+	}
+}
+
 static int	FloatAsInt( float f ) {
 	floatint_t fi;
 	fi.f = f;
@@ -710,6 +727,11 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 		CL_SetCameraAngles( VMA(1) );
 		return 0;
 
+	case CG_CM_TRACEBATCH:
+		CL_CM_TraceBatch( VM_ArgArray( args[1], sizeof( trace_t ), args[3] ),
+			VM_ArgArray( args[2], sizeof( traceRequest_t ), args[3] ), args[3], args[4] );
+		return 0;
+
 	default:
 	        assert(0);
 		Com_Error( ERR_DROP, "Bad cgame system trap: %ld", (long int) args[0] );
@@ -1502,6 +1502,7 @@ void CL_Disconnect( qboolean showMainMenu ) {
 		CL_WritePacket();
 		CL_WritePacket();
 		CL_WritePacket();
+		Sys_FlushPackets();
 	}
 	
 	// Remove pure paks
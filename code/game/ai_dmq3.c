@@ -2820,6 +2820,42 @@ qboolean InFieldOfVision(vec3_t viewangles, float fov, vec3_t angles)
 	return qtrue;
 }
 
+/*
+==================
+BotVisibilityRequest
+
+sets up the trace between the eye and one of the sample points of the entity
+==================
+*/
+static int BotVisibilityRequest(traceRequest_t *request, int viewer, vec3_t eye, int inwater, int ent, vec3_t point) {
+	int contents_mask, hitent;
+
+	contents_mask = CONTENTS_SOLID|CONTENTS_PLAYERCLIP;
+	request->passEntityNum = viewer;
+	hitent = ent;
+	VectorCopy(eye, request->start);
+	VectorCopy(point, request->end);
+	//if the entity is in water, lava or slime
+	if (trap_AAS_PointContents(point) & (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER)) {
+		contents_mask |= (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER);
+	}
+	//if eye is in water, lava or slime
+	if (inwater) {
+		if (!(contents_mask & (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER))) {
+			request->passEntityNum = ent;
+			hitent = viewer;
+			VectorCopy(point, request->start);
+			VectorCopy(eye, request->end);
+		}
+		contents_mask ^= (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER);
+	}
+	VectorClear(request->mins);
+	VectorClear(request->maxs);
+	request->contentmask = contents_mask;
+	request->capsule = qfalse;
+	return hitent;
+}
+
 /*
 ==================
 BotEntityVisible
@@ -2828,21 +2864,27 @@ returns visibility in the range [0, 1] taking fog and water surfaces into accoun
 ==================
 */
 float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int ent) {
-	int i, contents_mask, passent, hitent, infog, inwater, otherinfog, pc;
+	int i, contents_mask, passent, hitent[3], infog, inwater, otherinfog, pc;
 	float squaredfogdist, waterfactor, vis, bestvis;
-	bsp_trace_t trace;
+	bsp_trace_t trace, traces[3];
+	traceRequest_t requests[3];
 	aas_entityinfo_t entinfo;
-	vec3_t dir, entangles, start, end, middle;
+	vec3_t dir, entangles, start, end, middle[3];
 
 	//calculate middle of bounding box
 	BotEntityInfo(ent, &entinfo);
-	VectorAdd(entinfo.mins, entinfo.maxs, middle);
-	VectorScale(middle, 0.5, middle);
-	VectorAdd(entinfo.origin, middle, middle);
+	VectorAdd(entinfo.mins, entinfo.maxs, middle[0]);
+	VectorScale(middle[0], 0.5, middle[0]);
+	VectorAdd(entinfo.origin, middle[0], middle[0]);
 	//check if entity is within field of vision
-	VectorSubtract(middle, eye, dir);
+	VectorSubtract(middle[0], eye, dir);
 	vectoangles(dir, entangles);
 	if (!InFieldOfVision(viewangles, fov, entangles)) return 0;
+	//check bottom and top of bounding box as well
+	VectorCopy(middle[0], middle[1]);
+	middle[1][2] += entinfo.mins[2];
+	VectorCopy(middle[0], middle[2]);
+	middle[2][2] += entinfo.maxs[2];
 	//
 	pc = trap_AAS_PointContents(eye);
 	infog = (pc & CONTENTS_FOG);
@@ -2853,27 +2895,20 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 		//if the point is not in potential visible sight
 		//if (!AAS_inPVS(eye, middle)) continue;
 		//
-		contents_mask = CONTENTS_SOLID|CONTENTS_PLAYERCLIP;
-		passent = viewer;
-		hitent = ent;
-		VectorCopy(eye, start);
-		VectorCopy(middle, end);
-		//if the entity is in water, lava or slime
-		if (trap_AAS_PointContents(middle) & (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER)) {
-			contents_mask |= (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER);
-		}
-		//if eye is in water, lava or slime
-		if (inwater) {
-			if (!(contents_mask & (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER))) {
-				passent = ent;
-				hitent = viewer;
-				VectorCopy(middle, start);
-				VectorCopy(eye, end);
-			}
-			contents_mask ^= (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER);
-		}
-		//trace from start to end
-		BotAI_Trace(&trace, start, NULL, NULL, end, passent, contents_mask);
+		//the middle usually decides it, the bottom and top are traced together
+		if (i == 0) {
+			hitent[0] = BotVisibilityRequest(&requests[0], viewer, eye, inwater, ent, middle[0]);
+			BotAI_TraceBatch(&traces[0], &requests[0], 1);
+		}
+		else if (i == 1) {
+			hitent[1] = BotVisibilityRequest(&requests[1], viewer, eye, inwater, ent, middle[1]);
+			hitent[2] = BotVisibilityRequest(&requests[2], viewer, eye, inwater, ent, middle[2]);
+			BotAI_TraceBatch(&traces[1], &requests[1], 2);
+		}
+		trace = traces[i];
+		contents_mask = requests[i].contentmask;
+		passent = requests[i].passEntityNum;
+		VectorCopy(requests[i].end, end);
 		//if water was hit
 		waterfactor = 1.0;
 		if (trace.contents & (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER)) {
@@ -2886,10 +2921,10 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 			}
 		}
 		//if a full trace or the hitent was hit
-		if (trace.fraction >= 1 || trace.ent == hitent) {
+		if (trace.fraction >= 1 || trace.ent == hitent[i]) {
 			//check for fog, assuming there's only one fog brush where
 			//either the viewer or the entity is in or both are in
-			otherinfog = (trap_AAS_PointContents(middle) & CONTENTS_FOG);
+			otherinfog = (trap_AAS_PointContents(middle[i]) & CONTENTS_FOG);
 			if (infog && otherinfog) {
 				VectorSubtract(trace.endpos, eye, dir);
 				squaredfogdist = VectorLengthSquared(dir);
@@ -2919,9 +2954,6 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 			//if pretty much no fog
 			if (bestvis >= 0.95) return bestvis;
 		}
-		//check bottom and top of bounding box as well
-		if (i == 0) middle[2] += entinfo.mins[2];
-		else if (i == 1) middle[2] += entinfo.maxs[2] - entinfo.mins[2];
 	}
 	return bestvis;
 }
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // cmodel.c -- model loading
 
 #include "cm_local.h"
+#include "cm_patch.h"
 
 #ifdef BSPC
 
@@ -41,19 +42,14 @@ void SetPlaneSignbits (cplane_t *out) {
 }
 #endif //BSPC
 
-// to allow boxes to be treated as brush models, we allocate
-// some extra indexes along with those needed by the map
-#define	BOX_BRUSHES		1
-#define	BOX_SIDES		6
-#define	BOX_LEAFS		2
-#define	BOX_PLANES		12
-
 #define	LL(x) x=LittleLong(x)
 
 
 clipMap_t	cm;
 int			c_pointcontents;
-int			c_traces, c_brush_traces, c_patch_traces;
+
+cmTraceContext_t	cm_defaultTraceContext;
+static cmTraceContext_t	*cm_traceContexts = &cm_defaultTraceContext;
 
 
 byte		*cmod_base;
@@ -61,9 +57,19 @@ byte		*cmod_base;
 #ifndef BSPC
 cvar_t		*cm_noAreas;
 cvar_t		*cm_noCurves;
+cvar_t		*cm_simd;
 cvar_t		*cm_playerCurveClip;
+cvar_t		*cm_loadThreads;
+cvar_t		*cm_patchCache;
+
+// the bsp stays mapped for as long as lumps are referenced in place
+static void	*cmod_mapped;
+static long	cmod_mappedLength;
 #endif
 
+static qboolean	cmod_inPlace;
+static int		cmod_badSide;
+
 cmodel_t	box_model;
 cplane_t	*box_planes;
 cbrush_t	*box_brush;
@@ -72,6 +78,7 @@ cbrush_t	*box_brush;
 
 void	CM_InitBoxHull (void);
 void	CM_FloodAreaConnections (void);
+static void	CM_ResetTraceContexts( void );
 
 
 /*
@@ -100,6 +107,14 @@ void CMod_LoadShaders( lump_t *l ) {
 	if (count < 1) {
 		Com_Error (ERR_DROP, "Map with no shaders");
 	}
+
+	if ( cmod_inPlace ) {
+		// the disk layout is the memory layout
+		cm.shaders = in;
+		cm.numShaders = count;
+		return;
+	}
+
 	cm.shaders = Hunk_Alloc( count * sizeof( *cm.shaders ), h_high );
 	cm.numShaders = count;
 
@@ -178,9 +193,7 @@ CMod_LoadNodes
 */
 void CMod_LoadNodes( lump_t *l ) {
 	dnode_t		*in;
-	int			child;
-	cNode_t		*out;
-	int			i, j, count;
+	int			count;
 	
 	in = (void *)(cmod_base + l->fileofs);
 	if (l->filelen % sizeof(*in))
@@ -191,10 +204,23 @@ void CMod_LoadNodes( lump_t *l ) {
 		Com_Error (ERR_DROP, "Map has no nodes");
 	cm.nodes = Hunk_Alloc( count * sizeof( *cm.nodes ), h_high );
 	cm.numNodes = count;
+}
 
+/*
+=================
+CMod_ParseNodes
+=================
+*/
+static void CMod_ParseNodes( lump_t *l ) {
+	dnode_t		*in;
+	int			child;
+	cNode_t		*out;
+	int			i, j;
+
+	in = (void *)(cmod_base + l->fileofs);
 	out = cm.nodes;
 
-	for (i=0 ; i<count ; i++, out++, in++)
+	for (i=0 ; i<cm.numNodes ; i++, out++, in++)
 	{
 		out->plane = cm.planes + LittleLong( in->planeNum );
 		for (j=0 ; j<2 ; j++)
@@ -224,6 +250,32 @@ void CM_BoundBrush( cbrush_t *b ) {
 }
 
 
+/*
+=================
+CM_PackBrushPlanes
+=================
+*/
+void CM_PackBrushPlanes( cbrush_t *brush ) {
+	int			i, lane;
+	float		*group;
+	cplane_t	*plane;
+
+	for ( i = 0 ; i < PACKED_PLANE_GROUPS( brush->numsides ) * 4 ; i++ ) {
+		group = brush->packedPlanes + ( i >> 2 ) * PACKED_PLANE_FLOATS;
+		lane = i & 3;
+		if ( i < brush->numsides ) {
+			plane = brush->sides[i].plane;
+			group[lane] = plane->normal[0];
+			group[4 + lane] = plane->normal[1];
+			group[8 + lane] = plane->normal[2];
+			group[12 + lane] = plane->dist;
+		} else {
+			group[lane] = group[4 + lane] = group[8 + lane] = 0;
+			group[12 + lane] = PACKED_PLANE_PAD_DIST;
+		}
+	}
+}
+
 /*
 =================
 CMod_LoadBrushes
@@ -234,6 +286,8 @@ void CMod_LoadBrushes( lump_t *l ) {
 	dbrush_t	*in;
 	cbrush_t	*out;
 	int			i, count;
+	int			numGroups;
+	float		*packed;
 
 	in = (void *)(cmod_base + l->fileofs);
 	if (l->filelen % sizeof(*in)) {
@@ -246,19 +300,47 @@ void CMod_LoadBrushes( lump_t *l ) {
 
 	out = cm.brushes;
 
+	numGroups = BOX_BRUSHES * PACKED_PLANE_GROUPS( BOX_SIDES );
+	for ( i=0 ; i<count ; i++ ) {
+		numGroups += PACKED_PLANE_GROUPS( LittleLong( in[i].numSides ) );
+	}
+	packed = Hunk_Alloc( numGroups * PACKED_PLANE_FLOATS * sizeof( *packed ), h_high );
+
 	for ( i=0 ; i<count ; i++, out++, in++ ) {
 		out->sides = cm.brushsides + LittleLong(in->firstSide);
 		out->numsides = LittleLong(in->numSides);
+		out->packedPlanes = packed;
+		packed += PACKED_PLANE_GROUPS( out->numsides ) * PACKED_PLANE_FLOATS;
 
 		out->shaderNum = LittleLong( in->shaderNum );
 		if ( out->shaderNum < 0 || out->shaderNum >= cm.numShaders ) {
 			Com_Error( ERR_DROP, "CMod_LoadBrushes: bad shaderNum: %i", out->shaderNum );
 		}
 		out->contents = cm.shaders[out->shaderNum].contentFlags;
-
-		CM_BoundBrush( out );
 	}
 
+	// the box hull is packed by CM_ContextTempBoxModel
+	out->packedPlanes = packed;
+
+}
+
+/*
+=================
+CMod_BoundBrushesJob
+
+Bounds and packs a slice of the brushes once the planes and sides are in
+=================
+*/
+#define	BRUSH_JOBS	8
+static void CMod_BoundBrushesJob( void *data, int index ) {
+	int			i, last;
+
+	i = cm.numBrushes * index / BRUSH_JOBS;
+	last = cm.numBrushes * ( index + 1 ) / BRUSH_JOBS;
+	for ( ; i < last ; i++ ) {
+		CM_BoundBrush( &cm.brushes[i] );
+		CM_PackBrushPlanes( &cm.brushes[i] );
+	}
 }
 
 /*
@@ -268,8 +350,6 @@ CMod_LoadLeafs
 */
 void CMod_LoadLeafs (lump_t *l)
 {
-	int			i;
-	cLeaf_t		*out;
 	dleaf_t 	*in;
 	int			count;
 	
@@ -283,9 +363,22 @@ void CMod_LoadLeafs (lump_t *l)
 
 	cm.leafs = Hunk_Alloc( ( BOX_LEAFS + count ) * sizeof( *cm.leafs ), h_high );
 	cm.numLeafs = count;
+}
 
+/*
+=================
+CMod_ParseLeafs
+=================
+*/
+static void CMod_ParseLeafs( lump_t *l )
+{
+	int			i;
+	cLeaf_t		*out;
+	dleaf_t 	*in;
+
+	in = (void *)(cmod_base + l->fileofs);
 	out = cm.leafs;	
-	for ( i=0 ; i<count ; i++, in++, out++)
+	for ( i=0 ; i<cm.numLeafs ; i++, in++, out++)
 	{
 		out->cluster = LittleLong (in->cluster);
 		out->area = LittleLong (in->area);
@@ -299,7 +392,16 @@ void CMod_LoadLeafs (lump_t *l)
 		if (out->area >= cm.numAreas)
 			cm.numAreas = out->area + 1;
 	}
+}
+
+/*
+=================
+CMod_LoadAreas
 
+Once the leafs are parsed
+=================
+*/
+void CMod_LoadAreas( void ) {
 	cm.areas = Hunk_Alloc( cm.numAreas * sizeof( *cm.areas ), h_high );
 	cm.areaPortals = Hunk_Alloc( cm.numAreas * cm.numAreas * sizeof( *cm.areaPortals ), h_high );
 }
@@ -311,11 +413,8 @@ CMod_LoadPlanes
 */
 void CMod_LoadPlanes (lump_t *l)
 {
-	int			i, j;
-	cplane_t	*out;
 	dplane_t 	*in;
 	int			count;
-	int			bits;
 	
 	in = (void *)(cmod_base + l->fileofs);
 	if (l->filelen % sizeof(*in))
@@ -326,10 +425,24 @@ void CMod_LoadPlanes (lump_t *l)
 		Com_Error (ERR_DROP, "Map with no planes");
 	cm.planes = Hunk_Alloc( ( BOX_PLANES + count ) * sizeof( *cm.planes ), h_high );
 	cm.numPlanes = count;
+}
 
+/*
+=================
+CMod_ParsePlanes
+=================
+*/
+static void CMod_ParsePlanes( lump_t *l )
+{
+	int			i, j;
+	cplane_t	*out;
+	dplane_t 	*in;
+	int			bits;
+
+	in = (void *)(cmod_base + l->fileofs);
 	out = cm.planes;	
 
-	for ( i=0 ; i<count ; i++, in++, out++)
+	for ( i=0 ; i<cm.numPlanes ; i++, in++, out++)
 	{
 		bits = 0;
 		for (j=0 ; j<3 ; j++)
@@ -352,8 +465,6 @@ CMod_LoadLeafBrushes
 */
 void CMod_LoadLeafBrushes (lump_t *l)
 {
-	int			i;
-	int			*out;
 	int		 	*in;
 	int			count;
 	
@@ -364,10 +475,23 @@ void CMod_LoadLeafBrushes (lump_t *l)
 
 	cm.leafbrushes = Hunk_Alloc( (count + BOX_BRUSHES) * sizeof( *cm.leafbrushes ), h_high );
 	cm.numLeafBrushes = count;
+}
 
+/*
+=================
+CMod_ParseLeafBrushes
+=================
+*/
+static void CMod_ParseLeafBrushes( lump_t *l )
+{
+	int			i;
+	int			*out;
+	int		 	*in;
+
+	in = (void *)(cmod_base + l->fileofs);
 	out = cm.leafbrushes;
 
-	for ( i=0 ; i<count ; i++, in++, out++) {
+	for ( i=0 ; i<cm.numLeafBrushes ; i++, in++, out++) {
 		*out = LittleLong (*in);
 	}
 }
@@ -379,8 +503,6 @@ CMod_LoadLeafSurfaces
 */
 void CMod_LoadLeafSurfaces( lump_t *l )
 {
-	int			i;
-	int			*out;
 	int		 	*in;
 	int			count;
 	
@@ -391,10 +513,23 @@ void CMod_LoadLeafSurfaces( lump_t *l )
 
 	cm.leafsurfaces = Hunk_Alloc( count * sizeof( *cm.leafsurfaces ), h_high );
 	cm.numLeafSurfaces = count;
+}
 
+/*
+=================
+CMod_ParseLeafSurfaces
+=================
+*/
+static void CMod_ParseLeafSurfaces( lump_t *l )
+{
+	int			i;
+	int			*out;
+	int		 	*in;
+
+	in = (void *)(cmod_base + l->fileofs);
 	out = cm.leafsurfaces;
 
-	for ( i=0 ; i<count ; i++, in++, out++) {
+	for ( i=0 ; i<cm.numLeafSurfaces ; i++, in++, out++) {
 		*out = LittleLong (*in);
 	}
 }
@@ -406,11 +541,8 @@ CMod_LoadBrushSides
 */
 void CMod_LoadBrushSides (lump_t *l)
 {
-	int				i;
-	cbrushside_t	*out;
 	dbrushside_t 	*in;
 	int				count;
-	int				num;
 
 	in = (void *)(cmod_base + l->fileofs);
 	if ( l->filelen % sizeof(*in) ) {
@@ -420,15 +552,32 @@ void CMod_LoadBrushSides (lump_t *l)
 
 	cm.brushsides = Hunk_Alloc( ( BOX_SIDES + count ) * sizeof( *cm.brushsides ), h_high );
 	cm.numBrushSides = count;
+}
+
+/*
+=================
+CMod_ParseBrushSides
+
+A bad shader is left in cmod_badSide for the main thread to report
+=================
+*/
+static void CMod_ParseBrushSides( lump_t *l )
+{
+	int				i;
+	cbrushside_t	*out;
+	dbrushside_t 	*in;
+	int				num;
 
+	in = (void *)(cmod_base + l->fileofs);
 	out = cm.brushsides;	
 
-	for ( i=0 ; i<count ; i++, in++, out++) {
+	for ( i=0 ; i<cm.numBrushSides ; i++, in++, out++) {
 		num = LittleLong( in->planeNum );
 		out->plane = &cm.planes[num];
 		out->shaderNum = LittleLong( in->shaderNum );
 		if ( out->shaderNum < 0 || out->shaderNum >= cm.numShaders ) {
-			Com_Error( ERR_DROP, "CMod_LoadBrushSides: bad shaderNum: %i", out->shaderNum );
+			cmod_badSide = i;
+			continue;
 		}
 		out->surfaceFlags = cm.shaders[out->shaderNum].surfaceFlags;
 	}
@@ -441,6 +590,12 @@ CMod_LoadEntityString
 =================
 */
 void CMod_LoadEntityString( lump_t *l ) {
+	if ( cmod_inPlace && l->filelen && !cmod_base[l->fileofs + l->filelen - 1] ) {
+		cm.entityString = (char *)cmod_base + l->fileofs;
+		cm.numEntityChars = l->filelen;
+		return;
+	}
+
 	cm.entityString = Hunk_Alloc( l->filelen, h_high );
 	cm.numEntityChars = l->filelen;
 	Com_Memcpy (cm.entityString, cmod_base + l->fileofs, l->filelen);
@@ -466,9 +621,13 @@ void CMod_LoadVisibility( lump_t *l ) {
 	buf = cmod_base + l->fileofs;
 
 	cm.vised = qtrue;
-	cm.visibility = Hunk_Alloc( len, h_high );
 	cm.numClusters = LittleLong( ((int *)buf)[0] );
 	cm.clusterBytes = LittleLong( ((int *)buf)[1] );
+	if ( cmod_inPlace ) {
+		cm.visibility = buf + VIS_HEADER;
+		return;
+	}
+	cm.visibility = Hunk_Alloc( len, h_high );
 	Com_Memcpy (cm.visibility, buf + VIS_HEADER, len - VIS_HEADER );
 }
 
@@ -559,6 +718,474 @@ unsigned CM_Checksum(dheader_t *header) {
 	return LittleLong(Com_BlockChecksum(checksums, 11 * 4));
 }
 
+#ifndef BSPC
+/*
+===============================================================================
+
+PATCH CACHE
+
+Generating the patch collision data is the slowest part of loading a
+curve heavy map, so it is saved to <game>/patchcache/<map>.cmpatch under
+the home path and read back on later loads.  The file is keyed by
+CM_Checksum, which covers the surfaces and drawverts the patches are
+built from, and is rebuilt when the checksum or version doesn't match.
+
+Every field is 32 bits and stored little endian.  The header is followed
+by each patch in surface order: its surface number, bounds and counts,
+its planes, then its facets with only the borders in use.
+
+===============================================================================
+*/
+
+#define	PATCHCACHE_IDENT	(('C'<<24)+('P'<<16)+('M'<<8)+'C')	// little-endian "CMPC"
+#define	PATCHCACHE_VERSION	1
+
+#define	PATCHCACHE_ENTRY	9		// surfaceNum, bounds, numPlanes, numFacets
+#define	PATCHCACHE_PLANE	5		// plane, signbits
+#define	PATCHCACHE_FACET	2		// surfacePlane, numBorders, then 3 per border
+
+typedef struct {
+	int			ident;
+	int			version;
+	int			bspChecksum;
+	int			numSurfaces;
+	int			numPatches;
+	int			numPlanes;
+	int			numFacets;
+	int			dataChecksum;		// of everything after the header
+} patchCacheHeader_t;
+
+/*
+==================
+CMod_PatchCacheName
+
+Not va(), the map name usually came from there
+==================
+*/
+static void CMod_PatchCacheName( const char *name, char *cacheName, int size ) {
+	char	base[MAX_QPATH];
+
+	COM_StripExtension( COM_SkipPath( (char *)name ), base, sizeof( base ) );
+	Com_sprintf( cacheName, size, "%s/patchcache/%s.cmpatch", FS_GetCurrentGameDir(), base );
+}
+
+/*
+==================
+CMod_SwapPatchCache
+==================
+*/
+static void CMod_SwapPatchCache( int *words, int count ) {
+	int		i;
+
+	for ( i = 0 ; i < count ; i++ ) {
+		words[i] = LittleLong( words[i] );
+	}
+}
+
+/*
+==================
+CMod_CheckPatchCache
+
+Returns qfalse if the cache doesn't describe the patches in this bsp.
+The data has already been swapped.
+==================
+*/
+static qboolean CMod_CheckPatchCache( const patchCacheHeader_t *header, const int *data, const int *end, const dsurface_t *surfs ) {
+	int			i, j, k;
+	int			surfaceNum, patchSurface;
+	int			numPlanes, numFacets, numBorders;
+	int			totalPlanes, totalFacets;
+
+	surfaceNum = 0;
+	totalPlanes = totalFacets = 0;
+	for ( i = 0 ; i < header->numPatches ; i++ ) {
+		if ( end - data < PATCHCACHE_ENTRY ) {
+			return qfalse;
+		}
+		patchSurface = data[0];
+		numPlanes = data[7];
+		numFacets = data[8];
+		data += PATCHCACHE_ENTRY;
+
+		if ( patchSurface < surfaceNum || patchSurface >= header->numSurfaces ) {
+			return qfalse;
+		}
+		// every patch has to be there, in order
+		for ( ; surfaceNum < patchSurface ; surfaceNum++ ) {
+			if ( LittleLong( surfs[surfaceNum].surfaceType ) == MST_PATCH ) {
+				return qfalse;
+			}
+		}
+		if ( LittleLong( surfs[surfaceNum++].surfaceType ) != MST_PATCH ) {
+			return qfalse;
+		}
+
+		if ( numPlanes < 0 || numPlanes > MAX_PATCH_PLANES || numFacets < 0 || numFacets > MAX_FACETS ) {
+			return qfalse;
+		}
+		if ( ( end - data ) / PATCHCACHE_PLANE < numPlanes ) {
+			return qfalse;
+		}
+		data += numPlanes * PATCHCACHE_PLANE;
+
+		for ( j = 0 ; j < numFacets ; j++ ) {
+			if ( end - data < PATCHCACHE_FACET ) {
+				return qfalse;
+			}
+			numBorders = data[1];
+			if ( data[0] < 0 || data[0] >= numPlanes
+				|| numBorders < 0 || numBorders > ARRAY_LEN( ((facet_t *)0)->borderPlanes ) ) {
+				return qfalse;
+			}
+			data += PATCHCACHE_FACET;
+			if ( end - data < numBorders * 3 ) {
+				return qfalse;
+			}
+			for ( k = 0 ; k < numBorders ; k++, data += 3 ) {
+				if ( data[0] < 0 || data[0] >= numPlanes ) {
+					return qfalse;
+				}
+			}
+		}
+
+		totalPlanes += numPlanes;
+		totalFacets += numFacets;
+	}
+
+	for ( ; surfaceNum < header->numSurfaces ; surfaceNum++ ) {
+		if ( LittleLong( surfs[surfaceNum].surfaceType ) == MST_PATCH ) {
+			return qfalse;
+		}
+	}
+
+	return data == end && totalPlanes == header->numPlanes && totalFacets == header->numFacets;
+}
+
+/*
+==================
+CMod_LoadPatchCache
+
+Fills in cm.surfaces from the cache if it matches the bsp
+==================
+*/
+static qboolean CMod_LoadPatchCache( const char *name, dheader_t *header ) {
+	fileHandle_t		f;
+	long				length;
+	int					*buf, *data, *end;
+	patchCacheHeader_t	*cache;
+	const dsurface_t	*surfs;
+	patchPlane_t		*planes;
+	facet_t				*facets;
+	patchCollide_t		*pc;
+	cPatch_t			*patch;
+	int					i, j, k, shaderNum;
+	char				cacheName[MAX_OSPATH];
+
+	if ( !cm_patchCache->integer ) {
+		return qfalse;
+	}
+
+	CMod_PatchCacheName( name, cacheName, sizeof( cacheName ) );
+
+	length = FS_SV_FOpenFileRead( cacheName, &f );
+	if ( !f ) {
+		return qfalse;
+	}
+	if ( length < sizeof( *cache ) || ( length & 3 )
+		|| header->lumps[LUMP_SURFACES].filelen % sizeof( dsurface_t ) ) {
+		FS_FCloseFile( f );
+		return qfalse;
+	}
+
+	buf = Hunk_AllocateTempMemory( length );
+	FS_Read( buf, length, f );
+	FS_FCloseFile( f );
+
+	cache = (patchCacheHeader_t *)buf;
+	CMod_SwapPatchCache( buf, sizeof( *cache ) / 4 );
+	data = (int *)( cache + 1 );
+	end = buf + length / 4;
+
+	surfs = (void *)(cmod_base + header->lumps[LUMP_SURFACES].fileofs);
+
+	if ( cache->ident != PATCHCACHE_IDENT || cache->version != PATCHCACHE_VERSION
+		|| cache->bspChecksum != CM_Checksum( header )
+		|| cache->numSurfaces != header->lumps[LUMP_SURFACES].filelen / sizeof( dsurface_t )
+		|| cache->numPatches < 0 || cache->numPlanes < 0 || cache->numFacets < 0
+		|| cache->dataChecksum != Com_BlockChecksum( data, ( end - data ) * 4 ) ) {
+		Com_DPrintf( "%s is stale\n", cacheName );
+		Hunk_FreeTempMemory( buf );
+		return qfalse;
+	}
+
+	CMod_SwapPatchCache( data, end - data );
+	if ( !CMod_CheckPatchCache( cache, data, end, surfs ) ) {
+		Com_DPrintf( "%s doesn't match the map\n", cacheName );
+		Hunk_FreeTempMemory( buf );
+		return qfalse;
+	}
+
+	cm.numSurfaces = cache->numSurfaces;
+	cm.surfaces = Hunk_Alloc( cm.numSurfaces * sizeof( cm.surfaces[0] ), h_high );
+	planes = Hunk_Alloc( cache->numPlanes * sizeof( *planes ), h_high );
+	facets = Hunk_Alloc( cache->numFacets * sizeof( *facets ), h_high );
+
+	for ( i = 0 ; i < cache->numPatches ; i++ ) {
+		cm.surfaces[ data[0] ] = patch = Hunk_Alloc( sizeof( *patch ), h_high );
+
+		shaderNum = LittleLong( surfs[ data[0] ].shaderNum );
+		patch->contents = cm.shaders[shaderNum].contentFlags;
+		patch->surfaceFlags = cm.shaders[shaderNum].surfaceFlags;
+
+		patch->pc = pc = Hunk_Alloc( sizeof( *pc ), h_high );
+		Com_Memcpy( pc->bounds, data + 1, sizeof( pc->bounds ) );
+		pc->numPlanes = data[7];
+		pc->numFacets = data[8];
+		pc->planes = planes;
+		pc->facets = facets;
+		data += PATCHCACHE_ENTRY;
+
+		for ( j = 0 ; j < pc->numPlanes ; j++, planes++, data += PATCHCACHE_PLANE ) {
+			Com_Memcpy( planes->plane, data, sizeof( planes->plane ) );
+			planes->signbits = data[4];
+		}
+
+		// Hunk_Alloc clears, so the unused borders stay zero
+		for ( j = 0 ; j < pc->numFacets ; j++, facets++ ) {
+			facets->surfacePlane = data[0];
+			facets->numBorders = data[1];
+			data += PATCHCACHE_FACET;
+			for ( k = 0 ; k < facets->numBorders ; k++, data += 3 ) {
+				facets->borderPlanes[k] = data[0];
+				facets->borderInward[k] = data[1];
+				facets->borderNoAdjust[k] = data[2];
+			}
+		}
+	}
+
+	Com_DPrintf( "Loaded %i patches from %s\n", cache->numPatches, cacheName );
+
+	Hunk_FreeTempMemory( buf );
+	return qtrue;
+}
+
+/*
+==================
+CMod_WritePatchCache
+
+Saves the patches CMod_LoadPatches just generated
+==================
+*/
+static void CMod_WritePatchCache( const char *name, dheader_t *header ) {
+	fileHandle_t		f;
+	int					length;
+	int					*buf, *data;
+	patchCacheHeader_t	*cache;
+	patchCollide_t		*pc;
+	facet_t				*facet;
+	int					i, j, k;
+	char				cacheName[MAX_OSPATH];
+
+	if ( !cm_patchCache->integer ) {
+		return;
+	}
+
+	// size it for every border, only the ones in use are written
+	length = sizeof( *cache );
+	for ( i = 0 ; i < cm.numSurfaces ; i++ ) {
+		if ( cm.surfaces[i] ) {
+			pc = cm.surfaces[i]->pc;
+			length += 4 * ( PATCHCACHE_ENTRY + pc->numPlanes * PATCHCACHE_PLANE
+				+ pc->numFacets * ( PATCHCACHE_FACET + 3 * ARRAY_LEN( pc->facets->borderPlanes ) ) );
+		}
+	}
+
+	if ( length == sizeof( *cache ) ) {
+		return;		// no patches
+	}
+
+	buf = Hunk_AllocateTempMemory( length );
+	cache = (patchCacheHeader_t *)buf;
+	Com_Memset( cache, 0, sizeof( *cache ) );
+	cache->ident = PATCHCACHE_IDENT;
+	cache->version = PATCHCACHE_VERSION;
+	cache->bspChecksum = CM_Checksum( header );
+	cache->numSurfaces = cm.numSurfaces;
+
+	data = (int *)( cache + 1 );
+	for ( i = 0 ; i < cm.numSurfaces ; i++ ) {
+		if ( !cm.surfaces[i] ) {
+			continue;
+		}
+		pc = cm.surfaces[i]->pc;
+		cache->numPatches++;
+		cache->numPlanes += pc->numPlanes;
+		cache->numFacets += pc->numFacets;
+
+		data[0] = i;
+		Com_Memcpy( data + 1, pc->bounds, sizeof( pc->bounds ) );
+		data[7] = pc->numPlanes;
+		data[8] = pc->numFacets;
+		data += PATCHCACHE_ENTRY;
+
+		for ( j = 0 ; j < pc->numPlanes ; j++, data += PATCHCACHE_PLANE ) {
+			Com_Memcpy( data, pc->planes[j].plane, sizeof( pc->planes[j].plane ) );
+			data[4] = pc->planes[j].signbits;
+		}
+
+		for ( j = 0, facet = pc->facets ; j < pc->numFacets ; j++, facet++ ) {
+			data[0] = facet->surfacePlane;
+			data[1] = facet->numBorders;
+			data += PATCHCACHE_FACET;
+			for ( k = 0 ; k < facet->numBorders ; k++, data += 3 ) {
+				data[0] = facet->borderPlanes[k];
+				data[1] = facet->borderInward[k];
+				data[2] = facet->borderNoAdjust[k];
+			}
+		}
+	}
+
+	length = (byte *)data - (byte *)buf;
+	CMod_SwapPatchCache( buf, length / 4 );
+	cache->dataChecksum = LittleLong( Com_BlockChecksum( cache + 1, length - sizeof( *cache ) ) );
+
+	CMod_PatchCacheName( name, cacheName, sizeof( cacheName ) );
+	f = FS_SV_FOpenFileWrite( cacheName );
+	if ( f ) {
+		FS_Write( buf, length, f );
+		FS_FCloseFile( f );
+		Com_DPrintf( "Wrote %i patches to %s\n", LittleLong( cache->numPatches ), cacheName );
+	} else {
+		Com_DPrintf( "Couldn't write %s\n", cacheName );
+	}
+
+	Hunk_FreeTempMemory( buf );
+}
+#endif
+
+/*
+==================
+CMod_ParseJob
+==================
+*/
+typedef struct {
+	void		(*parse)( lump_t *l );
+	lump_t		*lump;
+} cmodParseJob_t;
+
+static void CMod_ParseJob( void *data, int index ) {
+	cmodParseJob_t	*job = (cmodParseJob_t *)data + index;
+
+	job->parse( job->lump );
+}
+
+/*
+==================
+CMod_RunJobs
+
+The jobs may only fill arrays that were already allocated
+and must not call Com_Error.
+==================
+*/
+static void CMod_RunJobs( sysJobFunc_t func, void *data, int count ) {
+#ifndef BSPC
+	Sys_RunJobs( func, data, count );
+#else
+	int		i;
+
+	for ( i = 0 ; i < count ; i++ ) {
+		func( data, i );
+	}
+#endif
+}
+
+/*
+==================
+CMod_ParseLumps
+
+Allocates everything on the main thread, then parses the lumps that don't
+depend on each other in parallel.  The patches stay serial: the patch
+collide generation uses static scratch space and Z_Malloc'd windings.
+==================
+*/
+static void CMod_ParseLumps( const char *name, dheader_t *header ) {
+	cmodParseJob_t	jobs[6];
+	int				numJobs;
+#ifndef BSPC
+	int				oldWorkers;
+#endif
+
+	CMod_LoadShaders( &header->lumps[LUMP_SHADERS] );
+	CMod_LoadLeafs (&header->lumps[LUMP_LEAFS]);
+	CMod_LoadLeafBrushes (&header->lumps[LUMP_LEAFBRUSHES]);
+	CMod_LoadLeafSurfaces (&header->lumps[LUMP_LEAFSURFACES]);
+	CMod_LoadPlanes (&header->lumps[LUMP_PLANES]);
+	CMod_LoadBrushSides (&header->lumps[LUMP_BRUSHSIDES]);
+	CMod_LoadBrushes (&header->lumps[LUMP_BRUSHES]);
+	CMod_LoadSubmodels (&header->lumps[LUMP_MODELS]);
+	CMod_LoadNodes (&header->lumps[LUMP_NODES]);
+	CMod_LoadEntityString (&header->lumps[LUMP_ENTITIES]);
+
+	// largest lumps first, the calling thread takes the first one
+	numJobs = 0;
+	jobs[numJobs].parse = CMod_ParseBrushSides;
+	jobs[numJobs++].lump = &header->lumps[LUMP_BRUSHSIDES];
+	jobs[numJobs].parse = CMod_ParsePlanes;
+	jobs[numJobs++].lump = &header->lumps[LUMP_PLANES];
+	jobs[numJobs].parse = CMod_ParseLeafSurfaces;
+	jobs[numJobs++].lump = &header->lumps[LUMP_LEAFSURFACES];
+	jobs[numJobs].parse = CMod_ParseLeafBrushes;
+	jobs[numJobs++].lump = &header->lumps[LUMP_LEAFBRUSHES];
+	jobs[numJobs].parse = CMod_ParseLeafs;
+	jobs[numJobs++].lump = &header->lumps[LUMP_LEAFS];
+	jobs[numJobs].parse = CMod_ParseNodes;
+	jobs[numJobs++].lump = &header->lumps[LUMP_NODES];
+
+	// spread the jobs over cm_loadThreads threads
+#ifndef BSPC
+	oldWorkers = Sys_JobWorkers();
+	Sys_SetJobWorkers( cm_loadThreads->integer - 1 );
+#endif
+
+	cmod_badSide = -1;
+	CMod_RunJobs( CMod_ParseJob, jobs, numJobs );
+	CMod_RunJobs( CMod_BoundBrushesJob, NULL, BRUSH_JOBS );
+
+#ifndef BSPC
+	Sys_SetJobWorkers( oldWorkers );
+#endif
+
+	if ( cmod_badSide >= 0 ) {
+		Com_Error( ERR_DROP, "CMod_LoadBrushSides: bad shaderNum: %i", cm.brushsides[cmod_badSide].shaderNum );
+	}
+
+	CMod_LoadAreas();
+	CMod_LoadVisibility( &header->lumps[LUMP_VISIBILITY] );
+#ifndef BSPC
+	if ( !CMod_LoadPatchCache( name, header ) ) {
+		CMod_LoadPatches( &header->lumps[LUMP_SURFACES], &header->lumps[LUMP_DRAWVERTS] );
+		CMod_WritePatchCache( name, header );
+	}
+#else
+	CMod_LoadPatches( &header->lumps[LUMP_SURFACES], &header->lumps[LUMP_DRAWVERTS] );
+#endif
+}
+
+#ifndef BSPC
+/*
+==================
+CM_UnmapBSP
+==================
+*/
+static void CM_UnmapBSP( void ) {
+	if ( cmod_mapped ) {
+		FS_UnmapFile( cmod_mapped, cmod_mappedLength );
+		cmod_mapped = NULL;
+		cmod_mappedLength = 0;
+	}
+}
+#endif
+
 /*
 ==================
 CM_LoadMap
@@ -575,6 +1202,9 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 	dheader_t		header;
 	int				length;
 	static unsigned	last_checksum;
+#ifndef BSPC
+	int				start, hunk;
+#endif
 
 	if ( !name || !name[0] ) {
 		Com_Error( ERR_DROP, "CM_LoadMap: NULL name" );
@@ -583,7 +1213,10 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 #ifndef BSPC
 	cm_noAreas = Cvar_Get ("cm_noAreas", "0", CVAR_CHEAT);
 	cm_noCurves = Cvar_Get ("cm_noCurves", "0", CVAR_CHEAT);
+	cm_simd = Cvar_Get ("cm_simd", "1", CVAR_CHEAT);
 	cm_playerCurveClip = Cvar_Get ("cm_playerCurveClip", "1", CVAR_ARCHIVE|CVAR_CHEAT );
+	cm_loadThreads = Cvar_Get ("cm_loadThreads", "4", CVAR_ARCHIVE);
+	cm_patchCache = Cvar_Get ("cm_patchCache", "1", CVAR_ARCHIVE);
 #endif
 	Com_DPrintf( "CM_LoadMap( %s, %i )\n", name, clientload );
 
@@ -593,6 +1226,10 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 	}
 
 	// free old stuff
+#ifndef BSPC
+	CM_StopTraceRecord();
+	CM_UnmapBSP();
+#endif
 	Com_Memset( &cm, 0, sizeof( cm ) );
 	CM_ClearLevelPatches();
 
@@ -601,6 +1238,7 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 		cm.numClusters = 1;
 		cm.numAreas = 1;
 		cm.cmodels = Hunk_Alloc( sizeof( *cm.cmodels ), h_high );
+		CM_ResetTraceContexts();
 		*checksum = 0;
 		return;
 	}
@@ -609,7 +1247,25 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 	// load the file
 	//
 #ifndef BSPC
-	length = FS_ReadFile( name, &buf.v );
+	start = Sys_Milliseconds();
+	hunk = Hunk_MemoryRemaining();
+
+	// map it if we can, so the lumps that need no conversion
+	// can be used where they are
+	length = FS_MapFile( name, &buf.v );
+#if !id386 && !idx64
+	if ( buf.v && ( (intptr_t)buf.v & 3 ) ) {
+		// unaligned stored pk3 entry
+		FS_UnmapFile( buf.v, length );
+		buf.v = NULL;
+	}
+#endif
+	if ( buf.v ) {
+		cmod_mapped = buf.v;
+		cmod_mappedLength = length;
+	} else {
+		length = FS_ReadFile( name, &buf.v );
+	}
 #else
 	length = LoadQuakeFile((quakefile_t *) name, &buf.v);
 #endif
@@ -620,6 +1276,11 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 
 	last_checksum = LittleLong (Com_BlockChecksum (buf.i, length));
 	*checksum = last_checksum;
+	cm.checksum = last_checksum;
+
+	if ( length < (int)sizeof( header ) ) {
+		Com_Error (ERR_DROP, "CM_LoadMap: %s is truncated", name );
+	}
 
 	header = *(dheader_t *)buf.i;
 	for (i=0 ; i<sizeof(dheader_t)/4 ; i++) {
@@ -631,27 +1292,40 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 		, name, header.version, BSP_VERSION );
 	}
 
+	// a mapping faults instead of reading past the end
+	for ( i = 0 ; i < HEADER_LUMPS ; i++ ) {
+		if ( header.lumps[i].fileofs < 0 || header.lumps[i].filelen < 0
+			|| header.lumps[i].fileofs > length - header.lumps[i].filelen ) {
+			Com_Error (ERR_DROP, "CM_LoadMap: %s has a bad lump %i", name, i );
+		}
+	}
+
 	cmod_base = (byte *)buf.i;
+#if defined( Q3_LITTLE_ENDIAN ) && !defined( BSPC )
+	cmod_inPlace = cmod_mapped != NULL;
+#else
+	cmod_inPlace = qfalse;
+#endif
 
 	// load into heap
-	CMod_LoadShaders( &header.lumps[LUMP_SHADERS] );
-	CMod_LoadLeafs (&header.lumps[LUMP_LEAFS]);
-	CMod_LoadLeafBrushes (&header.lumps[LUMP_LEAFBRUSHES]);
-	CMod_LoadLeafSurfaces (&header.lumps[LUMP_LEAFSURFACES]);
-	CMod_LoadPlanes (&header.lumps[LUMP_PLANES]);
-	CMod_LoadBrushSides (&header.lumps[LUMP_BRUSHSIDES]);
-	CMod_LoadBrushes (&header.lumps[LUMP_BRUSHES]);
-	CMod_LoadSubmodels (&header.lumps[LUMP_MODELS]);
-	CMod_LoadNodes (&header.lumps[LUMP_NODES]);
-	CMod_LoadEntityString (&header.lumps[LUMP_ENTITIES]);
-	CMod_LoadVisibility( &header.lumps[LUMP_VISIBILITY] );
-	CMod_LoadPatches( &header.lumps[LUMP_SURFACES], &header.lumps[LUMP_DRAWVERTS] );
+	CMod_ParseLumps( name, &header );
+
+#ifndef BSPC
+	if ( !cmod_mapped ) {
+		FS_FreeFile (buf.v);
+	}
 
+	Com_DPrintf( "CM_LoadMap: %s %s in %i msec, %i KB of hunk\n", cmod_mapped ? "mapped" : "read",
+		name, Sys_Milliseconds() - start, ( hunk - Hunk_MemoryRemaining() ) / 1024 );
+#else
 	// we are NOT freeing the file, because it is cached for the ref
 	FS_FreeFile (buf.v);
+#endif
 
 	CM_InitBoxHull ();
 
+	CM_ResetTraceContexts ();
+
 	CM_FloodAreaConnections ();
 
 	// allow this to be cached if it is loaded by the server
@@ -666,8 +1340,13 @@ CM_ClearMap
 ==================
 */
 void CM_ClearMap( void ) {
+#ifndef BSPC
+	CM_StopTraceRecord();
+	CM_UnmapBSP();
+#endif
 	Com_Memset( &cm, 0, sizeof( cm ) );
 	CM_ClearLevelPatches();
+	CM_ResetTraceContexts();
 }
 
 /*
@@ -695,6 +1374,20 @@ cmodel_t	*CM_ClipHandleToModel( clipHandle_t handle ) {
 
 }
 
+/*
+==================
+CM_ContextClipHandleToModel
+
+Temp boxes and capsules come from the context instead of the shared hull
+==================
+*/
+cmodel_t	*CM_ContextClipHandleToModel( cmTraceContext_t *ctx, clipHandle_t handle ) {
+	if ( handle == BOX_MODEL_HANDLE || handle == CAPSULE_MODEL_HANDLE ) {
+		return ctx->boxModel;
+	}
+	return CM_ClipHandleToModel( handle );
+}
+
 /*
 ==================
 CM_InlineModel
@@ -711,6 +1404,10 @@ int		CM_NumClusters( void ) {
 	return cm.numClusters;
 }
 
+int		CM_NumAreas( void ) {
+	return cm.numAreas;
+}
+
 int		CM_NumInlineModels( void ) {
 	return cm.numSubModels;
 }
@@ -738,48 +1435,40 @@ int		CM_LeafArea( int leafnum ) {
 
 /*
 ===================
-CM_InitBoxHull
+CM_SetupBoxHull
 
-Set up the planes and nodes so that the six floats of a bounding box
-can just be stored out and get a proper clipping hull structure.
+Points the six sides of a box brush at its planes, the distances are
+filled in by CM_ContextTempBoxModel.  The brush must already have its
+packed planes.
 ===================
 */
-void CM_InitBoxHull (void)
-{
+static void CM_SetupBoxHull( cbrush_t *brush, cbrushside_t *sides, cplane_t *planes ) {
 	int			i;
 	int			side;
 	cplane_t	*p;
 	cbrushside_t	*s;
 
-	box_planes = &cm.planes[cm.numPlanes];
-
-	box_brush = &cm.brushes[cm.numBrushes];
-	box_brush->numsides = 6;
-	box_brush->sides = cm.brushsides + cm.numBrushSides;
-	box_brush->contents = CONTENTS_BODY;
-
-	box_model.leaf.numLeafBrushes = 1;
-//	box_model.leaf.firstLeafBrush = cm.numBrushes;
-	box_model.leaf.firstLeafBrush = cm.numLeafBrushes;
-	cm.leafbrushes[cm.numLeafBrushes] = cm.numBrushes;
+	brush->numsides = 6;
+	brush->sides = sides;
+	brush->contents = CONTENTS_BODY;
 
 	for (i=0 ; i<6 ; i++)
 	{
 		side = i&1;
 
 		// brush sides
-		s = &cm.brushsides[cm.numBrushSides+i];
-		s->plane = 	cm.planes + (cm.numPlanes+i*2+side);
+		s = &sides[i];
+		s->plane = 	planes + (i*2+side);
 		s->surfaceFlags = 0;
 
 		// planes
-		p = &box_planes[i*2];
+		p = &planes[i*2];
 		p->type = i>>1;
 		p->signbits = 0;
 		VectorClear (p->normal);
 		p->normal[i>>1] = 1;
 
-		p = &box_planes[i*2+1];
+		p = &planes[i*2+1];
 		p->type = 3 + (i>>1);
 		p->signbits = 0;
 		VectorClear (p->normal);
@@ -787,45 +1476,199 @@ void CM_InitBoxHull (void)
 
 		SetPlaneSignbits( p );
 	}	
+
+	CM_PackBrushPlanes( brush );
 }
 
 /*
 ===================
-CM_TempBoxModel
+CM_InitBoxHull
+
+Set up the planes and nodes so that the six floats of a bounding box
+can just be stored out and get a proper clipping hull structure.
+===================
+*/
+void CM_InitBoxHull (void)
+{
+	box_planes = &cm.planes[cm.numPlanes];
+
+	box_brush = &cm.brushes[cm.numBrushes];
+	CM_SetupBoxHull( box_brush, cm.brushsides + cm.numBrushSides, box_planes );
+
+	box_model.leaf.numLeafBrushes = 1;
+//	box_model.leaf.firstLeafBrush = cm.numBrushes;
+	box_model.leaf.firstLeafBrush = cm.numLeafBrushes;
+	cm.leafbrushes[cm.numLeafBrushes] = cm.numBrushes;
+
+	cm_defaultTraceContext.boxModel = &box_model;
+	cm_defaultTraceContext.boxBrush = box_brush;
+	cm_defaultTraceContext.boxPlanes = box_planes;
+}
+
+/*
+===================
+CM_ContextTempBoxModel
 
 To keep everything totally uniform, bounding boxes are turned into small
 BSP trees instead of being compared directly.
 Capsules are handled differently though.
 ===================
 */
-clipHandle_t CM_TempBoxModel( const vec3_t mins, const vec3_t maxs, int capsule ) {
+clipHandle_t CM_ContextTempBoxModel( cmTraceContext_t *ctx, const vec3_t mins, const vec3_t maxs, int capsule ) {
+	cplane_t	*planes;
+	int			i;
 
-	VectorCopy( mins, box_model.mins );
-	VectorCopy( maxs, box_model.maxs );
+	VectorCopy( mins, ctx->boxModel->mins );
+	VectorCopy( maxs, ctx->boxModel->maxs );
 
 	if ( capsule ) {
 		return CAPSULE_MODEL_HANDLE;
 	}
 
-	box_planes[0].dist = maxs[0];
-	box_planes[1].dist = -maxs[0];
-	box_planes[2].dist = mins[0];
-	box_planes[3].dist = -mins[0];
-	box_planes[4].dist = maxs[1];
-	box_planes[5].dist = -maxs[1];
-	box_planes[6].dist = mins[1];
-	box_planes[7].dist = -mins[1];
-	box_planes[8].dist = maxs[2];
-	box_planes[9].dist = -maxs[2];
-	box_planes[10].dist = mins[2];
-	box_planes[11].dist = -mins[2];
-
-	VectorCopy( mins, box_brush->bounds[0] );
-	VectorCopy( maxs, box_brush->bounds[1] );
+	planes = ctx->boxPlanes;
+	planes[0].dist = maxs[0];
+	planes[1].dist = -maxs[0];
+	planes[2].dist = mins[0];
+	planes[3].dist = -mins[0];
+	planes[4].dist = maxs[1];
+	planes[5].dist = -maxs[1];
+	planes[6].dist = mins[1];
+	planes[7].dist = -mins[1];
+	planes[8].dist = maxs[2];
+	planes[9].dist = -maxs[2];
+	planes[10].dist = mins[2];
+	planes[11].dist = -mins[2];
+
+	VectorCopy( mins, ctx->boxBrush->bounds[0] );
+	VectorCopy( maxs, ctx->boxBrush->bounds[1] );
+
+	for ( i = 0 ; i < BOX_SIDES ; i++ ) {
+		ctx->boxBrush->packedPlanes[( i >> 2 ) * PACKED_PLANE_FLOATS + 12 + ( i & 3 )] = ctx->boxBrush->sides[i].plane->dist;
+	}
 
 	return BOX_MODEL_HANDLE;
 }
 
+/*
+===================
+CM_TempBoxModel
+===================
+*/
+clipHandle_t CM_TempBoxModel( const vec3_t mins, const vec3_t maxs, int capsule ) {
+	return CM_ContextTempBoxModel( &cm_defaultTraceContext, mins, maxs, capsule );
+}
+
+/*
+===============================================================================
+
+TRACE CONTEXTS
+
+===============================================================================
+*/
+
+/*
+===================
+CM_SizeTraceContext
+
+Check counts are indexed by brush and surface number, so they are
+reallocated for every map.
+===================
+*/
+static void CM_SizeTraceContext( cmTraceContext_t *ctx ) {
+	if ( ctx->brushChecks ) {
+		Z_Free( ctx->brushChecks );
+	}
+	if ( ctx->patchChecks ) {
+		Z_Free( ctx->patchChecks );
+	}
+
+	ctx->numBrushes = cm.numBrushes + BOX_BRUSHES;
+	ctx->numSurfaces = cm.numSurfaces + 1;
+	ctx->brushChecks = Z_Malloc( ctx->numBrushes * sizeof( *ctx->brushChecks ) );
+	ctx->patchChecks = Z_Malloc( ctx->numSurfaces * sizeof( *ctx->patchChecks ) );
+	ctx->checkcount = 0;
+}
+
+/*
+===================
+CM_ResetTraceContexts
+===================
+*/
+static void CM_ResetTraceContexts( void ) {
+	cmTraceContext_t	*ctx;
+
+	for ( ctx = cm_traceContexts ; ctx ; ctx = ctx->next ) {
+		CM_SizeTraceContext( ctx );
+	}
+}
+
+/*
+===================
+CM_AllocTraceContext
+===================
+*/
+cmTraceContext_t *CM_AllocTraceContext( void ) {
+	cmTraceContext_t	*ctx;
+
+	ctx = Z_Malloc( sizeof( *ctx ) );
+
+	ctx->boxModel = &ctx->ownBoxModel;
+	ctx->boxBrush = &ctx->ownBoxBrush;
+	ctx->boxPlanes = ctx->ownBoxPlanes;
+	ctx->boxBrush->packedPlanes = ctx->ownBoxPacked;
+	CM_SetupBoxHull( ctx->boxBrush, ctx->ownBoxSides, ctx->boxPlanes );
+
+	CM_SizeTraceContext( ctx );
+
+	ctx->next = cm_traceContexts;
+	cm_traceContexts = ctx;
+
+	return ctx;
+}
+
+/*
+===================
+CM_FreeTraceContext
+===================
+*/
+void CM_FreeTraceContext( cmTraceContext_t *ctx ) {
+	cmTraceContext_t	**prev;
+
+	if ( ctx == &cm_defaultTraceContext ) {
+		Com_Error( ERR_FATAL, "CM_FreeTraceContext: default context" );
+	}
+
+	for ( prev = &cm_traceContexts ; *prev ; prev = &(*prev)->next ) {
+		if ( *prev == ctx ) {
+			*prev = ctx->next;
+			break;
+		}
+	}
+
+	Z_Free( ctx->brushChecks );
+	Z_Free( ctx->patchChecks );
+	Z_Free( ctx );
+}
+
+/*
+===================
+CM_TakeTraceCounts
+
+Sums and clears the statistics of all contexts
+===================
+*/
+void CM_TakeTraceCounts( int *traces, int *brushTraces, int *patchTraces ) {
+	cmTraceContext_t	*ctx;
+
+	*traces = *brushTraces = *patchTraces = 0;
+	for ( ctx = cm_traceContexts ; ctx ; ctx = ctx->next ) {
+		*traces += ctx->traces;
+		*brushTraces += ctx->brushTraces;
+		*patchTraces += ctx->patchTraces;
+		ctx->traces = ctx->brushTraces = ctx->patchTraces = 0;
+	}
+}
+
 /*
 ===================
 CM_ModelBounds
@@ -28,6 +28,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define	BOX_MODEL_HANDLE		255
 #define CAPSULE_MODEL_HANDLE	254
 
+// to allow boxes to be treated as brush models, we allocate
+// some extra indexes along with those needed by the map
+#define	BOX_BRUSHES		1
+#define	BOX_SIDES		6
+#define	BOX_LEAFS		2
+#define	BOX_PLANES		12
+
 
 typedef struct {
 	cplane_t	*plane;
@@ -62,12 +69,18 @@ typedef struct {
 	vec3_t		bounds[2];
 	int			numsides;
 	cbrushside_t	*sides;
+	float		*packedPlanes;	// PACKED_PLANE_GROUPS( numsides ) groups for the SIMD plane tests
 	int			checkcount;		// to avoid repeated testings
 } cbrush_t;
 
+// brush planes are also stored four at a time as normal x[4], y[4], z[4]
+// and dist[4]; unused lanes hold a plane that everything is behind
+#define	PACKED_PLANE_FLOATS			16
+#define	PACKED_PLANE_GROUPS(sides)	( ( (sides) + 3 ) >> 2 )
+#define	PACKED_PLANE_PAD_DIST		1e30f
+
 
 typedef struct {
-	int			checkcount;				// to avoid repeated testings
 	int			surfaceFlags;
 	int			contents;
 	struct patchCollide_s	*pc;
@@ -81,6 +94,7 @@ typedef struct {
 
 typedef struct {
 	char		name[MAX_QPATH];
+	int			checksum;
 
 	int			numShaders;
 	dshader_t	*shaders;
@@ -125,7 +139,7 @@ typedef struct {
 	cPatch_t	**surfaces;			// non-patches will be NULL
 
 	int			floodvalid;
-	int			checkcount;					// incremented on each trace
+	int			checkcount;					// for CM_BoxBrushes, traces count in their context
 } clipMap_t;
 
 
@@ -133,12 +147,37 @@ typedef struct {
 // and to avoid various numeric issues
 #define	SURFACE_CLIP_EPSILON	(0.125)
 
+struct cmTraceContext_s {
+	int			checkcount;			// incremented on each trace
+	int			*brushChecks;		// [numBrushes] checkcount of the last test
+	int			*patchChecks;		// [numSurfaces]
+	int			numBrushes, numSurfaces;
+
+	// the default context uses the hull allocated with the map,
+	// so CM_PointContents can still test against the temp box
+	cmodel_t	*boxModel;
+	cbrush_t	*boxBrush;
+	cplane_t	*boxPlanes;
+
+	cmodel_t	ownBoxModel;
+	cbrush_t	ownBoxBrush;
+	cbrushside_t ownBoxSides[BOX_SIDES];
+	cplane_t	ownBoxPlanes[BOX_PLANES];
+	float		ownBoxPacked[PACKED_PLANE_GROUPS( BOX_SIDES ) * PACKED_PLANE_FLOATS];
+
+	int			traces, brushTraces, patchTraces;	// for statistics, may be zeroed
+
+	struct cmTraceContext_s	*next;
+};
+
 extern	clipMap_t	cm;
+extern	cmTraceContext_t	cm_defaultTraceContext;
 extern	int			c_pointcontents;
-extern	int			c_traces, c_brush_traces, c_patch_traces;
 extern	cvar_t		*cm_noAreas;
 extern	cvar_t		*cm_noCurves;
+extern	cvar_t		*cm_simd;
 extern	cvar_t		*cm_playerCurveClip;
+extern	fileHandle_t	cm_traceLog;
 
 // cm_test.c
 
@@ -164,6 +203,7 @@ typedef struct {
 	qboolean	isPoint;	// optimized case
 	trace_t		trace;		// returned from trace call
 	sphere_t	sphere;		// sphere for oriendted capsule collision
+	cmTraceContext_t	*ctx;	// check counts and temp box of the caller
 } traceWork_t;
 
 typedef struct leafList_s {
@@ -179,15 +219,28 @@ typedef struct leafList_s {
 
 int CM_BoxBrushes( const vec3_t mins, const vec3_t maxs, cbrush_t **list, int listsize );
 
+void CM_PackBrushPlanes( cbrush_t *brush );
+
 void CM_StoreLeafs( leafList_t *ll, int nodenum );
 void CM_StoreBrushes( leafList_t *ll, int nodenum );
 
 void CM_BoxLeafnums_r( leafList_t *ll, int nodenum );
 
 cmodel_t	*CM_ClipHandleToModel( clipHandle_t handle );
+cmodel_t	*CM_ContextClipHandleToModel( cmTraceContext_t *ctx, clipHandle_t handle );
 qboolean CM_BoundsIntersect( const vec3_t mins, const vec3_t maxs, const vec3_t mins2, const vec3_t maxs2 );
 qboolean CM_BoundsIntersectPoint( const vec3_t mins, const vec3_t maxs, const vec3_t point );
 
+// cm_tracelog.c
+
+void CM_LogTraceStart( const vec3_t start, const vec3_t end,
+				  const vec3_t mins, const vec3_t maxs, clipHandle_t model, int brushmask,
+				  const vec3_t origin, const vec3_t angles, int capsule );
+void CM_LogTraceEnd( const trace_t *results );
+void CM_LogPointContents( const vec3_t p, clipHandle_t model, int contents );
+void CM_StopTraceRecord( void );
+void CM_ReplayTraceLog( const char *name );
+
 // cm_patch.c
 
 struct patchCollide_s	*CM_GeneratePatchCollide( int width, int height, vec3_t *points );
@@ -1298,10 +1298,11 @@ void CM_TracePointThroughPatchCollide( traceWork_t *tw, const struct patchCollid
 		if ( j == facet->numBorders ) {
 			// we hit this facet
 #ifndef BSPC
-			if (!cv) {
+			// other contexts may be tracing on worker threads
+			if (tw->ctx == &cm_defaultTraceContext && !cv) {
 				cv = Cvar_Get( "r_debugSurfaceUpdate", "1", 0 );
 			}
-			if (cv->integer) {
+			if (tw->ctx == &cm_defaultTraceContext && cv->integer) {
 				debugPatchCollide = pc;
 				debugFacet = facet;
 			}
@@ -1485,10 +1486,11 @@ void CM_TraceThroughPatchCollide( traceWork_t *tw, const struct patchCollide_s *
 					enterFrac = 0;
 				}
 #ifndef BSPC
-				if (!cv) {
+				// other contexts may be tracing on worker threads
+				if (tw->ctx == &cm_defaultTraceContext && !cv) {
 					cv = Cvar_Get( "r_debugSurfaceUpdate", "1", 0 );
 				}
-				if (cv && cv->integer) {
+				if (tw->ctx == &cm_defaultTraceContext && cv->integer) {
 					debugPatchCollide = pc;
 					debugFacet = facet;
 				}
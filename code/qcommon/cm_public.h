@@ -31,6 +31,7 @@ clipHandle_t CM_TempBoxModel( const vec3_t mins, const vec3_t maxs, int capsule
 void		CM_ModelBounds( clipHandle_t model, vec3_t mins, vec3_t maxs );
 
 int			CM_NumClusters (void);
+int			CM_NumAreas (void);
 int			CM_NumInlineModels( void );
 char		*CM_EntityString (void);
 
@@ -46,6 +47,29 @@ void		CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule );
 
+// A trace context holds the state a trace changes: the brush and patch
+// check counts and the temp box model.  Traces through different contexts
+// may run at the same time; the functions above use a default context and
+// stay main thread only.  Contexts must be allocated and freed on the main
+// thread, they are resized automatically when a new map is loaded.
+typedef struct cmTraceContext_s cmTraceContext_t;
+
+cmTraceContext_t *CM_AllocTraceContext( void );
+void		CM_FreeTraceContext( cmTraceContext_t *ctx );
+clipHandle_t CM_ContextTempBoxModel( cmTraceContext_t *ctx, const vec3_t mins, const vec3_t maxs, int capsule );
+void		CM_ContextBoxTrace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask, int capsule );
+void		CM_ContextTransformedBoxTrace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask,
+						  const vec3_t origin, const vec3_t angles, int capsule );
+void		CM_TakeTraceCounts( int *traces, int *brushTraces, int *patchTraces );
+void		CM_TraceStress_f( void );
+void		CM_TraceBench_f( void );
+void		CM_TraceRecord_f( void );
+void		CM_StopTraceRecord_f( void );
+
 byte		*CM_ClusterPVS (int cluster);
 
 int			CM_PointLeafnum( const vec3_t p );
@@ -48,7 +48,7 @@ int CM_PointLeafnum_r( const vec3_t p, int num ) {
 			num = node->children[0];
 	}
 
-	c_pointcontents++;		// optimize counter
+	Q_AtomicIncrement( &c_pointcontents );		// optimize counter, snapshot jobs get here too
 
 	return -1 - num;
 }
@@ -269,6 +269,10 @@ int CM_PointContents( const vec3_t p, clipHandle_t model ) {
 		}
 	}
 
+	if ( cm_traceLog ) {
+		CM_LogPointContents( p, model, contents );
+	}
+
 	return contents;
 }
 
@@ -21,6 +21,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include "cm_local.h"
 
+// test brush planes four at a time from their packed copy, only where
+// scalar float math is already done in SSE registers so results match
+#if idx64 && !defined(BSPC)
+#include <emmintrin.h>
+#define CM_PACKED_PLANES
+#endif
+
 // always use bbox vs. bbox collision and never capsule vs. bbox or vice versa
 //#define ALWAYS_BBOX_VS_BBOX
 // always use capsule vs. capsule collision and never capsule vs. bbox or vice versa
@@ -207,6 +214,55 @@ void CM_TestBoxInBrush( traceWork_t *tw, cbrush_t *brush ) {
 				return;
 			}
 		}
+#ifdef CM_PACKED_PLANES
+	} else if ( cm_simd->integer ) {
+		__m128		zero, startX, startY, startZ, size0X, size0Y, size0Z, size1X, size1Y, size1Z;
+		__m128		nx, ny, nz, neg, ox, oy, oz, dist4, d14;
+		const float	*p;
+		int			group, mask;
+
+		zero = _mm_setzero_ps();
+		startX = _mm_set1_ps( tw->start[0] );
+		startY = _mm_set1_ps( tw->start[1] );
+		startZ = _mm_set1_ps( tw->start[2] );
+		size0X = _mm_set1_ps( tw->size[0][0] );
+		size0Y = _mm_set1_ps( tw->size[0][1] );
+		size0Z = _mm_set1_ps( tw->size[0][2] );
+		size1X = _mm_set1_ps( tw->size[1][0] );
+		size1Y = _mm_set1_ps( tw->size[1][1] );
+		size1Z = _mm_set1_ps( tw->size[1][2] );
+
+		// the first six planes are the axial planes, the two
+		// others in their group are masked off below
+		p = brush->packedPlanes + PACKED_PLANE_FLOATS;
+		for ( group = 1 ; group < PACKED_PLANE_GROUPS( brush->numsides ) ; group++, p += PACKED_PLANE_FLOATS ) {
+			nx = _mm_loadu_ps( p );
+			ny = _mm_loadu_ps( p + 4 );
+			nz = _mm_loadu_ps( p + 8 );
+
+			// the box corner the plane is offset by, as tw->offsets[ plane->signbits ]
+			neg = _mm_cmplt_ps( nx, zero );
+			ox = _mm_or_ps( _mm_and_ps( neg, size1X ), _mm_andnot_ps( neg, size0X ) );
+			neg = _mm_cmplt_ps( ny, zero );
+			oy = _mm_or_ps( _mm_and_ps( neg, size1Y ), _mm_andnot_ps( neg, size0Y ) );
+			neg = _mm_cmplt_ps( nz, zero );
+			oz = _mm_or_ps( _mm_and_ps( neg, size1Z ), _mm_andnot_ps( neg, size0Z ) );
+
+			dist4 = _mm_sub_ps( _mm_loadu_ps( p + 12 ), _mm_add_ps( _mm_add_ps(
+				_mm_mul_ps( ox, nx ), _mm_mul_ps( oy, ny ) ), _mm_mul_ps( oz, nz ) ) );
+			d14 = _mm_sub_ps( _mm_add_ps( _mm_add_ps(
+				_mm_mul_ps( startX, nx ), _mm_mul_ps( startY, ny ) ), _mm_mul_ps( startZ, nz ) ), dist4 );
+
+			mask = _mm_movemask_ps( _mm_cmpgt_ps( d14, zero ) );
+			if ( group == 1 ) {
+				mask &= ~3;
+			}
+			// if completely in front of face, no intersection
+			if ( mask ) {
+				return;
+			}
+		}
+#endif
 	} else {
 		// the first six planes are the axial planes, so we only
 		// need to test the remainder
@@ -241,18 +297,18 @@ CM_TestInLeaf
 */
 void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	int			k;
-	int			brushnum;
+	int			brushnum, surfnum;
 	cbrush_t	*b;
 	cPatch_t	*patch;
 
 	// test box position against all brushes in the leaf
 	for (k=0 ; k<leaf->numLeafBrushes ; k++) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
-		b = &cm.brushes[brushnum];
-		if (b->checkcount == cm.checkcount) {
+		if (tw->ctx->brushChecks[brushnum] == tw->ctx->checkcount) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		tw->ctx->brushChecks[brushnum] = tw->ctx->checkcount;
+		b = &cm.brushes[brushnum];
 
 		if ( !(b->contents & tw->contents)) {
 			continue;
@@ -271,14 +327,15 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	if ( !cm_noCurves->integer ) {
 #endif //BSPC
 		for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
-			patch = cm.surfaces[ cm.leafsurfaces[ leaf->firstLeafSurface + k ] ];
+			surfnum = cm.leafsurfaces[ leaf->firstLeafSurface + k ];
+			patch = cm.surfaces[ surfnum ];
 			if ( !patch ) {
 				continue;
 			}
-			if ( patch->checkcount == cm.checkcount ) {
+			if ( tw->ctx->patchChecks[surfnum] == tw->ctx->checkcount ) {
 				continue;	// already checked this brush in another leaf
 			}
-			patch->checkcount = cm.checkcount;
+			tw->ctx->patchChecks[surfnum] = tw->ctx->checkcount;
 
 			if ( !(patch->contents & tw->contents)) {
 				continue;
@@ -294,6 +351,37 @@ void CM_TestInLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	}
 }
 
+/*
+================
+CM_TestInBox
+
+The temp box of the context, its model leaf only holds the shared hull
+================
+*/
+static void CM_TestInBox( traceWork_t *tw ) {
+	cbrush_t	*b;
+
+	b = tw->ctx->boxBrush;
+	if ( !(b->contents & tw->contents)) {
+		return;
+	}
+
+	CM_TestBoxInBrush( tw, b );
+}
+
+/*
+================
+CM_ContextModelBounds
+================
+*/
+static void CM_ContextModelBounds( traceWork_t *tw, clipHandle_t model, vec3_t mins, vec3_t maxs ) {
+	cmodel_t	*cmod;
+
+	cmod = CM_ContextClipHandleToModel( tw->ctx, model );
+	VectorCopy( cmod->mins, mins );
+	VectorCopy( cmod->maxs, maxs );
+}
+
 /*
 ==================
 CM_TestCapsuleInCapsule
@@ -309,7 +397,7 @@ void CM_TestCapsuleInCapsule( traceWork_t *tw, clipHandle_t model ) {
 	vec3_t offset, symetricSize[2];
 	float radius, halfwidth, halfheight, offs, r;
 
-	CM_ModelBounds(model, mins, maxs);
+	CM_ContextModelBounds(tw, model, mins, maxs);
 
 	VectorAdd(tw->start, tw->sphere.offset, top);
 	VectorSubtract(tw->start, tw->sphere.offset, bottom);
@@ -372,12 +460,10 @@ bounding box inside capsule check
 */
 void CM_TestBoundingBoxInCapsule( traceWork_t *tw, clipHandle_t model ) {
 	vec3_t mins, maxs, offset, size[2];
-	clipHandle_t h;
-	cmodel_t *cmod;
 	int i;
 
 	// mins maxs of the capsule
-	CM_ModelBounds(model, mins, maxs);
+	CM_ContextModelBounds(tw, model, mins, maxs);
 
 	// offset for capsule center
 	for ( i = 0 ; i < 3 ; i++ ) {
@@ -395,10 +481,9 @@ void CM_TestBoundingBoxInCapsule( traceWork_t *tw, clipHandle_t model ) {
 	VectorSet( tw->sphere.offset, 0, 0, size[1][2] - tw->sphere.radius );
 
 	// replace the capsule with the bounding box
-	h = CM_TempBoxModel(tw->size[0], tw->size[1], qfalse);
+	CM_ContextTempBoxModel(tw->ctx, tw->size[0], tw->size[1], qfalse);
 	// calculate collision
-	cmod = CM_ClipHandleToModel( h );
-	CM_TestInLeaf( tw, &cmod->leaf );
+	CM_TestInBox( tw );
 }
 
 /*
@@ -428,12 +513,10 @@ void CM_PositionTest( traceWork_t *tw ) {
 	ll.lastLeaf = 0;
 	ll.overflowed = qfalse;
 
-	cm.checkcount++;
-
 	CM_BoxLeafnums_r( &ll, 0 );
 
 
-	cm.checkcount++;
+	tw->ctx->checkcount++;
 
 	// test the contents of the leafs
 	for (i=0 ; i < ll.count ; i++) {
@@ -462,7 +545,7 @@ CM_TraceThroughPatch
 void CM_TraceThroughPatch( traceWork_t *tw, cPatch_t *patch ) {
 	float		oldFrac;
 
-	c_patch_traces++;
+	tw->ctx->patchTraces++;
 
 	oldFrac = tw->trace.fraction;
 
@@ -500,7 +583,7 @@ void CM_TraceThroughBrush( traceWork_t *tw, cbrush_t *brush ) {
 		return;
 	}
 
-	c_brush_traces++;
+	tw->ctx->brushTraces++;
 
 	getout = qfalse;
 	startout = qfalse;
@@ -574,6 +657,112 @@ void CM_TraceThroughBrush( traceWork_t *tw, cbrush_t *brush ) {
 				}
 			}
 		}
+#ifdef CM_PACKED_PLANES
+	} else if ( cm_simd->integer ) {
+		__m128		zero, epsilon, startX, startY, startZ, endX, endY, endZ;
+		__m128		size0X, size0Y, size0Z, size1X, size1Y, size1Z;
+		__m128		nx, ny, nz, neg, ox, oy, oz, dist4, d14, d24;
+		float		d1s[4], d2s[4];
+		const float	*p;
+		int			group, mask, lane;
+
+		zero = _mm_setzero_ps();
+		epsilon = _mm_set1_ps( SURFACE_CLIP_EPSILON );
+		startX = _mm_set1_ps( tw->start[0] );
+		startY = _mm_set1_ps( tw->start[1] );
+		startZ = _mm_set1_ps( tw->start[2] );
+		endX = _mm_set1_ps( tw->end[0] );
+		endY = _mm_set1_ps( tw->end[1] );
+		endZ = _mm_set1_ps( tw->end[2] );
+		size0X = _mm_set1_ps( tw->size[0][0] );
+		size0Y = _mm_set1_ps( tw->size[0][1] );
+		size0Z = _mm_set1_ps( tw->size[0][2] );
+		size1X = _mm_set1_ps( tw->size[1][0] );
+		size1Y = _mm_set1_ps( tw->size[1][1] );
+		size1Z = _mm_set1_ps( tw->size[1][2] );
+
+		//
+		// the same tests as below for four planes at a time, the
+		// planes that are crossed are then taken in order so the
+		// same plane wins ties
+		//
+		p = brush->packedPlanes;
+		for ( group = 0 ; group < PACKED_PLANE_GROUPS( brush->numsides ) ; group++, p += PACKED_PLANE_FLOATS ) {
+			nx = _mm_loadu_ps( p );
+			ny = _mm_loadu_ps( p + 4 );
+			nz = _mm_loadu_ps( p + 8 );
+
+			// the box corner the plane is offset by, as tw->offsets[ plane->signbits ]
+			neg = _mm_cmplt_ps( nx, zero );
+			ox = _mm_or_ps( _mm_and_ps( neg, size1X ), _mm_andnot_ps( neg, size0X ) );
+			neg = _mm_cmplt_ps( ny, zero );
+			oy = _mm_or_ps( _mm_and_ps( neg, size1Y ), _mm_andnot_ps( neg, size0Y ) );
+			neg = _mm_cmplt_ps( nz, zero );
+			oz = _mm_or_ps( _mm_and_ps( neg, size1Z ), _mm_andnot_ps( neg, size0Z ) );
+
+			// adjust the plane distance apropriately for mins/maxs
+			dist4 = _mm_sub_ps( _mm_loadu_ps( p + 12 ), _mm_add_ps( _mm_add_ps(
+				_mm_mul_ps( ox, nx ), _mm_mul_ps( oy, ny ) ), _mm_mul_ps( oz, nz ) ) );
+
+			d14 = _mm_sub_ps( _mm_add_ps( _mm_add_ps(
+				_mm_mul_ps( startX, nx ), _mm_mul_ps( startY, ny ) ), _mm_mul_ps( startZ, nz ) ), dist4 );
+			d24 = _mm_sub_ps( _mm_add_ps( _mm_add_ps(
+				_mm_mul_ps( endX, nx ), _mm_mul_ps( endY, ny ) ), _mm_mul_ps( endZ, nz ) ), dist4 );
+
+			// if completely in front of face, no intersection with the entire brush
+			if ( _mm_movemask_ps( _mm_and_ps( _mm_cmpgt_ps( d14, zero ),
+				_mm_or_ps( _mm_cmpge_ps( d24, epsilon ), _mm_cmpge_ps( d24, d14 ) ) ) ) ) {
+				return;
+			}
+
+			if ( _mm_movemask_ps( _mm_cmpgt_ps( d24, zero ) ) ) {
+				getout = qtrue;	// endpoint is not in solid
+			}
+			if ( _mm_movemask_ps( _mm_cmpgt_ps( d14, zero ) ) ) {
+				startout = qtrue;
+			}
+
+			// if it doesn't cross the plane, the plane isn't relevent
+			mask = _mm_movemask_ps( _mm_and_ps( _mm_cmple_ps( d14, zero ), _mm_cmple_ps( d24, zero ) ) ) ^ 15;
+			if ( !mask ) {
+				continue;
+			}
+
+			_mm_storeu_ps( d1s, d14 );
+			_mm_storeu_ps( d2s, d24 );
+
+			for ( lane = 0 ; mask ; lane++, mask >>= 1 ) {
+				if ( !( mask & 1 ) ) {
+					continue;
+				}
+				side = brush->sides + group * 4 + lane;
+				plane = side->plane;
+				d1 = d1s[lane];
+				d2 = d2s[lane];
+
+				// crosses face
+				if (d1 > d2) {	// enter
+					f = (d1-SURFACE_CLIP_EPSILON) / (d1-d2);
+					if ( f < 0 ) {
+						f = 0;
+					}
+					if (f > enterFrac) {
+						enterFrac = f;
+						clipplane = plane;
+						leadside = side;
+					}
+				} else {	// leave
+					f = (d1+SURFACE_CLIP_EPSILON) / (d1-d2);
+					if ( f > 1 ) {
+						f = 1;
+					}
+					if (f < leaveFrac) {
+						leaveFrac = f;
+					}
+				}
+			}
+		}
+#endif
 	} else {
 		//
 		// compare the trace against all planes of the brush
@@ -664,7 +853,7 @@ CM_TraceThroughLeaf
 */
 void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	int			k;
-	int			brushnum;
+	int			brushnum, surfnum;
 	cbrush_t	*b;
 	cPatch_t	*patch;
 
@@ -672,11 +861,11 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	for ( k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
 		brushnum = cm.leafbrushes[leaf->firstLeafBrush+k];
 
-		b = &cm.brushes[brushnum];
-		if ( b->checkcount == cm.checkcount ) {
+		if ( tw->ctx->brushChecks[brushnum] == tw->ctx->checkcount ) {
 			continue;	// already checked this brush in another leaf
 		}
-		b->checkcount = cm.checkcount;
+		tw->ctx->brushChecks[brushnum] = tw->ctx->checkcount;
+		b = &cm.brushes[brushnum];
 
 		if ( !(b->contents & tw->contents) ) {
 			continue;
@@ -700,14 +889,15 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	if ( !cm_noCurves->integer ) {
 #endif
 		for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
-			patch = cm.surfaces[ cm.leafsurfaces[ leaf->firstLeafSurface + k ] ];
+			surfnum = cm.leafsurfaces[ leaf->firstLeafSurface + k ];
+			patch = cm.surfaces[ surfnum ];
 			if ( !patch ) {
 				continue;
 			}
-			if ( patch->checkcount == cm.checkcount ) {
+			if ( tw->ctx->patchChecks[surfnum] == tw->ctx->checkcount ) {
 				continue;	// already checked this patch in another leaf
 			}
-			patch->checkcount = cm.checkcount;
+			tw->ctx->patchChecks[surfnum] = tw->ctx->checkcount;
 
 			if ( !(patch->contents & tw->contents) ) {
 				continue;
@@ -721,6 +911,29 @@ void CM_TraceThroughLeaf( traceWork_t *tw, cLeaf_t *leaf ) {
 	}
 }
 
+/*
+================
+CM_TraceThroughBox
+
+The temp box of the context, its model leaf only holds the shared hull
+================
+*/
+static void CM_TraceThroughBox( traceWork_t *tw ) {
+	cbrush_t	*b;
+
+	b = tw->ctx->boxBrush;
+	if ( !(b->contents & tw->contents) ) {
+		return;
+	}
+
+	if ( !CM_BoundsIntersect( tw->bounds[0], tw->bounds[1],
+				b->bounds[0], b->bounds[1] ) ) {
+		return;
+	}
+
+	CM_TraceThroughBrush( tw, b );
+}
+
 #define RADIUS_EPSILON		1.0f
 
 /*
@@ -930,7 +1143,7 @@ void CM_TraceCapsuleThroughCapsule( traceWork_t *tw, clipHandle_t model ) {
 	vec3_t offset, symetricSize[2];
 	float radius, halfwidth, halfheight, offs, h;
 
-	CM_ModelBounds(model, mins, maxs);
+	CM_ContextModelBounds(tw, model, mins, maxs);
 	// test trace bounds vs. capsule bounds
 	if ( tw->bounds[0][0] > maxs[0] + RADIUS_EPSILON
 		|| tw->bounds[0][1] > maxs[1] + RADIUS_EPSILON
@@ -987,12 +1200,10 @@ bounding box vs. capsule collision
 */
 void CM_TraceBoundingBoxThroughCapsule( traceWork_t *tw, clipHandle_t model ) {
 	vec3_t mins, maxs, offset, size[2];
-	clipHandle_t h;
-	cmodel_t *cmod;
 	int i;
 
 	// mins maxs of the capsule
-	CM_ModelBounds(model, mins, maxs);
+	CM_ContextModelBounds(tw, model, mins, maxs);
 
 	// offset for capsule center
 	for ( i = 0 ; i < 3 ; i++ ) {
@@ -1010,10 +1221,9 @@ void CM_TraceBoundingBoxThroughCapsule( traceWork_t *tw, clipHandle_t model ) {
 	VectorSet( tw->sphere.offset, 0, 0, size[1][2] - tw->sphere.radius );
 
 	// replace the capsule with the bounding box
-	h = CM_TempBoxModel(tw->size[0], tw->size[1], qfalse);
+	CM_ContextTempBoxModel(tw->ctx, tw->size[0], tw->size[1], qfalse);
 	// calculate collision
-	cmod = CM_ClipHandleToModel( h );
-	CM_TraceThroughLeaf( tw, &cmod->leaf );
+	CM_TraceThroughBox( tw );
 }
 
 //=========================================================================================
@@ -1141,23 +1351,24 @@ void CM_TraceThroughTree( traceWork_t *tw, int num, float p1f, float p2f, vec3_t
 CM_Trace
 ==================
 */
-void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mins, vec3_t maxs,
+static void CM_Trace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end, vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, const vec3_t origin, int brushmask, int capsule, sphere_t *sphere ) {
 	int			i;
 	traceWork_t	tw;
 	vec3_t		offset;
 	cmodel_t	*cmod;
 
-	cmod = CM_ClipHandleToModel( model );
+	cmod = CM_ContextClipHandleToModel( ctx, model );
 
-	cm.checkcount++;		// for multi-check avoidance
+	ctx->checkcount++;		// for multi-check avoidance
 
-	c_traces++;				// for statistics, may be zeroed
+	ctx->traces++;			// for statistics, may be zeroed
 
 	// fill in a default trace
 	Com_Memset( &tw, 0, sizeof(tw) );
 	tw.trace.fraction = 1;	// assume it goes the entire distance until shown otherwise
 	VectorCopy(origin, tw.modelOrigin);
+	tw.ctx = ctx;
 
 	if (!cm.numNodes) {
 		*results = tw.trace;
@@ -1267,7 +1478,7 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 #ifdef ALWAYS_BBOX_VS_BBOX // FIXME - compile time flag?
 			if ( model == BOX_MODEL_HANDLE || model == CAPSULE_MODEL_HANDLE) {
 				tw.sphere.use = qfalse;
-				CM_TestInLeaf( &tw, &cmod->leaf );
+				CM_TestInBox( &tw );
 			}
 			else
 #elif defined(ALWAYS_CAPSULE_VS_CAPSULE)
@@ -1284,6 +1495,9 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 					CM_TestBoundingBoxInCapsule( &tw, model );
 				}
 			}
+			else if ( model == BOX_MODEL_HANDLE ) {
+				CM_TestInBox( &tw );
+			}
 			else {
 				CM_TestInLeaf( &tw, &cmod->leaf );
 			}
@@ -1311,7 +1525,7 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 #ifdef ALWAYS_BBOX_VS_BBOX
 			if ( model == BOX_MODEL_HANDLE || model == CAPSULE_MODEL_HANDLE) {
 				tw.sphere.use = qfalse;
-				CM_TraceThroughLeaf( &tw, &cmod->leaf );
+				CM_TraceThroughBox( &tw );
 			}
 			else
 #elif defined(ALWAYS_CAPSULE_VS_CAPSULE)
@@ -1328,6 +1542,9 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 					CM_TraceBoundingBoxThroughCapsule( &tw, model );
 				}
 			}
+			else if ( model == BOX_MODEL_HANDLE ) {
+				CM_TraceThroughBox( &tw );
+			}
 			else {
 				CM_TraceThroughLeaf( &tw, &cmod->leaf );
 			}
@@ -1354,6 +1571,17 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 	*results = tw.trace;
 }
 
+/*
+==================
+CM_ContextBoxTrace
+==================
+*/
+void CM_ContextBoxTrace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask, int capsule ) {
+	CM_Trace( ctx, results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
+}
+
 /*
 ==================
 CM_BoxTrace
@@ -1362,18 +1590,26 @@ CM_BoxTrace
 void CM_BoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
 						  vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, int brushmask, int capsule ) {
-	CM_Trace( results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
+	if ( cm_traceLog ) {
+		CM_LogTraceStart( start, end, mins, maxs, model, brushmask, NULL, NULL, capsule );
+	}
+
+	CM_Trace( &cm_defaultTraceContext, results, start, end, mins, maxs, model, vec3_origin, brushmask, capsule, NULL );
+
+	if ( cm_traceLog ) {
+		CM_LogTraceEnd( results );
+	}
 }
 
 /*
 ==================
-CM_TransformedBoxTrace
+CM_ContextTransformedBoxTrace
 
 Handles offseting and rotation of the end points for moving and
 rotating entities
 ==================
 */
-void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
+void CM_ContextTransformedBoxTrace( cmTraceContext_t *ctx, trace_t *results, const vec3_t start, const vec3_t end,
 						  vec3_t mins, vec3_t maxs,
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule ) {
@@ -1447,7 +1683,7 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 	}
 
 	// sweep the box through the model
-	CM_Trace( &trace, start_l, end_l, symetricSize[0], symetricSize[1], model, origin, brushmask, capsule, &sphere );
+	CM_Trace( ctx, &trace, start_l, end_l, symetricSize[0], symetricSize[1], model, origin, brushmask, capsule, &sphere );
 
 	// if the bmodel was rotated and there was a collision
 	if ( rotated && trace.fraction != 1.0 ) {
@@ -1464,3 +1700,251 @@ void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 
 	*results = trace;
 }
+
+/*
+==================
+CM_TransformedBoxTrace
+==================
+*/
+void CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t end,
+						  vec3_t mins, vec3_t maxs,
+						  clipHandle_t model, int brushmask,
+						  const vec3_t origin, const vec3_t angles, int capsule ) {
+	if ( cm_traceLog ) {
+		CM_LogTraceStart( start, end, mins, maxs, model, brushmask, origin, angles, capsule );
+	}
+
+	CM_ContextTransformedBoxTrace( &cm_defaultTraceContext, results, start, end, mins, maxs,
+		model, brushmask, origin, angles, capsule );
+
+	if ( cm_traceLog ) {
+		CM_LogTraceEnd( results );
+	}
+}
+
+/*
+===============================================================================
+
+TRACE STRESS TEST
+
+===============================================================================
+*/
+
+#define	STRESS_JOBS		64
+#define	MAX_STRESS_TRACES	0x40000
+#define	STRESS_MASK		( CONTENTS_SOLID | CONTENTS_PLAYERCLIP | CONTENTS_BODY )
+
+typedef struct {
+	int			numTraces;
+	trace_t		*results;
+	cmTraceContext_t	*contexts[STRESS_JOBS];
+} traceStress_t;
+
+static float CM_StressRandom( unsigned int *seed ) {
+	*seed = *seed * 1103515245 + 12345;
+	return ( ( *seed >> 8 ) & 0xffff ) / 65535.0f;
+}
+
+/*
+==================
+CM_StressTrace
+
+Runs trace number i of the stress test, the parameters only depend on i.
+Mixes point and box traces through the world, position tests, and traces
+against temp boxes, capsules and rotated inline models.
+==================
+*/
+static void CM_StressTrace( cmTraceContext_t *ctx, int i, trace_t *result ) {
+	static vec3_t	playerMins = { -15, -15, -24 }, playerMaxs = { 15, 15, 32 };
+	vec3_t		start, end, boxMins, boxMaxs, angles;
+	float		*mins, *maxs;
+	unsigned int	seed;
+	clipHandle_t	model;
+	int			j, kind;
+
+	seed = i * 2654435761u;
+	for ( j = 0 ; j < 3 ; j++ ) {
+		start[j] = cm.cmodels[0].mins[j] + ( cm.cmodels[0].maxs[j] - cm.cmodels[0].mins[j] ) * CM_StressRandom( &seed );
+	}
+	kind = (int)( CM_StressRandom( &seed ) * 8 );
+	if ( kind == 0 ) {
+		VectorCopy( start, end );
+	} else {
+		for ( j = 0 ; j < 3 ; j++ ) {
+			end[j] = start[j] + ( CM_StressRandom( &seed ) - 0.5f ) * 2048;
+		}
+	}
+	if ( kind & 1 ) {
+		mins = maxs = NULL;
+	} else {
+		mins = playerMins;
+		maxs = playerMaxs;
+	}
+
+	if ( kind >= 6 ) {
+		// a box or capsule somewhere along the move
+		for ( j = 0 ; j < 3 ; j++ ) {
+			boxMins[j] = start[j] + ( end[j] - start[j] ) * CM_StressRandom( &seed ) - 32;
+			boxMaxs[j] = boxMins[j] + 16 + CM_StressRandom( &seed ) * 48;
+		}
+		model = CM_ContextTempBoxModel( ctx, boxMins, boxMaxs, kind == 7 );
+		CM_ContextBoxTrace( ctx, result, start, end, mins, maxs, model, STRESS_MASK, qfalse );
+	} else if ( kind == 5 && cm.numSubModels > 1 ) {
+		model = CM_InlineModel( 1 + (int)( CM_StressRandom( &seed ) * ( cm.numSubModels - 2 ) ) );
+		VectorSet( angles, CM_StressRandom( &seed ) * 360, CM_StressRandom( &seed ) * 360, 0 );
+		CM_ContextTransformedBoxTrace( ctx, result, start, end, mins, maxs, model, STRESS_MASK,
+			vec3_origin, angles, qfalse );
+	} else {
+		CM_ContextBoxTrace( ctx, result, start, end, mins, maxs, 0, STRESS_MASK, qfalse );
+	}
+}
+
+/*
+==================
+CM_TraceStressJob
+==================
+*/
+static void CM_TraceStressJob( void *data, int index ) {
+	traceStress_t	*ts = data;
+	int				i, first, last;
+
+	first = ts->numTraces * index / STRESS_JOBS;
+	last = ts->numTraces * ( index + 1 ) / STRESS_JOBS;
+	for ( i = first ; i < last ; i++ ) {
+		CM_StressTrace( ts->contexts[index], i, &ts->results[i] );
+	}
+}
+
+/*
+==================
+CM_TraceStress_f
+
+Runs the same traces on the main thread through the default context and
+then spread over the job workers with a context per job, and counts the
+results that differ.
+==================
+*/
+void CM_TraceStress_f( void ) {
+	traceStress_t	ts;
+	trace_t			*reference;
+	int				threads, oldWorkers;
+	int				i, mismatches;
+	unsigned int	single, multi;
+
+	if ( !cm.numNodes ) {
+		Com_Printf( "No map loaded.\n" );
+		return;
+	}
+
+	threads = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 4;
+	ts.numTraces = Cmd_Argc() > 2 ? atoi( Cmd_Argv( 2 ) ) : 65536;
+	if ( threads < 1 ) {
+		threads = 1;
+	}
+	if ( ts.numTraces < 1 ) {
+		ts.numTraces = 1;
+	} else if ( ts.numTraces > MAX_STRESS_TRACES ) {
+		ts.numTraces = MAX_STRESS_TRACES;
+	}
+
+	reference = Hunk_AllocateTempMemory( ts.numTraces * sizeof( trace_t ) );
+	ts.results = Hunk_AllocateTempMemory( ts.numTraces * sizeof( trace_t ) );
+	for ( i = 0 ; i < STRESS_JOBS ; i++ ) {
+		ts.contexts[i] = CM_AllocTraceContext();
+	}
+
+	single = Sys_Microseconds();
+	for ( i = 0 ; i < ts.numTraces ; i++ ) {
+		CM_StressTrace( &cm_defaultTraceContext, i, &reference[i] );
+	}
+	single = Sys_Microseconds() - single;
+
+	oldWorkers = Sys_JobWorkers();
+	threads = Sys_SetJobWorkers( threads - 1 ) + 1;
+
+	multi = Sys_Microseconds();
+	Sys_RunJobs( CM_TraceStressJob, &ts, STRESS_JOBS );
+	multi = Sys_Microseconds() - multi;
+
+	Sys_SetJobWorkers( oldWorkers );
+
+	mismatches = 0;
+	for ( i = 0 ; i < ts.numTraces ; i++ ) {
+		if ( memcmp( &reference[i], &ts.results[i], sizeof( trace_t ) ) ) {
+			mismatches++;
+		}
+	}
+
+	for ( i = 0 ; i < STRESS_JOBS ; i++ ) {
+		CM_FreeTraceContext( ts.contexts[i] );
+	}
+	Hunk_FreeTempMemory( ts.results );
+	Hunk_FreeTempMemory( reference );
+
+	Com_Printf( "%d traces: 1 thread %.3f usec/trace, %d threads %.3f usec/trace, %d mismatches\n",
+		ts.numTraces, (float)single / ts.numTraces, threads, (float)multi / ts.numTraces, mismatches );
+}
+
+/*
+==================
+CM_TraceBench_f
+
+tracebench [traces]
+tracebench <log>
+
+Runs the stress test traces through the default context with the scalar
+brush clipping and then with the packed planes, and counts the results
+that differ.
+==================
+*/
+void CM_TraceBench_f( void ) {
+	trace_t			*results[2];
+	unsigned int	usec[2];
+	int				numTraces, oldSimd;
+	int				i, pass, mismatches;
+
+	// tracebench <log> replays a recorded match instead
+	if ( Cmd_Argc() > 1 && !( Cmd_Argv( 1 )[0] >= '0' && Cmd_Argv( 1 )[0] <= '9' ) ) {
+		CM_ReplayTraceLog( Cmd_Argv( 1 ) );
+		return;
+	}
+
+	if ( !cm.numNodes ) {
+		Com_Printf( "No map loaded.\n" );
+		return;
+	}
+
+	numTraces = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 65536;
+	if ( numTraces < 1 ) {
+		numTraces = 1;
+	} else if ( numTraces > MAX_STRESS_TRACES ) {
+		numTraces = MAX_STRESS_TRACES;
+	}
+
+	results[0] = Hunk_AllocateTempMemory( numTraces * sizeof( trace_t ) );
+	results[1] = Hunk_AllocateTempMemory( numTraces * sizeof( trace_t ) );
+
+	oldSimd = cm_simd->integer;
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		Cvar_SetValue( "cm_simd", pass );
+		usec[pass] = Sys_Microseconds();
+		for ( i = 0 ; i < numTraces ; i++ ) {
+			CM_StressTrace( &cm_defaultTraceContext, i, &results[pass][i] );
+		}
+		usec[pass] = Sys_Microseconds() - usec[pass];
+	}
+	Cvar_SetValue( "cm_simd", oldSimd );
+
+	mismatches = 0;
+	for ( i = 0 ; i < numTraces ; i++ ) {
+		if ( memcmp( &results[0][i], &results[1][i], sizeof( trace_t ) ) ) {
+			mismatches++;
+		}
+	}
+
+	Hunk_FreeTempMemory( results[1] );
+	Hunk_FreeTempMemory( results[0] );
+
+	Com_Printf( "%d traces: scalar %.0f traces/sec, packed %.0f traces/sec, %d mismatches\n", numTraces,
+		numTraces * 1000000.0 / ( usec[0] ? usec[0] : 1 ), numTraces * 1000000.0 / ( usec[1] ? usec[1] : 1 ), mismatches );
+}
@@ -0,0 +1,603 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+#include "cm_local.h"
+
+/*
+===============================================================================
+
+TRACE LOGS
+
+A trace log records every query made through CM_BoxTrace,
+CM_TransformedBoxTrace and CM_PointContents with its inputs and results,
+so a real match can be replayed against the collision code later.
+
+The file is a header followed by variable length records, all little
+endian.  Each record starts with a flags word giving its type and which
+optional fields follow.
+
+===============================================================================
+*/
+
+#define	TRACELOG_IDENT			(('R'<<24)+('T'<<16)+('M'<<8)+'C')	// little-endian "CMTR"
+#define	TRACELOG_VERSION		1
+
+#define	TRACELOG_BOX			0
+#define	TRACELOG_TRANSFORMED	1
+#define	TRACELOG_POINT			2
+#define	TRACELOG_TYPE			3
+
+#define	TRACELOG_NOSIZE			4		// mins and maxs were NULL
+#define	TRACELOG_TEMPBOX		8		// the bounds of the temp box model follow
+
+#define	TRACELOG_RESULT_SIZE	44		// fraction, endpos, plane, surfaceFlags, contents, solid bits
+#define	TRACELOG_MAX_RECORD		( 4 + 12 * 8 + 12 + TRACELOG_RESULT_SIZE )
+
+#define	TRACELOG_REPEATS		16		// calls per latency sample
+#define	TRACELOG_MISMATCHES		8		// mismatches printed
+
+typedef struct {
+	int			ident;
+	int			version;
+	int			checksum;
+	int			numRecords;
+	char		mapName[MAX_QPATH];
+} traceLogHeader_t;
+
+typedef struct {
+	int			flags;
+	vec3_t		start, end;
+	vec3_t		mins, maxs;
+	clipHandle_t	model;
+	int			brushmask;
+	int			capsule;
+	vec3_t		boxMins, boxMaxs;
+	vec3_t		origin, angles;
+	const byte	*result;			// logged result, as written
+} traceLogRecord_t;
+
+fileHandle_t	cm_traceLog;
+static traceLogHeader_t	cm_traceLogHeader;
+static byte		cm_traceLogRecord[TRACELOG_MAX_RECORD];	// the trace being made
+static int		cm_traceLogLength;
+
+/*
+===============================================================================
+
+ENCODING
+
+===============================================================================
+*/
+
+static byte *CM_PutLong( byte *p, int l ) {
+	l = LittleLong( l );
+	Com_Memcpy( p, &l, 4 );
+	return p + 4;
+}
+
+static byte *CM_PutFloat( byte *p, float f ) {
+	f = LittleFloat( f );
+	Com_Memcpy( p, &f, 4 );
+	return p + 4;
+}
+
+static byte *CM_PutVector( byte *p, const vec3_t v ) {
+	p = CM_PutFloat( p, v[0] );
+	p = CM_PutFloat( p, v[1] );
+	return CM_PutFloat( p, v[2] );
+}
+
+static const byte *CM_GetLong( const byte *p, int *l ) {
+	Com_Memcpy( l, p, 4 );
+	*l = LittleLong( *l );
+	return p + 4;
+}
+
+static const byte *CM_GetFloat( const byte *p, float *f ) {
+	Com_Memcpy( f, p, 4 );
+	*f = LittleFloat( *f );
+	return p + 4;
+}
+
+static const byte *CM_GetVector( const byte *p, vec3_t v ) {
+	p = CM_GetFloat( p, &v[0] );
+	p = CM_GetFloat( p, &v[1] );
+	return CM_GetFloat( p, &v[2] );
+}
+
+/*
+==================
+CM_PutTraceResult
+
+Only the fields filled in by the collision model are kept.
+==================
+*/
+static byte *CM_PutTraceResult( byte *p, const trace_t *trace ) {
+	p = CM_PutFloat( p, trace->fraction );
+	p = CM_PutVector( p, trace->endpos );
+	p = CM_PutVector( p, trace->plane.normal );
+	p = CM_PutFloat( p, trace->plane.dist );
+	p = CM_PutLong( p, trace->surfaceFlags );
+	p = CM_PutLong( p, trace->contents );
+	return CM_PutLong( p, ( trace->allsolid ? 1 : 0 ) | ( trace->startsolid ? 2 : 0 ) );
+}
+
+/*
+==================
+CM_PutModel
+
+Temp box models are rebuilt from their bounds on replay.
+==================
+*/
+static byte *CM_PutModel( byte *p, int *flags, clipHandle_t model ) {
+	p = CM_PutLong( p, model );
+	if ( model == BOX_MODEL_HANDLE || model == CAPSULE_MODEL_HANDLE ) {
+		*flags |= TRACELOG_TEMPBOX;
+		p = CM_PutVector( p, cm_defaultTraceContext.boxModel->mins );
+		p = CM_PutVector( p, cm_defaultTraceContext.boxModel->maxs );
+	}
+	return p;
+}
+
+/*
+===============================================================================
+
+RECORDING
+
+===============================================================================
+*/
+
+/*
+==================
+CM_LogTraceStart
+
+Encodes the inputs before the trace is made, since capsule traces
+reuse the temp box model.  origin and angles are NULL for CM_BoxTrace.
+==================
+*/
+void CM_LogTraceStart( const vec3_t start, const vec3_t end,
+				  const vec3_t mins, const vec3_t maxs, clipHandle_t model, int brushmask,
+				  const vec3_t origin, const vec3_t angles, int capsule ) {
+	byte	*p;
+	int		flags;
+
+	flags = origin ? TRACELOG_TRANSFORMED : TRACELOG_BOX;
+
+	p = cm_traceLogRecord + 4;
+	p = CM_PutVector( p, start );
+	p = CM_PutVector( p, end );
+	if ( !mins && !maxs ) {
+		flags |= TRACELOG_NOSIZE;
+	} else {
+		p = CM_PutVector( p, mins ? mins : vec3_origin );
+		p = CM_PutVector( p, maxs ? maxs : vec3_origin );
+	}
+	p = CM_PutModel( p, &flags, model );
+	p = CM_PutLong( p, brushmask );
+	p = CM_PutLong( p, capsule );
+	if ( origin ) {
+		p = CM_PutVector( p, origin );
+		p = CM_PutVector( p, angles );
+	}
+	CM_PutLong( cm_traceLogRecord, flags );
+
+	cm_traceLogLength = p - cm_traceLogRecord;
+}
+
+/*
+==================
+CM_LogTraceEnd
+==================
+*/
+void CM_LogTraceEnd( const trace_t *results ) {
+	byte	*p;
+
+	p = CM_PutTraceResult( cm_traceLogRecord + cm_traceLogLength, results );
+
+	FS_Write( cm_traceLogRecord, p - cm_traceLogRecord, cm_traceLog );
+	cm_traceLogHeader.numRecords++;
+}
+
+/*
+==================
+CM_LogPointContents
+==================
+*/
+void CM_LogPointContents( const vec3_t p, clipHandle_t model, int contents ) {
+	byte	record[TRACELOG_MAX_RECORD];
+	byte	*out;
+	int		flags;
+
+	flags = TRACELOG_POINT;
+
+	out = record + 4;
+	out = CM_PutVector( out, p );
+	out = CM_PutModel( out, &flags, model );
+	out = CM_PutLong( out, contents );
+	CM_PutLong( record, flags );
+
+	FS_Write( record, out - record, cm_traceLog );
+	cm_traceLogHeader.numRecords++;
+}
+
+/*
+==================
+CM_WriteTraceLogHeader
+==================
+*/
+static void CM_WriteTraceLogHeader( void ) {
+	byte	header[16 + MAX_QPATH];
+	byte	*p;
+
+	p = CM_PutLong( header, cm_traceLogHeader.ident );
+	p = CM_PutLong( p, cm_traceLogHeader.version );
+	p = CM_PutLong( p, cm_traceLogHeader.checksum );
+	p = CM_PutLong( p, cm_traceLogHeader.numRecords );
+	Com_Memcpy( p, cm_traceLogHeader.mapName, MAX_QPATH );
+
+	FS_Write( header, sizeof( header ), cm_traceLog );
+}
+
+/*
+==================
+CM_TraceLogName
+
+Bare names go in the traces directory.
+==================
+*/
+static void CM_TraceLogName( char *name, int size, const char *arg ) {
+	if ( strchr( arg, '/' ) ) {
+		Q_strncpyz( name, arg, size );
+	} else {
+		Com_sprintf( name, size, "traces/%s", arg );
+	}
+	COM_DefaultExtension( name, size, ".cmtrace" );
+}
+
+/*
+==================
+CM_TraceRecord_f
+
+tracerecord [name]
+==================
+*/
+void CM_TraceRecord_f( void ) {
+	char	name[MAX_QPATH];
+	char	mapName[MAX_QPATH];
+
+	if ( cm_traceLog ) {
+		Com_Printf( "Already recording collision queries.\n" );
+		return;
+	}
+	if ( !cm.numNodes ) {
+		Com_Printf( "No map loaded.\n" );
+		return;
+	}
+
+	if ( Cmd_Argc() > 1 ) {
+		CM_TraceLogName( name, sizeof( name ), Cmd_Argv( 1 ) );
+	} else {
+		COM_StripExtension( COM_SkipPath( cm.name ), mapName, sizeof( mapName ) );
+		CM_TraceLogName( name, sizeof( name ), mapName[0] ? mapName : "trace" );
+	}
+
+	cm_traceLog = FS_FOpenFileWrite( name );
+	if ( !cm_traceLog ) {
+		Com_Printf( "Couldn't open %s for writing.\n", name );
+		return;
+	}
+
+	Com_Memset( &cm_traceLogHeader, 0, sizeof( cm_traceLogHeader ) );
+	cm_traceLogHeader.ident = TRACELOG_IDENT;
+	cm_traceLogHeader.version = TRACELOG_VERSION;
+	cm_traceLogHeader.checksum = cm.checksum;
+	Q_strncpyz( cm_traceLogHeader.mapName, cm.name, sizeof( cm_traceLogHeader.mapName ) );
+	CM_WriteTraceLogHeader();
+
+	Com_Printf( "Recording collision queries to %s.\n", name );
+}
+
+/*
+==================
+CM_StopTraceRecord
+
+Also called when the map is changed or cleared.
+==================
+*/
+void CM_StopTraceRecord( void ) {
+	if ( !cm_traceLog ) {
+		return;
+	}
+
+	// the record count wasn't known when the header was written
+	FS_Seek( cm_traceLog, 0, FS_SEEK_SET );
+	CM_WriteTraceLogHeader();
+	FS_FCloseFile( cm_traceLog );
+	cm_traceLog = 0;
+
+	Com_Printf( "Stopped recording collision queries, %d recorded.\n", cm_traceLogHeader.numRecords );
+}
+
+/*
+==================
+CM_StopTraceRecord_f
+==================
+*/
+void CM_StopTraceRecord_f( void ) {
+	if ( !cm_traceLog ) {
+		Com_Printf( "Not recording collision queries.\n" );
+		return;
+	}
+	CM_StopTraceRecord();
+}
+
+/*
+===============================================================================
+
+REPLAY
+
+===============================================================================
+*/
+
+/*
+==================
+CM_DecodeTraceLog
+
+Returns the number of records decoded, which is less than requested if
+the log is truncated, or -1 if a record has an unknown type.  The buffer
+must be padded past end by a record.
+==================
+*/
+static int CM_DecodeTraceLog( const byte *p, const byte *end, traceLogRecord_t *records, int numRecords ) {
+	traceLogRecord_t	*r;
+	int			i, type;
+
+	for ( i = 0, r = records ; i < numRecords ; i++, r++ ) {
+		if ( p >= end ) {
+			break;
+		}
+
+		Com_Memset( r, 0, sizeof( *r ) );
+		p = CM_GetLong( p, &r->flags );
+		type = r->flags & TRACELOG_TYPE;
+		if ( type != TRACELOG_BOX && type != TRACELOG_TRANSFORMED && type != TRACELOG_POINT ) {
+			Com_Printf( "record %d has unknown trace type %d.\n", i, type );
+			return -1;
+		}
+
+		p = CM_GetVector( p, r->start );
+		if ( type == TRACELOG_POINT ) {
+			p = CM_GetLong( p, &r->model );
+			if ( r->flags & TRACELOG_TEMPBOX ) {
+				p = CM_GetVector( p, r->boxMins );
+				p = CM_GetVector( p, r->boxMaxs );
+			}
+			r->result = p;
+			p += 4;
+			continue;
+		}
+
+		p = CM_GetVector( p, r->end );
+		if ( !( r->flags & TRACELOG_NOSIZE ) ) {
+			p = CM_GetVector( p, r->mins );
+			p = CM_GetVector( p, r->maxs );
+		}
+		p = CM_GetLong( p, &r->model );
+		if ( r->flags & TRACELOG_TEMPBOX ) {
+			p = CM_GetVector( p, r->boxMins );
+			p = CM_GetVector( p, r->boxMaxs );
+		}
+		p = CM_GetLong( p, &r->brushmask );
+		p = CM_GetLong( p, &r->capsule );
+		if ( type == TRACELOG_TRANSFORMED ) {
+			p = CM_GetVector( p, r->origin );
+			p = CM_GetVector( p, r->angles );
+		}
+		r->result = p;
+		p += TRACELOG_RESULT_SIZE;
+	}
+
+	return i;
+}
+
+/*
+==================
+CM_ReplayRecord
+
+Makes the logged call again and encodes its result as it was logged.
+==================
+*/
+static void CM_ReplayRecord( const traceLogRecord_t *r, byte *result ) {
+	trace_t		trace;
+	float		*mins, *maxs;
+
+	if ( r->flags & TRACELOG_TEMPBOX ) {
+		CM_TempBoxModel( r->boxMins, r->boxMaxs, r->model == CAPSULE_MODEL_HANDLE );
+	}
+
+	if ( ( r->flags & TRACELOG_TYPE ) == TRACELOG_POINT ) {
+		CM_PutLong( result, CM_PointContents( r->start, r->model ) );
+		return;
+	}
+
+	if ( r->flags & TRACELOG_NOSIZE ) {
+		mins = maxs = NULL;
+	} else {
+		mins = (float *)r->mins;
+		maxs = (float *)r->maxs;
+	}
+
+	if ( ( r->flags & TRACELOG_TYPE ) == TRACELOG_TRANSFORMED ) {
+		CM_TransformedBoxTrace( &trace, r->start, r->end, mins, maxs, r->model, r->brushmask,
+			r->origin, r->angles, r->capsule );
+	} else {
+		CM_BoxTrace( &trace, r->start, r->end, mins, maxs, r->model, r->brushmask, r->capsule );
+	}
+	CM_PutTraceResult( result, &trace );
+}
+
+/*
+==================
+CM_CompareLatency
+==================
+*/
+static int CM_CompareLatency( const void *a, const void *b ) {
+	return *(const int *)a - *(const int *)b;
+}
+
+/*
+==================
+CM_ReplayTraceLog
+
+Loads the map the log was recorded on if no map is loaded, then replays
+the log once for throughput and once more with each call repeated for
+its latency, checking the results against the log.
+==================
+*/
+void CM_ReplayTraceLog( const char *arg ) {
+	char		name[MAX_QPATH];
+	fileHandle_t	f;
+	byte		*buf;
+	const byte	*p;
+	traceLogRecord_t	*records;
+	int			*latency;
+	byte		result[TRACELOG_RESULT_SIZE];
+	int			length, numRecords, checksum;
+	int			i, j, type, mismatches, counts[TRACELOG_TYPE + 1];
+	unsigned int	usec, sample;
+
+	if ( cm_traceLog ) {
+		Com_Printf( "Can't replay a trace log while recording one.\n" );
+		return;
+	}
+
+	CM_TraceLogName( name, sizeof( name ), arg );
+	length = FS_FOpenFileRead( name, &f, qtrue );
+	if ( !f ) {
+		Com_Printf( "Couldn't open %s.\n", name );
+		return;
+	}
+	if ( length < 16 + MAX_QPATH ) {
+		Com_Printf( "%s is not a trace log.\n", name );
+		FS_FCloseFile( f );
+		return;
+	}
+
+	// the raw log stays loaded since results are compared in their encoded
+	// form, and is padded so a damaged last record can't be read past
+	buf = Hunk_AllocateTempMemory( length + TRACELOG_MAX_RECORD );
+	FS_Read( buf, length, f );
+	FS_FCloseFile( f );
+	Com_Memset( buf + length, 0, TRACELOG_MAX_RECORD );
+
+	p = CM_GetLong( buf, &cm_traceLogHeader.ident );
+	p = CM_GetLong( p, &cm_traceLogHeader.version );
+	p = CM_GetLong( p, &cm_traceLogHeader.checksum );
+	p = CM_GetLong( p, &cm_traceLogHeader.numRecords );
+	Q_strncpyz( cm_traceLogHeader.mapName, (const char *)p, sizeof( cm_traceLogHeader.mapName ) );
+	p += MAX_QPATH;
+
+	if ( cm_traceLogHeader.ident != TRACELOG_IDENT || cm_traceLogHeader.version != TRACELOG_VERSION ) {
+		Com_Printf( "%s is not a version %d trace log.\n", name, TRACELOG_VERSION );
+		Hunk_FreeTempMemory( buf );
+		return;
+	}
+
+	if ( !cm.numNodes && cm_traceLogHeader.mapName[0] ) {
+		CM_LoadMap( cm_traceLogHeader.mapName, qfalse, &checksum );
+	}
+	if ( !cm.numNodes || cm.checksum != cm_traceLogHeader.checksum ) {
+		Com_Printf( "%s was recorded on a different map (%s).\n", name, cm_traceLogHeader.mapName );
+		Hunk_FreeTempMemory( buf );
+		return;
+	}
+
+	numRecords = cm_traceLogHeader.numRecords;
+	i = ( Hunk_MemoryRemaining() - 0x100000 ) / (int)( sizeof( *records ) + sizeof( *latency ) );
+	if ( numRecords > i ) {
+		Com_Printf( "Not enough hunk for the %d records of %s, replaying %d.\n", numRecords, name, i );
+		numRecords = i;
+	}
+	if ( numRecords < 1 ) {
+		Com_Printf( "No records to replay.\n" );
+		Hunk_FreeTempMemory( buf );
+		return;
+	}
+
+	records = Hunk_AllocateTempMemory( numRecords * sizeof( *records ) );
+	numRecords = CM_DecodeTraceLog( p, buf + length, records, numRecords );
+	if ( numRecords < 0 ) {
+		Com_Printf( "%s is corrupt.\n", name );
+		Hunk_FreeTempMemory( records );
+		Hunk_FreeTempMemory( buf );
+		return;
+	}
+	// the header counted records that weren't all there
+	if ( numRecords < 1 ) {
+		Com_Printf( "No records to replay.\n" );
+		Hunk_FreeTempMemory( records );
+		Hunk_FreeTempMemory( buf );
+		return;
+	}
+	latency = Hunk_AllocateTempMemory( numRecords * sizeof( *latency ) );
+
+	// throughput
+	usec = Sys_Microseconds();
+	for ( i = 0 ; i < numRecords ; i++ ) {
+		CM_ReplayRecord( &records[i], result );
+	}
+	usec = Sys_Microseconds() - usec;
+
+	// latency and results
+	mismatches = 0;
+	Com_Memset( counts, 0, sizeof( counts ) );
+	for ( i = 0 ; i < numRecords ; i++ ) {
+		type = records[i].flags & TRACELOG_TYPE;
+		counts[type]++;
+
+		sample = Sys_Microseconds();
+		for ( j = 0 ; j < TRACELOG_REPEATS ; j++ ) {
+			CM_ReplayRecord( &records[i], result );
+		}
+		latency[i] = ( Sys_Microseconds() - sample ) * 1000 / TRACELOG_REPEATS;
+
+		if ( memcmp( result, records[i].result, type == TRACELOG_POINT ? 4 : TRACELOG_RESULT_SIZE ) ) {
+			if ( mismatches < TRACELOG_MISMATCHES ) {
+				Com_Printf( "record %d: result differs from the log\n", i );
+			}
+			mismatches++;
+		}
+	}
+
+	qsort( latency, numRecords, sizeof( *latency ), CM_CompareLatency );
+
+	Com_Printf( "%d calls (%d box, %d transformed, %d point): %.0f calls/sec, %d mismatches\n",
+		numRecords, counts[TRACELOG_BOX], counts[TRACELOG_TRANSFORMED], counts[TRACELOG_POINT],
+		numRecords * 1000000.0 / ( usec ? usec : 1 ), mismatches );
+	Com_Printf( "latency usec: p50 %.3f, p90 %.3f, p99 %.3f, p99.9 %.3f, max %.3f\n",
+		latency[numRecords / 2] * 0.001f, latency[numRecords * 9 / 10] * 0.001f,
+		latency[numRecords * 99 / 100] * 0.001f, latency[(int)( numRecords * 0.999 )] * 0.001f,
+		latency[numRecords - 1] * 0.001f );
+
+	Hunk_FreeTempMemory( latency );
+	Hunk_FreeTempMemory( records );
+	Hunk_FreeTempMemory( buf );
+}
@@ -1618,6 +1618,9 @@ The client calls this before starting a vid_restart or snd_restart
 =================
 */
 void Hunk_ClearToMark( void ) {
+	// queued reads go into the hunk
+	FS_CancelReads();
+
 	hunk_low.permanent = hunk_low.temp = hunk_low.mark;
 	hunk_high.permanent = hunk_high.temp = hunk_high.mark;
 }
@@ -1647,6 +1650,9 @@ The server calls this before shutting down or loading a new map
 */
 void Hunk_Clear( void ) {
 
+	// queued reads go into the hunk
+	FS_CancelReads();
+
 #ifndef DEDICATED
 	CL_ShutdownCGame();
 	CL_ShutdownUI();
@@ -2716,6 +2722,11 @@ void Com_Init( char *commandLine ) {
 	}
 	Cmd_AddCommand ("quit", Com_Quit_f);
 	Cmd_AddCommand ("changeVectors", MSG_ReportChangeVectors_f );
+	Cmd_AddCommand ("huffbench", MSG_HuffBench_f );
+	Cmd_AddCommand ("tracestress", CM_TraceStress_f );
+	Cmd_AddCommand ("tracebench", CM_TraceBench_f );
+	Cmd_AddCommand ("tracerecord", CM_TraceRecord_f );
+	Cmd_AddCommand ("stoptracerecord", CM_StopTraceRecord_f );
 	Cmd_AddCommand ("writeconfig", Com_WriteConfig_f );
 	Cmd_SetCommandCompletionFunc( "writeconfig", Cmd_CompleteCfgName );
 	Cmd_AddCommand("game_restart", Com_GameRestart_f);
@@ -3153,6 +3164,9 @@ void Com_Frame( void ) {
 
 	Cbuf_Execute ();
 
+	// run the callbacks of reads that finished in the background
+	FS_CompleteReads();
+
 	if (com_altivec->modified)
 	{
 		Com_DetectAltivec();
@@ -3246,14 +3260,12 @@ void Com_Frame( void ) {
 	//
 	if ( com_showtrace->integer ) {
 	
-		extern	int c_traces, c_brush_traces, c_patch_traces;
 		extern	int	c_pointcontents;
+		int		c_traces, c_brush_traces, c_patch_traces;
 
+		CM_TakeTraceCounts( &c_traces, &c_brush_traces, &c_patch_traces );
 		Com_Printf ("%4i traces  (%ib %ip) %4i points\n", c_traces,
 			c_brush_traces, c_patch_traces, c_pointcontents);
-		c_traces = 0;
-		c_brush_traces = 0;
-		c_patch_traces = 0;
 		c_pointcontents = 0;
 	}
 
@@ -206,6 +206,8 @@ static const unsigned int missionpak_checksums[] =
 #define MAX_ZPATH			256
 #define	MAX_SEARCH_PATHS	4096
 #define MAX_FILEHASH_SIZE	1024
+#define	MAX_FOUND_FILES		0x1000
+#define PK3_SEEK_BUFFER_SIZE 65536
 
 typedef struct fileInPack_s {
 	char					*name;		// name of the file
@@ -227,6 +229,9 @@ typedef struct {
 	int				hashSize;					// hash table size (power of 2)
 	fileInPack_t*	*hashTable;					// hash table
 	fileInPack_t*	buildBuffer;				// buffer with the filenames etc.
+	unsigned long	zipStart;					// bytes in front of the zip data, for sfx
+	byte			*mapped;					// the whole pk3 mapped read only by the first open
+	long			mappedLength;				// -1 if it couldn't be mapped
 } pack_t;
 
 typedef struct {
@@ -240,6 +245,7 @@ typedef struct searchpath_s {
 
 	pack_t		*pack;		// only one of pack / dir will be non NULL
 	directory_t	*dir;
+	int			order;		// position in fs_searchpaths, for the file index
 } searchpath_t;
 
 static	char		fs_gamedir[MAX_OSPATH];	// this will be a single file name with no separators
@@ -254,6 +260,8 @@ static  cvar_t          *fs_apppath;
 static	cvar_t		*fs_basepath;
 static	cvar_t		*fs_basegame;
 static	cvar_t		*fs_gamedirvar;
+static	cvar_t		*fs_mapPaks;
+static	cvar_t		*fs_readThreads;
 static	searchpath_t	*fs_searchpaths;
 static	int			fs_readCount;			// total bytes read
 static	int			fs_loadCount;			// total files read
@@ -262,6 +270,8 @@ static	int			fs_packFiles = 0;		// total number of files in packs
 
 static int fs_checksumFeed;
 
+static qboolean	fs_indexDirty;			// a file was written, the file index rechecks the directories
+
 typedef union qfile_gus {
 	FILE*		o;
 	unzFile		z;
@@ -280,6 +290,13 @@ typedef struct {
 	int			zipFilePos;
 	qboolean	zipFile;
 	qboolean	streamed;
+	const byte	*mapped;		// data of a pk3 entry in its pak's mapping, read without unzip
+	int			mappedLength;	// bytes of data at mapped
+	int			mappedSize;		// uncompressed size
+	int			mappedPos;		// uncompressed read position
+	qboolean	mappedDeflated;
+	z_stream	*inflate;		// for a deflated entry, between reads
+	searchpath_t	*search;	// where the file was found
 	char		name[MAX_ZPATH];
 } fileHandleData_t;
 
@@ -386,7 +403,8 @@ static fileHandle_t	FS_HandleForFile(void) {
 	int		i;
 
 	for ( i = 1 ; i < MAX_FILE_HANDLES ; i++ ) {
-		if ( fsh[i].handleFiles.file.o == NULL ) {
+		// mapped pk3 entries have no FILE or zip handle
+		if ( fsh[i].handleFiles.file.o == NULL && !fsh[i].mapped ) {
 			return i;
 		}
 	}
@@ -661,6 +679,7 @@ fileHandle_t FS_SV_FOpenFileWrite( const char *filename ) {
 	ospath = FS_BuildOSPath( fs_homepath->string, filename, "" );
 	ospath[strlen(ospath)-1] = '\0';
 
+	fs_indexDirty = qtrue;
 	f = FS_HandleForFile();
 	fsh[f].zipFile = qfalse;
 
@@ -782,6 +801,7 @@ void FS_SV_Rename( const char *from, const char *to ) {
 
 	FS_CheckFilenameIsNotExecutable( to_ospath, __func__ );
 
+	fs_indexDirty = qtrue;
 	rename(from_ospath, to_ospath);
 }
 
@@ -812,9 +832,285 @@ void FS_Rename( const char *from, const char *to ) {
 
 	FS_CheckFilenameIsNotExecutable( to_ospath, __func__ );
 
+	fs_indexDirty = qtrue;
 	rename(from_ospath, to_ospath);
 }
 
+/*
+==========================================================================
+
+MAPPED PK3 ENTRIES
+
+With fs_mapPaks set, the first file opened from a pk3 maps the whole pk3
+read only.  Handles on its entries then read straight from the mapping
+instead of going through unzip: a stored entry is copied with one memcpy,
+and a deflated one is inflated from the mapping into the caller's buffer,
+so FS_ReadFile inflates a file with a single call.  FS_MapFile hands out
+pointers into the mapping for stored entries without mapping anything.
+
+Entries the mapping can't be used for, encrypted ones or other compression
+methods, and paks that can't be mapped fall back to unzip.
+
+==========================================================================
+*/
+
+static unsigned FS_ZipShort( const byte *p ) {
+	return p[0] | ( p[1] << 8 );
+}
+
+static unsigned long FS_ZipLong( const byte *p ) {
+	return p[0] | ( p[1] << 8 ) | ( p[2] << 16 ) | ( (unsigned long)p[3] << 24 );
+}
+
+/*
+=================
+FS_MapPak
+
+Maps the whole pk3 on first use, returns qfalse if it isn't mapped
+=================
+*/
+static qboolean FS_MapPak( pack_t *pak ) {
+	FILE	*f;
+	long	length;
+
+	if ( pak->mapped ) {
+		return qtrue;
+	}
+	if ( pak->mappedLength < 0 || !fs_mapPaks || !fs_mapPaks->integer ) {
+		return qfalse;
+	}
+
+	pak->mappedLength = -1;
+
+	f = fopen( pak->pakFilename, "rb" );
+	if ( !f ) {
+		return qfalse;
+	}
+	length = FS_fplength( f );
+	fclose( f );
+
+	pak->mapped = Sys_MapFile( pak->pakFilename, 0, length );
+	if ( !pak->mapped ) {
+		Com_DPrintf( "Couldn't map %s\n", pak->pakFilename );
+		return qfalse;
+	}
+	pak->mappedLength = length;
+
+	return qtrue;
+}
+
+static void FS_UnmapPak( pack_t *pak ) {
+	if ( pak->mapped ) {
+		Sys_UnmapFile( pak->mapped, pak->mappedLength );
+		pak->mapped = NULL;
+	}
+}
+
+/*
+=================
+FS_OpenMappedEntry
+
+Points a handle at the data of a pk3 entry in the pak's mapping by walking
+its central directory record and local header.  Returns qfalse if the
+entry has to be read with unzip.
+=================
+*/
+static qboolean FS_OpenMappedEntry( fileHandle_t f, pack_t *pak, fileInPack_t *pakFile ) {
+	const byte		*central, *local;
+	unsigned long	ofs, method, compressed;
+
+	if ( !FS_MapPak( pak ) ) {
+		return qfalse;
+	}
+
+	ofs = pak->zipStart + pakFile->pos;
+	if ( ofs + 46 > pak->mappedLength ) {
+		return qfalse;
+	}
+	central = pak->mapped + ofs;
+	if ( FS_ZipLong( central ) != 0x02014b50 || ( FS_ZipShort( central + 8 ) & 1 ) ) {
+		return qfalse;
+	}
+	method = FS_ZipShort( central + 10 );
+	compressed = FS_ZipLong( central + 20 );
+	if ( ( method != 0 && method != Z_DEFLATED ) || ( method == 0 && compressed != pakFile->len ) ) {
+		return qfalse;
+	}
+
+	ofs = pak->zipStart + FS_ZipLong( central + 42 );
+	if ( ofs + 30 > pak->mappedLength ) {
+		return qfalse;
+	}
+	local = pak->mapped + ofs;
+	if ( FS_ZipLong( local ) != 0x04034b50 ) {
+		return qfalse;
+	}
+	ofs += 30 + FS_ZipShort( local + 26 ) + FS_ZipShort( local + 28 );
+	if ( compressed > pak->mappedLength || ofs > pak->mappedLength - compressed ) {
+		return qfalse;
+	}
+
+	fsh[f].handleFiles.file.z = NULL;
+	fsh[f].mapped = pak->mapped + ofs;
+	fsh[f].mappedLength = compressed;
+	fsh[f].mappedSize = pakFile->len;
+	fsh[f].mappedPos = 0;
+	fsh[f].mappedDeflated = ( method == Z_DEFLATED );
+	fsh[f].inflate = NULL;
+
+	return qtrue;
+}
+
+static void FS_EndInflate( fileHandleData_t *fh ) {
+	if ( fh->inflate ) {
+		inflateEnd( fh->inflate );
+		Z_Free( fh->inflate );
+		fh->inflate = NULL;
+	}
+}
+
+/*
+=================
+FS_InflateEntry
+
+Inflates all of a deflated entry into buffer with one Z_FINISH call, which
+lets zlib write straight into it without its window.  Uses nothing but
+zlib, so the read threads can call it.  Returns the number of bytes that
+came out.
+=================
+*/
+static int FS_InflateEntry( const byte *data, int dataLength, void *buffer, int length ) {
+	z_stream	zs;
+
+	Com_Memset( &zs, 0, sizeof( zs ) );
+	zs.next_in = (Bytef *)data;
+	zs.avail_in = dataLength;
+	if ( inflateInit2( &zs, -MAX_WBITS ) != Z_OK ) {
+		return 0;
+	}
+
+	zs.next_out = buffer;
+	zs.avail_out = length;
+	inflate( &zs, Z_FINISH );
+	inflateEnd( &zs );
+
+	return length - zs.avail_out;
+}
+
+/*
+=================
+FS_ReadMapped
+
+A read of a whole deflated entry is inflated in one go, a read that takes
+the rest of one is done with Z_FINISH.
+=================
+*/
+static int FS_ReadMapped( void *buffer, int len, fileHandleData_t *fh ) {
+	z_stream	*zs;
+	int			err;
+
+	if ( len > fh->mappedSize - fh->mappedPos ) {
+		len = fh->mappedSize - fh->mappedPos;
+	}
+	if ( len <= 0 ) {
+		return 0;
+	}
+
+	if ( !fh->mappedDeflated ) {
+		Com_Memcpy( buffer, fh->mapped + fh->mappedPos, len );
+		fh->mappedPos += len;
+		return len;
+	}
+
+	if ( !fh->inflate && len == fh->mappedSize ) {
+		len = FS_InflateEntry( fh->mapped, fh->mappedLength, buffer, len );
+		if ( len < fh->mappedSize ) {
+			Com_Printf( S_COLOR_YELLOW "WARNING: %s is damaged\n", fh->name );
+		}
+		fh->mappedPos = fh->mappedSize = len;
+		return len;
+	}
+
+	if ( !fh->inflate ) {
+		zs = Z_Malloc( sizeof( *zs ) );
+		zs->next_in = (Bytef *)fh->mapped;
+		zs->avail_in = fh->mappedLength;
+		if ( inflateInit2( zs, -MAX_WBITS ) != Z_OK ) {
+			Z_Free( zs );
+			return 0;
+		}
+		fh->inflate = zs;
+	}
+
+	zs = fh->inflate;
+	zs->next_out = buffer;
+	zs->avail_out = len;
+	err = inflate( zs, fh->mappedPos + len == fh->mappedSize ? Z_FINISH : Z_SYNC_FLUSH );
+	len -= zs->avail_out;
+	fh->mappedPos += len;
+
+	if ( err == Z_STREAM_END || ( err != Z_OK && err != Z_BUF_ERROR ) ) {
+		if ( err != Z_STREAM_END ) {
+			Com_Printf( S_COLOR_YELLOW "WARNING: %s is damaged\n", fh->name );
+		}
+		// nothing more can come out of it
+		FS_EndInflate( fh );
+		fh->mappedSize = fh->mappedPos;
+	}
+
+	return len;
+}
+
+/*
+=================
+FS_SeekMapped
+=================
+*/
+static int FS_SeekMapped( fileHandleData_t *fh, long offset, int origin ) {
+	byte	buffer[PK3_SEEK_BUFFER_SIZE];
+	int		block;
+
+	switch( origin ) {
+	case FS_SEEK_CUR:
+		offset += fh->mappedPos;
+		break;
+	case FS_SEEK_END:
+		offset += fh->mappedSize;
+		break;
+	case FS_SEEK_SET:
+		break;
+	default:
+		Com_Error( ERR_FATAL, "Bad origin in FS_Seek" );
+		return -1;
+	}
+
+	if ( offset < 0 || offset > fh->mappedSize ) {
+		return -1;
+	}
+
+	if ( !fh->mappedDeflated ) {
+		fh->mappedPos = offset;
+		return 0;
+	}
+
+	// deflated data can only be skipped forward, start over to go back
+	if ( offset < fh->mappedPos ) {
+		FS_EndInflate( fh );
+		fh->mappedPos = 0;
+	}
+	while ( fh->mappedPos < offset ) {
+		block = offset - fh->mappedPos;
+		if ( block > sizeof( buffer ) ) {
+			block = sizeof( buffer );
+		}
+		if ( !FS_ReadMapped( buffer, block, fh ) ) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
 /*
 ==============
 FS_FCloseFile
@@ -830,6 +1126,12 @@ void FS_FCloseFile( fileHandle_t f ) {
 		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
 	}
 
+	if (fsh[f].mapped) {
+		FS_EndInflate( &fsh[f] );
+		Com_Memset( &fsh[f], 0, sizeof( fsh[f] ) );
+		return;
+	}
+
 	if (fsh[f].zipFile == qtrue) {
 		unzCloseCurrentFile( fsh[f].handleFiles.file.z );
 		if ( fsh[f].handleFiles.unique ) {
@@ -860,6 +1162,7 @@ fileHandle_t FS_FOpenFileWrite( const char *filename ) {
 		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
 	}
 
+	fs_indexDirty = qtrue;
 	f = FS_HandleForFile();
 	fsh[f].zipFile = qfalse;
 
@@ -903,6 +1206,7 @@ fileHandle_t FS_FOpenFileAppend( const char *filename ) {
 		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
 	}
 
+	fs_indexDirty = qtrue;
 	f = FS_HandleForFile();
 	fsh[f].zipFile = qfalse;
 
@@ -948,6 +1252,7 @@ fileHandle_t FS_FCreateOpenPipeFile( const char *filename ) {
 		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
 	}
 
+	fs_indexDirty = qtrue;
 	f = FS_HandleForFile();
 	fsh[f].zipFile = qfalse;
 
@@ -1241,26 +1546,31 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 					if(strstr(filename, "ui.qvm"))
 						pak->referenced |= FS_UI_REF;
 
-					if(uniqueFILE)
-					{
-						// open a new file on the pakfile
-						fsh[*file].handleFiles.file.z = unzOpen(pak->pakFilename);
-					
-						if(fsh[*file].handleFiles.file.z == NULL)
-							Com_Error(ERR_FATAL, "Couldn't open %s", pak->pakFilename);
-					}
-					else
-						fsh[*file].handleFiles.file.z = pak->handle;
-
 					Q_strncpyz(fsh[*file].name, filename, sizeof(fsh[*file].name));
 					fsh[*file].zipFile = qtrue;
-				
-					// set the file position in the zip file (also sets the current file info)
-					unzSetOffset(fsh[*file].handleFiles.file.z, pakFile->pos);
-
-					// open the file in the zip
-					unzOpenCurrentFile(fsh[*file].handleFiles.file.z);
 					fsh[*file].zipFilePos = pakFile->pos;
+					fsh[*file].search = search;
+
+					// mapped entries don't need a zip handle, unique or not
+					if(!FS_OpenMappedEntry(*file, pak, pakFile))
+					{
+						if(uniqueFILE)
+						{
+							// open a new file on the pakfile
+							fsh[*file].handleFiles.file.z = unzOpen(pak->pakFilename);
+
+							if(fsh[*file].handleFiles.file.z == NULL)
+								Com_Error(ERR_FATAL, "Couldn't open %s", pak->pakFilename);
+						}
+						else
+							fsh[*file].handleFiles.file.z = pak->handle;
+
+						// set the file position in the zip file (also sets the current file info)
+						unzSetOffset(fsh[*file].handleFiles.file.z, pakFile->pos);
+
+						// open the file in the zip
+						unzOpenCurrentFile(fsh[*file].handleFiles.file.z);
+					}
 
 					if(fs_debug->integer)
 					{
@@ -1313,6 +1623,7 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 
 		Q_strncpyz(fsh[*file].name, filename, sizeof(fsh[*file].name));
 		fsh[*file].zipFile = qfalse;
+		fsh[*file].search = search;
 		
 		if(fs_debug->integer)
 		{
@@ -1328,95 +1639,445 @@ long FS_FOpenFileReadDir(const char *filename, searchpath_t *search, fileHandle_
 }
 
 /*
-===========
-FS_FOpenFileRead
+=================================================================================
 
-Finds the file in the search path.
-Returns filesize and an open FILE pointer.
-Used for streaming data out of either a
-separate file or a ZIP file.
-===========
+FILE INDEX
+
+One hash over the contents of all search paths, so finding a file only visits
+the search paths that have it instead of probing every pk3 and opening the file
+in every directory, and a missing file costs a single hash lookup.  Entries are
+kept in search path order and are still opened with FS_FOpenFileReadDir, so the
+pure and referencing rules don't change.  Directories are listed when the index
+is built and listed again when their modification time changes.
+
+=================================================================================
 */
-long FS_FOpenFileRead(const char *filename, fileHandle_t *file, qboolean uniqueFILE)
-{
-	searchpath_t *search;
-	long len;
 
-	if(!fs_searchpaths)
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+#define FS_INDEX_MAX_DIRS		1024	// larger directory trees use the plain search
+#define FS_INDEX_CHECK_MSEC		1000	// how often the directory times are compared
+
+typedef struct fsIndexEntry_s {
+	const char				*name;
+	searchpath_t			*search;
+	struct fsIndexEntry_s	*next;		// next in the hash chain, in search path order
+} fsIndexEntry_t;
+
+typedef struct fsIndexDir_s {
+	searchpath_t			*search;
+	char					*subdir;	// "" for the game directory itself
+	int						time;		// modification time when it was listed
+	int						listTime;	// real time when it was listed
+	struct fsIndexDir_s		*next;
+} fsIndexDir_t;
+
+static fsIndexEntry_t	**fs_index;			// NULL if there is no index
+static int				fs_indexSize;
+static fsIndexEntry_t	*fs_indexPackEntries;
+static int				fs_numIndexPackEntries;
+static fsIndexDir_t		*fs_indexDirs;
+static int				fs_numIndexDirs;
+static int				fs_indexCheckTime;
+static qboolean			fs_indexComplete;
 
-	for(search = fs_searchpaths; search; search = search->next)
-	{
-	        len = FS_FOpenFileReadDir(filename, search, file, uniqueFILE, qfalse);
-	        
-	        if(file == NULL)
-	        {
-	                if(len > 0)
-	                        return len;
-	        }
-	        else
-	        {
-	                if(len >= 0 && *file)
-	                        return len;
-	        }
-	        
+/*
+================
+FS_IndexHash
+
+FNV-1a over the whole name, equal for names that FS_FilenameCompare matches.
+FS_HashFileName skips the extension and spreads too little for a table
+holding every file.
+================
+*/
+static int FS_IndexHash( const char *qpath ) {
+	unsigned int	hash;
+	int				c;
+
+	hash = 2166136261u;
+	while ( ( c = *qpath++ ) != 0 ) {
+		if ( c >= 'a' && c <= 'z' ) {
+			c -= ( 'a' - 'A' );
+		} else if ( c == '\\' || c == ':' ) {
+			c = '/';
+		}
+		hash = ( hash ^ c ) * 16777619u;
 	}
-	
-#ifdef FS_MISSING
-	if(missingFiles)
-		fprintf(missingFiles, "%s\n", filename);
-#endif
 
-        if(file)
-        	*file = 0;
-        	
-	return -1;
+	return ( hash ^ ( hash >> 16 ) ) & ( fs_indexSize - 1 );
 }
 
 /*
-=================
-FS_FindVM
+================
+FS_IndexInsert
+================
+*/
+static void FS_IndexInsert( fsIndexEntry_t *entry ) {
+	fsIndexEntry_t	**link;
 
-Find a suitable VM file in search path order.
+	link = &fs_index[FS_IndexHash( entry->name )];
+	while ( *link && ( *link )->search->order <= entry->search->order ) {
+		link = &( *link )->next;
+	}
+	entry->next = *link;
+	*link = entry;
+}
 
-In each searchpath try:
- - open DLL file if DLL loading enabled
- - open QVM file
+/*
+================
+FS_IndexFind
 
-Enable search for DLL by setting enableDll to FSVM_ENABLEDLL
+Returns the first entry for qpath, continue with FS_IndexNext
+================
+*/
+static fsIndexEntry_t *FS_IndexNext( fsIndexEntry_t *entry, const char *qpath ) {
+	for ( ; entry ; entry = entry->next ) {
+		if ( !FS_FilenameCompare( entry->name, qpath ) ) {
+			return entry;
+		}
+	}
+	return NULL;
+}
 
-write found DLL or QVM to "found" and return VMI_NATIVE if DLL, VMI_COMPILED if QVM
-Return the searchpath in "startSearch".
-=================
+static fsIndexEntry_t *FS_IndexFind( const char *qpath ) {
+	return FS_IndexNext( fs_index[FS_IndexHash( qpath )], qpath );
+}
+
+/*
+================
+FS_IndexOSPath
+================
 */
+static char *FS_IndexOSPath( searchpath_t *search, const char *subdir ) {
+	if ( !subdir[0] ) {
+		return search->dir->fullpath;	// no trailing slash
+	}
+	return FS_BuildOSPath( search->dir->path, search->dir->gamedir, subdir );
+}
 
-vmInterpret_t FS_FindVM(void **startSearch, char *found, int foundlen, const char *name, int enableDll)
-{
-	searchpath_t *search, *lastSearch;
-	directory_t *dir;
-	pack_t *pack;
-	char dllName[MAX_OSPATH], qvmName[MAX_OSPATH];
-	char *netpath;
+/*
+================
+FS_IndexDirectory
 
-	if(!fs_searchpaths)
-		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+Adds the files below a directory search path that aren't in the index yet
+================
+*/
+static void FS_IndexDirectory( searchpath_t *search, const char *subdir ) {
+	char			ospath[MAX_OSPATH], qpath[MAX_ZPATH];
+	char			**list;
+	int				i, numfiles;
+	fsIndexDir_t	*dir;
+	fsIndexEntry_t	*entry;
+
+	for ( dir = fs_indexDirs ; dir ; dir = dir->next ) {
+		if ( dir->search == search && !strcmp( dir->subdir, subdir ) ) {
+			break;
+		}
+	}
+	if ( !dir ) {
+		if ( fs_numIndexDirs == FS_INDEX_MAX_DIRS ) {
+			fs_indexComplete = qfalse;
+			return;
+		}
+		dir = Z_Malloc( sizeof( *dir ) + strlen( subdir ) + 1 );
+		dir->search = search;
+		dir->subdir = (char *)( dir + 1 );
+		strcpy( dir->subdir, subdir );
+		dir->next = fs_indexDirs;
+		fs_indexDirs = dir;
+		fs_numIndexDirs++;
+	}
 
-	if(enableDll)
-		Com_sprintf(dllName, sizeof(dllName), "%s" ARCH_STRING DLL_EXT, name);
-		
-	Com_sprintf(qvmName, sizeof(qvmName), "vm/%s.qvm", name);
+	// take the time first, so changes made during the listing are seen next time
+	Q_strncpyz( ospath, FS_IndexOSPath( search, subdir ), sizeof( ospath ) );
+	dir->time = Sys_FileTime( ospath );
+	dir->listTime = Com_RealTime( NULL );
 
-	lastSearch = *startSearch;
-	if(*startSearch == NULL)
-		search = fs_searchpaths;
-	else
-		search = lastSearch->next;
-        
-	while(search)
-	{
-		if(search->dir && !fs_numServerPaks)
-		{
-			dir = search->dir;
+	list = Sys_ListFiles( ospath, "", NULL, &numfiles, qfalse );
+	if ( numfiles >= MAX_FOUND_FILES - 1 ) {
+		fs_indexComplete = qfalse;
+	}
+	for ( i = 0 ; i < numfiles ; i++ ) {
+		Com_sprintf( qpath, sizeof( qpath ), "%s%s%s", subdir, subdir[0] ? "/" : "", list[i] );
+
+		for ( entry = FS_IndexFind( qpath ) ; entry ; entry = FS_IndexNext( entry->next, qpath ) ) {
+			if ( entry->search == search ) {
+				break;
+			}
+		}
+		if ( entry ) {
+			continue;
+		}
+
+		entry = Z_Malloc( sizeof( *entry ) + strlen( qpath ) + 1 );
+		entry->name = strcpy( (char *)( entry + 1 ), qpath );
+		entry->search = search;
+		FS_IndexInsert( entry );
+	}
+	Sys_FreeFileList( list );
+
+	// directories that are already known are checked on their own
+	list = Sys_ListFiles( ospath, "/", NULL, &numfiles, qfalse );
+	for ( i = 0 ; i < numfiles ; i++ ) {
+		if ( !strcmp( list[i], "." ) || !strcmp( list[i], ".." ) ) {
+			continue;
+		}
+		Com_sprintf( qpath, sizeof( qpath ), "%s%s%s", subdir, subdir[0] ? "/" : "", list[i] );
+
+		for ( dir = fs_indexDirs ; dir ; dir = dir->next ) {
+			if ( dir->search == search && !strcmp( dir->subdir, qpath ) ) {
+				break;
+			}
+		}
+		if ( !dir ) {
+			FS_IndexDirectory( search, qpath );
+		}
+	}
+	Sys_FreeFileList( list );
+}
+
+/*
+================
+FS_FreeIndex
+================
+*/
+static void FS_FreeIndex( void ) {
+	fsIndexEntry_t	*entry, *next;
+	fsIndexDir_t	*dir;
+	int				i;
+
+	if ( fs_index ) {
+		for ( i = 0 ; i < fs_indexSize ; i++ ) {
+			for ( entry = fs_index[i] ; entry ; entry = next ) {
+				next = entry->next;
+				if ( entry->search->dir ) {
+					Z_Free( entry );
+				}
+			}
+		}
+		Z_Free( fs_index );
+		fs_index = NULL;
+	}
+
+	if ( fs_indexPackEntries ) {
+		Z_Free( fs_indexPackEntries );
+		fs_indexPackEntries = NULL;
+	}
+
+	while ( fs_indexDirs ) {
+		dir = fs_indexDirs;
+		fs_indexDirs = dir->next;
+		Z_Free( dir );
+	}
+	fs_numIndexDirs = 0;
+}
+
+/*
+================
+FS_BuildIndex
+
+Called whenever the search paths change
+================
+*/
+static void FS_BuildIndex( void ) {
+	searchpath_t	*search;
+	fsIndexEntry_t	*entry;
+	int				i, order, count;
+
+	FS_FreeIndex();
+
+	count = 0;
+	order = 0;
+	for ( search = fs_searchpaths ; search ; search = search->next ) {
+		search->order = order++;
+		if ( search->pack ) {
+			count += search->pack->numfiles;
+		}
+	}
+
+	for ( fs_indexSize = MAX_FILEHASH_SIZE ; fs_indexSize < count ; fs_indexSize <<= 1 ) {
+	}
+	fs_index = Z_Malloc( fs_indexSize * sizeof( *fs_index ) );
+	if ( count ) {
+		fs_indexPackEntries = Z_Malloc( count * sizeof( *fs_indexPackEntries ) );
+	}
+	fs_numIndexPackEntries = count;
+	fs_indexComplete = qtrue;
+
+	entry = fs_indexPackEntries;
+	for ( search = fs_searchpaths ; search ; search = search->next ) {
+		if ( search->pack ) {
+			for ( i = 0 ; i < search->pack->numfiles ; i++, entry++ ) {
+				entry->name = search->pack->buildBuffer[i].name;
+				entry->search = search;
+				FS_IndexInsert( entry );
+			}
+		} else {
+			FS_IndexDirectory( search, "" );
+		}
+	}
+
+	if ( !fs_indexComplete ) {
+		Com_Printf( "Too many loose files to index, searching all paths\n" );
+		FS_FreeIndex();
+	}
+
+	fs_indexCheckTime = Sys_Milliseconds();
+	fs_indexDirty = qfalse;
+}
+
+/*
+================
+FS_CheckIndex
+
+Lists the directories again that changed since they were last listed
+================
+*/
+static void FS_CheckIndex( void ) {
+	fsIndexDir_t	*dir;
+	int				time, msec;
+
+	msec = Sys_Milliseconds();
+	if ( !fs_indexDirty && msec - fs_indexCheckTime < FS_INDEX_CHECK_MSEC ) {
+		return;
+	}
+	fs_indexCheckTime = msec;
+	fs_indexDirty = qfalse;
+
+	// new directories go to the front and are already listed
+	for ( dir = fs_indexDirs ; dir ; dir = dir->next ) {
+		time = Sys_FileTime( FS_IndexOSPath( dir->search, dir->subdir ) );
+		// a change within the second it was listed may not show in the time
+		if ( time != dir->time || time >= dir->listTime ) {
+			FS_IndexDirectory( dir->search, dir->subdir );
+		}
+	}
+
+	if ( !fs_indexComplete ) {
+		Com_Printf( "Too many loose files to index, searching all paths\n" );
+		FS_FreeIndex();
+	}
+}
+
+/*
+===========
+FS_FOpenFileRead
+
+Finds the file in the search path.
+Returns filesize and an open FILE pointer.
+Used for streaming data out of either a
+separate file or a ZIP file.
+===========
+*/
+long FS_FOpenFileRead(const char *filename, fileHandle_t *file, qboolean uniqueFILE)
+{
+	searchpath_t *search;
+	fsIndexEntry_t *entry;
+	const char *name;
+	long len;
+
+	if(!fs_searchpaths)
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+
+	if(fs_index)
+		FS_CheckIndex();
+
+	if(fs_index && filename)
+	{
+		// only visit the search paths that have the file
+		name = filename;
+		if(name[0] == '/' || name[0] == '\\')
+			name++;
+
+		for(entry = FS_IndexFind(name); entry; entry = FS_IndexNext(entry->next, name))
+		{
+			len = FS_FOpenFileReadDir(filename, entry->search, file, uniqueFILE, qfalse);
+
+			if(file == NULL)
+			{
+				if(len > 0)
+					return len;
+			}
+			else
+			{
+				if(len >= 0 && *file)
+					return len;
+			}
+		}
+	}
+	else
+	{
+		for(search = fs_searchpaths; search; search = search->next)
+		{
+		        len = FS_FOpenFileReadDir(filename, search, file, uniqueFILE, qfalse);
+		        
+		        if(file == NULL)
+		        {
+		                if(len > 0)
+		                        return len;
+		        }
+		        else
+		        {
+		                if(len >= 0 && *file)
+		                        return len;
+		        }
+		        
+		}
+	}
+	
+#ifdef FS_MISSING
+	if(missingFiles)
+		fprintf(missingFiles, "%s\n", filename);
+#endif
+
+        if(file)
+        	*file = 0;
+        	
+	return -1;
+}
+
+/*
+=================
+FS_FindVM
+
+Find a suitable VM file in search path order.
+
+In each searchpath try:
+ - open DLL file if DLL loading enabled
+ - open QVM file
+
+Enable search for DLL by setting enableDll to FSVM_ENABLEDLL
+
+write found DLL or QVM to "found" and return VMI_NATIVE if DLL, VMI_COMPILED if QVM
+Return the searchpath in "startSearch".
+=================
+*/
+
+vmInterpret_t FS_FindVM(void **startSearch, char *found, int foundlen, const char *name, int enableDll)
+{
+	searchpath_t *search, *lastSearch;
+	directory_t *dir;
+	pack_t *pack;
+	char dllName[MAX_OSPATH], qvmName[MAX_OSPATH];
+	char *netpath;
+
+	if(!fs_searchpaths)
+		Com_Error(ERR_FATAL, "Filesystem call made without initialization");
+
+	if(enableDll)
+		Com_sprintf(dllName, sizeof(dllName), "%s" ARCH_STRING DLL_EXT, name);
+		
+	Com_sprintf(qvmName, sizeof(qvmName), "vm/%s.qvm", name);
+
+	lastSearch = *startSearch;
+	if(*startSearch == NULL)
+		search = fs_searchpaths;
+	else
+		search = lastSearch->next;
+        
+	while(search)
+	{
+		if(search->dir && !fs_numServerPaks)
+		{
+			dir = search->dir;
 
 			if(enableDll)
 			{
@@ -1534,6 +2195,8 @@ int FS_Read( void *buffer, int len, fileHandle_t f ) {
 			buf += read;
 		}
 		return len;
+	} else if (fsh[f].mapped) {
+		return FS_ReadMapped(buffer, len, &fsh[f]);
 	} else {
 		return unzReadCurrentFile(fsh[f].handleFiles.file.z, buffer, len);
 	}
@@ -1603,8 +2266,6 @@ void QDECL FS_Printf( fileHandle_t h, const char *fmt, ... ) {
 	FS_Write(msg, strlen(msg), h);
 }
 
-#define PK3_SEEK_BUFFER_SIZE 65536
-
 /*
 =================
 FS_Seek
@@ -1625,6 +2286,10 @@ int FS_Seek( fileHandle_t f, long offset, int origin ) {
 		fsh[f].streamed = qtrue;
 	}
 
+	if (fsh[f].mapped) {
+		return FS_SeekMapped( &fsh[f], offset, origin );
+	}
+
 	if (fsh[f].zipFile == qtrue) {
 		//FIXME: this is incomplete and really, really
 		//crappy (but better than what was here before)
@@ -1681,238 +2346,870 @@ int FS_Seek( fileHandle_t f, long offset, int origin ) {
 }
 
 
-/*
-======================================================================================
+/*
+======================================================================================
+
+CONVENIENCE FUNCTIONS FOR ENTIRE FILES
+
+======================================================================================
+*/
+
+int	FS_FileIsInPAK(const char *filename, int *pChecksum ) {
+	searchpath_t	*search;
+	pack_t			*pak;
+	fileInPack_t	*pakFile;
+	long			hash = 0;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	if ( !filename ) {
+		Com_Error( ERR_FATAL, "FS_FOpenFileRead: NULL 'filename' parameter passed" );
+	}
+
+	// qpaths are not supposed to have a leading slash
+	if ( filename[0] == '/' || filename[0] == '\\' ) {
+		filename++;
+	}
+
+	// make absolutely sure that it can't back up the path.
+	// The searchpaths do guarantee that something will always
+	// be prepended, so we don't need to worry about "c:" or "//limbo" 
+	if ( strstr( filename, ".." ) || strstr( filename, "::" ) ) {
+		return -1;
+	}
+
+	//
+	// search through the path, one element at a time
+	//
+
+	for ( search = fs_searchpaths ; search ; search = search->next ) {
+		//
+		if (search->pack) {
+			hash = FS_HashFileName(filename, search->pack->hashSize);
+		}
+		// is the element a pak file?
+		if ( search->pack && search->pack->hashTable[hash] ) {
+			// disregard if it doesn't match one of the allowed pure pak files
+			if ( !FS_PakIsPure(search->pack) ) {
+				continue;
+			}
+
+			// look through all the pak file elements
+			pak = search->pack;
+			pakFile = pak->hashTable[hash];
+			do {
+				// case and separator insensitive comparisons
+				if ( !FS_FilenameCompare( pakFile->name, filename ) ) {
+					if (pChecksum) {
+						*pChecksum = pak->pure_checksum;
+					}
+					return 1;
+				}
+				pakFile = pakFile->next;
+			} while(pakFile != NULL);
+		}
+	}
+	return -1;
+}
+
+/*
+============
+FS_ReadFileDir
+
+Filename are relative to the quake search path
+a null buffer will just return the file length without loading
+If searchPath is non-NULL search only in that specific search path
+============
+*/
+long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer)
+{
+	fileHandle_t	h;
+	searchpath_t	*search;
+	byte*			buf;
+	qboolean		isConfig;
+	long				len;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	if ( !qpath || !qpath[0] ) {
+		Com_Error( ERR_FATAL, "FS_ReadFile with empty name" );
+	}
+
+	buf = NULL;	// quiet compiler warning
+
+	// if this is a .cfg file and we are playing back a journal, read
+	// it from the journal file
+	if ( strstr( qpath, ".cfg" ) ) {
+		isConfig = qtrue;
+		if ( com_journal && com_journal->integer == 2 ) {
+			int		r;
+
+			Com_DPrintf( "Loading %s from journal file.\n", qpath );
+			r = FS_Read( &len, sizeof( len ), com_journalDataFile );
+			if ( r != sizeof( len ) ) {
+				if (buffer != NULL) *buffer = NULL;
+				return -1;
+			}
+			// if the file didn't exist when the journal was created
+			if (!len) {
+				if (buffer == NULL) {
+					return 1;			// hack for old journal files
+				}
+				*buffer = NULL;
+				return -1;
+			}
+			if (buffer == NULL) {
+				return len;
+			}
+
+			buf = Hunk_AllocateTempMemory(len+1);
+			*buffer = buf;
+
+			r = FS_Read( buf, len, com_journalDataFile );
+			if ( r != len ) {
+				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
+			}
+
+			fs_loadCount++;
+			fs_loadStack++;
+
+			// guarantee that it will have a trailing 0 for string operations
+			buf[len] = 0;
+
+			return len;
+		}
+	} else {
+		isConfig = qfalse;
+	}
+
+	search = searchPath;
+
+	if(search == NULL)
+	{
+		// look for it in the filesystem or pack files
+		len = FS_FOpenFileRead(qpath, &h, qfalse);
+        }
+	else
+	{
+		// look for it in a specific search path only
+		len = FS_FOpenFileReadDir(qpath, search, &h, qfalse, unpure);
+	}
+
+	if ( h == 0 ) {
+		if ( buffer ) {
+			*buffer = NULL;
+		}
+		// if we are journalling and it is a config file, write a zero to the journal file
+		if ( isConfig && com_journal && com_journal->integer == 1 ) {
+			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
+			len = 0;
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		return -1;
+	}
+	
+	if ( !buffer ) {
+		if ( isConfig && com_journal && com_journal->integer == 1 ) {
+			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		FS_FCloseFile( h);
+		return len;
+	}
+
+	fs_loadCount++;
+	fs_loadStack++;
+
+	buf = Hunk_AllocateTempMemory(len+1);
+	*buffer = buf;
+
+	FS_Read (buf, len, h);
+
+	// guarantee that it will have a trailing 0 for string operations
+	buf[len] = 0;
+	FS_FCloseFile( h );
+
+	// if we are journalling and it is a config file, write it to the journal file
+	if ( isConfig && com_journal && com_journal->integer == 1 ) {
+		Com_DPrintf( "Writing %s to journal file.\n", qpath );
+		FS_Write( &len, sizeof( len ), com_journalDataFile );
+		FS_Write( buf, len, com_journalDataFile );
+		FS_Flush( com_journalDataFile );
+	}
+	return len;
+}
+
+/*
+============
+FS_ReadFile
+
+Filename are relative to the quake search path
+a null buffer will just return the file length without loading
+============
+*/
+long FS_ReadFile(const char *qpath, void **buffer)
+{
+	return FS_ReadFileDir(qpath, NULL, qfalse, buffer);
+}
+
+/*
+=============
+FS_FreeFile
+=============
+*/
+void FS_FreeFile( void *buffer ) {
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+	if ( !buffer ) {
+		Com_Error( ERR_FATAL, "FS_FreeFile( NULL )" );
+	}
+	fs_loadStack--;
+
+	Hunk_FreeTempMemory( buffer );
+
+	// if all of our temp files are free, clear all of our space
+	if ( fs_loadStack == 0 ) {
+		Hunk_ClearTempMemory();
+	}
+}
+
+/*
+============
+FS_MapFile
+
+Maps a file read only straight from disk instead of copying it to the
+hunk.  Works for loose files and for pk3 entries that were stored
+without compression.  The mapping belongs to the caller and outlives
+filesystem restarts until FS_UnmapFile.  Returns -1 with a NULL buffer
+if the file can't be mapped, in which case the caller should use
+FS_ReadFile.  The mapping has no trailing 0.
+============
+*/
+long FS_MapFile( const char *qpath, void **buffer )
+{
+	searchpath_t	*search;
+	fileHandle_t	h;
+	unz_file_info	info;
+	char			*ospath;
+	long			offset, len;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	}
+
+	*buffer = NULL;
+
+	// journal playback has to see every read
+	if ( com_journal && com_journal->integer ) {
+		return -1;
+	}
+
+	for ( search = fs_searchpaths ; search ; search = search->next ) {
+		len = FS_FOpenFileReadDir( qpath, search, &h, qfalse, qfalse );
+		if ( len >= 0 && h ) {
+			break;
+		}
+	}
+	if ( !search ) {
+		return -1;
+	}
+
+	if ( fsh[h].mapped ) {
+		// the caller gets its own mapping, the pak's one goes away
+		// with the pak when the filesystem restarts
+		offset = fsh[h].mapped - search->pack->mapped;
+		ospath = search->pack->pakFilename;
+		if ( fsh[h].mappedDeflated ) {
+			FS_FCloseFile( h );
+			return -1;
+		}
+	} else if ( search->pack ) {
+		unzGetCurrentFileInfo( fsh[h].handleFiles.file.z, &info, NULL, 0, NULL, 0, NULL, 0 );
+		offset = unzGetCurrentFileZStreamPos( fsh[h].handleFiles.file.z );
+		ospath = search->pack->pakFilename;
+		if ( info.compression_method != 0 || !offset ) {
+			FS_FCloseFile( h );
+			return -1;
+		}
+	} else {
+		offset = 0;
+		ospath = FS_BuildOSPath( search->dir->path, search->dir->gamedir, qpath );
+	}
+	FS_FCloseFile( h );
+
+	*buffer = Sys_MapFile( ospath, offset, len );
+	if ( !*buffer ) {
+		return -1;
+	}
+
+	if ( fs_debug->integer ) {
+		Com_Printf( "FS_MapFile: %s (%ld bytes at %ld in '%s')\n", qpath, len, offset, ospath );
+	}
+
+	return len;
+}
+
+/*
+=============
+FS_UnmapFile
+=============
+*/
+void FS_UnmapFile( void *buffer, long length ) {
+	if ( !buffer ) {
+		Com_Error( ERR_FATAL, "FS_UnmapFile( NULL )" );
+	}
+
+	Sys_UnmapFile( buffer, length );
+}
+
+/*
+==========================================================================
+
+ASYNCHRONOUS READS
+
+FS_ReadFileAsync and FS_PrefetchFile let a loader queue all of its files
+up front and keep parsing while fs_readThreads threads read and inflate
+them.  The search paths, the hunk and the handle table are only touched
+on the main thread: queueing a request finds the file, allocates its
+buffer and notes where its data is, either a range of a mapped pk3 or a
+range of a file on disk.  A read thread opens the file itself, so waiting
+requests hold no handles.  Callbacks run on the main thread, every frame
+from FS_CompleteReads or from FS_WaitForRead.  Waiting for a read that no
+thread has started yet does it on the spot, so with fs_readThreads 0
+reads happen when they are waited for or at the next frame.
+
+A prefetch reads the file's data without keeping it, which brings it into
+the OS cache, or pages it into the pk3's mapping.
+
+==========================================================================
+*/
+
+#define	MAX_READ_REQUESTS	1024		// power of 2
+#define	MAX_READ_THREADS	8
+
+typedef enum {
+	READ_FREE,
+	READ_QUEUED,
+	READ_RUNNING,
+	READ_DONE
+} fsReadState_t;
+
+typedef struct {
+	int					request;
+	fsReadState_t		state;
+	qboolean			prefetch;
+
+	const byte			*source;		// data in a mapped pk3
+	char				ospath[MAX_OSPATH];	// or the file the data is in
+	long				offset;
+	long				sourceLength;	// bytes of data
+	qboolean			deflated;
+
+	byte				*buffer;		// hunk temp memory, NULL for a prefetch
+	long				length;
+	long				read;
+
+	fsReadCallback_t	callback;
+	void				*data;
+	char				qpath[MAX_ZPATH];
+} fsRead_t;
+
+static fsRead_t	fs_reads[MAX_READ_REQUESTS];
+static int		fs_firstRead = 1;		// oldest request that hasn't completed
+static int		fs_nextRead = 1;		// number of the next request
+static int		fs_nextRun = 1;			// where the read threads look for queued requests
+static void		*fs_readLock;
+static void		*fs_readWork;			// posted for each queued request
+static void		*fs_readDone;			// posted each time a read thread finishes one
+static void		*fs_readThreadHandles[MAX_READ_THREADS];
+static int		fs_numReadThreads;
+static qboolean	fs_readQuit;
+
+static fsRead_t *FS_ReadSlot( int request ) {
+	return &fs_reads[request & ( MAX_READ_REQUESTS - 1 )];
+}
+
+/*
+=================
+FS_RunRead
+
+Runs on a read thread, or on the main thread for a read nobody had
+started, so nothing but the request and the C library is used
+=================
+*/
+static void FS_RunRead( fsRead_t *r ) {
+	byte				scratch[PK3_SEEK_BUFFER_SIZE];
+	const volatile byte	*page;
+	FILE				*f;
+	byte				*data;
+	long				ofs, block;
+
+	r->read = 0;
+
+	if ( r->source ) {
+		if ( r->prefetch ) {
+			// fault the pages in
+			page = r->source;
+			for ( ofs = 0 ; ofs < r->sourceLength ; ofs += 4096 ) {
+				(void)page[ofs];
+			}
+		} else if ( r->deflated ) {
+			r->read = FS_InflateEntry( r->source, r->sourceLength, r->buffer, r->length );
+		} else {
+			Com_Memcpy( r->buffer, r->source, r->length );
+			r->read = r->length;
+		}
+		return;
+	}
+
+	f = fopen( r->ospath, "rb" );
+	if ( !f ) {
+		return;
+	}
+
+	if ( fseek( f, r->offset, SEEK_SET ) ) {
+		fclose( f );
+		return;
+	}
+
+	if ( r->prefetch ) {
+		for ( ofs = 0 ; ofs < r->sourceLength ; ofs += block ) {
+			block = r->sourceLength - ofs;
+			if ( block > sizeof( scratch ) ) {
+				block = sizeof( scratch );
+			}
+			if ( fread( scratch, 1, block, f ) != block ) {
+				break;
+			}
+		}
+	} else if ( !r->deflated ) {
+		r->read = fread( r->buffer, 1, r->length, f );
+	} else {
+		data = malloc( r->sourceLength );
+		if ( data && fread( data, 1, r->sourceLength, f ) == r->sourceLength ) {
+			r->read = FS_InflateEntry( data, r->sourceLength, r->buffer, r->length );
+		}
+		free( data );
+	}
+
+	fclose( f );
+}
+
+/*
+=================
+FS_ReadThread
+=================
+*/
+static void FS_ReadThread( void *data, int index ) {
+	fsRead_t	*r;
+
+	while ( 1 ) {
+		Sys_WaitSemaphore( fs_readWork );
+
+		Sys_LockMutex( fs_readLock );
+		if ( fs_readQuit ) {
+			Sys_UnlockMutex( fs_readLock );
+			return;
+		}
+
+		// the main thread may have done some of them already
+		r = NULL;
+		if ( fs_nextRun < fs_firstRead ) {
+			fs_nextRun = fs_firstRead;
+		}
+		while ( fs_nextRun < fs_nextRead ) {
+			r = FS_ReadSlot( fs_nextRun++ );
+			if ( r->state == READ_QUEUED ) {
+				r->state = READ_RUNNING;
+				break;
+			}
+			r = NULL;
+		}
+		Sys_UnlockMutex( fs_readLock );
+
+		if ( !r ) {
+			continue;
+		}
+
+		FS_RunRead( r );
+
+		Sys_LockMutex( fs_readLock );
+		r->state = READ_DONE;
+		Sys_UnlockMutex( fs_readLock );
+		Sys_PostSemaphore( fs_readDone );
+	}
+}
+
+/*
+=================
+FS_StartReadThreads
+
+Starts fs_readThreads read threads, stopping any that are running
+=================
+*/
+static void FS_StartReadThreads( void ) {
+	int		i, count;
+
+	if ( !fs_readLock ) {
+		fs_readLock = Sys_CreateMutex();
+		fs_readWork = Sys_CreateSemaphore();
+		fs_readDone = Sys_CreateSemaphore();
+	}
+
+	count = Com_Clamp( 0, MAX_READ_THREADS, fs_readThreads->integer );
+	if ( count == fs_numReadThreads ) {
+		return;
+	}
+
+	if ( fs_numReadThreads ) {
+		Sys_LockMutex( fs_readLock );
+		fs_readQuit = qtrue;
+		Sys_UnlockMutex( fs_readLock );
+
+		for ( i = 0 ; i < fs_numReadThreads ; i++ ) {
+			Sys_PostSemaphore( fs_readWork );
+		}
+		for ( i = 0 ; i < fs_numReadThreads ; i++ ) {
+			Sys_JoinThread( fs_readThreadHandles[i] );
+		}
+
+		fs_numReadThreads = 0;
+		fs_readQuit = qfalse;
+	}
+
+	for ( i = 0 ; i < count ; i++ ) {
+		fs_readThreadHandles[i] = Sys_CreateThread( FS_ReadThread, NULL, i );
+		if ( !fs_readThreadHandles[i] ) {
+			Com_Printf( S_COLOR_YELLOW "WARNING: could only start %d of %d read threads\n", i, count );
+			break;
+		}
+		fs_numReadThreads++;
+	}
+}
+
+/*
+=================
+FS_ResolveRead
+
+Finds where the data of a request's file is.  Returns qfalse if the file
+isn't present, or reads it right away if it is in a form the read threads
+can't handle.
+=================
+*/
+static qboolean FS_ResolveRead( fsRead_t *r ) {
+	fileHandle_t	h;
+	fileHandleData_t	*fh;
+	unz_file_info	info;
+	long			len;
+
+	// journal playback reads config files from the journal
+	if ( com_journal && com_journal->integer && strstr( r->qpath, ".cfg" ) ) {
+		if ( r->prefetch ) {
+			return qfalse;
+		}
+		r->length = r->read = FS_ReadFile( r->qpath, (void **)&r->buffer );
+		r->state = READ_DONE;
+		return r->buffer != NULL;
+	}
+
+	len = FS_FOpenFileRead( r->qpath, &h, qfalse );
+	if ( !h ) {
+		return qfalse;
+	}
+	fh = &fsh[h];
+
+	r->length = len;
+	r->state = READ_QUEUED;
+
+	if ( fh->mapped ) {
+		r->source = fh->mapped;
+		r->sourceLength = fh->mappedLength;
+		r->deflated = fh->mappedDeflated;
+	} else if ( fh->zipFile ) {
+		unzGetCurrentFileInfo( fh->handleFiles.file.z, &info, NULL, 0, NULL, 0, NULL, 0 );
+		Q_strncpyz( r->ospath, fh->search->pack->pakFilename, sizeof( r->ospath ) );
+		r->offset = unzGetCurrentFileZStreamPos( fh->handleFiles.file.z );
+		r->sourceLength = info.compressed_size;
+		r->deflated = ( info.compression_method == Z_DEFLATED );
+		if ( !r->offset || ( info.compression_method != 0 && !r->deflated ) ) {
+			r->state = READ_DONE;
+		}
+	} else {
+		Q_strncpyz( r->ospath, FS_BuildOSPath( fh->search->dir->path, fh->search->dir->gamedir, r->qpath ), sizeof( r->ospath ) );
+		r->offset = 0;
+		r->sourceLength = len;
+	}
+
+	if ( !r->prefetch ) {
+		r->buffer = Hunk_AllocateTempMemory( len + 1 );
+		r->buffer[len] = 0;
+		fs_loadCount++;
+		fs_loadStack++;
+		fs_readCount += len;
+
+		if ( r->state == READ_DONE ) {
+			r->read = FS_Read( r->buffer, len, h );
+		}
+	}
+
+	FS_FCloseFile( h );
 
-CONVENIENCE FUNCTIONS FOR ENTIRE FILES
+	return qtrue;
+}
 
-======================================================================================
+/*
+=================
+FS_QueueRead
+=================
 */
-
-int	FS_FileIsInPAK(const char *filename, int *pChecksum ) {
-	searchpath_t	*search;
-	pack_t			*pak;
-	fileInPack_t	*pakFile;
-	long			hash = 0;
+static fsRead_t *FS_QueueRead( const char *qpath, qboolean prefetch ) {
+	fsRead_t	*r;
 
 	if ( !fs_searchpaths ) {
 		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
 	}
 
-	if ( !filename ) {
-		Com_Error( ERR_FATAL, "FS_FOpenFileRead: NULL 'filename' parameter passed" );
+	if ( !qpath || !qpath[0] ) {
+		Com_Error( ERR_FATAL, "FS_ReadFileAsync with empty name" );
 	}
 
-	// qpaths are not supposed to have a leading slash
-	if ( filename[0] == '/' || filename[0] == '\\' ) {
-		filename++;
+	// a slot can only be used again once its request has completed
+	while ( fs_nextRead - fs_firstRead >= MAX_READ_REQUESTS ) {
+		if ( prefetch ) {
+			return NULL;
+		}
+		FS_WaitForRead( fs_firstRead );
 	}
 
-	// make absolutely sure that it can't back up the path.
-	// The searchpaths do guarantee that something will always
-	// be prepended, so we don't need to worry about "c:" or "//limbo" 
-	if ( strstr( filename, ".." ) || strstr( filename, "::" ) ) {
-		return -1;
+	r = FS_ReadSlot( fs_nextRead );
+	Com_Memset( r, 0, sizeof( *r ) );
+	r->request = fs_nextRead;
+	r->prefetch = prefetch;
+	Q_strncpyz( r->qpath, qpath, sizeof( r->qpath ) );
+
+	if ( !FS_ResolveRead( r ) ) {
+		r->state = READ_FREE;
+		return NULL;
 	}
 
-	//
-	// search through the path, one element at a time
-	//
+	if ( prefetch && r->state == READ_DONE ) {
+		// nothing the read threads could do ahead of time
+		r->state = READ_FREE;
+		return NULL;
+	}
 
-	for ( search = fs_searchpaths ; search ; search = search->next ) {
-		//
-		if (search->pack) {
-			hash = FS_HashFileName(filename, search->pack->hashSize);
-		}
-		// is the element a pak file?
-		if ( search->pack && search->pack->hashTable[hash] ) {
-			// disregard if it doesn't match one of the allowed pure pak files
-			if ( !FS_PakIsPure(search->pack) ) {
-				continue;
-			}
+	Sys_LockMutex( fs_readLock );
+	fs_nextRead++;
+	Sys_UnlockMutex( fs_readLock );
 
-			// look through all the pak file elements
-			pak = search->pack;
-			pakFile = pak->hashTable[hash];
-			do {
-				// case and separator insensitive comparisons
-				if ( !FS_FilenameCompare( pakFile->name, filename ) ) {
-					if (pChecksum) {
-						*pChecksum = pak->pure_checksum;
-					}
-					return 1;
-				}
-				pakFile = pakFile->next;
-			} while(pakFile != NULL);
-		}
+	if ( r->state == READ_QUEUED && fs_numReadThreads ) {
+		Sys_PostSemaphore( fs_readWork );
 	}
-	return -1;
+
+	return r;
 }
 
 /*
-============
-FS_ReadFileDir
+=================
+FS_FinishRead
 
-Filename are relative to the quake search path
-a null buffer will just return the file length without loading
-If searchPath is non-NULL search only in that specific search path
-============
+Frees a finished request's slot and runs its callback
+=================
 */
-long FS_ReadFileDir(const char *qpath, void *searchPath, qboolean unpure, void **buffer)
-{
-	fileHandle_t	h;
-	searchpath_t	*search;
-	byte*			buf;
-	qboolean		isConfig;
-	long				len;
+static void FS_FinishRead( fsRead_t *r ) {
+	char				qpath[MAX_ZPATH];
+	fsReadCallback_t	callback;
+	void				*buffer, *data;
+	long				length;
 
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	if ( !r->prefetch && r->read != r->length ) {
+		Com_Printf( S_COLOR_YELLOW "WARNING: only read %ld of %ld bytes of %s\n", r->read, r->length, r->qpath );
 	}
 
-	if ( !qpath || !qpath[0] ) {
-		Com_Error( ERR_FATAL, "FS_ReadFile with empty name" );
+	Q_strncpyz( qpath, r->qpath, sizeof( qpath ) );
+	callback = r->callback;
+	buffer = r->buffer;
+	length = r->length;
+	data = r->data;
+
+	Sys_LockMutex( fs_readLock );
+	r->state = READ_FREE;
+	while ( fs_firstRead < fs_nextRead && FS_ReadSlot( fs_firstRead )->state == READ_FREE ) {
+		fs_firstRead++;
 	}
+	Sys_UnlockMutex( fs_readLock );
 
-	buf = NULL;	// quiet compiler warning
+	if ( callback ) {
+		callback( qpath, buffer, length, data );
+	}
+}
 
-	// if this is a .cfg file and we are playing back a journal, read
-	// it from the journal file
-	if ( strstr( qpath, ".cfg" ) ) {
-		isConfig = qtrue;
-		if ( com_journal && com_journal->integer == 2 ) {
-			int		r;
+/*
+=================
+FS_WaitRead
 
-			Com_DPrintf( "Loading %s from journal file.\n", qpath );
-			r = FS_Read( &len, sizeof( len ), com_journalDataFile );
-			if ( r != sizeof( len ) ) {
-				if (buffer != NULL) *buffer = NULL;
-				return -1;
-			}
-			// if the file didn't exist when the journal was created
-			if (!len) {
-				if (buffer == NULL) {
-					return 1;			// hack for old journal files
-				}
-				*buffer = NULL;
-				return -1;
-			}
-			if (buffer == NULL) {
-				return len;
-			}
+Waits for a request to be done, doing it here if no read thread has
+started it
+=================
+*/
+static void FS_WaitRead( fsRead_t *r ) {
+	Sys_LockMutex( fs_readLock );
 
-			buf = Hunk_AllocateTempMemory(len+1);
-			*buffer = buf;
+	if ( r->state == READ_QUEUED ) {
+		r->state = READ_RUNNING;
+		Sys_UnlockMutex( fs_readLock );
 
-			r = FS_Read( buf, len, com_journalDataFile );
-			if ( r != len ) {
-				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
-			}
+		FS_RunRead( r );
 
-			fs_loadCount++;
-			fs_loadStack++;
+		Sys_LockMutex( fs_readLock );
+		r->state = READ_DONE;
+	}
 
-			// guarantee that it will have a trailing 0 for string operations
-			buf[len] = 0;
+	while ( r->state != READ_DONE ) {
+		Sys_UnlockMutex( fs_readLock );
+		Sys_WaitSemaphore( fs_readDone );
+		Sys_LockMutex( fs_readLock );
+	}
 
-			return len;
-		}
-	} else {
-		isConfig = qfalse;
+	Sys_UnlockMutex( fs_readLock );
+}
+
+/*
+=================
+FS_ReadFileAsync
+=================
+*/
+int FS_ReadFileAsync( const char *qpath, fsReadCallback_t callback, void *data ) {
+	fsRead_t	*r;
+
+	r = FS_QueueRead( qpath, qfalse );
+	if ( !r ) {
+		return 0;
 	}
 
-	search = searchPath;
+	r->callback = callback;
+	r->data = data;
 
-	if(search == NULL)
-	{
-		// look for it in the filesystem or pack files
-		len = FS_FOpenFileRead(qpath, &h, qfalse);
-        }
-	else
-	{
-		// look for it in a specific search path only
-		len = FS_FOpenFileReadDir(qpath, search, &h, qfalse, unpure);
+	return r->request;
+}
+
+/*
+=================
+FS_PrefetchFile
+=================
+*/
+void FS_PrefetchFile( const char *qpath ) {
+	if ( !fs_numReadThreads ) {
+		return;
 	}
 
-	if ( h == 0 ) {
-		if ( buffer ) {
-			*buffer = NULL;
-		}
-		// if we are journalling and it is a config file, write a zero to the journal file
-		if ( isConfig && com_journal && com_journal->integer == 1 ) {
-			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
-			len = 0;
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
-		}
-		return -1;
+	FS_QueueRead( qpath, qtrue );
+}
+
+/*
+=================
+FS_WaitForRead
+=================
+*/
+void FS_WaitForRead( int request ) {
+	fsRead_t	*r;
+
+	if ( request < fs_firstRead || request >= fs_nextRead ) {
+		return;
 	}
-	
-	if ( !buffer ) {
-		if ( isConfig && com_journal && com_journal->integer == 1 ) {
-			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
-		}
-		FS_FCloseFile( h);
-		return len;
+
+	r = FS_ReadSlot( request );
+	if ( r->request != request || r->state == READ_FREE ) {
+		return;
 	}
 
-	fs_loadCount++;
-	fs_loadStack++;
+	FS_WaitRead( r );
+	FS_FinishRead( r );
+}
 
-	buf = Hunk_AllocateTempMemory(len+1);
-	*buffer = buf;
+/*
+=================
+FS_CompleteReads
+=================
+*/
+void FS_CompleteReads( void ) {
+	fsRead_t	*r;
+	int			request, last;
+	qboolean	done;
 
-	FS_Read (buf, len, h);
+	// callbacks may queue more, those wait for the next frame
+	last = fs_nextRead;
 
-	// guarantee that it will have a trailing 0 for string operations
-	buf[len] = 0;
-	FS_FCloseFile( h );
+	for ( request = fs_firstRead ; request < last ; request++ ) {
+		r = FS_ReadSlot( request );
+		if ( r->request != request ) {
+			continue;
+		}
 
-	// if we are journalling and it is a config file, write it to the journal file
-	if ( isConfig && com_journal && com_journal->integer == 1 ) {
-		Com_DPrintf( "Writing %s to journal file.\n", qpath );
-		FS_Write( &len, sizeof( len ), com_journalDataFile );
-		FS_Write( buf, len, com_journalDataFile );
-		FS_Flush( com_journalDataFile );
+		if ( !fs_numReadThreads ) {
+			FS_WaitForRead( request );
+			continue;
+		}
+
+		Sys_LockMutex( fs_readLock );
+		done = ( r->state == READ_DONE );
+		Sys_UnlockMutex( fs_readLock );
+
+		if ( done ) {
+			FS_FinishRead( r );
+		}
 	}
-	return len;
 }
 
 /*
-============
-FS_ReadFile
+=================
+FS_CancelReads
 
-Filename are relative to the quake search path
-a null buffer will just return the file length without loading
-============
+Called before the hunk is cleared and the search paths go away
+=================
 */
-long FS_ReadFile(const char *qpath, void **buffer)
-{
-	return FS_ReadFileDir(qpath, NULL, qfalse, buffer);
-}
+void FS_CancelReads( void ) {
+	fsRead_t	*r;
+	int			request;
 
-/*
-=============
-FS_FreeFile
-=============
-*/
-void FS_FreeFile( void *buffer ) {
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization" );
+	if ( !fs_readLock || fs_firstRead == fs_nextRead ) {
+		return;
 	}
-	if ( !buffer ) {
-		Com_Error( ERR_FATAL, "FS_FreeFile( NULL )" );
+
+	Sys_LockMutex( fs_readLock );
+	for ( request = fs_firstRead ; request < fs_nextRead ; request++ ) {
+		r = FS_ReadSlot( request );
+		if ( r->request == request && r->state == READ_QUEUED ) {
+			r->state = READ_DONE;
+		}
 	}
-	fs_loadStack--;
+	Sys_UnlockMutex( fs_readLock );
 
-	Hunk_FreeTempMemory( buffer );
+	// the buffers were allocated in request order, temp memory is freed
+	// newest first
+	for ( request = fs_nextRead - 1 ; request >= fs_firstRead ; request-- ) {
+		r = FS_ReadSlot( request );
+		if ( r->request != request || r->state == READ_FREE ) {
+			continue;
+		}
 
-	// if all of our temp files are free, clear all of our space
-	if ( fs_loadStack == 0 ) {
-		Hunk_ClearTempMemory();
+		FS_WaitRead( r );
+		if ( r->buffer ) {
+			FS_FreeFile( r->buffer );
+		}
+		r->state = READ_FREE;
 	}
+
+	Sys_LockMutex( fs_readLock );
+	fs_firstRead = fs_nextRead;
+	Sys_UnlockMutex( fs_readLock );
 }
 
 /*
@@ -2027,6 +3324,7 @@ static pack_t *FS_LoadZipFile(const char *zipfile, const char *basename)
 
 	pack->handle = uf;
 	pack->numfiles = gi.number_entry;
+	pack->zipStart = unzGetZipStart(uf);
 	unzGoToFirstFile(uf);
 
 	for (i = 0; i < gi.number_entry; i++)
@@ -2072,6 +3370,7 @@ Frees a pak structure and releases all associated resources
 
 static void FS_FreePak(pack_t *thepak)
 {
+	FS_UnmapPak(thepak);
 	unzClose(thepak->handle);
 	Z_Free(thepak->buildBuffer);
 	Z_Free(thepak);
@@ -2114,8 +3413,6 @@ DIRECTORY SCANNING FUNCTIONS
 =================================================================================
 */
 
-#define	MAX_FOUND_FILES	0x1000
-
 static int FS_ReturnPath( const char *zname, char *zpath, int *depth ) {
 	int len, at, newdep;
 
@@ -2722,7 +4019,7 @@ void FS_Path_f( void ) {
 
 	Com_Printf( "\n" );
 	for ( i = 1 ; i < MAX_FILE_HANDLES ; i++ ) {
-		if ( fsh[i].handleFiles.file.o ) {
+		if ( fsh[i].handleFiles.file.o || fsh[i].mapped ) {
 			Com_Printf( "handle %i: %s\n", i, fsh[i].name );
 		}
 	}
@@ -3063,12 +4360,16 @@ void FS_Shutdown( qboolean closemfp ) {
 	searchpath_t	*p, *next;
 	int	i;
 
+	FS_CancelReads();
+
 	for(i = 0; i < MAX_FILE_HANDLES; i++) {
-		if (fsh[i].fileSize) {
+		if (fsh[i].fileSize || fsh[i].mapped) {
 			FS_FCloseFile(i);
 		}
 	}
 
+	FS_FreeIndex();
+
 	// free everything
 	for(p = fs_searchpaths; p; p = next)
 	{
@@ -3157,6 +4458,8 @@ static void FS_Startup( const char *gameName )
 	fs_packFiles = 0;
 
 	fs_debug = Cvar_Get( "fs_debug", "0", 0 );
+	fs_mapPaks = Cvar_Get( "fs_mapPaks", sizeof( void * ) > 4 ? "1" : "0", CVAR_ARCHIVE );
+	fs_readThreads = Cvar_Get( "fs_readThreads", "2", CVAR_ARCHIVE );
 	fs_basepath = Cvar_Get ("fs_basepath", Sys_DefaultInstallPath(), CVAR_INIT|CVAR_PROTECTED );
 	fs_basegame = Cvar_Get ("fs_basegame", "", CVAR_INIT );
 	homePath = Sys_DefaultHomePath();
@@ -3234,6 +4537,10 @@ static void FS_Startup( const char *gameName )
 	// reorder the pure pk3 files according to server order
 	FS_ReorderPurePaks();
 
+	FS_BuildIndex();
+
+	FS_StartReadThreads();
+
 	// print the current search paths
 	FS_Path_f();
 
@@ -3888,7 +5195,13 @@ qboolean FS_ConditionalRestart(int checksumFeed, qboolean disconnect)
 	if(checksumFeed != fs_checksumFeed)
 		FS_Restart(checksumFeed);
 	else if(fs_numServerPaks && !fs_reordered)
+	{
 		FS_ReorderPurePaks();
+
+		// lookups go through the index, which has the old order
+		if(fs_reordered)
+			FS_BuildIndex();
+	}
 	
 	return qfalse;
 }
@@ -3937,7 +5250,9 @@ int		FS_FOpenFileByMode( const char *qpath, fileHandle_t *f, fsMode_t mode ) {
 	}
 
 	if ( *f ) {
-		if (fsh[*f].zipFile == qtrue) {
+		if (fsh[*f].mapped) {
+			fsh[*f].baseOffset = fsh[*f].mappedPos;
+		} else if (fsh[*f].zipFile == qtrue) {
 			fsh[*f].baseOffset = unztell(fsh[*f].handleFiles.file.z);
 		} else {
 			fsh[*f].baseOffset = ftell(fsh[*f].handleFiles.file.o);
@@ -3956,7 +5271,9 @@ int		FS_FOpenFileByMode( const char *qpath, fileHandle_t *f, fsMode_t mode ) {
 
 int		FS_FTell( fileHandle_t f ) {
 	int pos;
-	if (fsh[f].zipFile == qtrue) {
+	if (fsh[f].mapped) {
+		pos = fsh[f].mappedPos;
+	} else if (fsh[f].zipFile == qtrue) {
 		pos = unztell(fsh[f].handleFiles.file.z);
 	} else {
 		pos = ftell(fsh[f].handleFiles.file.o);
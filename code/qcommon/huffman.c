@@ -29,14 +29,17 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 static int			bloc = 0;
 
+// the offset based functions keep the bit position in the caller's
+// variable rather than in bloc, so separate messages can be written
+// and read from several threads at once
 void	Huff_putBit( int bit, byte *fout, int *offset) {
-	bloc = *offset;
-	if ((bloc&7) == 0) {
-		fout[(bloc>>3)] = 0;
+	int		o = *offset;
+
+	if ((o&7) == 0) {
+		fout[(o>>3)] = 0;
 	}
-	fout[(bloc>>3)] |= bit << (bloc&7);
-	bloc++;
-	*offset = bloc;
+	fout[(o>>3)] |= bit << (o&7);
+	*offset = o + 1;
 }
 
 int		Huff_getBloc(void)
@@ -51,20 +54,22 @@ void	Huff_setBloc(int _bloc)
 
 int		Huff_getBit( byte *fin, int *offset) {
 	int t;
-	bloc = *offset;
-	t = (fin[(bloc>>3)] >> (bloc&7)) & 0x1;
-	bloc++;
-	*offset = bloc;
+	int o = *offset;
+
+	t = (fin[(o>>3)] >> (o&7)) & 0x1;
+	*offset = o + 1;
 	return t;
 }
 
 /* Add a bit to the output file (buffered) */
-static void add_bit (char bit, byte *fout) {
-	if ((bloc&7) == 0) {
-		fout[(bloc>>3)] = 0;
+static void add_bit (char bit, byte *fout, int *offset) {
+	int		o = *offset;
+
+	if ((o&7) == 0) {
+		fout[(o>>3)] = 0;
 	}
-	fout[(bloc>>3)] |= bit << (bloc&7);
-	bloc++;
+	fout[(o>>3)] |= bit << (o&7);
+	*offset = o + 1;
 }
 
 /* Receive one bit from the input file (buffered) */
@@ -280,13 +285,15 @@ int Huff_Receive (node_t *node, int *ch, byte *fin) {
 
 /* Get a symbol */
 void Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset) {
-	bloc = *offset;
+	int		o = *offset;
+
 	while (node && node->symbol == INTERNAL_NODE) {
-		if (get_bit(fin)) {
+		if ((fin[(o>>3)] >> (o&7)) & 0x1) {
 			node = node->right;
 		} else {
 			node = node->left;
 		}
+		o++;
 	}
 	if (!node) {
 		*ch = 0;
@@ -294,19 +301,19 @@ void Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset) {
 //		Com_Error(ERR_DROP, "Illegal tree!");
 	}
 	*ch = node->symbol;
-	*offset = bloc;
+	*offset = o;
 }
 
 /* Send the prefix code for this node */
-static void send(node_t *node, node_t *child, byte *fout) {
+static void send(node_t *node, node_t *child, byte *fout, int *offset) {
 	if (node->parent) {
-		send(node->parent, node, fout);
+		send(node->parent, node, fout, offset);
 	}
 	if (child) {
 		if (node->right == child) {
-			add_bit(1, fout);
+			add_bit(1, fout, offset);
 		} else {
-			add_bit(0, fout);
+			add_bit(0, fout, offset);
 		}
 	}
 }
@@ -318,17 +325,121 @@ void Huff_transmit (huff_t *huff, int ch, byte *fout) {
 		/* node_t hasn't been transmitted, send a NYT, then the symbol */
 		Huff_transmit(huff, NYT, fout);
 		for (i = 7; i >= 0; i--) {
-			add_bit((char)((ch >> i) & 0x1), fout);
+			add_bit((char)((ch >> i) & 0x1), fout, &bloc);
 		}
 	} else {
-		send(huff->loc[ch], NULL, fout);
+		send(huff->loc[ch], NULL, fout, &bloc);
 	}
 }
 
 void Huff_offsetTransmit (huff_t *huff, int ch, byte *fout, int *offset) {
-	bloc = *offset;
-	send(huff->loc[ch], NULL, fout);
-	*offset = bloc;
+	send(huff->loc[ch], NULL, fout, offset);
+}
+
+/*
+==============================================================================
+
+Lookup tables
+
+Once a tree stops adapting, the code for each symbol and the symbol at
+the front of every HUFF_LOOKUP_BITS bit pattern can be read straight
+out of tables instead of walking the tree one bit at a time.  Both are
+taken from the tree itself, so the bits are exactly the same.
+==============================================================================
+*/
+
+/* Append count bits of value, lowest first */
+static void put_bits( unsigned int value, int count, byte *fout, int *offset ) {
+	int		o = *offset;
+	int		shift, n;
+	byte	*out;
+
+	while (count > 0) {
+		n = 8 - (o&7);
+		if (n > count) {
+			n = count;
+		}
+		out = &fout[(o>>3)];
+		shift = o&7;
+		if (!shift) {
+			*out = value & ((1<<n)-1);
+		} else {
+			*out |= (value & ((1<<n)-1)) << shift;
+		}
+		value >>= n;
+		count -= n;
+		o += n;
+	}
+	*offset = o;
+}
+
+qboolean Huff_BuildTable( huffman_t *huff, huffTable_t *table ) {
+	node_t			*node;
+	unsigned int	code;
+	int				ch, i, length;
+
+	Com_Memset(table, 0, sizeof(*table));
+
+	// walk up from each leaf, the same way send does
+	for (ch = 0; ch < HMAX; ch++) {
+		node = huff->compressor.loc[ch];
+		if (!node) {
+			return qfalse;
+		}
+		code = 0;
+		length = 0;
+		while (node->parent) {
+			if (length == 32) {
+				return qfalse;
+			}
+			code = (code << 1) | (node->parent->right == node);
+			length++;
+			node = node->parent;
+		}
+		table->code[ch] = code;
+		table->codeLength[ch] = length;
+	}
+
+	// walk down for every possible run of lookup bits
+	for (i = 0; i < (1<<HUFF_LOOKUP_BITS); i++) {
+		node = huff->decompressor.tree;
+		length = 0;
+		while (node && node->symbol == INTERNAL_NODE && length < HUFF_LOOKUP_BITS) {
+			if ((i >> length) & 1) {
+				node = node->right;
+			} else {
+				node = node->left;
+			}
+			length++;
+		}
+		if (node && node->symbol != INTERNAL_NODE) {
+			table->symbol[i] = node->symbol;
+			table->symbolLength[i] = length;
+		}
+	}
+
+	table->valid = qtrue;
+	return qtrue;
+}
+
+void Huff_tableTransmit( const huffTable_t *table, int ch, byte *fout, int *offset ) {
+	put_bits(table->code[ch], table->codeLength[ch], fout, offset);
+}
+
+/* fin must have two more bytes after the one at offset */
+void Huff_tableReceive( const huffTable_t *table, node_t *tree, int *ch, byte *fin, int *offset ) {
+	int		o = *offset;
+	int		bits;
+
+	bits = fin[(o>>3)] | (fin[(o>>3)+1] << 8) | (fin[(o>>3)+2] << 16);
+	bits = (bits >> (o&7)) & ((1<<HUFF_LOOKUP_BITS)-1);
+
+	if (!table->symbolLength[bits]) {
+		Huff_offsetReceive(tree, ch, fin, offset);
+		return;
+	}
+	*ch = table->symbol[bits];
+	*offset = o + table->symbolLength[bits];
 }
 
 void Huff_Decompress(msg_t *mbuf, int offset) {
@@ -383,7 +494,7 @@ void Huff_Decompress(msg_t *mbuf, int offset) {
 	Com_Memcpy(mbuf->data + offset, seq, cch);
 }
 
-extern 	int oldsize;
+extern 	Q_THREADLOCAL int oldsize;
 
 void Huff_Compress(msg_t *mbuf, int offset) {
 	int			i, ch, size;
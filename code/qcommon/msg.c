@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "qcommon.h"
 
 static huffman_t		msgHuff;
+static huffTable_t		msgHuffTable;
 
 static qboolean			msgInit = qfalse;
 
@@ -37,7 +38,8 @@ Handles byte ordering and avoids alignment errors
 ==============================================================================
 */
 
-int oldsize = 0;
+// only written, one copy per thread so the snapshot jobs don't share them
+Q_THREADLOCAL int oldsize = 0;
 
 void MSG_initHuffman( void );
 
@@ -101,7 +103,7 @@ bit functions
 =============================================================================
 */
 
-int	overflows;
+Q_THREADLOCAL int	overflows;
 
 // negative bit values include signs
 void MSG_WriteBits( msg_t *msg, int value, int bits ) {
@@ -174,7 +176,12 @@ void MSG_WriteBits( msg_t *msg, int value, int bits ) {
 			}
 			bits = bits - nbits;
 		}
-		if (bits) {
+		if (bits && msgHuffTable.valid) {
+			for(i=0;i<bits;i+=8) {
+				Huff_tableTransmit (&msgHuffTable, (value&0xff), msg->data, &msg->bit);
+				value = (value>>8);
+			}
+		} else if (bits) {
 			for(i=0;i<bits;i+=8) {
 //				fwrite(bp, 1, 1, fp);
 				Huff_offsetTransmit (&msgHuff.compressor, (value&0xff), msg->data, &msg->bit);
@@ -186,6 +193,59 @@ void MSG_WriteBits( msg_t *msg, int value, int bits ) {
 	}
 }
 
+/*
+============
+MSG_WriteEncodedBits
+
+Appends bits that were already written to another message with
+MSG_WriteBits.  The Huffman codes don't depend on where in the stream
+they start, so this produces the same bits as repeating those writes.
+============
+*/
+void MSG_WriteEncodedBits( msg_t *msg, const byte *data, int bits ) {
+	int		i, n, shift, value;
+	byte	*out;
+
+	if ( bits <= 0 ) {
+		return;
+	}
+
+	if ( msg->oob ) {
+		Com_Error( ERR_DROP, "MSG_WriteEncodedBits: out of band message" );
+	}
+
+	oldsize += bits;
+
+	if ( msg->maxsize - ( ( msg->bit + bits ) >> 3 ) - 1 < 4 ) {
+		msg->overflowed = qtrue;
+		return;
+	}
+
+	for ( i = 0 ; i < bits ; i += 8 ) {
+		n = bits - i;
+		value = data[i >> 3];
+		if ( n < 8 ) {
+			value &= ( 1 << n ) - 1;
+		} else {
+			n = 8;
+		}
+
+		out = &msg->data[msg->bit >> 3];
+		shift = msg->bit & 7;
+		if ( !shift ) {
+			out[0] = value;
+		} else {
+			out[0] |= value << shift;
+			if ( shift + n > 8 ) {
+				out[1] = value >> ( 8 - shift );
+			}
+		}
+		msg->bit += n;
+	}
+
+	msg->cursize = ( msg->bit >> 3 ) + 1;
+}
+
 int MSG_ReadBits( msg_t *msg, int bits ) {
 	int			value;
 	int			get;
@@ -238,7 +298,12 @@ int MSG_ReadBits( msg_t *msg, int bits ) {
 		if (bits) {
 //			fp = fopen("c:\\netchan.bin", "a");
 			for(i=0;i<bits;i+=8) {
-				Huff_offsetReceive (msgHuff.decompressor.tree, &get, msg->data, &msg->bit);
+				// the lookup peeks at up to three bytes
+				if ( msgHuffTable.valid && (msg->bit>>3) + 3 <= msg->maxsize ) {
+					Huff_tableReceive (&msgHuffTable, msgHuff.decompressor.tree, &get, msg->data, &msg->bit);
+				} else {
+					Huff_offsetReceive (msgHuff.decompressor.tree, &get, msg->data, &msg->bit);
+				}
 //				fwrite(&get, 1, 1, fp);
 				value |= (get<<(i+nbits));
 			}
@@ -1773,6 +1838,143 @@ void MSG_initHuffman( void ) {
 			Huff_addRef(&msgHuff.decompressor,	(byte)i);			// Do update
 		}
 	}
+
+	// the tree is fixed from here on
+	if ( !Huff_BuildTable( &msgHuff, &msgHuffTable ) ) {
+		Com_DPrintf( "MSG_initHuffman: codes too long for lookup tables\n" );
+	}
+}
+
+/*
+=================
+MSG_HuffBench_f
+
+huffbench [buffers]
+
+Codes random buffers at random bit offsets with the tree walk and with
+the lookup tables of the message codec, decodes the streams both ways,
+counts the buffers where anything differs and reports the throughput.
+=================
+*/
+#define HUFFBENCH_SIZE	1400		// bytes per buffer, about a full packet
+
+void MSG_HuffBench_f( void ) {
+	byte			*in, *treeOut, *tableOut, *treeIn, *tableIn;
+	int				*treeBits, *tableBits;
+	int				numBuffers, outSize, maxLength;
+	int				b, i, ch, bit, mismatches;
+	unsigned int	usec[4];
+	float			mb;
+
+	if ( !msgInit ) {
+		MSG_initHuffman();
+	}
+	if ( !msgHuffTable.valid ) {
+		Com_Printf( "The message codec has no lookup tables.\n" );
+		return;
+	}
+
+	numBuffers = 500;
+	if ( Cmd_Argc() > 1 ) {
+		numBuffers = atoi( Cmd_Argv( 1 ) );
+		if ( numBuffers < 1 ) {
+			numBuffers = 1;
+		}
+	}
+
+	// room for the longest codes plus the table decoder's peek
+	maxLength = 0;
+	for ( ch = 0 ; ch < HMAX ; ch++ ) {
+		if ( msgHuffTable.codeLength[ch] > maxLength ) {
+			maxLength = msgHuffTable.codeLength[ch];
+		}
+	}
+	outSize = 1 + ( HUFFBENCH_SIZE * maxLength + 7 ) / 8 + 3;
+
+	in = Hunk_AllocateTempMemory( numBuffers * HUFFBENCH_SIZE );
+	treeOut = Hunk_AllocateTempMemory( numBuffers * outSize );
+	tableOut = Hunk_AllocateTempMemory( numBuffers * outSize );
+	treeIn = Hunk_AllocateTempMemory( numBuffers * HUFFBENCH_SIZE );
+	tableIn = Hunk_AllocateTempMemory( numBuffers * HUFFBENCH_SIZE );
+	treeBits = Hunk_AllocateTempMemory( numBuffers * sizeof( *treeBits ) );
+	tableBits = Hunk_AllocateTempMemory( numBuffers * sizeof( *tableBits ) );
+
+	for ( i = 0 ; i < numBuffers * HUFFBENCH_SIZE ; i++ ) {
+		in[i] = rand() & 0xff;
+	}
+	Com_Memset( treeOut, 0, numBuffers * outSize );
+	Com_Memset( tableOut, 0, numBuffers * outSize );
+
+	// encode
+	usec[0] = Sys_Microseconds();
+	for ( b = 0 ; b < numBuffers ; b++ ) {
+		bit = b & 7;
+		for ( i = 0 ; i < HUFFBENCH_SIZE ; i++ ) {
+			Huff_offsetTransmit( &msgHuff.compressor, in[b * HUFFBENCH_SIZE + i], treeOut + b * outSize, &bit );
+		}
+		treeBits[b] = bit;
+	}
+	usec[0] = Sys_Microseconds() - usec[0];
+
+	usec[1] = Sys_Microseconds();
+	for ( b = 0 ; b < numBuffers ; b++ ) {
+		bit = b & 7;
+		for ( i = 0 ; i < HUFFBENCH_SIZE ; i++ ) {
+			Huff_tableTransmit( &msgHuffTable, in[b * HUFFBENCH_SIZE + i], tableOut + b * outSize, &bit );
+		}
+		tableBits[b] = bit;
+	}
+	usec[1] = Sys_Microseconds() - usec[1];
+
+	// decode the table encoder's streams both ways
+	usec[2] = Sys_Microseconds();
+	for ( b = 0 ; b < numBuffers ; b++ ) {
+		bit = b & 7;
+		for ( i = 0 ; i < HUFFBENCH_SIZE ; i++ ) {
+			Huff_offsetReceive( msgHuff.decompressor.tree, &ch, tableOut + b * outSize, &bit );
+			treeIn[b * HUFFBENCH_SIZE + i] = ch;
+		}
+	}
+	usec[2] = Sys_Microseconds() - usec[2];
+
+	usec[3] = Sys_Microseconds();
+	for ( b = 0 ; b < numBuffers ; b++ ) {
+		bit = b & 7;
+		for ( i = 0 ; i < HUFFBENCH_SIZE ; i++ ) {
+			Huff_tableReceive( &msgHuffTable, msgHuff.decompressor.tree, &ch, tableOut + b * outSize, &bit );
+			tableIn[b * HUFFBENCH_SIZE + i] = ch;
+		}
+	}
+	usec[3] = Sys_Microseconds() - usec[3];
+
+	mismatches = 0;
+	for ( b = 0 ; b < numBuffers ; b++ ) {
+		if ( treeBits[b] != tableBits[b]
+			|| memcmp( treeOut + b * outSize, tableOut + b * outSize, outSize )
+			|| memcmp( treeIn + b * HUFFBENCH_SIZE, in + b * HUFFBENCH_SIZE, HUFFBENCH_SIZE )
+			|| memcmp( tableIn + b * HUFFBENCH_SIZE, in + b * HUFFBENCH_SIZE, HUFFBENCH_SIZE ) ) {
+			mismatches++;
+		}
+	}
+
+	mb = (float)numBuffers * HUFFBENCH_SIZE / ( 1024 * 1024 );
+	for ( i = 0 ; i < 4 ; i++ ) {
+		if ( !usec[i] ) {
+			usec[i] = 1;
+		}
+	}
+
+	Com_Printf( "%d buffers of %d bytes: %d mismatches\n", numBuffers, HUFFBENCH_SIZE, mismatches );
+	Com_Printf( "encode: tree %.1f MB/s, table %.1f MB/s\n", mb * 1e6f / usec[0], mb * 1e6f / usec[1] );
+	Com_Printf( "decode: tree %.1f MB/s, table %.1f MB/s\n", mb * 1e6f / usec[2], mb * 1e6f / usec[3] );
+
+	Hunk_FreeTempMemory( tableBits );
+	Hunk_FreeTempMemory( treeBits );
+	Hunk_FreeTempMemory( tableIn );
+	Hunk_FreeTempMemory( treeIn );
+	Hunk_FreeTempMemory( tableOut );
+	Hunk_FreeTempMemory( treeOut );
+	Hunk_FreeTempMemory( in );
 }
 
 /*
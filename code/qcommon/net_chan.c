@@ -534,6 +534,9 @@ void NET_FlushPacketQueue(void)
 		Z_Free(last->data);
 		Z_Free(last);
 	}
+
+	// the sys layer may hold this frame's packets for a batched send
+	Sys_FlushPackets();
 }
 
 void NET_SendPacket( netsrc_t sock, int length, const void *data, netadr_t to ) {
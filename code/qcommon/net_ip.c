@@ -20,6 +20,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 
+#ifdef __linux__
+#	define _GNU_SOURCE	// recvmmsg, sendmmsg
+#endif
+
 #include "../qcommon/q_shared.h"
 #include "../qcommon/qcommon.h"
 
@@ -81,6 +85,13 @@ static qboolean	winsockInitialized = qfalse;
 #		include <sys/filio.h>
 #	endif
 
+#	ifdef __linux__
+#		include <sys/epoll.h>
+#		include <sys/resource.h>
+#		include <time.h>
+#		define USE_NET_BATCH
+#	endif
+
 typedef int SOCKET;
 #	define INVALID_SOCKET		-1
 #	define SOCKET_ERROR			-1
@@ -111,6 +122,10 @@ static cvar_t	*net_mcast6iface;
 
 static cvar_t	*net_dropsim;
 
+#ifdef USE_NET_BATCH
+static cvar_t	*net_batch;
+#endif
+
 static struct sockaddr	socksRelayAddr;
 
 static SOCKET	ip_sockets[MAX_IP_SOCKETS] = { // No easy way to initialize an array
@@ -520,6 +535,51 @@ qboolean	NET_IsLocalAddress( netadr_t adr ) {
 
 //=============================================================================
 
+/*
+==================
+NET_ParsePacket
+
+Fills in the sender of a datagram that was just read into net_message
+==================
+*/
+static qboolean NET_ParsePacket(struct sockaddr_storage *from, socklen_t fromlen, int ret, qboolean v4, netadr_t *net_from, msg_t *net_message)
+{
+	if(v4)
+	{
+		memset( ((struct sockaddr_in *)from)->sin_zero, 0, 8 );
+
+		if ( usingSocks && memcmp( from, &socksRelayAddr, fromlen ) == 0 ) {
+			if ( ret < 10 || net_message->data[0] != 0 || net_message->data[1] != 0 || net_message->data[2] != 0 || net_message->data[3] != 1 ) {
+				return qfalse;
+			}
+			net_from->type = NA_IP;
+			net_from->ip[0] = net_message->data[4];
+			net_from->ip[1] = net_message->data[5];
+			net_from->ip[2] = net_message->data[6];
+			net_from->ip[3] = net_message->data[7];
+			net_from->port = *(short *)&net_message->data[8];
+			net_message->readcount = 10;
+		}
+		else {
+			SockadrToNetadr( (struct sockaddr *) from, net_from );
+			net_message->readcount = 0;
+		}
+	}
+	else
+	{
+		SockadrToNetadr((struct sockaddr *) from, net_from);
+		net_message->readcount = 0;
+	}
+
+	if( ret >= net_message->maxsize ) {
+		Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
+		return qfalse;
+	}
+
+	net_message->cursize = ret;
+	return qtrue;
+}
+
 /*
 ==================
 NET_GetPacket
@@ -550,35 +610,7 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr, int
 					Com_Printf( "NET_GetPacket: %s\n", NET_ErrorString() );
 			}
 			else
-			{
-
-				memset( ((struct sockaddr_in *)&from)->sin_zero, 0, 8 );
-			
-				if ( usingSocks && memcmp( &from, &socksRelayAddr, fromlen ) == 0 ) {
-					if ( ret < 10 || net_message->data[0] != 0 || net_message->data[1] != 0 || net_message->data[2] != 0 || net_message->data[3] != 1 ) {
-						return qfalse;
-					}
-					net_from->type = NA_IP;
-					net_from->ip[0] = net_message->data[4];
-					net_from->ip[1] = net_message->data[5];
-					net_from->ip[2] = net_message->data[6];
-					net_from->ip[3] = net_message->data[7];
-					net_from->port = *(short *)&net_message->data[8];
-					net_message->readcount = 10;
-				}
-				else {
-					SockadrToNetadr( (struct sockaddr *) &from, net_from );
-					net_message->readcount = 0;
-				}
-			
-				if( ret >= net_message->maxsize ) {
-					Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
-					return qfalse;
-				}
-				
-				net_message->cursize = ret;
-				return qtrue;
-			}
+				return NET_ParsePacket(&from, fromlen, ret, qtrue, net_from, net_message);
 		}
 	}
 	
@@ -596,19 +628,7 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr, int
 				Com_Printf( "NET_GetPacket: %s\n", NET_ErrorString() );
 		}
 		else
-		{
-			SockadrToNetadr((struct sockaddr *) &from, net_from);
-			net_message->readcount = 0;
-		
-			if(ret >= net_message->maxsize)
-			{
-				Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
-				return qfalse;
-			}
-			
-			net_message->cursize = ret;
-			return qtrue;
-		}
+			return NET_ParsePacket(&from, fromlen, ret, qfalse, net_from, net_message);
 	}
 
 	if(multicast6_socket != INVALID_SOCKET && multicast6_socket != ip6_socket && FD_ISSET(multicast6_socket, fdr))
@@ -624,19 +644,7 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr, int
 				Com_Printf( "NET_GetPacket: %s\n", NET_ErrorString() );
 		}
 		else
-		{
-			SockadrToNetadr((struct sockaddr *) &from, net_from);
-			net_message->readcount = 0;
-		
-			if(ret >= net_message->maxsize)
-			{
-				Com_Printf( "Oversize packet from %s\n", NET_AdrToString (*net_from) );
-				return qfalse;
-			}
-			
-			net_message->cursize = ret;
-			return qtrue;
-		}
+			return NET_ParsePacket(&from, fromlen, ret, qfalse, net_from, net_message);
 	}
 	
 	
@@ -645,6 +653,236 @@ qboolean NET_GetPacket(netadr_t *net_from, msg_t *net_message, fd_set *fdr, int
 
 //=============================================================================
 
+/*
+==================
+NET_SendError
+==================
+*/
+static void NET_SendError( netadrtype_t type ) {
+	int err = socketError;
+
+	// wouldblock is silent
+	if( err == EAGAIN ) {
+		return;
+	}
+
+	// some PPP links do not allow broadcasts and return an error
+	if( ( err == EADDRNOTAVAIL ) && ( ( type == NA_BROADCAST ) ) ) {
+		return;
+	}
+
+	Com_Printf( "Sys_SendPacket: %s\n", NET_ErrorString() );
+}
+
+#ifdef USE_NET_BATCH
+/*
+On Linux a ready socket is drained with recvmmsg into a ring of buffers,
+outgoing packets are queued and handed to the kernel with one sendmmsg per
+socket when the frame is done, and NET_Sleep waits on an epoll set instead
+of rebuilding an fd_set every call.
+*/
+
+#define NET_RECV_PACKETS	32
+#define NET_SEND_PACKETS	64
+#define NET_SEND_BYTES		0x20000
+
+typedef struct {
+	struct mmsghdr		hdrs[NET_RECV_PACKETS];
+	struct iovec		iovs[NET_RECV_PACKETS];
+	struct sockaddr_storage	addrs[NET_RECV_PACKETS];
+	byte			data[NET_RECV_PACKETS][MAX_MSGLEN + 1];
+} netRecvRing_t;
+
+typedef struct {
+	struct mmsghdr		hdrs[NET_SEND_PACKETS];
+	struct iovec		iovs[NET_SEND_PACKETS];
+	struct sockaddr_storage	addrs[NET_SEND_PACKETS];
+	SOCKET			sockets[NET_SEND_PACKETS];
+	netadrtype_t		types[NET_SEND_PACKETS];
+	int			numPackets;
+	int			numBytes;
+	byte			data[NET_SEND_BYTES];
+} netSendQueue_t;
+
+static netRecvRing_t	net_recvRing;
+static netSendQueue_t	net_sendQueue;
+static qboolean		net_batching = qfalse;
+static int		net_epollFd = -1;
+
+/*
+==================
+NET_RecvRing
+
+Reads up to NET_RECV_PACKETS datagrams from s with a single syscall.
+Returns the number of datagrams read.
+==================
+*/
+static int NET_RecvRing( SOCKET s, netRecvRing_t *ring )
+{
+	struct msghdr	*hdr;
+	int		i, ret;
+
+	for( i = 0; i < NET_RECV_PACKETS; i++ ) {
+		ring->iovs[i].iov_base = ring->data[i];
+		ring->iovs[i].iov_len = sizeof( ring->data[i] );
+
+		hdr = &ring->hdrs[i].msg_hdr;
+		hdr->msg_name = &ring->addrs[i];
+		hdr->msg_namelen = sizeof( ring->addrs[i] );
+		hdr->msg_iov = &ring->iovs[i];
+		hdr->msg_iovlen = 1;
+		hdr->msg_control = NULL;
+		hdr->msg_controllen = 0;
+		hdr->msg_flags = 0;
+	}
+
+	ret = recvmmsg( s, ring->hdrs, NET_RECV_PACKETS, MSG_DONTWAIT, NULL );
+
+	if( ret == SOCKET_ERROR ) {
+		int err = socketError;
+
+		if( err != EAGAIN && err != ECONNRESET )
+			Com_Printf( "NET_RecvRing: %s\n", NET_ErrorString() );
+
+		return 0;
+	}
+
+	return ret;
+}
+
+/*
+==================
+NET_FlushSendQueue
+
+Hands every queued packet to the kernel, one sendmmsg per run of packets
+going out through the same socket
+==================
+*/
+static void NET_FlushSendQueue( netSendQueue_t *q )
+{
+	int i, count, ret;
+
+	for( i = 0; i < q->numPackets; ) {
+		for( count = 1; i + count < q->numPackets; count++ ) {
+			if( q->sockets[i + count] != q->sockets[i] )
+				break;
+		}
+
+		ret = sendmmsg( q->sockets[i], &q->hdrs[i], count, 0 );
+
+		if( ret == SOCKET_ERROR ) {
+			// the packet at i failed, drop it like sendto would and go on
+			NET_SendError( q->types[i] );
+			i++;
+		}
+		else
+			i += ret > 0 ? ret : 1;
+	}
+
+	q->numPackets = 0;
+	q->numBytes = 0;
+}
+
+/*
+==================
+NET_QueueSend
+==================
+*/
+static void NET_QueueSend( netSendQueue_t *q, SOCKET s, const void *data, int length,
+	const struct sockaddr_storage *addr, socklen_t addrlen, netadrtype_t type )
+{
+	struct msghdr	*hdr;
+	int		n;
+
+	if( q->numPackets == NET_SEND_PACKETS || q->numBytes + length > NET_SEND_BYTES )
+		NET_FlushSendQueue( q );
+
+	n = q->numPackets++;
+
+	Com_Memcpy( q->data + q->numBytes, data, length );
+	Com_Memcpy( &q->addrs[n], addr, addrlen );
+	q->iovs[n].iov_base = q->data + q->numBytes;
+	q->iovs[n].iov_len = length;
+	q->sockets[n] = s;
+	q->types[n] = type;
+	q->numBytes += length;
+
+	hdr = &q->hdrs[n].msg_hdr;
+	hdr->msg_name = &q->addrs[n];
+	hdr->msg_namelen = addrlen;
+	hdr->msg_iov = &q->iovs[n];
+	hdr->msg_iovlen = 1;
+	hdr->msg_control = NULL;
+	hdr->msg_controllen = 0;
+	hdr->msg_flags = 0;
+}
+
+/*
+==================
+NET_AddBatchSocket
+==================
+*/
+static void NET_AddBatchSocket( SOCKET s ) {
+	struct epoll_event	ev;
+
+	if( s == INVALID_SOCKET )
+		return;
+
+	memset( &ev, 0, sizeof( ev ) );
+	ev.events = EPOLLIN;
+	ev.data.fd = s;
+
+	if( epoll_ctl( net_epollFd, EPOLL_CTL_ADD, s, &ev ) == SOCKET_ERROR )
+		Com_Printf( "WARNING: NET_AddBatchSocket: epoll_ctl: %s\n", NET_ErrorString() );
+}
+
+/*
+==================
+NET_OpenBatch
+
+Called once the sockets are open
+==================
+*/
+static void NET_OpenBatch( void ) {
+	int		i;
+
+	if( !net_batch->integer )
+		return;
+
+	net_epollFd = epoll_create1( EPOLL_CLOEXEC );
+
+	if( net_epollFd == SOCKET_ERROR ) {
+		Com_Printf( "WARNING: NET_OpenBatch: epoll_create1: %s\n", NET_ErrorString() );
+		return;
+	}
+
+	for( i = 0; i < MAX_IP_SOCKETS; i++ )
+		NET_AddBatchSocket( ip_sockets[i] );
+
+	NET_AddBatchSocket( ip6_socket );
+
+	net_batching = qtrue;
+}
+
+/*
+==================
+NET_CloseBatch
+
+Called before the sockets are closed
+==================
+*/
+static void NET_CloseBatch( void ) {
+	NET_FlushSendQueue( &net_sendQueue );
+
+	if( net_epollFd != SOCKET_ERROR ) {
+		close( net_epollFd );
+		net_epollFd = SOCKET_ERROR;
+	}
+
+	net_batching = qfalse;
+}
+#endif
+
 static char socksBuf[4096];
 
 /*
@@ -685,6 +923,16 @@ void Sys_SendPacket( int length, const void *data, netadr_t to, int sockid ) {
 		memcpy( &socksBuf[10], data, length );
 		ret = sendto( ip_sockets[sockid], socksBuf, length+10, 0, &socksRelayAddr, sizeof(socksRelayAddr) );
 	}
+#ifdef USE_NET_BATCH
+	else if( net_batching ) {
+		// sent by Sys_FlushPackets at the end of the frame
+		if(addr.ss_family == AF_INET)
+			NET_QueueSend( &net_sendQueue, ip_sockets[sockid], data, length, &addr, sizeof(struct sockaddr_in), to.type );
+		else if(addr.ss_family == AF_INET6)
+			NET_QueueSend( &net_sendQueue, ip6_socket, data, length, &addr, sizeof(struct sockaddr_in6), to.type );
+		return;
+	}
+#endif
 	else {
 		if(addr.ss_family == AF_INET)
 			ret = sendto( ip_sockets[sockid], data, length, 0, (struct sockaddr *) &addr, sizeof(struct sockaddr_in) );
@@ -692,20 +940,22 @@ void Sys_SendPacket( int length, const void *data, netadr_t to, int sockid ) {
 			ret = sendto( ip6_socket, data, length, 0, (struct sockaddr *) &addr, sizeof(struct sockaddr_in6) );
 	}
 	if( ret == SOCKET_ERROR ) {
-		int err = socketError;
-
-		// wouldblock is silent
-		if( err == EAGAIN ) {
-			return;
-		}
+		NET_SendError( to.type );
+	}
+}
 
-		// some PPP links do not allow broadcasts and return an error
-		if( ( err == EADDRNOTAVAIL ) && ( ( to.type == NA_BROADCAST ) ) ) {
-			return;
-		}
+/*
+==================
+Sys_FlushPackets
 
-		Com_Printf( "Sys_SendPacket: %s\n", NET_ErrorString() );
-	}
+Sends anything Sys_SendPacket has queued up
+==================
+*/
+void Sys_FlushPackets( void ) {
+#ifdef USE_NET_BATCH
+	if( net_sendQueue.numPackets )
+		NET_FlushSendQueue( &net_sendQueue );
+#endif
 }
 
 
@@ -1500,6 +1750,12 @@ static qboolean NET_GetCvars( void ) {
 
 	net_dropsim = Cvar_Get("net_dropsim", "", CVAR_TEMP);
 
+#ifdef USE_NET_BATCH
+	net_batch = Cvar_Get( "net_batch", "1", CVAR_LATCH | CVAR_ARCHIVE );
+	modified += net_batch->modified;
+	net_batch->modified = qfalse;
+#endif
+
 	return modified ? qtrue : qfalse;
 }
 
@@ -1549,6 +1805,10 @@ void NET_Config( qboolean enableNetworking ) {
 	}
 
 	if( stop ) {
+#ifdef USE_NET_BATCH
+		NET_CloseBatch();
+#endif
+
 		if ( ip_socket != INVALID_SOCKET ) {
 			closesocket( ip_socket );
 			ip_socket = INVALID_SOCKET;
@@ -1580,11 +1840,155 @@ void NET_Config( qboolean enableNetworking ) {
 		{
 			NET_OpenIP();
 			NET_SetMulticast6();
+#ifdef USE_NET_BATCH
+			NET_OpenBatch();
+#endif
 		}
 	}
 }
 
 
+#ifdef USE_NET_BATCH
+/*
+====================
+NET_BenchSocket
+====================
+*/
+static SOCKET NET_BenchSocket( struct sockaddr_in *addr ) {
+	SOCKET		s;
+	socklen_t	addrlen = sizeof( *addr );
+	int		rcvbuf = 4 * 1024 * 1024;
+	ioctlarg_t	_true = 1;
+
+	if( ( s = socket( AF_INET, SOCK_DGRAM, IPPROTO_UDP ) ) == INVALID_SOCKET ) {
+		Com_Printf( "netbench: socket: %s\n", NET_ErrorString() );
+		return INVALID_SOCKET;
+	}
+
+	memset( addr, 0, sizeof( *addr ) );
+	addr->sin_family = AF_INET;
+	addr->sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+
+	if( bind( s, (struct sockaddr *)addr, sizeof( *addr ) ) == SOCKET_ERROR ||
+		getsockname( s, (struct sockaddr *)addr, &addrlen ) == SOCKET_ERROR ) {
+		Com_Printf( "netbench: bind: %s\n", NET_ErrorString() );
+		closesocket( s );
+		return INVALID_SOCKET;
+	}
+
+	ioctlsocket( s, FIONBIO, &_true );
+	setsockopt( s, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof( rcvbuf ) );
+
+	return s;
+}
+
+/*
+====================
+NET_BenchTime
+====================
+*/
+static void NET_BenchTime( double *wall, double *cpu ) {
+	struct timespec	ts;
+	struct rusage	ru;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	*wall = ts.tv_sec + ts.tv_nsec * 1e-9;
+
+	getrusage( RUSAGE_THREAD, &ru );
+	*cpu = ru.ru_utime.tv_sec + ru.ru_stime.tv_sec +
+		( ru.ru_utime.tv_usec + ru.ru_stime.tv_usec ) * 1e-6;
+}
+
+/*
+====================
+NET_Bench_f
+
+Loopback load generator. Pushes packets between two throwaway sockets on
+127.0.0.1, first with a sendto/recvfrom per packet, then through the
+sendmmsg/recvmmsg queues, and reports packets per second and CPU time
+spent per packet for both.
+====================
+*/
+static void NET_Bench_f( void ) {
+	static const char	*modes[2] = { "sendto/recvfrom", "sendmmsg/recvmmsg" };
+	netRecvRing_t		*ring;
+	netSendQueue_t		*queue;
+	struct sockaddr_in	rxAddr, txAddr;
+	struct sockaddr_storage	to;
+	SOCKET			rx, tx;
+	byte			payload[1400], buf[1401];
+	double			wall0, cpu0, wall1, cpu1;
+	int			packets, size, mode;
+	int			sent, received, burst, i, n;
+
+	packets = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 200000;
+	size = Cmd_Argc() > 2 ? atoi( Cmd_Argv( 2 ) ) : 1000;
+
+	if( packets < 1 )
+		packets = 1;
+	size = Com_Clamp( 1, sizeof( payload ), size );
+
+	rx = NET_BenchSocket( &rxAddr );
+	tx = NET_BenchSocket( &txAddr );
+
+	if( rx == INVALID_SOCKET || tx == INVALID_SOCKET ) {
+		if( rx != INVALID_SOCKET )
+			closesocket( rx );
+		if( tx != INVALID_SOCKET )
+			closesocket( tx );
+		return;
+	}
+
+	memset( &to, 0, sizeof( to ) );
+	Com_Memcpy( &to, &rxAddr, sizeof( rxAddr ) );
+	for( i = 0; i < size; i++ )
+		payload[i] = i;
+
+	ring = Z_Malloc( sizeof( *ring ) );
+	queue = Z_Malloc( sizeof( *queue ) );
+
+	for( mode = 0; mode < 2; mode++ ) {
+		sent = received = 0;
+		NET_BenchTime( &wall0, &cpu0 );
+
+		while( sent < packets ) {
+			// keep each burst within what one ring read can take
+			burst = packets - sent;
+			if( burst > NET_RECV_PACKETS )
+				burst = NET_RECV_PACKETS;
+
+			if( mode == 0 ) {
+				for( i = 0; i < burst; i++ )
+					sendto( tx, payload, size, 0, (struct sockaddr *)&rxAddr, sizeof( rxAddr ) );
+
+				while( recv( rx, buf, sizeof( buf ), 0 ) > 0 )
+					received++;
+			} else {
+				for( i = 0; i < burst; i++ )
+					NET_QueueSend( queue, tx, payload, size, &to, sizeof( rxAddr ), NA_IP );
+				NET_FlushSendQueue( queue );
+
+				while( ( n = NET_RecvRing( rx, ring ) ) > 0 )
+					received += n;
+			}
+
+			sent += burst;
+		}
+
+		NET_BenchTime( &wall1, &cpu1 );
+
+		Com_Printf( "netbench: %-17s %i/%i packets of %i bytes in %.1f ms, %.0f packets/s, %.0f ns CPU/packet\n",
+			modes[mode], received, sent, size, ( wall1 - wall0 ) * 1000.0,
+			received / ( wall1 - wall0 ), ( cpu1 - cpu0 ) * 1e9 / sent );
+	}
+
+	Z_Free( queue );
+	Z_Free( ring );
+	closesocket( rx );
+	closesocket( tx );
+}
+#endif
+
 /*
 ====================
 NET_Init
@@ -1607,6 +2011,9 @@ void NET_Init( void ) {
 	NET_Config( qtrue );
 	
 	Cmd_AddCommand ("net_restart", NET_Restart_f);
+#ifdef USE_NET_BATCH
+	Cmd_AddCommand ("netbench", NET_Bench_f);
+#endif
 }
 
 
@@ -1628,6 +2035,56 @@ void NET_Shutdown( void ) {
 #endif
 }
 
+/*
+====================
+NET_DispatchPacket
+====================
+*/
+static void NET_DispatchPacket(netadr_t *from, msg_t *netmsg, int sockid)
+{
+	if(net_dropsim->value > 0.0f && net_dropsim->value <= 100.0f)
+	{
+		// com_dropsim->value percent of incoming packets get dropped.
+		if(rand() < (int) (((double) RAND_MAX) / 100.0 * (double) net_dropsim->value))
+			return;          // drop this packet
+	}
+
+	if(com_sv_running->integer)
+		Com_RunAndTimeServerPacket(from, netmsg, sockid);
+	else
+		CL_PacketEvent(*from, netmsg);
+}
+
+#ifdef USE_NET_BATCH
+/*
+====================
+NET_DrainSocket
+
+Reads everything pending on a socket, a ring of datagrams per syscall
+====================
+*/
+static void NET_DrainSocket(SOCKET s, int sockid, qboolean v4)
+{
+	netadr_t from;
+	msg_t netmsg;
+	int i, count;
+
+	do
+	{
+		count = NET_RecvRing(s, &net_recvRing);
+
+		for(i = 0; i < count; i++)
+		{
+			MSG_Init(&netmsg, net_recvRing.data[i], sizeof(net_recvRing.data[i]));
+
+			if(NET_ParsePacket(&net_recvRing.addrs[i], net_recvRing.hdrs[i].msg_hdr.msg_namelen,
+				net_recvRing.hdrs[i].msg_len, v4, &from, &netmsg))
+				NET_DispatchPacket(&from, &netmsg, sockid);
+		}
+	} while(count == NET_RECV_PACKETS);
+}
+#endif
+
 /*
 ====================
 NET_Event
@@ -1642,25 +2099,29 @@ void NET_Event(fd_set *fdr)
 	netadr_t from;
 	msg_t netmsg;
 	int sockid;
+
+#ifdef USE_NET_BATCH
+	if(net_batching)
+	{
+		for(sockid = 0; sockid < MAX_IP_SOCKETS; sockid++)
+		{
+			if(ip_sockets[sockid] != INVALID_SOCKET && FD_ISSET(ip_sockets[sockid], fdr))
+				NET_DrainSocket(ip_sockets[sockid], sockid, qtrue);
+		}
+
+		if(ip6_socket != INVALID_SOCKET && FD_ISSET(ip6_socket, fdr))
+			NET_DrainSocket(ip6_socket, 0, qfalse);
+
+		return;
+	}
+#endif
 	
 	while(1)
 	{
 		MSG_Init(&netmsg, bufData, sizeof(bufData));
 
 		if(NET_GetPacket(&from, &netmsg, fdr, &sockid))
-		{
-			if(net_dropsim->value > 0.0f && net_dropsim->value <= 100.0f)
-			{
-				// com_dropsim->value percent of incoming packets get dropped.
-				if(rand() < (int) (((double) RAND_MAX) / 100.0 * (double) net_dropsim->value))
-					continue;          // drop this packet
-			}
-
-			if(com_sv_running->integer)
-				Com_RunAndTimeServerPacket(&from, &netmsg, sockid);
-			else
-				CL_PacketEvent(from, &netmsg);
-		}
+			NET_DispatchPacket(&from, &netmsg, sockid);
 		else
 			break;
 	}
@@ -1684,6 +2145,35 @@ void NET_Sleep(int msec)
 	if(msec < 0)
 		msec = 0;
 
+#ifdef USE_NET_BATCH
+	if(net_batching)
+	{
+		struct epoll_event events[MAX_IP_SOCKETS + 1];
+
+		// anything queued since the last frame goes out before we block
+		Sys_FlushPackets();
+
+		retval = epoll_wait(net_epollFd, events, ARRAY_LEN(events), msec);
+
+		if(retval == SOCKET_ERROR)
+		{
+			if(socketError != EINTR)
+				Com_Printf("Warning: epoll_wait() syscall failed: %s\n", NET_ErrorString());
+		}
+		else if(retval > 0)
+		{
+			FD_ZERO(&fdr);
+
+			for(i = 0; i < retval; i++)
+				FD_SET(events[i].data.fd, &fdr);
+
+			NET_Event(&fdr);
+		}
+
+		return;
+	}
+#endif
+
 	FD_ZERO(&fdr);
 
 	for(i = 0; i < MAX_IP_SOCKETS; i++)
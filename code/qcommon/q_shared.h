@@ -1010,6 +1010,18 @@ typedef struct {
 	int			entityNum;	// entity the contacted sirface is a part of
 } trace_t;
 
+// one entry of a batched trace syscall, the result goes to the trace_t
+// with the same index
+typedef struct {
+	vec3_t		start;
+	vec3_t		mins;
+	vec3_t		maxs;
+	vec3_t		end;
+	int			passEntityNum;	// ignored by the cgame, which only traces a model
+	int			contentmask;
+	int			capsule;
+} traceRequest_t;
+
 // trace->entityNum can also be 0 to (MAX_GENTITIES-1)
 // or ENTITYNUM_NONE, ENTITYNUM_WORLD
 
@@ -67,6 +67,7 @@ struct entityState_s;
 struct playerState_s;
 
 void MSG_WriteBits( msg_t *msg, int value, int bits );
+void MSG_WriteEncodedBits( msg_t *msg, const byte *data, int bits );
 
 void MSG_WriteChar (msg_t *sb, int c);
 void MSG_WriteByte (msg_t *sb, int c);
@@ -111,6 +112,7 @@ void MSG_ReadDeltaPlayerstate( msg_t *msg, struct playerState_s *from, struct pl
 
 
 void MSG_ReportChangeVectors_f( void );
+void MSG_HuffBench_f( void );
 
 //============================================================================
 
@@ -377,6 +379,7 @@ void	VM_Clear(void);
 void	VM_Forced_Unload_Start(void);
 void	VM_Forced_Unload_Done(void);
 vm_t	*VM_Restart(vm_t *vm, qboolean unpure);
+vmInterpret_t	VM_Backend( vm_t *vm );
 
 intptr_t		QDECL VM_Call( vm_t *vm, int callNum, ... );
 
@@ -384,6 +387,7 @@ void	VM_Debug( int level );
 
 void	*VM_ArgPtr( intptr_t intValue );
 void	*VM_ExplicitArgPtr( vm_t *vm, intptr_t intValue );
+void	*VM_ArgArray( intptr_t intValue, int size, int count );
 
 #define	VMA(x) VM_ArgPtr(args[x])
 static ID_INLINE float _vmf(intptr_t x)
@@ -690,6 +694,34 @@ void	FS_ForceFlush( fileHandle_t f );
 void	FS_FreeFile( void *buffer );
 // frees the memory returned by FS_ReadFile
 
+long	FS_MapFile( const char *qpath, void **buffer );
+// maps a loose file or stored pk3 entry read only without copying it,
+// -1 length == not present or can't be mapped, no 0 is appended
+
+void	FS_UnmapFile( void *buffer, long length );
+// releases a mapping returned by FS_MapFile
+
+typedef void (*fsReadCallback_t)( const char *qpath, void *buffer, long length, void *data );
+
+int		FS_ReadFileAsync( const char *qpath, fsReadCallback_t callback, void *data );
+// queues a read of a whole file on the read threads and returns a request number,
+// or 0 if the file isn't present.  The callback gets the buffer FS_ReadFile would
+// have returned, to be freed with FS_FreeFile, on the main thread from
+// FS_CompleteReads or FS_WaitForRead
+
+void	FS_WaitForRead( int request );
+// finishes a read queued with FS_ReadFileAsync and runs its callback
+
+void	FS_CompleteReads( void );
+// runs the callbacks of all finished reads, called every frame
+
+void	FS_PrefetchFile( const char *qpath );
+// hints that a file is going to be read soon, so a read thread can bring its data
+// into memory first
+
+void	FS_CancelReads( void );
+// drops all queued reads and prefetches without running their callbacks
+
 void	FS_WriteFile( const char *qpath, const void *buffer, int size );
 // writes a complete file, creating any subdirectories needed
 
@@ -1122,6 +1154,8 @@ void	Sys_Print( const char *msg );
 // Sys_Milliseconds should only be used for profiling purposes,
 // any game related timing information should come from event timestamps
 int		Sys_Milliseconds (void);
+// wraps every ~71 minutes, only differences are meaningful
+unsigned int	Sys_Microseconds (void);
 
 void	Sys_SnapVector( float *v );
 
@@ -1135,6 +1169,7 @@ cpuFeatures_t Sys_GetProcessorFeatures( void );
 void	Sys_SetErrorText( const char *text );
 
 void	Sys_SendPacket( int length, const void *data, netadr_t to, int sockid );
+void	Sys_FlushPackets( void );
 
 qboolean	Sys_StringToAdr( const char *s, netadr_t *a, netadrtype_t family );
 //Does NOT parse port numbers, only base addresses.
@@ -1144,6 +1179,9 @@ void		Sys_ShowIP(void);
 
 qboolean Sys_Mkdir( const char *path );
 FILE	*Sys_Mkfifo( const char *ospath );
+int		Sys_FileTime( char *path );	// modification time, -1 if not present
+void	*Sys_MapFile( const char *ospath, long offset, long length );
+void	Sys_UnmapFile( void *buffer, long length );
 char	*Sys_Cwd( void );
 void	Sys_SetDefaultInstallPath(const char *path);
 char	*Sys_DefaultInstallPath(void);
@@ -1187,6 +1225,37 @@ dialogResult_t Sys_Dialog( dialogType_t type, const char *message, const char *t
 
 qboolean Sys_WritePIDFile( void );
 
+// worker threads for independent per-frame work items
+typedef void (*sysJobFunc_t)( void *data, int index );
+
+int		Sys_SetJobWorkers( int count );
+int		Sys_JobWorkers( void );
+void	Sys_RunJobs( sysJobFunc_t func, void *data, int count );
+
+// statistics the jobs bump, either one copy per thread or a locked add
+#ifdef _MSC_VER
+#include <intrin.h>
+#define Q_THREADLOCAL			__declspec( thread )
+#define Q_AtomicIncrement( p )	_InterlockedIncrement( (volatile long *)(p) )
+#else
+#define Q_THREADLOCAL			__thread
+#define Q_AtomicIncrement( p )	__sync_add_and_fetch( (p), 1 )
+#endif
+
+void	*Sys_CreateMutex( void );
+void	Sys_DestroyMutex( void *mutex );
+void	Sys_LockMutex( void *mutex );
+void	Sys_UnlockMutex( void *mutex );
+
+// long running threads, func gets data and index
+void	*Sys_CreateThread( sysJobFunc_t func, void *data, int index );
+void	Sys_JoinThread( void *thread );
+
+void	*Sys_CreateSemaphore( void );
+void	Sys_DestroySemaphore( void *sem );
+void	Sys_PostSemaphore( void *sem );
+void	Sys_WaitSemaphore( void *sem );
+
 /* This is based on the Adaptive Huffman algorithm described in Sayood's Data
  * Compression book.  The ranks are not actually stored, but implicitly defined
  * by the location of a node within a doubly-linked list */
@@ -1223,6 +1292,17 @@ typedef struct {
 	huff_t		decompressor;
 } huffman_t;
 
+// lookup tables for a tree that no longer changes
+#define HUFF_LOOKUP_BITS	11
+
+typedef struct {
+	qboolean		valid;
+	unsigned int	code[HMAX];		// transmitted bits, the first one lowest
+	byte			codeLength[HMAX];
+	short			symbol[1<<HUFF_LOOKUP_BITS];		// indexed by the next HUFF_LOOKUP_BITS bits
+	byte			symbolLength[1<<HUFF_LOOKUP_BITS];	// 0 if the code is longer than that
+} huffTable_t;
+
 void	Huff_Compress(msg_t *buf, int offset);
 void	Huff_Decompress(msg_t *buf, int offset);
 void	Huff_Init(huffman_t *huff);
@@ -1233,6 +1313,9 @@ void	Huff_offsetReceive (node_t *node, int *ch, byte *fin, int *offset);
 void	Huff_offsetTransmit (huff_t *huff, int ch, byte *fout, int *offset);
 void	Huff_putBit( int bit, byte *fout, int *offset);
 int		Huff_getBit( byte *fout, int *offset);
+qboolean	Huff_BuildTable( huffman_t *huff, huffTable_t *table );
+void	Huff_tableTransmit( const huffTable_t *table, int ch, byte *fout, int *offset );
+void	Huff_tableReceive( const huffTable_t *table, node_t *tree, int *ch, byte *fin, int *offset );
 
 // don't use if you don't know what you're doing.
 int		Huff_getBloc(void);
@@ -1587,6 +1587,37 @@ extern uLong ZEXPORT unzGetOffset (file)
     return s->pos_in_central_dir;
 }
 
+/* Get the position of the current file's data in the zipfile, before any
+   of it has been read.  Only meaningful for stored files. */
+extern uLong ZEXPORT unzGetCurrentFileZStreamPos (file)
+    unzFile file;
+{
+    unz_s* s;
+    file_in_zip_read_info_s* pfile_in_zip_read_info;
+
+    if (file==NULL)
+        return 0;
+    s=(unz_s*)file;
+    pfile_in_zip_read_info=s->pfile_in_zip_read;
+    if (pfile_in_zip_read_info==NULL)
+        return 0;
+    return pfile_in_zip_read_info->pos_in_zipfile +
+           pfile_in_zip_read_info->byte_before_the_zipfile;
+}
+
+/* Get the number of bytes in front of the zip data, nonzero for sfx files.
+   Offsets stored in the zip are relative to it. */
+extern uLong ZEXPORT unzGetZipStart (file)
+    unzFile file;
+{
+    unz_s* s;
+
+    if (file==NULL)
+        return 0;
+    s=(unz_s*)file;
+    return s->byte_before_the_zipfile;
+}
+
 extern int ZEXPORT unzSetOffset (file, pos)
         unzFile file;
         uLong pos;
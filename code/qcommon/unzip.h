@@ -346,6 +346,13 @@ extern uLong ZEXPORT unzGetOffset (unzFile file);
 /* Set the current file offset */
 extern int ZEXPORT unzSetOffset (unzFile file, uLong pos);
 
+/* Get the offset of the opened file's data in the zipfile */
+extern uLong ZEXPORT unzGetCurrentFileZStreamPos (unzFile file);
+
+/* Get the number of bytes in front of the zip data, offsets in the zip are
+   relative to it */
+extern uLong ZEXPORT unzGetZipStart (unzFile file);
+
 
 
 #ifdef __cplusplus
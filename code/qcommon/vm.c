@@ -33,22 +33,55 @@ and one exported function: Perform
 
 */
 
+#ifdef __linux__
+#	define _GNU_SOURCE	// REG_RIP, REG_EIP
+#endif
+
 #include "vm_local.h"
 
+#ifdef __linux__
+#	include <unistd.h>
+#	if defined(__x86_64__) || defined(__i386__)
+#		define VM_SAMPLING
+#		include <signal.h>
+#		include <sys/time.h>
+#		include <ucontext.h>
+#	endif
+#	ifdef __x86_64__
+#		define VM_GUARD_PAGES
+#		include <sys/mman.h>
+#	endif
+#endif
+
 
 vm_t	*currentVM = NULL;
 vm_t	*lastVM    = NULL;
 int		vm_debugLevel;
 
+static cvar_t	*vm_perfMap;
+static cvar_t	*vm_guardPages;
+
 // used by Com_Error to get rid of running vm's before longjmp
 static int forced_unload;
 
 #define	MAX_VM		3
 vm_t	vmTable[MAX_VM];
 
+// syscall numbers above this share the last vmstats slot
+#define	MAX_VM_SYSCALLS		1024
+
+typedef struct {
+	int			count;
+	int64_t		usec;
+} vmSyscallStat_t;
+
+static qboolean			vmStatsRunning;
+static vmSyscallStat_t	vmSyscallStats[MAX_VM][MAX_VM_SYSCALLS];
+
 
 void VM_VmInfo_f( void );
 void VM_VmProfile_f( void );
+void VM_VmStats_f( void );
 
 
 
@@ -73,9 +106,17 @@ void VM_Init( void ) {
 	Cvar_Get( "vm_cgame", "2", CVAR_ARCHIVE );	// !@# SHIP WITH SET TO 2
 	Cvar_Get( "vm_game", "2", CVAR_ARCHIVE );	// !@# SHIP WITH SET TO 2
 	Cvar_Get( "vm_ui", "2", CVAR_ARCHIVE );		// !@# SHIP WITH SET TO 2
+	Cvar_Get( "vm_jitOptimize", "1", CVAR_ARCHIVE );	// register caching in the x86_64 compiler
+	Cvar_Get( "vm_optimize", "1", CVAR_ARCHIVE );		// bytecode optimizer for all backends
+	Cvar_Get( "vm_threaded", "1", CVAR_ARCHIVE );		// direct threaded dispatch in the interpreter
+	vm_perfMap = Cvar_Get( "vm_perfMap", "0", 0 );		// tell perf where compiled functions are
+	Cvar_Get( "vm_inlineSyscalls", "1", CVAR_ARCHIVE );	// compile sqrt and memory traps inline
+	Cvar_Get( "vm_codeCache", "1", CVAR_ARCHIVE );		// reuse compiled code, 2 also keeps it on disk
+	vm_guardPages = Cvar_Get( "vm_guardPages", "0", CVAR_ARCHIVE );	// fault on bad accesses instead of masking them
 
 	Cmd_AddCommand ("vmprofile", VM_VmProfile_f );
 	Cmd_AddCommand ("vminfo", VM_VmInfo_f );
+	Cmd_AddCommand ("vmstats", VM_VmStats_f );
 
 	Com_Memset( vmTable, 0, sizeof( vmTable ) );
 }
@@ -230,9 +271,10 @@ void VM_LoadSymbols( vm_t *vm ) {
 	int		chars;
 	int		segment;
 	int		numInstructions;
+	intptr_t	ptr;
 
 	// don't load symbols if not developer
-	if ( !com_developer->integer ) {
+	if ( !com_developer->integer && !vm_perfMap->integer ) {
 		return;
 	}
 
@@ -275,18 +317,27 @@ void VM_LoadSymbols( vm_t *vm ) {
 			Com_Printf( "WARNING: incomplete line at end of file\n" );
 			break;
 		}
+
+		// syscall stubs and the stack markers don't name an instruction,
+		// they would only get in the way of the address lookups
+		if ( value < 0 || value >= numInstructions ) {
+			continue;
+		}
+
 		chars = strlen( token );
 		sym = Hunk_Alloc( sizeof( *sym ) + chars, h_high );
 		*prev = sym;
 		prev = &sym->next;
 		sym->next = NULL;
 
-		// convert value from an instruction number to a code offset
-		if ( value >= 0 && value < numInstructions ) {
-			value = vm->instructionPointers[value];
+		// convert value from an instruction number to a code offset,
+		// some compilers keep absolute addresses in instructionPointers
+		ptr = vm->instructionPointers[value];
+		if ( vm->compiled && ptr >= (intptr_t) vm->codeBase ) {
+			ptr -= (intptr_t) vm->codeBase;
 		}
 
-		sym->symValue = value;
+		sym->symValue = ptr;
 		Q_strncpyz( sym->symName, token, chars + 1 );
 
 		count++;
@@ -297,6 +348,64 @@ void VM_LoadSymbols( vm_t *vm ) {
 	FS_FreeFile( mapfile.v );
 }
 
+/*
+===============
+VM_WritePerfMap
+
+Writes the compiled functions of the loaded vms to /tmp/perf-<pid>.map,
+where Linux perf looks up symbols for code that doesn't come from an ELF
+file.  Without a .map file the whole code block gets the name of the vm.
+The file is rewritten each time a compiled vm is loaded, so the ranges of
+vms freed since don't overlap the code that reuses their memory, and it
+is left alone on shutdown for perf report to read.
+===============
+*/
+static void VM_WritePerfMap( void ) {
+#ifdef __linux__
+	char		filename[MAX_OSPATH];
+	FILE		*f;
+	vm_t		*vm;
+	vmSymbol_t	*sym;
+	int			i, end, count;
+
+	if ( !vm_perfMap->integer ) {
+		return;
+	}
+
+	Com_sprintf( filename, sizeof( filename ), "/tmp/perf-%d.map", (int) getpid() );
+	f = fopen( filename, "w" );
+	if ( !f ) {
+		Com_Printf( "Couldn't open %s\n", filename );
+		return;
+	}
+
+	count = 0;
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		vm = &vmTable[i];
+		if ( !vm->compiled ) {
+			continue;
+		}
+
+		if ( !vm->symbols ) {
+			fprintf( f, "%lx %x %s.qvm\n", (unsigned long) vm->codeBase, vm->codeLength, vm->name );
+		}
+
+		for ( sym = vm->symbols ; sym ; sym = sym->next ) {
+			end = sym->next ? sym->next->symValue : vm->codeLength;
+			if ( end <= sym->symValue ) {
+				continue;
+			}
+			fprintf( f, "%lx %x %s:%s\n", (unsigned long) ( vm->codeBase + sym->symValue ),
+				end - sym->symValue, vm->name, sym->symName );
+		}
+		count += vm->numSymbols;
+	}
+
+	fclose( f );
+	Com_DPrintf( "Wrote %i symbols to %s\n", count, filename );
+#endif
+}
+
 /*
 ============
 VM_DllSyscall
@@ -356,6 +465,107 @@ intptr_t QDECL VM_DllSyscall( intptr_t arg, ... ) {
 }
 
 
+#ifdef VM_GUARD_PAGES
+/*
+==============================================================================
+
+GUARD PAGES
+
+Compiled x86_64 code addresses vm memory as dataBase plus a 32 bit offset.
+When dataBase starts a 4 GiB reservation that is inaccessible past the real
+data, no offset can get out of the vm, so the compiler can leave out the
+per access address masks.  A bad access faults instead, and the SIGSEGV
+handler turns that into the usual drop error.
+
+==============================================================================
+*/
+
+// any 32 bit offset plus the widest access stays inside the reservation
+#define VM_GUARD_SIZE	( ( 1ULL << 32 ) + 0x10000 )
+
+static qboolean			vmGuardHandler;
+static struct sigaction	vmOldSegv;
+
+/*
+=================
+VM_GuardViolation
+
+Entered from a faulting data access in compiled code, see VM_GuardSignal
+=================
+*/
+static void VM_GuardViolation( void ) {
+	Com_Error( ERR_DROP, "Program tried to access memory outside VM" );
+}
+
+/*
+=================
+VM_GuardSignal
+=================
+*/
+static void VM_GuardSignal( int signum, siginfo_t *info, void *context ) {
+	ucontext_t	*uc = context;
+	byte		*addr = info->si_addr;
+	byte		*pc = (byte *) uc->uc_mcontext.gregs[REG_RIP];
+	greg_t		sp;
+	vm_t		*vm;
+	int			i;
+
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		vm = &vmTable[i];
+		if ( vm->dataGuarded && vm->compiled
+			&& addr >= vm->dataBase && addr < vm->dataBase + VM_GUARD_SIZE
+			&& pc >= vm->codeBase && pc < vm->codeBase + vm->codeLength ) {
+			// don't longjmp out of the handler, make it look like the
+			// faulting instruction called VM_GuardViolation instead
+			sp = ( uc->uc_mcontext.gregs[REG_RSP] & ~15 ) - 8;
+			*(greg_t *) sp = (greg_t) pc;
+			uc->uc_mcontext.gregs[REG_RSP] = sp;
+			uc->uc_mcontext.gregs[REG_RIP] = (greg_t) VM_GuardViolation;
+			return;
+		}
+	}
+
+	// not ours, hand it to the previous handler
+	sigaction( SIGSEGV, &vmOldSegv, NULL );
+	vmGuardHandler = qfalse;
+	raise( SIGSEGV );
+}
+
+/*
+=================
+VM_AllocGuarded
+
+Reserves the guard region and makes the first length bytes usable,
+returns NULL if the address space isn't available
+=================
+*/
+static byte *VM_AllocGuarded( int length ) {
+	struct sigaction	sa;
+	void				*base;
+
+	base = mmap( NULL, VM_GUARD_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+	if ( base == MAP_FAILED ) {
+		return NULL;
+	}
+	if ( mprotect( base, length, PROT_READ | PROT_WRITE ) ) {
+		munmap( base, VM_GUARD_SIZE );
+		return NULL;
+	}
+
+	if ( !vmGuardHandler ) {
+		Com_Memset( &sa, 0, sizeof( sa ) );
+		sa.sa_sigaction = VM_GuardSignal;
+		sa.sa_flags = SA_SIGINFO;
+		sigemptyset( &sa.sa_mask );
+		sigaction( SIGSEGV, &sa, &vmOldSegv );
+		vmGuardHandler = qtrue;
+	}
+
+	return base;
+}
+#endif
+
+
 /*
 =================
 VM_LoadQVM
@@ -451,7 +661,16 @@ vmHeader_t *VM_LoadQVM( vm_t *vm, qboolean alloc, qboolean unpure)
 	if(alloc)
 	{
 		// allocate zero filled space for initialized and uninitialized data
-		vm->dataBase = Hunk_Alloc(dataLength, h_high);
+		vm->dataBase = NULL;
+#ifdef VM_GUARD_PAGES
+		if(vm->dataGuarded)
+		{
+			vm->dataBase = VM_AllocGuarded(dataLength);
+			vm->dataGuarded = (vm->dataBase != NULL);
+		}
+#endif
+		if(!vm->dataBase)
+			vm->dataBase = Hunk_Alloc(dataLength, h_high);
 		vm->dataMask = dataLength - 1;
 	}
 	else
@@ -539,7 +758,7 @@ vm_t *VM_Restart(vm_t *vm, qboolean unpure)
 		char	name[MAX_QPATH];
 		intptr_t	(*systemCall)( intptr_t *parms );
 		
-		systemCall = vm->systemCall;	
+		systemCall = vm->moduleSystemCall;
 		Q_strncpyz( name, vm->name, sizeof( name ) );
 
 		VM_Free( vm );
@@ -563,6 +782,55 @@ vm_t *VM_Restart(vm_t *vm, qboolean unpure)
 	return vm;
 }
 
+/*
+================
+VM_Backend
+
+How the module actually ended up being run, VM_Create falls back
+to the next option when a dll or the compiler isn't available
+================
+*/
+vmInterpret_t VM_Backend( vm_t *vm ) {
+	if ( vm->dllHandle ) {
+		return VMI_NATIVE;
+	}
+
+	return vm->compiled ? VMI_COMPILED : VMI_BYTECODE;
+}
+
+/*
+=================
+VM_CountSyscall
+
+Stands in for the module's syscall handler while vmstats is running
+=================
+*/
+static intptr_t VM_CountSyscall( intptr_t *args ) {
+	vm_t			*vm = currentVM;
+	vmSyscallStat_t	*stat;
+	unsigned int	start;
+	intptr_t		r;
+
+	if ( args[0] >= 0 && args[0] < MAX_VM_SYSCALLS ) {
+		stat = &vmSyscallStats[vm - vmTable][args[0]];
+	} else {
+		stat = &vmSyscallStats[vm - vmTable][MAX_VM_SYSCALLS - 1];
+	}
+
+	start = Sys_Microseconds();
+	r = vm->moduleSystemCall( args );
+	stat->usec += Sys_Microseconds() - start;
+	stat->count++;
+
+	return r;
+}
+
+static void VM_SetSystemCall( vm_t *vm, intptr_t (*systemCalls)(intptr_t *) ) {
+	vm->moduleSystemCall = systemCalls;
+	vm->systemCall = vmStatsRunning ? VM_CountSyscall : systemCalls;
+	Com_Memset( vmSyscallStats[vm - vmTable], 0, sizeof( vmSyscallStats[0] ) );
+}
+
 /*
 ================
 VM_Create
@@ -620,7 +888,7 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 			
 			if(vm->dllHandle)
 			{
-				vm->systemCall = systemCalls;
+				VM_SetSystemCall( vm, systemCalls );
 				return vm;
 			}
 			
@@ -629,6 +897,9 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 		else if(retval == VMI_COMPILED)
 		{
 			vm->searchPath = startSearch;
+#ifdef VM_GUARD_PAGES
+			vm->dataGuarded = (interpret == VMI_COMPILED && vm_guardPages->integer);
+#endif
 			if((header = VM_LoadQVM(vm, qtrue, qfalse)))
 				break;
 
@@ -640,7 +911,10 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 	if(retval < 0)
 		return NULL;
 
-	vm->systemCall = systemCalls;
+	VM_SetSystemCall( vm, systemCalls );
+
+	// rewrite the bytecode before any backend sees it
+	VM_OptimizeBytecode( vm, header );
 
 	// allocate space for the jump targets, which will be filled in by the compile/prep functions
 	vm->instructionCount = header->instructionCount;
@@ -674,6 +948,9 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 
 	// load the map file
 	VM_LoadSymbols( vm );
+	if ( vm->compiled ) {
+		VM_WritePerfMap();
+	}
 
 	// the stack is implicitly at the end of the image
 	vm->programStack = vm->dataMask + 1;
@@ -707,6 +984,12 @@ void VM_Free( vm_t *vm ) {
 	if(vm->destroy)
 		vm->destroy(vm);
 
+#ifdef VM_GUARD_PAGES
+	if ( vm->dataGuarded && vm->dataBase ) {
+		munmap( vm->dataBase, VM_GUARD_SIZE );
+	}
+#endif
+
 	if ( vm->dllHandle ) {
 		Sys_UnloadDll( vm->dllHandle );
 		Com_Memset( vm, 0, sizeof( *vm ) );
@@ -759,6 +1042,41 @@ void *VM_ArgPtr( intptr_t intValue ) {
 	}
 }
 
+/*
+============
+VM_ArgArray
+
+Like VM_ArgPtr, for an argument that points at count elements of
+size bytes each.  Masking only keeps the first byte inside the data
+segment, so the whole block is range checked for interpreted and
+compiled VMs.
+============
+*/
+void *VM_ArgArray( intptr_t intValue, int size, int count ) {
+	intptr_t	length;
+
+	if ( count < 0 || size <= 0 || ( count && size > INT_MAX / count ) ) {
+		Com_Error( ERR_DROP, "VM_ArgArray: bad array size" );
+	}
+	if ( !count ) {
+		return NULL;
+	}
+	if ( currentVM == NULL ) {
+		return NULL;
+	}
+	if ( currentVM->entryPoint ) {
+		return (void *)(currentVM->dataBase + intValue);
+	}
+
+	length = (intptr_t)size * count;
+	if ( ( intValue & currentVM->dataMask ) != intValue
+		|| intValue + length - 1 > currentVM->dataMask ) {
+		Com_Error( ERR_DROP, "VM_ArgArray: array out of range" );
+	}
+
+	return (void *)(currentVM->dataBase + intValue);
+}
+
 void *VM_ExplicitArgPtr( vm_t *vm, intptr_t intValue ) {
 	if ( !intValue ) {
 		return NULL;
@@ -887,10 +1205,82 @@ static int QDECL VM_ProfileSort( const void *a, const void *b ) {
 	return 0;
 }
 
+#ifdef VM_SAMPLING
+/*
+==============
+VM_ProfileSignal
+
+SIGPROF handler for the sampling profiler. Samples that land in compiled
+code are charged to the function around the interrupted instruction,
+everything else to the vm that is currently running, if any.
+==============
+*/
+static void VM_ProfileSignal( int signum, siginfo_t *info, void *context ) {
+	ucontext_t	*uc = context;
+	byte		*pc;
+	vm_t		*vm;
+	int			i;
+
+#ifdef __x86_64__
+	pc = (byte *) uc->uc_mcontext.gregs[REG_RIP];
+#else
+	pc = (byte *) uc->uc_mcontext.gregs[REG_EIP];
+#endif
+
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		vm = &vmTable[i];
+		if ( vm->compiled && pc >= vm->codeBase && pc < vm->codeBase + vm->codeLength ) {
+			VM_ValueToFunctionSymbol( vm, pc - vm->codeBase )->profileCount++;
+			return;
+		}
+	}
+
+	if ( currentVM ) {
+		currentVM->profileOther++;
+	}
+}
+
+/*
+==============
+VM_ProfileSampling
+
+Starts or stops the SIGPROF timer, rate is in samples per second of cpu time
+==============
+*/
+static void VM_ProfileSampling( int rate ) {
+	struct sigaction	sa;
+	struct itimerval	timer;
+	int					i;
+
+	Com_Memset( &timer, 0, sizeof( timer ) );
+	if ( rate > 0 ) {
+		Com_Memset( &sa, 0, sizeof( sa ) );
+		sa.sa_sigaction = VM_ProfileSignal;
+		sa.sa_flags = SA_SIGINFO | SA_RESTART;
+		sigemptyset( &sa.sa_mask );
+		sigaction( SIGPROF, &sa, NULL );
+
+		timer.it_interval.tv_usec = 1000000 / rate;
+		timer.it_value = timer.it_interval;
+
+		for ( i = 0 ; i < MAX_VM ; i++ ) {
+			if ( vmTable[i].compiled && !vmTable[i].symbols ) {
+				Com_Printf( "%s has no symbols, set developer or vm_perfMap before loading it\n",
+					vmTable[i].name );
+			}
+		}
+		Com_Printf( "Sampling compiled vms %i times per second\n", rate );
+	}
+	setitimer( ITIMER_PROF, &timer, NULL );
+}
+#endif
+
 /*
 ==============
 VM_VmProfile_f
 
+vmprofile start [rate] / stop controls the sampling profiler for compiled
+vms, without arguments the counts of the last vm are printed and cleared
 ==============
 */
 void VM_VmProfile_f( void ) {
@@ -899,6 +1289,21 @@ void VM_VmProfile_f( void ) {
 	int			i;
 	double		total;
 
+	if ( !Q_stricmp( Cmd_Argv( 1 ), "start" ) || !Q_stricmp( Cmd_Argv( 1 ), "stop" ) ) {
+#ifdef VM_SAMPLING
+		if ( !Q_stricmp( Cmd_Argv( 1 ), "stop" ) ) {
+			VM_ProfileSampling( 0 );
+		} else if ( Cmd_Argc() > 2 ) {
+			VM_ProfileSampling( Com_Clamp( 10, 10000, atoi( Cmd_Argv( 2 ) ) ) );
+		} else {
+			VM_ProfileSampling( 1000 );
+		}
+#else
+		Com_Printf( "vmprofile sampling is not supported on this platform\n" );
+#endif
+		return;
+	}
+
 	if ( !lastVM ) {
 		return;
 	}
@@ -924,16 +1329,106 @@ void VM_VmProfile_f( void ) {
 
 		sym = sorted[i];
 
-		perc = 100 * (float) sym->profileCount / total;
+		perc = total ? 100 * (float) sym->profileCount / total : 0;
 		Com_Printf( "%2i%% %9i %s\n", perc, sym->profileCount, sym->symName );
 		sym->profileCount = 0;
 	}
 
 	Com_Printf("    %9.0f total\n", total );
+	if ( vm->profileOther ) {
+		Com_Printf("    %9i outside compiled code\n", vm->profileOther );
+		vm->profileOther = 0;
+	}
 
 	Z_Free( sorted );
 }
 
+typedef struct {
+	int			num;
+	int			count;
+	int64_t		usec;
+} vmSyscallSort_t;
+
+static int QDECL VM_SyscallSort( const void *a, const void *b ) {
+	const vmSyscallSort_t	*sa = a, *sb = b;
+
+	if ( sa->usec != sb->usec ) {
+		return sa->usec < sb->usec ? 1 : -1;
+	}
+	return sb->count - sa->count;
+}
+
+/*
+==============
+VM_VmStats_f
+
+vmstats start / stop counts and times the syscalls of every vm, without
+arguments the counts are printed and cleared. Traps that were compiled
+inline never leave the vm and don't show up.
+==============
+*/
+void VM_VmStats_f( void ) {
+	vmSyscallSort_t	sorted[MAX_VM_SYSCALLS];
+	vmSyscallStat_t	*stat;
+	vm_t			*vm;
+	int				i, j, numSorted;
+	int				count;
+	int64_t			usec;
+
+	if ( !Q_stricmp( Cmd_Argv( 1 ), "start" ) || !Q_stricmp( Cmd_Argv( 1 ), "stop" ) ) {
+		vmStatsRunning = !Q_stricmp( Cmd_Argv( 1 ), "start" );
+		for ( i = 0 ; i < MAX_VM ; i++ ) {
+			vm = &vmTable[i];
+			if ( vm->name[0] ) {
+				vm->systemCall = vmStatsRunning ? VM_CountSyscall : vm->moduleSystemCall;
+			}
+		}
+		return;
+	}
+
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		vm = &vmTable[i];
+		if ( !vm->name[0] ) {
+			continue;
+		}
+
+		numSorted = 0;
+		count = 0;
+		usec = 0;
+		for ( j = 0 ; j < MAX_VM_SYSCALLS ; j++ ) {
+			stat = &vmSyscallStats[i][j];
+			if ( !stat->count ) {
+				continue;
+			}
+			sorted[numSorted].num = j;
+			sorted[numSorted].count = stat->count;
+			sorted[numSorted].usec = stat->usec;
+			numSorted++;
+			count += stat->count;
+			usec += stat->usec;
+		}
+
+		Com_Printf( "%s: %i syscalls, %i usec\n", vm->name, count, (int) usec );
+		if ( !numSorted ) {
+			continue;
+		}
+
+		qsort( sorted, numSorted, sizeof( sorted[0] ), VM_SyscallSort );
+
+		Com_Printf( "  num     calls      usec  usec/call\n" );
+		for ( j = 0 ; j < numSorted ; j++ ) {
+			Com_Printf( "%5i %9i %9i %10.3f\n", sorted[j].num, sorted[j].count,
+				(int) sorted[j].usec, (float) sorted[j].usec / sorted[j].count );
+		}
+
+		Com_Memset( vmSyscallStats[i], 0, sizeof( vmSyscallStats[i] ) );
+	}
+
+	if ( !vmStatsRunning ) {
+		Com_Printf( "use vmstats start to count syscalls\n" );
+	}
+}
+
 /*
 ==============
 VM_VmInfo_f
@@ -0,0 +1,496 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// vm_cache.c -- reuse compiled code when the same qvm is loaded again
+
+#include "vm_local.h"
+
+/*
+===============================================================================
+
+COMPILED CODE CACHE
+
+Every map change frees the game vm and compiles the same qvm again, and the
+client does the same for cgame.  Once a backend has put its code in place it
+calls VM_StoreCachedCode, which keeps a copy with every absolute address in
+it turned back into an offset.  The next VM_Create of the same image copies
+that into the new code buffer and relocates it instead of compiling.
+
+While compiling, the backend records a relocation for each pointer sized
+address it emits.  It says what the address points into: the code itself,
+the data segment, vm->instructionPointers, or an entry of the backend's
+import table for engine functions and variables.  Imports are looked up by
+index, so the code stays valid when the engine is loaded somewhere else.
+
+The key is a checksum of the bytecode after VM_OptimizeBytecode, the data
+size, the backend's build stamp and the options it compiled with.  With
+vm_codeCache 2 the code is also saved to <game>/vmcache/<module>.jit under
+the home path, in the same native layout it has in memory, and read back by
+later runs of the same build.
+
+===============================================================================
+*/
+
+#define	VMCACHE_IDENT		(('C'<<24)+('M'<<16)+('V'<<8)+'Q')	// little-endian "QVMC"
+#define	VMCACHE_VERSION		1
+
+#define	MAX_VMCACHE_BUILD	64
+#define	MAX_CACHED_VMS		4
+
+typedef struct {
+	int			ident;
+	int			version;
+	char		build[MAX_VMCACHE_BUILD];
+	int			checksum;			// of the bytecode the code was compiled from
+	int			dataMask;
+	int			options;
+	int			instructionCount;
+	int			codeLength;
+	int			entryOfs;
+	int			numRelocs;
+	int			dataChecksum;		// of everything after the header
+} vmCacheHeader_t;
+
+// followed by the instruction offsets, the relocations and the code
+typedef struct {
+	char			name[MAX_QPATH];
+	int				lastUsed;
+	vmCacheHeader_t	*header;
+} vmCachedCode_t;
+
+static vmCachedCode_t	vmCache[MAX_CACHED_VMS];
+static int				vmCacheSequence;
+static vmCachedCode_t	*vmCacheFound;		// set by VM_FindCachedCode for VM_LinkCachedCode
+
+// relocations of the compile in progress
+static vmReloc_t		*vmRelocs;
+static int				vmNumRelocs, vmMaxRelocs;
+static qboolean			vmRelocsFailed;
+
+/*
+=================
+VM_AddReloc
+
+The pointer sized value at ofs in the generated code is an address of type
+=================
+*/
+void VM_AddReloc( int ofs, vmRelocType_t type, int import ) {
+	vmReloc_t	*relocs;
+
+	if ( vmNumRelocs == vmMaxRelocs ) {
+		relocs = realloc( vmRelocs, ( vmMaxRelocs + 4096 ) * sizeof( *vmRelocs ) );
+		if ( !relocs ) {
+			vmRelocsFailed = qtrue;
+			return;
+		}
+		vmRelocs = relocs;
+		vmMaxRelocs += 4096;
+	}
+
+	vmRelocs[vmNumRelocs].ofs = ofs;
+	vmRelocs[vmNumRelocs].type = type;
+	vmRelocs[vmNumRelocs].import = import;
+	vmNumRelocs++;
+}
+
+int VM_NumRelocs( void ) {
+	return vmNumRelocs;
+}
+
+/*
+=================
+VM_TruncateRelocs
+
+Forgets the relocations after the first numRelocs, for backends that emit
+the same code more than once.  0 starts a new compile.
+=================
+*/
+void VM_TruncateRelocs( int numRelocs ) {
+	if ( !numRelocs ) {
+		vmRelocsFailed = qfalse;
+	}
+	if ( numRelocs < vmNumRelocs ) {
+		vmNumRelocs = numRelocs;
+	}
+}
+
+static void VM_FreeRelocs( void ) {
+	free( vmRelocs );
+	vmRelocs = NULL;
+	vmNumRelocs = vmMaxRelocs = 0;
+}
+
+/*
+=================
+VM_CacheKey
+
+Fills in the fields of a header that have to match for the code to be reused
+=================
+*/
+static void VM_CacheKey( vm_t *vm, vmHeader_t *header, const vmBackend_t *backend, vmCacheHeader_t *key ) {
+	int		sums[4];
+
+	sums[0] = Com_BlockChecksum( (byte *)header + header->codeOffset, header->codeLength );
+	sums[1] = vm->jumpTableTargets ? Com_BlockChecksum( vm->jumpTableTargets, vm->numJumpTableTargets * 4 ) : 0;
+	sums[2] = header->instructionCount;
+	sums[3] = vm->numJumpTableTargets;
+
+	Com_Memset( key, 0, sizeof( *key ) );
+	key->ident = VMCACHE_IDENT;
+	key->version = VMCACHE_VERSION;
+	Q_strncpyz( key->build, backend->build, sizeof( key->build ) );
+	key->checksum = Com_BlockChecksum( sums, sizeof( sums ) );
+	key->dataMask = vm->dataMask;
+	key->options = backend->options;
+	key->instructionCount = header->instructionCount;
+}
+
+static qboolean VM_CacheKeyMatches( const vmCacheHeader_t *cached, const vmCacheHeader_t *key ) {
+	return cached->ident == key->ident && cached->version == key->version
+		&& !strcmp( cached->build, key->build ) && cached->checksum == key->checksum
+		&& cached->dataMask == key->dataMask && cached->options == key->options
+		&& cached->instructionCount == key->instructionCount;
+}
+
+static int *VM_CachedInstructions( vmCacheHeader_t *header ) {
+	return (int *)( header + 1 );
+}
+
+static vmReloc_t *VM_CachedRelocs( vmCacheHeader_t *header ) {
+	return (vmReloc_t *)( VM_CachedInstructions( header ) + header->instructionCount );
+}
+
+static byte *VM_CachedCode( vmCacheHeader_t *header ) {
+	return (byte *)( VM_CachedRelocs( header ) + header->numRelocs );
+}
+
+static int VM_CachedLength( vmCacheHeader_t *header ) {
+	return VM_CachedCode( header ) + header->codeLength - (byte *)header;
+}
+
+/*
+=================
+VM_CheckCachedCode
+
+Returns qfalse if a cache file is damaged or doesn't fit this backend
+=================
+*/
+static qboolean VM_CheckCachedCode( vmCacheHeader_t *header, int length, const vmBackend_t *backend ) {
+	int			i;
+	int			*instructions;
+	vmReloc_t	*reloc;
+
+	if ( header->instructionCount < 0 || header->numRelocs < 0 || header->codeLength <= 0
+		|| header->instructionCount > length / 4 || header->numRelocs > length / sizeof( *reloc )
+		|| header->codeLength > length || VM_CachedLength( header ) != length ) {
+		return qfalse;
+	}
+
+	if ( header->dataChecksum != Com_BlockChecksum( header + 1, length - sizeof( *header ) ) ) {
+		return qfalse;
+	}
+
+	if ( header->entryOfs < 0 || header->entryOfs >= header->codeLength ) {
+		return qfalse;
+	}
+
+	instructions = VM_CachedInstructions( header );
+	for ( i = 0 ; i < header->instructionCount ; i++ ) {
+		if ( instructions[i] < 0 || instructions[i] >= header->codeLength ) {
+			return qfalse;
+		}
+	}
+
+	reloc = VM_CachedRelocs( header );
+	for ( i = 0 ; i < header->numRelocs ; i++, reloc++ ) {
+		if ( reloc->ofs < 0 || reloc->ofs > header->codeLength - (int)sizeof( intptr_t ) ) {
+			return qfalse;
+		}
+		if ( reloc->type < VMR_CODE || reloc->type > VMR_IMPORT ) {
+			return qfalse;
+		}
+		if ( reloc->type == VMR_IMPORT && ( reloc->import < 0 || reloc->import >= backend->numImports ) ) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+
+/*
+=================
+VM_CacheName
+
+Not va(), the module name may have come from there
+=================
+*/
+static void VM_CacheName( const char *module, char *cacheName, int size ) {
+	Com_sprintf( cacheName, size, "%s/vmcache/%s.jit", FS_GetCurrentGameDir(), module );
+}
+
+/*
+=================
+VM_CacheSlot
+
+The entry for a module, or the least recently used one
+=================
+*/
+static vmCachedCode_t *VM_CacheSlot( const char *module ) {
+	vmCachedCode_t	*slot;
+	int				i;
+
+	slot = &vmCache[0];
+	for ( i = 0 ; i < MAX_CACHED_VMS ; i++ ) {
+		if ( !Q_stricmp( vmCache[i].name, module ) ) {
+			return &vmCache[i];
+		}
+		if ( vmCache[i].lastUsed < slot->lastUsed ) {
+			slot = &vmCache[i];
+		}
+	}
+
+	return slot;
+}
+
+static void VM_SetCacheSlot( vmCachedCode_t *slot, const char *module, vmCacheHeader_t *header ) {
+	if ( slot->header != header ) {
+		free( slot->header );
+	}
+	Q_strncpyz( slot->name, module, sizeof( slot->name ) );
+	slot->header = header;
+	slot->lastUsed = ++vmCacheSequence;
+}
+
+/*
+=================
+VM_LoadCacheFile
+=================
+*/
+static vmCacheHeader_t *VM_LoadCacheFile( vm_t *vm, const vmCacheHeader_t *key, const vmBackend_t *backend ) {
+	fileHandle_t	f;
+	long			length;
+	vmCacheHeader_t	*header;
+	char			cacheName[MAX_OSPATH];
+
+	VM_CacheName( vm->name, cacheName, sizeof( cacheName ) );
+
+	length = FS_SV_FOpenFileRead( cacheName, &f );
+	if ( !f ) {
+		return NULL;
+	}
+	if ( length < sizeof( *header ) || !( header = malloc( length ) ) ) {
+		FS_FCloseFile( f );
+		return NULL;
+	}
+
+	FS_Read( header, length, f );
+	FS_FCloseFile( f );
+
+	header->build[sizeof( header->build ) - 1] = 0;
+	if ( !VM_CacheKeyMatches( header, key ) ) {
+		Com_DPrintf( "%s is stale\n", cacheName );
+		free( header );
+		return NULL;
+	}
+	if ( !VM_CheckCachedCode( header, length, backend ) ) {
+		Com_DPrintf( "%s is damaged\n", cacheName );
+		free( header );
+		return NULL;
+	}
+
+	Com_DPrintf( "Loaded %i bytes of code from %s\n", header->codeLength, cacheName );
+	return header;
+}
+
+/*
+=================
+VM_WriteCacheFile
+=================
+*/
+static void VM_WriteCacheFile( vm_t *vm, vmCacheHeader_t *header ) {
+	fileHandle_t	f;
+	char			cacheName[MAX_OSPATH];
+
+	VM_CacheName( vm->name, cacheName, sizeof( cacheName ) );
+
+	f = FS_SV_FOpenFileWrite( cacheName );
+	if ( f ) {
+		FS_Write( header, VM_CachedLength( header ), f );
+		FS_FCloseFile( f );
+		Com_DPrintf( "Wrote %i bytes of code to %s\n", header->codeLength, cacheName );
+	} else {
+		Com_DPrintf( "Couldn't write %s\n", cacheName );
+	}
+}
+
+static intptr_t VM_RelocBase( vm_t *vm, const vmBackend_t *backend, const vmReloc_t *reloc ) {
+	switch ( reloc->type ) {
+	case VMR_CODE:
+		return (intptr_t) vm->codeBase;
+	case VMR_DATA:
+		return (intptr_t) vm->dataBase;
+	case VMR_INSTRUCTIONS:
+		return (intptr_t) vm->instructionPointers;
+	default:
+		return (intptr_t) backend->imports[reloc->import];
+	}
+}
+
+/*
+=================
+VM_FindCachedCode
+
+Returns the length of cached code the backend can use instead of
+compiling, or 0.  The backend allocates that much and calls
+VM_LinkCachedCode.
+=================
+*/
+int VM_FindCachedCode( vm_t *vm, vmHeader_t *header, const vmBackend_t *backend ) {
+	vmCacheHeader_t	key, *cached;
+	vmCachedCode_t	*slot;
+
+	vmCacheFound = NULL;
+
+	if ( Cvar_VariableIntegerValue( "vm_codeCache" ) <= 0 ) {
+		return 0;
+	}
+
+	VM_CacheKey( vm, header, backend, &key );
+
+	slot = VM_CacheSlot( vm->name );
+	if ( !slot->header || Q_stricmp( slot->name, vm->name ) || !VM_CacheKeyMatches( slot->header, &key ) ) {
+		if ( Cvar_VariableIntegerValue( "vm_codeCache" ) < 2 ) {
+			return 0;
+		}
+		if ( !( cached = VM_LoadCacheFile( vm, &key, backend ) ) ) {
+			return 0;
+		}
+		VM_SetCacheSlot( slot, vm->name, cached );
+	}
+
+	slot->lastUsed = ++vmCacheSequence;
+	vmCacheFound = slot;
+
+	return slot->header->codeLength;
+}
+
+/*
+=================
+VM_LinkCachedCode
+
+Copies the code VM_FindCachedCode found to vm->codeBase, which must still
+be writable, and fixes up its addresses for this vm.  The instruction
+pointers are left as offsets, like a compile leaves them.
+=================
+*/
+void VM_LinkCachedCode( vm_t *vm, const vmBackend_t *backend ) {
+	vmCacheHeader_t	*header;
+	vmReloc_t		*reloc;
+	int				*instructions;
+	intptr_t		value;
+	int				i;
+
+	if ( !vmCacheFound ) {
+		Com_Error( ERR_DROP, "VM_LinkCachedCode: no code" );
+	}
+
+	header = vmCacheFound->header;
+	vmCacheFound = NULL;
+
+	Com_Memcpy( vm->codeBase, VM_CachedCode( header ), header->codeLength );
+	vm->codeLength = header->codeLength;
+	vm->entryOfs = header->entryOfs;
+
+	reloc = VM_CachedRelocs( header );
+	for ( i = 0 ; i < header->numRelocs ; i++, reloc++ ) {
+		Com_Memcpy( &value, vm->codeBase + reloc->ofs, sizeof( value ) );
+		value += VM_RelocBase( vm, backend, reloc );
+		Com_Memcpy( vm->codeBase + reloc->ofs, &value, sizeof( value ) );
+	}
+
+	instructions = VM_CachedInstructions( header );
+	for ( i = 0 ; i < header->instructionCount ; i++ ) {
+		vm->instructionPointers[i] = instructions[i];
+	}
+
+	Com_Printf( "VM file %s reused %i bytes of compiled code\n", vm->name, header->codeLength );
+}
+
+/*
+=================
+VM_StoreCachedCode
+
+Called once the code is in vm->codeBase with all its addresses filled in,
+while the instruction pointers are still offsets
+=================
+*/
+void VM_StoreCachedCode( vm_t *vm, vmHeader_t *header, const vmBackend_t *backend ) {
+	vmCacheHeader_t	key, *cached;
+	vmReloc_t		*reloc;
+	int				*instructions;
+	intptr_t		value;
+	int				i, length;
+
+	if ( Cvar_VariableIntegerValue( "vm_codeCache" ) <= 0 || vmRelocsFailed ) {
+		VM_FreeRelocs();
+		return;
+	}
+
+	VM_CacheKey( vm, header, backend, &key );
+	key.codeLength = vm->codeLength;
+	key.entryOfs = vm->entryOfs;
+	key.numRelocs = vmNumRelocs;
+
+	length = VM_CachedLength( &key );
+	cached = malloc( length );
+	if ( !cached ) {
+		VM_FreeRelocs();
+		return;
+	}
+
+	*cached = key;
+
+	instructions = VM_CachedInstructions( cached );
+	for ( i = 0 ; i < header->instructionCount ; i++ ) {
+		instructions[i] = vm->instructionPointers[i];
+	}
+
+	Com_Memcpy( VM_CachedRelocs( cached ), vmRelocs, vmNumRelocs * sizeof( *vmRelocs ) );
+	Com_Memcpy( VM_CachedCode( cached ), vm->codeBase, vm->codeLength );
+
+	// turn the addresses back into offsets
+	reloc = VM_CachedRelocs( cached );
+	for ( i = 0 ; i < vmNumRelocs ; i++, reloc++ ) {
+		Com_Memcpy( &value, VM_CachedCode( cached ) + reloc->ofs, sizeof( value ) );
+		value -= VM_RelocBase( vm, backend, reloc );
+		Com_Memcpy( VM_CachedCode( cached ) + reloc->ofs, &value, sizeof( value ) );
+	}
+
+	VM_FreeRelocs();
+
+	cached->dataChecksum = Com_BlockChecksum( cached + 1, length - sizeof( *cached ) );
+
+	VM_SetCacheSlot( VM_CacheSlot( vm->name ), vm->name, cached );
+
+	if ( Cvar_VariableIntegerValue( "vm_codeCache" ) >= 2 ) {
+		VM_WriteCacheFile( vm, cached );
+	}
+}
@@ -112,6 +112,14 @@ static char	*opnames[256] = {
 };
 #endif
 
+// direct threaded dispatch needs labels as values, debug builds keep
+// using the switch so they can trace every instruction
+#if defined(__GNUC__) && !defined(DEBUG_VM)
+#define VM_THREADED
+static void VM_PrepareThreaded( vm_t *vm, const int *image, int length );
+static int VM_CallThreaded( vm_t *vm, int *args );
+#endif
+
 #if idppc
 
 //FIXME: these, um... look the same to me
@@ -174,8 +182,22 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header ) {
 	byte	*code;
 	int		instruction;
 	int		*codeBase;
-
-	vm->codeBase = Hunk_Alloc( vm->codeLength*4, h_high );			// we're now int aligned
+	int		codeEnd;
+
+	vm->threaded = qfalse;
+#ifdef VM_THREADED
+	if ( Cvar_VariableIntegerValue( "vm_threaded" ) ) {
+		// only needed until it has been translated to handler addresses
+		vm->threaded = qtrue;
+		codeBase = Z_Malloc( vm->codeLength*4 + 4 );
+	} else
+#endif
+	{
+		// one cell past the end stays OP_UNDEF, instructionPointers of trailing
+		// OP_IGNOREs point there
+		vm->codeBase = Hunk_Alloc( vm->codeLength*4 + 4, h_high );			// we're now int aligned
+		codeBase = (int *)vm->codeBase;
+	}
 //	memcpy( vm->codeBase, (byte *)header + header->codeOffset, vm->codeLength );
 
 	// we don't need to translate the instructions, but we still need
@@ -183,7 +205,6 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header ) {
 	int_pc = byte_pc = 0;
 	instruction = 0;
 	code = (byte *)header + header->codeOffset;
-	codeBase = (int *)vm->codeBase;
 
 	// Copy and expand instructions to words while building instruction table
 	while ( instruction < header->instructionCount ) {
@@ -191,11 +212,17 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header ) {
 		instruction++;
 
 		op = (int)code[ byte_pc ];
-		codeBase[int_pc] = op;
 		if(byte_pc > header->codeLength)
 			Com_Error(ERR_DROP, "VM_PrepareInterpreter: pc > header->codeLength");
 
 		byte_pc++;
+
+		// left behind by VM_OptimizeBytecode, jumps here run the next instruction
+		if ( op == OP_IGNORE ) {
+			continue;
+		}
+
+		codeBase[int_pc] = op;
 		int_pc++;
 
 		// these are the only opcodes that aren't a single byte
@@ -235,14 +262,13 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header ) {
 		}
 
 	}
+	codeEnd = int_pc;
 	int_pc = 0;
-	instruction = 0;
 	
 	// Now that the code has been expanded to int-sized opcodes, we'll translate instruction index
 	//into an index into codeBase[], which contains opcodes and operands.
-	while ( instruction < header->instructionCount ) {
+	while ( int_pc < codeEnd ) {
 		op = codeBase[ int_pc ];
-		instruction++;
 		int_pc++;
 		
 		switch ( op ) {
@@ -263,7 +289,7 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header ) {
 		case OP_LEF:
 		case OP_GTF:
 		case OP_GEF:
-			if(codeBase[int_pc] < 0 || codeBase[int_pc] > vm->instructionCount)
+			if(codeBase[int_pc] < 0 || codeBase[int_pc] >= vm->instructionCount)
 				Com_Error(ERR_DROP, "VM_PrepareInterpreter: Jump to invalid instruction number");
 
 			// codeBase[pc] is the instruction index. Convert that into an offset into
@@ -287,6 +313,13 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header ) {
 		}
 
 	}
+
+#ifdef VM_THREADED
+	if ( vm->threaded ) {
+		VM_PrepareThreaded( vm, codeBase, codeEnd );
+		Z_Free( codeBase );
+	}
+#endif
 }
 
 /*
@@ -331,6 +364,12 @@ int	VM_CallInterpreted( vm_t *vm, int *args ) {
 	vmSymbol_t	*profileSymbol;
 #endif
 
+#ifdef VM_THREADED
+	if ( vm->threaded ) {
+		return VM_CallThreaded( vm, args );
+	}
+#endif
+
 	// interpret the code
 	vm->currentlyInterpreting = qtrue;
 
@@ -899,3 +938,667 @@ done:
 	// return the result
 	return opStack[opStackOfs];
 }
+
+#ifdef VM_THREADED
+/*
+===============================================================================
+
+THREADED INTERPRETER
+
+VM_PrepareThreaded turns the int image built by VM_PrepareInterpreter into
+one cell per int: opcodes become the address of their handler in
+VM_CallThreaded and operands are copied as they are.  Every instruction
+then jumps straight to the next handler instead of going through the
+switch, and the indices stay the same as in the int image so return
+addresses, symbols and VM_StackTrace don't notice.
+
+Superinstructions run a common sequence of opcodes with a single dispatch.
+Only the handler of the first opcode is replaced, the rest of the sequence
+keeps its own handlers for code that jumps into the middle of it.
+
+===============================================================================
+*/
+
+enum {
+	TOP_LOCAL_LOAD4 = OP_CVFI + 1,	// LOCAL x; LOAD4
+	TOP_CONST_ADD,					// CONST c; ADD
+	TOP_CONST_ADD_LOAD4,			// CONST c; ADD; LOAD4
+	TOP_LOCAL_CONST_STORE4,			// LOCAL x; CONST c; STORE4
+	TOP_CONST_EQ,					// CONST c; EQ ... GEF
+	TOP_CONST_GEF = TOP_CONST_EQ + OP_GEF - OP_EQ,
+	TOP_NUM_HANDLERS
+};
+
+static const void	**threadedHandlers;
+
+/*
+====================
+VM_ThreadedOpSize
+
+Cells taken by an opcode and its operand
+====================
+*/
+static int VM_ThreadedOpSize( int op ) {
+	switch ( op ) {
+	case OP_ENTER:
+	case OP_CONST:
+	case OP_LOCAL:
+	case OP_LEAVE:
+	case OP_EQ:
+	case OP_NE:
+	case OP_LTI:
+	case OP_LEI:
+	case OP_GTI:
+	case OP_GEI:
+	case OP_LTU:
+	case OP_LEU:
+	case OP_GTU:
+	case OP_GEU:
+	case OP_EQF:
+	case OP_NEF:
+	case OP_LTF:
+	case OP_LEF:
+	case OP_GTF:
+	case OP_GEF:
+	case OP_BLOCK_COPY:
+	case OP_ARG:
+		return 2;
+	default:
+		return 1;
+	}
+}
+
+/*
+====================
+VM_PrepareThreaded
+====================
+*/
+static void VM_PrepareThreaded( vm_t *vm, const int *image, int length ) {
+	intptr_t	*code;
+	int			pc, op, size, next, next2;
+
+	// fetch the label addresses
+	VM_CallThreaded( NULL, NULL );
+
+	// the extra cell is where jumps past trailing OP_IGNOREs land
+	code = Hunk_Alloc( ( length + 1 ) * sizeof( *code ), h_high );
+	// return addresses come from qvm memory, so remember where the
+	// instructions start to check them before jumping through code[]
+	vm->threadedStarts = Hunk_Alloc( ( length + 7 ) >> 3, h_high );
+	vm->threadedLength = length;
+
+	for ( pc = 0 ; pc < length ; pc += size ) {
+		op = image[pc];
+		size = VM_ThreadedOpSize( op );
+		if ( op < 0 || op > OP_CVFI || pc + size > length ) {
+			Com_Error( ERR_DROP, "VM_PrepareThreaded: bad opcode %i at %i", op, pc );
+		}
+
+		vm->threadedStarts[pc >> 3] |= 1 << ( pc & 7 );
+		code[pc] = (intptr_t)threadedHandlers[op];
+		if ( size > 1 ) {
+			code[pc + 1] = image[pc + 1];
+		}
+
+		next = pc + size < length ? image[pc + size] : -1;
+		next2 = pc + size + 1 < length ? image[pc + size + 1] : -1;
+
+		if ( op == OP_LOCAL ) {
+			if ( next == OP_LOAD4 ) {
+				code[pc] = (intptr_t)threadedHandlers[TOP_LOCAL_LOAD4];
+			} else if ( next == OP_CONST && pc + 4 < length && image[pc + 4] == OP_STORE4 ) {
+				code[pc] = (intptr_t)threadedHandlers[TOP_LOCAL_CONST_STORE4];
+			}
+		} else if ( op == OP_CONST ) {
+			if ( next == OP_ADD ) {
+				if ( next2 == OP_LOAD4 ) {
+					code[pc] = (intptr_t)threadedHandlers[TOP_CONST_ADD_LOAD4];
+				} else {
+					code[pc] = (intptr_t)threadedHandlers[TOP_CONST_ADD];
+				}
+			} else if ( next >= OP_EQ && next <= OP_GEF && pc + 3 < length ) {
+				code[pc] = (intptr_t)threadedHandlers[TOP_CONST_EQ + next - OP_EQ];
+			}
+		}
+	}
+	code[length] = (intptr_t)threadedHandlers[OP_UNDEF];
+
+	// branch targets were translated to cells, they must land on an instruction
+	for ( pc = 0 ; pc < length ; pc += size ) {
+		op = image[pc];
+		size = VM_ThreadedOpSize( op );
+		if ( op < OP_EQ || op > OP_GEF ) {
+			continue;
+		}
+		next = image[pc + 1];
+		if ( next != length && !( (unsigned)next < (unsigned)length &&
+			( vm->threadedStarts[next >> 3] & ( 1 << ( next & 7 ) ) ) ) ) {
+			Com_Error( ERR_DROP, "VM_PrepareThreaded: branch to %i at %i", next, pc );
+		}
+	}
+
+	vm->codeBase = (byte *)code;
+}
+
+#define	DISPATCH()	goto *(void *)code[programCounter++]
+
+// a return address read back from qvm memory must be an instruction start
+#define THREADED_VALID_PC(pc) \
+	( (unsigned)(pc) < (unsigned)vm->threadedLength && \
+	( vm->threadedStarts[(pc) >> 3] & ( 1 << ( (pc) & 7 ) ) ) )
+
+// compare the two values on top of the stack
+#define THREADED_BRANCH(op, type) \
+	op##_handler: \
+		opStackOfs -= 2; \
+		if ( ((type *)opStack)[(uint8_t) (opStackOfs + 1)] op##_COND ((type *)opStack)[(uint8_t) (opStackOfs + 2)] ) { \
+			programCounter = code[programCounter]; \
+		} else { \
+			programCounter += 1; \
+		} \
+		DISPATCH()
+
+// compare the top of the stack with the constant pushed just before the branch
+#define THREADED_CONST_BRANCH(op, type, member) \
+	CONST_##op##_handler: \
+		constant.i = code[programCounter]; \
+		opStackOfs--; \
+		if ( ((type *)opStack)[(uint8_t) (opStackOfs + 1)] op##_COND constant.member ) { \
+			programCounter = code[programCounter + 2]; \
+		} else { \
+			programCounter += 3; \
+		} \
+		DISPATCH()
+
+#define OP_EQ_COND		==
+#define OP_NE_COND		!=
+#define OP_LTI_COND		<
+#define OP_LEI_COND		<=
+#define OP_GTI_COND		>
+#define OP_GEI_COND		>=
+#define OP_LTU_COND		<
+#define OP_LEU_COND		<=
+#define OP_GTU_COND		>
+#define OP_GEU_COND		>=
+#define OP_EQF_COND		==
+#define OP_NEF_COND		!=
+#define OP_LTF_COND		<
+#define OP_LEF_COND		<=
+#define OP_GTF_COND		>
+#define OP_GEF_COND		>=
+
+/*
+====================
+VM_CallThreaded
+
+Same as the switch in VM_CallInterpreted, one label per opcode.
+Called with a NULL vm to publish the label addresses.
+====================
+*/
+static int VM_CallThreaded( vm_t *vm, int *args ) {
+	static const void	*handlers[TOP_NUM_HANDLERS] = {
+		[OP_UNDEF] = &&OP_UNDEF_handler,
+		[OP_IGNORE] = &&OP_UNDEF_handler,
+		[OP_BREAK] = &&OP_BREAK_handler,
+		[OP_ENTER] = &&OP_ENTER_handler,
+		[OP_LEAVE] = &&OP_LEAVE_handler,
+		[OP_CALL] = &&OP_CALL_handler,
+		[OP_PUSH] = &&OP_PUSH_handler,
+		[OP_POP] = &&OP_POP_handler,
+		[OP_CONST] = &&OP_CONST_handler,
+		[OP_LOCAL] = &&OP_LOCAL_handler,
+		[OP_JUMP] = &&OP_JUMP_handler,
+		[OP_EQ] = &&OP_EQ_handler,
+		[OP_NE] = &&OP_NE_handler,
+		[OP_LTI] = &&OP_LTI_handler,
+		[OP_LEI] = &&OP_LEI_handler,
+		[OP_GTI] = &&OP_GTI_handler,
+		[OP_GEI] = &&OP_GEI_handler,
+		[OP_LTU] = &&OP_LTU_handler,
+		[OP_LEU] = &&OP_LEU_handler,
+		[OP_GTU] = &&OP_GTU_handler,
+		[OP_GEU] = &&OP_GEU_handler,
+		[OP_EQF] = &&OP_EQF_handler,
+		[OP_NEF] = &&OP_NEF_handler,
+		[OP_LTF] = &&OP_LTF_handler,
+		[OP_LEF] = &&OP_LEF_handler,
+		[OP_GTF] = &&OP_GTF_handler,
+		[OP_GEF] = &&OP_GEF_handler,
+		[OP_LOAD1] = &&OP_LOAD1_handler,
+		[OP_LOAD2] = &&OP_LOAD2_handler,
+		[OP_LOAD4] = &&OP_LOAD4_handler,
+		[OP_STORE1] = &&OP_STORE1_handler,
+		[OP_STORE2] = &&OP_STORE2_handler,
+		[OP_STORE4] = &&OP_STORE4_handler,
+		[OP_ARG] = &&OP_ARG_handler,
+		[OP_BLOCK_COPY] = &&OP_BLOCK_COPY_handler,
+		[OP_SEX8] = &&OP_SEX8_handler,
+		[OP_SEX16] = &&OP_SEX16_handler,
+		[OP_NEGI] = &&OP_NEGI_handler,
+		[OP_ADD] = &&OP_ADD_handler,
+		[OP_SUB] = &&OP_SUB_handler,
+		[OP_DIVI] = &&OP_DIVI_handler,
+		[OP_DIVU] = &&OP_DIVU_handler,
+		[OP_MODI] = &&OP_MODI_handler,
+		[OP_MODU] = &&OP_MODU_handler,
+		[OP_MULI] = &&OP_MULI_handler,
+		[OP_MULU] = &&OP_MULU_handler,
+		[OP_BAND] = &&OP_BAND_handler,
+		[OP_BOR] = &&OP_BOR_handler,
+		[OP_BXOR] = &&OP_BXOR_handler,
+		[OP_BCOM] = &&OP_BCOM_handler,
+		[OP_LSH] = &&OP_LSH_handler,
+		[OP_RSHI] = &&OP_RSHI_handler,
+		[OP_RSHU] = &&OP_RSHU_handler,
+		[OP_NEGF] = &&OP_NEGF_handler,
+		[OP_ADDF] = &&OP_ADDF_handler,
+		[OP_SUBF] = &&OP_SUBF_handler,
+		[OP_DIVF] = &&OP_DIVF_handler,
+		[OP_MULF] = &&OP_MULF_handler,
+		[OP_CVIF] = &&OP_CVIF_handler,
+		[OP_CVFI] = &&OP_CVFI_handler,
+
+		[TOP_LOCAL_LOAD4] = &&LOCAL_LOAD4_handler,
+		[TOP_CONST_ADD] = &&CONST_ADD_handler,
+		[TOP_CONST_ADD_LOAD4] = &&CONST_ADD_LOAD4_handler,
+		[TOP_LOCAL_CONST_STORE4] = &&LOCAL_CONST_STORE4_handler,
+		[TOP_CONST_EQ + OP_EQ - OP_EQ] = &&CONST_OP_EQ_handler,
+		[TOP_CONST_EQ + OP_NE - OP_EQ] = &&CONST_OP_NE_handler,
+		[TOP_CONST_EQ + OP_LTI - OP_EQ] = &&CONST_OP_LTI_handler,
+		[TOP_CONST_EQ + OP_LEI - OP_EQ] = &&CONST_OP_LEI_handler,
+		[TOP_CONST_EQ + OP_GTI - OP_EQ] = &&CONST_OP_GTI_handler,
+		[TOP_CONST_EQ + OP_GEI - OP_EQ] = &&CONST_OP_GEI_handler,
+		[TOP_CONST_EQ + OP_LTU - OP_EQ] = &&CONST_OP_LTU_handler,
+		[TOP_CONST_EQ + OP_LEU - OP_EQ] = &&CONST_OP_LEU_handler,
+		[TOP_CONST_EQ + OP_GTU - OP_EQ] = &&CONST_OP_GTU_handler,
+		[TOP_CONST_EQ + OP_GEU - OP_EQ] = &&CONST_OP_GEU_handler,
+		[TOP_CONST_EQ + OP_EQF - OP_EQ] = &&CONST_OP_EQF_handler,
+		[TOP_CONST_EQ + OP_NEF - OP_EQ] = &&CONST_OP_NEF_handler,
+		[TOP_CONST_EQ + OP_LTF - OP_EQ] = &&CONST_OP_LTF_handler,
+		[TOP_CONST_EQ + OP_LEF - OP_EQ] = &&CONST_OP_LEF_handler,
+		[TOP_CONST_EQ + OP_GTF - OP_EQ] = &&CONST_OP_GTF_handler,
+		[TOP_CONST_EQ + OP_GEF - OP_EQ] = &&CONST_OP_GEF_handler
+	};
+	byte		stack[OPSTACK_SIZE + 15];
+	int			*opStack;
+	uint8_t		opStackOfs;
+	int			programCounter;
+	int			programStack;
+	int			stackOnEntry;
+	byte		*image;
+	intptr_t	*code;
+	int			v1, r;
+	floatint_t	constant;
+	int			dataMask;
+	int			arg;
+
+	if ( !vm ) {
+		threadedHandlers = handlers;
+		return 0;
+	}
+
+	vm->currentlyInterpreting = qtrue;
+
+	// we might be called recursively, so this might not be the very top
+	programStack = stackOnEntry = vm->programStack;
+
+	image = vm->dataBase;
+	code = (intptr_t *)vm->codeBase;
+	dataMask = vm->dataMask;
+
+	programStack -= ( 8 + 4 * MAX_VMMAIN_ARGS );
+
+	for ( arg = 0; arg < MAX_VMMAIN_ARGS; arg++ )
+		*(int *)&image[ programStack + 8 + arg * 4 ] = args[ arg ];
+
+	*(int *)&image[ programStack + 4 ] = 0;	// return stack
+	*(int *)&image[ programStack ] = -1;	// will terminate the loop on return
+
+	VM_Debug(0);
+
+	// leave a free spot at start of stack so
+	// that as long as opStack is valid, opStack-1 will
+	// not corrupt anything
+	opStack = PADP(stack, 16);
+	*opStack = 0xDEADBEEF;
+	opStackOfs = 0;
+
+	programCounter = 0;
+	DISPATCH();
+
+OP_UNDEF_handler:
+	Com_Error( ERR_DROP, "Bad VM instruction" );
+	return 0;
+
+OP_BREAK_handler:
+	vm->breakCount++;
+	DISPATCH();
+
+OP_CONST_handler:
+	opStackOfs++;
+	opStack[opStackOfs] = code[programCounter];
+	programCounter += 1;
+	DISPATCH();
+
+OP_LOCAL_handler:
+	opStackOfs++;
+	opStack[opStackOfs] = code[programCounter] + programStack;
+	programCounter += 1;
+	DISPATCH();
+
+OP_LOAD4_handler:
+	opStack[opStackOfs] = *(int *)&image[ opStack[opStackOfs] & dataMask & ~3 ];
+	DISPATCH();
+
+OP_LOAD2_handler:
+	opStack[opStackOfs] = *(unsigned short *)&image[ opStack[opStackOfs] & dataMask & ~1 ];
+	DISPATCH();
+
+OP_LOAD1_handler:
+	opStack[opStackOfs] = image[ opStack[opStackOfs] & dataMask ];
+	DISPATCH();
+
+OP_STORE4_handler:
+	*(int *)&image[ opStack[(uint8_t) (opStackOfs - 1)] & dataMask & ~3 ] = opStack[opStackOfs];
+	opStackOfs -= 2;
+	DISPATCH();
+
+OP_STORE2_handler:
+	*(short *)&image[ opStack[(uint8_t) (opStackOfs - 1)] & dataMask & ~1 ] = opStack[opStackOfs];
+	opStackOfs -= 2;
+	DISPATCH();
+
+OP_STORE1_handler:
+	image[ opStack[(uint8_t) (opStackOfs - 1)] & dataMask ] = opStack[opStackOfs];
+	opStackOfs -= 2;
+	DISPATCH();
+
+OP_ARG_handler:
+	// single byte offset from programStack
+	*(int *)&image[ (code[programCounter] + programStack) & dataMask & ~3 ] = opStack[opStackOfs];
+	opStackOfs--;
+	programCounter += 1;
+	DISPATCH();
+
+OP_BLOCK_COPY_handler:
+	VM_BlockCopy( opStack[(uint8_t) (opStackOfs - 1)], opStack[opStackOfs], code[programCounter] );
+	programCounter += 1;
+	opStackOfs -= 2;
+	DISPATCH();
+
+OP_CALL_handler:
+	// save current program counter
+	*(int *)&image[ programStack ] = programCounter;
+
+	// jump to the location on the stack
+	v1 = opStack[opStackOfs];
+	opStackOfs--;
+	if ( v1 < 0 ) {
+		// system call, save the stack to allow recursive VM entry
+		vm->programStack = programStack - 4;
+		*(int *)&image[ programStack + 4 ] = -1 - v1;
+
+		// the vm has ints on the stack, we expect
+		// pointers so we might have to convert it
+		if ( sizeof( intptr_t ) != sizeof( int ) ) {
+			intptr_t	argarr[ MAX_VMSYSCALL_ARGS ];
+			int			*imagePtr = (int *)&image[ programStack ];
+			int			i;
+
+			for ( i = 0; i < ARRAY_LEN( argarr ); ++i ) {
+				argarr[i] = *(++imagePtr);
+			}
+			r = vm->systemCall( argarr );
+		} else {
+			r = vm->systemCall( (intptr_t *)&image[ programStack + 4 ] );
+		}
+
+		// save return value
+		opStackOfs++;
+		opStack[opStackOfs] = r;
+		programCounter = *(int *)&image[ programStack ];
+		if ( !THREADED_VALID_PC( programCounter ) ) {
+			Com_Error( ERR_DROP, "VM program counter out of range in OP_CALL" );
+			return 0;
+		}
+	} else if ( (unsigned)v1 >= vm->instructionCount ) {
+		Com_Error( ERR_DROP, "VM program counter out of range in OP_CALL" );
+		return 0;
+	} else {
+		programCounter = vm->instructionPointers[ v1 ];
+	}
+	DISPATCH();
+
+// push and pop are only needed for discarded or bad function return values
+OP_PUSH_handler:
+	opStackOfs++;
+	DISPATCH();
+
+OP_POP_handler:
+	opStackOfs--;
+	DISPATCH();
+
+OP_ENTER_handler:
+	// get size of stack frame
+	programStack -= code[programCounter];
+	programCounter += 1;
+	DISPATCH();
+
+OP_LEAVE_handler:
+	// remove our stack frame
+	programStack += code[programCounter];
+
+	// grab the saved program counter
+	programCounter = *(int *)&image[ programStack ];
+
+	// check for leaving the VM
+	if ( programCounter == -1 ) {
+		goto done;
+	} else if ( !THREADED_VALID_PC( programCounter ) ) {
+		Com_Error( ERR_DROP, "VM program counter out of range in OP_LEAVE" );
+		return 0;
+	}
+	DISPATCH();
+
+OP_JUMP_handler:
+	v1 = opStack[opStackOfs];
+	if ( (unsigned)v1 >= vm->instructionCount ) {
+		Com_Error( ERR_DROP, "VM program counter out of range in OP_JUMP" );
+		return 0;
+	}
+
+	programCounter = vm->instructionPointers[ v1 ];
+	opStackOfs--;
+	DISPATCH();
+
+	THREADED_BRANCH( OP_EQ, int );
+	THREADED_BRANCH( OP_NE, int );
+	THREADED_BRANCH( OP_LTI, int );
+	THREADED_BRANCH( OP_LEI, int );
+	THREADED_BRANCH( OP_GTI, int );
+	THREADED_BRANCH( OP_GEI, int );
+	THREADED_BRANCH( OP_LTU, unsigned int );
+	THREADED_BRANCH( OP_LEU, unsigned int );
+	THREADED_BRANCH( OP_GTU, unsigned int );
+	THREADED_BRANCH( OP_GEU, unsigned int );
+	THREADED_BRANCH( OP_EQF, float );
+	THREADED_BRANCH( OP_NEF, float );
+	THREADED_BRANCH( OP_LTF, float );
+	THREADED_BRANCH( OP_LEF, float );
+	THREADED_BRANCH( OP_GTF, float );
+	THREADED_BRANCH( OP_GEF, float );
+
+OP_NEGI_handler:
+	opStack[opStackOfs] = -opStack[opStackOfs];
+	DISPATCH();
+
+OP_ADD_handler:
+	opStackOfs--;
+	opStack[opStackOfs] += opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_SUB_handler:
+	opStackOfs--;
+	opStack[opStackOfs] -= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_DIVI_handler:
+	opStackOfs--;
+	opStack[opStackOfs] /= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_DIVU_handler:
+	opStackOfs--;
+	opStack[opStackOfs] = ((unsigned) opStack[opStackOfs]) / ((unsigned) opStack[(uint8_t) (opStackOfs + 1)]);
+	DISPATCH();
+
+OP_MODI_handler:
+	opStackOfs--;
+	opStack[opStackOfs] %= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_MODU_handler:
+	opStackOfs--;
+	opStack[opStackOfs] = ((unsigned) opStack[opStackOfs]) % ((unsigned) opStack[(uint8_t) (opStackOfs + 1)]);
+	DISPATCH();
+
+OP_MULI_handler:
+	opStackOfs--;
+	opStack[opStackOfs] *= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_MULU_handler:
+	opStackOfs--;
+	opStack[opStackOfs] = ((unsigned) opStack[opStackOfs]) * ((unsigned) opStack[(uint8_t) (opStackOfs + 1)]);
+	DISPATCH();
+
+OP_BAND_handler:
+	opStackOfs--;
+	opStack[opStackOfs] &= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_BOR_handler:
+	opStackOfs--;
+	opStack[opStackOfs] |= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_BXOR_handler:
+	opStackOfs--;
+	opStack[opStackOfs] ^= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_BCOM_handler:
+	opStack[opStackOfs] = ~((unsigned) opStack[opStackOfs]);
+	DISPATCH();
+
+OP_LSH_handler:
+	opStackOfs--;
+	opStack[opStackOfs] <<= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_RSHI_handler:
+	opStackOfs--;
+	opStack[opStackOfs] >>= opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_RSHU_handler:
+	opStackOfs--;
+	opStack[opStackOfs] = ((unsigned) opStack[opStackOfs]) >> opStack[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_NEGF_handler:
+	((float *) opStack)[opStackOfs] = -((float *) opStack)[opStackOfs];
+	DISPATCH();
+
+OP_ADDF_handler:
+	opStackOfs--;
+	((float *) opStack)[opStackOfs] = ((float *) opStack)[opStackOfs] + ((float *) opStack)[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_SUBF_handler:
+	opStackOfs--;
+	((float *) opStack)[opStackOfs] = ((float *) opStack)[opStackOfs] - ((float *) opStack)[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_DIVF_handler:
+	opStackOfs--;
+	((float *) opStack)[opStackOfs] = ((float *) opStack)[opStackOfs] / ((float *) opStack)[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_MULF_handler:
+	opStackOfs--;
+	((float *) opStack)[opStackOfs] = ((float *) opStack)[opStackOfs] * ((float *) opStack)[(uint8_t) (opStackOfs + 1)];
+	DISPATCH();
+
+OP_CVIF_handler:
+	((float *) opStack)[opStackOfs] = (float) opStack[opStackOfs];
+	DISPATCH();
+
+OP_CVFI_handler:
+	opStack[opStackOfs] = Q_ftol(((float *) opStack)[opStackOfs]);
+	DISPATCH();
+
+OP_SEX8_handler:
+	opStack[opStackOfs] = (signed char) opStack[opStackOfs];
+	DISPATCH();
+
+OP_SEX16_handler:
+	opStack[opStackOfs] = (short) opStack[opStackOfs];
+	DISPATCH();
+
+	/*
+	===================================================================
+	SUPERINSTRUCTIONS
+	===================================================================
+	*/
+
+LOCAL_LOAD4_handler:
+	opStackOfs++;
+	opStack[opStackOfs] = *(int *)&image[ (code[programCounter] + programStack) & dataMask & ~3 ];
+	programCounter += 2;
+	DISPATCH();
+
+CONST_ADD_handler:
+	opStack[opStackOfs] += code[programCounter];
+	programCounter += 2;
+	DISPATCH();
+
+CONST_ADD_LOAD4_handler:
+	opStack[opStackOfs] = *(int *)&image[ (opStack[opStackOfs] + code[programCounter]) & dataMask & ~3 ];
+	programCounter += 3;
+	DISPATCH();
+
+LOCAL_CONST_STORE4_handler:
+	*(int *)&image[ (code[programCounter] + programStack) & dataMask & ~3 ] = code[programCounter + 2];
+	programCounter += 4;
+	DISPATCH();
+
+	THREADED_CONST_BRANCH( OP_EQ, int, i );
+	THREADED_CONST_BRANCH( OP_NE, int, i );
+	THREADED_CONST_BRANCH( OP_LTI, int, i );
+	THREADED_CONST_BRANCH( OP_LEI, int, i );
+	THREADED_CONST_BRANCH( OP_GTI, int, i );
+	THREADED_CONST_BRANCH( OP_GEI, int, i );
+	THREADED_CONST_BRANCH( OP_LTU, unsigned int, ui );
+	THREADED_CONST_BRANCH( OP_LEU, unsigned int, ui );
+	THREADED_CONST_BRANCH( OP_GTU, unsigned int, ui );
+	THREADED_CONST_BRANCH( OP_GEU, unsigned int, ui );
+	THREADED_CONST_BRANCH( OP_EQF, float, f );
+	THREADED_CONST_BRANCH( OP_NEF, float, f );
+	THREADED_CONST_BRANCH( OP_LTF, float, f );
+	THREADED_CONST_BRANCH( OP_LEF, float, f );
+	THREADED_CONST_BRANCH( OP_GTF, float, f );
+	THREADED_CONST_BRANCH( OP_GEF, float, f );
+
+done:
+	vm->currentlyInterpreting = qfalse;
+
+	if (opStackOfs != 1 || *opStack != 0xDEADBEEF)
+		Com_Error(ERR_DROP, "Interpreter error: opStack[0] = %X, opStackOfs = %d", opStack[0], opStackOfs);
+
+	vm->programStack = stackOnEntry;
+
+	// return the result
+	return opStack[opStackOfs];
+}
+#endif
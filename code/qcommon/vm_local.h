@@ -156,9 +156,13 @@ struct vm_s {
 	void		*dllHandle;
 	intptr_t			(QDECL *entryPoint)( int callNum, ... );
 	void (*destroy)(vm_t* self);
+	intptr_t	(*moduleSystemCall)( intptr_t *parms );	// systemCall unless vmstats is counting
 
 	// for interpreted modules
 	qboolean	currentlyInterpreting;
+	qboolean	threaded;			// codeBase holds handler addresses for VM_CallThreaded
+	byte		*threadedStarts;	// one bit per code cell, set where an instruction starts
+	int			threadedLength;		// cells in the threaded code
 
 	qboolean	compiled;
 	byte		*codeBase;
@@ -170,11 +174,13 @@ struct vm_s {
 
 	byte		*dataBase;
 	int			dataMask;
+	qboolean	dataGuarded;		// dataBase starts a 4 GiB guard region, see vm.c
 
 	int			stackBottom;		// if programStack < stackBottom, error
 
 	int			numSymbols;
 	struct vmSymbol_s	*symbols;
+	int			profileOther;		// vmprofile samples taken outside the compiled code
 
 	int			callLevel;		// counts recursive VM_Call
 	int			breakFunction;		// increment breakCount on function entry to this
@@ -194,6 +200,36 @@ int	VM_CallCompiled( vm_t *vm, int *args );
 void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header );
 int	VM_CallInterpreted( vm_t *vm, int *args );
 
+void VM_OptimizeBytecode( vm_t *vm, vmHeader_t *header );
+
+// what an absolute address in compiled code points into, see vm_cache.c
+typedef enum {
+	VMR_CODE,
+	VMR_DATA,
+	VMR_INSTRUCTIONS,		// vm->instructionPointers itself
+	VMR_IMPORT				// an entry of the backend's import table
+} vmRelocType_t;
+
+typedef struct {
+	int		ofs;
+	short	type;
+	short	import;
+} vmReloc_t;
+
+typedef struct {
+	const char	*build;			// different for every build of the backend
+	int			options;		// settings that change the generated code
+	void		**imports;		// engine functions and variables the code uses
+	int			numImports;
+} vmBackend_t;
+
+void VM_AddReloc( int ofs, vmRelocType_t type, int import );
+int VM_NumRelocs( void );
+void VM_TruncateRelocs( int numRelocs );
+int VM_FindCachedCode( vm_t *vm, vmHeader_t *header, const vmBackend_t *backend );
+void VM_LinkCachedCode( vm_t *vm, const vmBackend_t *backend );
+void VM_StoreCachedCode( vm_t *vm, vmHeader_t *header, const vmBackend_t *backend );
+
 vmSymbol_t *VM_ValueToFunctionSymbol( vm_t *vm, int value );
 int VM_SymbolToValue( vm_t *vm, const char *symbol );
 const char *VM_ValueToSymbol( vm_t *vm, int value );
@@ -0,0 +1,795 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// vm_optimize.c -- platform independent rewriting of qvm bytecode
+
+#include "vm_local.h"
+
+/*
+===============================================================================
+
+BYTECODE OPTIMIZER
+
+Runs on the loaded image before it is handed to the interpreter or one of
+the compilers, so every backend gets the benefit without any per
+architecture work.
+
+Jumps, jump tables and the symbol map all refer to instruction numbers, so
+the instruction count never changes.  Instructions that aren't needed any
+more are turned into OP_IGNORE, which the backends skip.  A sequence that is
+folded leaves its result in its last instruction, next to whatever uses it,
+and nothing after the first instruction of a sequence may be a jump target.
+
+Only VM_MAGIC_VER2 images are optimized, older ones don't say where the
+computed jumps of switch statements can land.
+
+===============================================================================
+*/
+
+typedef struct {
+	int		op;
+	int		value;
+} vmInstruction_t;
+
+static vmInstruction_t	*optCode;
+static byte				*optLeader;		// a jump or call can land here
+static int				optCount;
+
+static int	numFolded, numReduced, numLocals, numDeadStores, numJumps;
+
+/*
+=================
+VM_ArgSize
+
+Bytes of immediate data following the opcode
+=================
+*/
+static int VM_ArgSize( int op ) {
+	switch ( op ) {
+	case OP_ENTER:
+	case OP_CONST:
+	case OP_LOCAL:
+	case OP_LEAVE:
+	case OP_EQ:
+	case OP_NE:
+	case OP_LTI:
+	case OP_LEI:
+	case OP_GTI:
+	case OP_GEI:
+	case OP_LTU:
+	case OP_LEU:
+	case OP_GTU:
+	case OP_GEU:
+	case OP_EQF:
+	case OP_NEF:
+	case OP_LTF:
+	case OP_LEF:
+	case OP_GTF:
+	case OP_GEF:
+	case OP_BLOCK_COPY:
+		return 4;
+	case OP_ARG:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/*
+=================
+VM_DecodeBytecode
+
+Returns qfalse if the image is malformed, the backend will complain about it
+=================
+*/
+static qboolean VM_DecodeBytecode( vm_t *vm, vmHeader_t *header ) {
+	byte	*code;
+	int		i, pc, op, size;
+
+	code = (byte *)header + header->codeOffset;
+	pc = 0;
+
+	for ( i = 0 ; i < optCount ; i++ ) {
+		if ( pc >= header->codeLength ) {
+			return qfalse;
+		}
+
+		op = code[pc++];
+		if ( op > OP_CVFI ) {
+			return qfalse;
+		}
+
+		size = VM_ArgSize( op );
+		if ( pc + size > header->codeLength ) {
+			return qfalse;
+		}
+
+		optCode[i].op = op;
+		if ( size == 4 ) {
+			optCode[i].value = code[pc] | ( code[pc+1] << 8 ) | ( code[pc+2] << 16 ) | ( code[pc+3] << 24 );
+		} else if ( size == 1 ) {
+			optCode[i].value = code[pc];
+		} else {
+			optCode[i].value = 0;
+		}
+		pc += size;
+	}
+
+	return qtrue;
+}
+
+/*
+=================
+VM_MarkLeaders
+
+Flag every instruction that can be reached other than by falling
+through from the one before it
+=================
+*/
+static void VM_MarkLeaders( vm_t *vm ) {
+	int		i, op, target;
+
+	optLeader[0] = 1;
+
+	for ( i = 0 ; i < optCount ; i++ ) {
+		op = optCode[i].op;
+
+		if ( op == OP_ENTER ) {
+			optLeader[i] = 1;
+		} else if ( op >= OP_EQ && op <= OP_GEF ) {
+			target = optCode[i].value;
+			if ( target >= 0 && target < optCount ) {
+				optLeader[target] = 1;
+			}
+		} else if ( op == OP_CONST && i + 1 < optCount
+			&& ( optCode[i+1].op == OP_JUMP || optCode[i+1].op == OP_CALL ) ) {
+			target = optCode[i].value;
+			if ( target >= 0 && target < optCount ) {
+				optLeader[target] = 1;
+			}
+		}
+
+		// return address of a call
+		if ( op == OP_CALL && i + 1 < optCount ) {
+			optLeader[i+1] = 1;
+		}
+	}
+
+	for ( i = 0 ; i < vm->numJumpTableTargets ; i++ ) {
+		target = ((int *)vm->jumpTableTargets)[i];
+		if ( target >= 0 && target < optCount ) {
+			optLeader[target] = 1;
+		}
+	}
+}
+
+/*
+=================
+VM_PrevOp
+
+The instruction that ran before this one in the same basic block,
+skipping removed ones, or -1 if the block starts here
+=================
+*/
+static int VM_PrevOp( int i ) {
+	while ( !optLeader[i] ) {
+		i--;
+		if ( optCode[i].op != OP_IGNORE ) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/*
+=================
+VM_Remove
+=================
+*/
+static void VM_Remove( int i ) {
+	optCode[i].op = OP_IGNORE;
+	optCode[i].value = 0;
+}
+
+/*
+=================
+VM_PowerOfTwo
+
+Returns the shift count for a power of two, or -1
+=================
+*/
+static int VM_PowerOfTwo( unsigned int v ) {
+	int		shift;
+
+	if ( !v || ( v & ( v - 1 ) ) ) {
+		return -1;
+	}
+
+	for ( shift = 0 ; v > 1 ; shift++ ) {
+		v >>= 1;
+	}
+
+	return shift;
+}
+
+/*
+=================
+VM_FoldBinaryConst
+
+Evaluates an integer operation on two constants, returns qfalse if it would
+trap or its result depends on the backend
+=================
+*/
+static qboolean VM_FoldBinaryConst( int op, int a, int b, int *result ) {
+	unsigned int	ua = a, ub = b;
+
+	switch ( op ) {
+	case OP_ADD:	*result = ua + ub; return qtrue;
+	case OP_SUB:	*result = ua - ub; return qtrue;
+	case OP_MULI:
+	case OP_MULU:	*result = ua * ub; return qtrue;
+	case OP_BAND:	*result = a & b; return qtrue;
+	case OP_BOR:	*result = a | b; return qtrue;
+	case OP_BXOR:	*result = a ^ b; return qtrue;
+	case OP_DIVI:
+	case OP_MODI:
+		if ( b == 0 || ( a == INT_MIN && b == -1 ) ) {
+			return qfalse;
+		}
+		*result = ( op == OP_DIVI ) ? a / b : a % b;
+		return qtrue;
+	case OP_DIVU:
+	case OP_MODU:
+		if ( ub == 0 ) {
+			return qfalse;
+		}
+		*result = ( op == OP_DIVU ) ? ua / ub : ua % ub;
+		return qtrue;
+	case OP_LSH:
+	case OP_RSHI:
+	case OP_RSHU:
+		// the hardware decides what happens to larger counts
+		if ( ub > 31 ) {
+			return qfalse;
+		}
+		if ( op == OP_LSH ) {
+			*result = ua << b;
+		} else if ( op == OP_RSHI ) {
+			*result = a >> b;
+		} else {
+			*result = ua >> b;
+		}
+		return qtrue;
+	default:
+		return qfalse;
+	}
+}
+
+/*
+=================
+VM_FoldUnaryConst
+=================
+*/
+static qboolean VM_FoldUnaryConst( int op, int a, int *result ) {
+	floatint_t	fi;
+
+	switch ( op ) {
+	case OP_NEGI:	*result = -(unsigned int)a; return qtrue;
+	case OP_BCOM:	*result = ~a; return qtrue;
+	case OP_SEX8:	*result = (signed char)a; return qtrue;
+	case OP_SEX16:	*result = (short)a; return qtrue;
+	case OP_NEGF:	*result = a ^ 0x80000000; return qtrue;
+	case OP_CVIF:
+		fi.f = (float)a;
+		*result = fi.i;
+		return qtrue;
+	case OP_CVFI:
+		// out of range conversions differ between backends
+		fi.i = a;
+		if ( !( fi.f >= -2147483648.0f && fi.f < 2147483648.0f ) ) {
+			return qfalse;
+		}
+		*result = (int)fi.f;
+		return qtrue;
+	default:
+		return qfalse;
+	}
+}
+
+/*
+=================
+VM_OptimizeBinary
+
+Constant folding, frame address folding and strength reduction for
+an operation taking two values
+=================
+*/
+static void VM_OptimizeBinary( int i ) {
+	int		op, a, b, c, shift, result;
+
+	op = optCode[i].op;
+
+	b = VM_PrevOp( i );
+	if ( b < 0 ) {
+		return;
+	}
+	a = VM_PrevOp( b );
+
+	if ( optCode[b].op == OP_CONST ) {
+		c = optCode[b].value;
+
+		if ( a >= 0 && optCode[a].op == OP_CONST ) {
+			if ( VM_FoldBinaryConst( op, optCode[a].value, c, &result ) ) {
+				VM_Remove( a );
+				VM_Remove( b );
+				optCode[i].op = OP_CONST;
+				optCode[i].value = result;
+				numFolded++;
+			}
+			return;
+		}
+
+		// a frame address plus an offset is just another frame address
+		if ( a >= 0 && optCode[a].op == OP_LOCAL && ( op == OP_ADD || op == OP_SUB ) ) {
+			optCode[i].op = OP_LOCAL;
+			optCode[i].value = ( op == OP_ADD ) ? optCode[a].value + c : optCode[a].value - c;
+			VM_Remove( a );
+			VM_Remove( b );
+			numLocals++;
+			return;
+		}
+
+		switch ( op ) {
+		case OP_ADD:
+		case OP_SUB:
+		case OP_BOR:
+		case OP_BXOR:
+		case OP_LSH:
+		case OP_RSHI:
+		case OP_RSHU:
+			if ( c == 0 ) {
+				VM_Remove( b );
+				VM_Remove( i );
+				numReduced++;
+			}
+			break;
+		case OP_MULI:
+		case OP_MULU:
+			shift = VM_PowerOfTwo( c );
+			if ( shift == 0 ) {
+				VM_Remove( b );
+				VM_Remove( i );
+				numReduced++;
+			} else if ( shift > 0 ) {
+				optCode[b].value = shift;
+				optCode[i].op = OP_LSH;
+				numReduced++;
+			}
+			break;
+		case OP_DIVI:
+			// signed division rounds towards zero, so only x / 1 is simple
+			if ( c == 1 ) {
+				VM_Remove( b );
+				VM_Remove( i );
+				numReduced++;
+			}
+			break;
+		case OP_DIVU:
+			shift = VM_PowerOfTwo( c );
+			if ( shift == 0 ) {
+				VM_Remove( b );
+				VM_Remove( i );
+				numReduced++;
+			} else if ( shift > 0 ) {
+				optCode[b].value = shift;
+				optCode[i].op = OP_RSHU;
+				numReduced++;
+			}
+			break;
+		case OP_MODU:
+			if ( VM_PowerOfTwo( c ) > 0 ) {
+				optCode[b].value = c - 1;
+				optCode[i].op = OP_BAND;
+				numReduced++;
+			}
+			break;
+		default:
+			break;
+		}
+	} else if ( optCode[b].op == OP_LOCAL && op == OP_ADD && a >= 0 && optCode[a].op == OP_CONST ) {
+		optCode[i].op = OP_LOCAL;
+		optCode[i].value = optCode[b].value + optCode[a].value;
+		VM_Remove( a );
+		VM_Remove( b );
+		numLocals++;
+	}
+}
+
+/*
+=================
+VM_OptimizeUnary
+=================
+*/
+static void VM_OptimizeUnary( int i ) {
+	int		a, result;
+
+	a = VM_PrevOp( i );
+	if ( a < 0 || optCode[a].op != OP_CONST ) {
+		return;
+	}
+
+	if ( VM_FoldUnaryConst( optCode[i].op, optCode[a].value, &result ) ) {
+		VM_Remove( a );
+		optCode[i].op = OP_CONST;
+		optCode[i].value = result;
+		numFolded++;
+	}
+}
+
+#define	MAX_JUMP_CHAIN		16
+
+/*
+=================
+VM_NextOp
+
+The first instruction at or after i that does something
+=================
+*/
+static int VM_NextOp( int i ) {
+	while ( i < optCount && optCode[i].op == OP_IGNORE ) {
+		i++;
+	}
+
+	return i;
+}
+
+/*
+=================
+VM_JumpDestination
+
+Where control really ends up after a jump to target, following
+unconditional jumps that lcc leaves at the end of if/else and loops
+=================
+*/
+static int VM_JumpDestination( int target ) {
+	int		i, j, k;
+
+	for ( i = 0 ; i < MAX_JUMP_CHAIN ; i++ ) {
+		j = VM_NextOp( target );
+		if ( j >= optCount || optCode[j].op != OP_CONST ) {
+			break;
+		}
+		k = VM_NextOp( j + 1 );
+		if ( k >= optCount || optCode[k].op != OP_JUMP || optLeader[k] ) {
+			break;
+		}
+		if ( optCode[j].value < 0 || optCode[j].value >= optCount ) {
+			break;
+		}
+		target = optCode[j].value;
+	}
+
+	return target;
+}
+
+/*
+=================
+VM_ThreadJumps
+
+Retarget branches and jumps that land on another jump, and remove
+jumps to the next instruction
+=================
+*/
+static void VM_ThreadJumps( void ) {
+	int		i, j, op, target;
+
+	for ( i = 0 ; i < optCount ; i++ ) {
+		op = optCode[i].op;
+
+		if ( op >= OP_EQ && op <= OP_GEF ) {
+			if ( optCode[i].value < 0 || optCode[i].value >= optCount ) {
+				continue;
+			}
+			target = VM_JumpDestination( optCode[i].value );
+			if ( target != optCode[i].value ) {
+				optCode[i].value = target;
+				numJumps++;
+			}
+		} else if ( op == OP_CONST && i + 1 < optCount && optCode[i+1].op == OP_JUMP && !optLeader[i+1] ) {
+			if ( optCode[i].value < 0 || optCode[i].value >= optCount ) {
+				continue;
+			}
+			target = VM_JumpDestination( optCode[i].value );
+			if ( target != optCode[i].value ) {
+				optCode[i].value = target;
+				numJumps++;
+			}
+
+			// falls through to the same place anyway
+			j = VM_NextOp( i + 2 );
+			if ( VM_NextOp( target ) == j ) {
+				VM_Remove( i );
+				VM_Remove( i + 1 );
+				numJumps++;
+			}
+		}
+	}
+}
+
+#define	MAX_TRACKED_STACK	16
+
+/*
+=================
+VM_DeadStore
+
+A store of a constant or frame address to a local that is overwritten
+further down the same block before anything could read it.  Loads through
+anything but the address of another local end the search, as they could
+read it through a pointer, and so does anything that leaves the block.
+=================
+*/
+static qboolean VM_DeadStore( int i ) {
+	int		a, v, j, size, top;
+	int		stack[MAX_TRACKED_STACK];	// frame offset of each value, or -1
+	int		ofs, coverSize;
+
+	switch ( optCode[i].op ) {
+	case OP_STORE4: size = 4; break;
+	case OP_STORE2: size = 2; break;
+	case OP_STORE1: size = 1; break;
+	default: return qfalse;
+	}
+
+	v = VM_PrevOp( i );
+	if ( v < 0 || ( optCode[v].op != OP_CONST && optCode[v].op != OP_LOCAL ) ) {
+		return qfalse;
+	}
+	a = VM_PrevOp( v );
+	if ( a < 0 || optCode[a].op != OP_LOCAL ) {
+		return qfalse;
+	}
+	ofs = optCode[a].value;
+
+	// values left on the stack by earlier code are unknown
+	top = 0;
+	for ( j = i + 1 ; j < optCount && !optLeader[j] ; j++ ) {
+		switch ( optCode[j].op ) {
+		case OP_IGNORE:
+			continue;
+		case OP_CONST:
+		case OP_PUSH:
+			if ( top == MAX_TRACKED_STACK ) {
+				return qfalse;
+			}
+			stack[top++] = -1;
+			continue;
+		case OP_LOCAL:
+			if ( top == MAX_TRACKED_STACK ) {
+				return qfalse;
+			}
+			stack[top++] = optCode[j].value;
+			continue;
+		case OP_SEX8:
+		case OP_SEX16:
+		case OP_NEGI:
+		case OP_BCOM:
+		case OP_NEGF:
+		case OP_CVIF:
+		case OP_CVFI:
+			if ( top > 0 ) {
+				stack[top-1] = -1;
+			}
+			continue;
+		case OP_ADD:
+		case OP_SUB:
+		case OP_DIVI:
+		case OP_DIVU:
+		case OP_MODI:
+		case OP_MODU:
+		case OP_MULI:
+		case OP_MULU:
+		case OP_BAND:
+		case OP_BOR:
+		case OP_BXOR:
+		case OP_LSH:
+		case OP_RSHI:
+		case OP_RSHU:
+		case OP_ADDF:
+		case OP_SUBF:
+		case OP_DIVF:
+		case OP_MULF:
+			if ( top > 0 ) {
+				top--;
+			}
+			if ( top > 0 ) {
+				stack[top-1] = -1;
+			}
+			continue;
+		case OP_POP:
+		case OP_ARG:
+			if ( top > 0 ) {
+				top--;
+			}
+			continue;
+		case OP_LOAD4:
+		case OP_LOAD2:
+		case OP_LOAD1:
+			// only reads of other locals are known to be safe
+			coverSize = ( optCode[j].op == OP_LOAD4 ) ? 4 : ( optCode[j].op == OP_LOAD2 ) ? 2 : 1;
+			if ( top < 1 || stack[top-1] == -1
+				|| ( stack[top-1] < ofs + size && stack[top-1] + coverSize > ofs ) ) {
+				return qfalse;
+			}
+			stack[top-1] = -1;
+			continue;
+		case OP_STORE4:
+		case OP_STORE2:
+		case OP_STORE1:
+			coverSize = ( optCode[j].op == OP_STORE4 ) ? 4 : ( optCode[j].op == OP_STORE2 ) ? 2 : 1;
+			if ( top < 2 ) {
+				// storing through an address we don't know about
+				top = 0;
+				continue;
+			}
+			top -= 2;
+			if ( stack[top] != -1 && stack[top] <= ofs && stack[top] + coverSize >= ofs + size ) {
+				VM_Remove( a );
+				VM_Remove( v );
+				VM_Remove( i );
+				numDeadStores++;
+				return qtrue;
+			}
+			continue;
+		default:
+			return qfalse;
+		}
+	}
+
+	return qfalse;
+}
+
+/*
+=================
+VM_EncodeBytecode
+
+Write the instructions back over the original image, which they always fit in
+=================
+*/
+static void VM_EncodeBytecode( vmHeader_t *header ) {
+	byte	*code;
+	int		i, pc, size, value;
+
+	code = (byte *)header + header->codeOffset;
+	pc = 0;
+
+	for ( i = 0 ; i < optCount ; i++ ) {
+		code[pc++] = optCode[i].op;
+		size = VM_ArgSize( optCode[i].op );
+		value = optCode[i].value;
+		if ( size == 4 ) {
+			code[pc++] = value & 0xFF;
+			code[pc++] = ( value >> 8 ) & 0xFF;
+			code[pc++] = ( value >> 16 ) & 0xFF;
+			code[pc++] = ( value >> 24 ) & 0xFF;
+		} else if ( size == 1 ) {
+			code[pc++] = value;
+		}
+	}
+
+	header->codeLength = pc;
+}
+
+/*
+=================
+VM_OptimizeBytecode
+
+Called between VM_LoadQVM and the backend setup
+=================
+*/
+void VM_OptimizeBytecode( vm_t *vm, vmHeader_t *header ) {
+	int		i, op, length, removed;
+
+	if ( !Cvar_VariableIntegerValue( "vm_optimize" ) || !vm->jumpTableTargets ) {
+		return;
+	}
+
+	optCount = header->instructionCount;
+	if ( optCount <= 0 ) {
+		return;
+	}
+
+	optCode = Z_Malloc( optCount * sizeof( *optCode ) );
+	optLeader = Z_Malloc( optCount );
+
+	if ( !VM_DecodeBytecode( vm, header ) ) {
+		Z_Free( optCode );
+		Z_Free( optLeader );
+		return;
+	}
+
+	VM_MarkLeaders( vm );
+
+	numFolded = numReduced = numLocals = numDeadStores = numJumps = 0;
+
+	VM_ThreadJumps();
+
+	for ( i = 0 ; i < optCount ; i++ ) {
+		op = optCode[i].op;
+
+		// don't create jump targets the leaders above don't know about
+		if ( i + 1 < optCount && optCode[i+1].op == OP_JUMP ) {
+			continue;
+		}
+
+		switch ( op ) {
+		case OP_ADD:
+		case OP_SUB:
+		case OP_DIVI:
+		case OP_DIVU:
+		case OP_MODI:
+		case OP_MODU:
+		case OP_MULI:
+		case OP_MULU:
+		case OP_BAND:
+		case OP_BOR:
+		case OP_BXOR:
+		case OP_LSH:
+		case OP_RSHI:
+		case OP_RSHU:
+			VM_OptimizeBinary( i );
+			break;
+		case OP_SEX8:
+		case OP_SEX16:
+		case OP_NEGI:
+		case OP_BCOM:
+		case OP_NEGF:
+		case OP_CVIF:
+		case OP_CVFI:
+			VM_OptimizeUnary( i );
+			break;
+		default:
+			break;
+		}
+	}
+
+	// folding turns more stores into constant ones, so this goes second
+	for ( i = 0 ; i < optCount ; i++ ) {
+		VM_DeadStore( i );
+	}
+
+	length = header->codeLength;
+	VM_EncodeBytecode( header );
+
+	removed = 0;
+	for ( i = 0 ; i < optCount ; i++ ) {
+		if ( optCode[i].op == OP_IGNORE ) {
+			removed++;
+		}
+	}
+
+	Com_DPrintf( "Optimized %s: %d folded, %d reduced, %d frame addresses, %d dead stores, "
+		"%d jumps, %d of %d instructions removed, %d bytes saved\n", vm->name, numFolded,
+		numReduced, numLocals, numDeadStores, numJumps, removed, optCount, length - header->codeLength );
+
+	Z_Free( optCode );
+	Z_Free( optLeader );
+}
@@ -69,6 +69,8 @@ static	int		pc = 0;
 #define FTOL_PTR
 
 static	int	instruction, pass;
+static	int	inlineSyscalls, numInlined;
+static	int	addrMask;	// 0 when the data segment is behind guard pages
 static	int	lastConst = 0;
 static	int	oc0, oc1, pop0, pop1;
 static	int jlabel;
@@ -158,6 +160,13 @@ static void EmitPtr(void *ptr)
 #endif
 }
 
+// an address the code cache has to fix up when it moves the code
+static void EmitRelocPtr(vmRelocType_t type, void *ptr, int import)
+{
+	VM_AddReloc(compiledOfs, type, import);
+	EmitPtr(ptr);
+}
+
 static int Hex( int c ) {
 	if ( c >= 'a' && c <= 'f' ) {
 		return 10 + c - 'a';
@@ -203,9 +212,14 @@ static void EmitRexString(byte rex, const char *string)
 
 
 #define MASK_REG(modrm, mask) \
-	EmitString("81"); \
-	EmitString((modrm)); \
-	Emit4((mask))
+	do { \
+		if((mask)) \
+		{ \
+			EmitString("81"); \
+			EmitString((modrm)); \
+			Emit4((mask)); \
+		} \
+	} while(0)
 
 // add bl, bytes
 #define STACK_PUSH(bytes) \
@@ -454,6 +468,33 @@ static void DoSyscall(void)
 	currentVM = savedVM;
 }
 
+/*
+=================
+EmitImport
+Engine addresses are emitted through this table, the code cache finds
+them again by index when the engine has moved
+=================
+*/
+
+enum {
+	IMPORT_DOSYSCALL,
+	IMPORT_SYSCALLNUM,
+	IMPORT_PROGRAMSTACK,
+	IMPORT_OPSTACKOFS,
+	IMPORT_OPSTACKBASE,
+	IMPORT_ARG,
+	IMPORT_FTOL,
+	NUM_IMPORTS
+};
+
+static void *imports[NUM_IMPORTS];
+static vmBackend_t backend = { "vm_x86 " ARCH_STRING " " __DATE__ " " __TIME__, 0, imports, NUM_IMPORTS };
+
+static void EmitImport(int import)
+{
+	EmitRelocPtr(VMR_IMPORT, imports[import], import);
+}
+
 /*
 =================
 EmitCallRel
@@ -478,7 +519,7 @@ int EmitCallDoSyscall(vm_t *vm)
 {
 	// use edx register to store DoSyscall address
 	EmitRexString(0x48, "BA");		// mov edx, DoSyscall
-	EmitPtr(DoSyscall);
+	EmitImport(IMPORT_DOSYSCALL);
 
 	// Push important registers to stack as we can't really make
 	// any assumptions about calling conventions.
@@ -493,23 +534,23 @@ int EmitCallDoSyscall(vm_t *vm)
 	// write arguments to global vars
 	// syscall number
 	EmitString("A3");			// mov [0x12345678], eax
-	EmitPtr(&vm_syscallNum);
+	EmitImport(IMPORT_SYSCALLNUM);
 	// vm_programStack value
 	EmitString("89 F0");			// mov eax, esi
 	EmitString("A3");			// mov [0x12345678], eax
-	EmitPtr(&vm_programStack);
+	EmitImport(IMPORT_PROGRAMSTACK);
 	// vm_opStackOfs 
 	EmitString("88 D8");			// mov al, bl
 	EmitString("A2");			// mov [0x12345678], al
-	EmitPtr(&vm_opStackOfs);
+	EmitImport(IMPORT_OPSTACKOFS);
 	// vm_opStackBase
 	EmitRexString(0x48, "89 F8");		// mov eax, edi
 	EmitRexString(0x48, "A3");		// mov [0x12345678], eax
-	EmitPtr(&vm_opStackBase);
+	EmitImport(IMPORT_OPSTACKBASE);
 	// vm_arg
 	EmitString("89 C8");			// mov eax, ecx
 	EmitString("A3");			// mov [0x12345678], eax
-	EmitPtr(&vm_arg);
+	EmitImport(IMPORT_ARG);
 	
 	// align the stack pointer to a 16-byte-boundary
 	EmitString("55");			// push ebp
@@ -585,7 +626,7 @@ int EmitCallProcedure(vm_t *vm, int sysCallOfs)
 	EmitRexString(0x49, "FF 14 C0");	// call qword ptr [r8 + eax * 8]
 #else
 	EmitString("FF 14 85");			// call dword ptr [vm->instructionPointers + eax * 4]
-	Emit4((intptr_t) vm->instructionPointers);
+	EmitRelocPtr(VMR_INSTRUCTIONS, vm->instructionPointers, 0);
 #endif
 	EmitString("8B 04 9F");			// mov eax, dword ptr [edi + ebx * 4]
 	EmitString("C3");			// ret
@@ -649,6 +690,140 @@ void EmitCallIns(vm_t *vm, int cdest)
 		compiledOfs += 4;
 }
 
+/*
+=================
+EmitSyscallArg
+Apply op to reg and the syscall argument arg on the program stack
+=================
+*/
+
+static void EmitSyscallArg(vm_t *vm, const char *op, int reg, int arg)
+{
+#if idx64
+	EmitRexString(0x41, op);
+	Emit1(0x44 | (reg << 3));		// op reg, dword ptr [r9 + rsi + 4 + 4 * arg]
+	Emit1(0x31);
+	Emit1(4 + 4 * arg);
+#else
+	EmitString(op);
+	Emit1(0x86 | (reg << 3));		// op reg, dword ptr [esi + dataBase + 4 + 4 * arg]
+	EmitRelocPtr(VMR_DATA, vm->dataBase + 4 + 4 * arg, 0);
+#endif
+}
+
+/*
+=================
+EmitInlineSyscall
+The sqrt and memory traps shared by all modules are compiled to native
+code instead of leaving the VM. sin and cos stay syscalls, fsin/fcos are
+slower than libm. Blocks that don't fit in the data segment still go
+through DoSyscall, so the module decides what happens.
+=================
+*/
+
+static qboolean EmitInlineSyscall(vm_t *vm, int cdest, int callProcOfsSyscall)
+{
+	int jmpSyscall[3], numJmpSyscall, jmpDone;
+	int num, i;
+
+	num = ~cdest;
+
+	if(!inlineSyscalls)
+		return qfalse;
+
+	switch(num)
+	{
+	case TRAP_SQRT:
+		EmitSyscallArg(vm, "D9", 0, 1);		// fld dword ptr [arg1]
+		EmitString("D9 FA");			// fsqrt
+		EmitString("D9 5C 9F 04");		// fstp dword ptr 4[edi + ebx * 4]
+		STACK_PUSH(1);				// add bl, 1
+		numInlined++;
+		return qtrue;
+	case TRAP_MEMSET:
+	case TRAP_MEMCPY:
+		break;
+	default:
+		return qfalse;
+	}
+
+	EmitSyscallArg(vm, "8B", 1, 3);		// mov ecx, count
+	EmitSyscallArg(vm, "8B", 0, 2);		// mov eax, value or source
+	EmitSyscallArg(vm, "8B", 2, 1);		// mov edx, destination
+
+	// count <= size and dest + count <= size, the first keeps the sum from wrapping
+	numJmpSyscall = 0;
+	EmitString("81 F9");			// cmp ecx, size
+	Emit4(vm->dataMask + 1);
+	EmitString("77");			// ja syscall
+	jmpSyscall[numJmpSyscall++] = compiledOfs++;
+
+	MASK_REG("E2", vm->dataMask);		// and edx, 0x12345678
+	EmitString("01 CA");			// add edx, ecx
+	EmitString("81 FA");			// cmp edx, size
+	Emit4(vm->dataMask + 1);
+	EmitString("77");			// ja syscall
+	jmpSyscall[numJmpSyscall++] = compiledOfs++;
+	EmitString("29 CA");			// sub edx, ecx
+
+	if(num == TRAP_MEMCPY)
+	{
+		MASK_REG("E0", vm->dataMask);	// and eax, 0x12345678
+		EmitString("01 C8");		// add eax, ecx
+		EmitString("3D");		// cmp eax, size
+		Emit4(vm->dataMask + 1);
+		EmitString("77");		// ja syscall
+		jmpSyscall[numJmpSyscall++] = compiledOfs++;
+		EmitString("29 C8");		// sub eax, ecx
+	}
+
+	EmitString("57");			// push edi
+#if idx64
+	EmitRexString(0x49, "8D 3C 11");	// lea rdi, [r9 + rdx]
+#else
+	EmitString("8D BA");			// lea edi, [edx + 0x12345678]
+	EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
+#endif
+
+	if(num == TRAP_MEMCPY)
+	{
+		EmitString("56");		// push esi
+#if idx64
+		EmitRexString(0x49, "8D 34 01");	// lea rsi, [r9 + rax]
+#else
+		EmitString("8D B0");		// lea esi, [eax + 0x12345678]
+		EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
+#endif
+		EmitString("F3 A4");		// rep movsb
+		EmitString("5E");		// pop esi
+	}
+	else
+		EmitString("F3 AA");		// rep stosb
+
+	EmitString("5F");			// pop edi
+
+	// the modules return 0 from both
+	EmitString("C7 44 9F 04");		// mov dword ptr 4[edi + ebx * 4], 0
+	Emit4(0);
+	STACK_PUSH(1);				// add bl, 1
+	EmitString("EB");			// jmp done
+	jmpDone = compiledOfs++;
+
+	// syscall:
+	for(i = 0; i < numJmpSyscall; i++)
+		SET_JMPOFS(jmpSyscall[i]);
+
+	EmitString("B8");			// mov eax, cdest
+	Emit4(cdest);
+	EmitCallRel(vm, callProcOfsSyscall);
+
+	// done:
+	SET_JMPOFS(jmpDone);
+
+	numInlined++;
+	return qtrue;
+}
+
 /*
 =================
 EmitCallConst
@@ -660,6 +835,9 @@ void EmitCallConst(vm_t *vm, int cdest, int callProcOfsSyscall)
 {
 	if(cdest < 0)
 	{
+		if(EmitInlineSyscall(vm, cdest, callProcOfsSyscall))
+			return;
+
 		EmitString("B8");	// mov eax, cdest
 		Emit4(cdest);
 
@@ -742,7 +920,7 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 		Emit4(Constant4() & vm->dataMask);
 #else
 		EmitString("B8");				// mov eax, 0x12345678
-		EmitPtr(vm->dataBase + (Constant4() & vm->dataMask));
+		EmitRelocPtr(VMR_DATA, vm->dataBase + (Constant4() & vm->dataMask), 0);
 		EmitString("8B 00");				// mov eax, dword ptr [eax]
 #endif
 		EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
@@ -758,7 +936,7 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 		Emit4(Constant4() & vm->dataMask);
 #else
 		EmitString("B8");				// mov eax, 0x12345678
-		EmitPtr(vm->dataBase + (Constant4() & vm->dataMask));
+		EmitRelocPtr(VMR_DATA, vm->dataBase + (Constant4() & vm->dataMask), 0);
 		EmitString("0F B7 00");				// movzx eax, word ptr [eax]
 #endif
 		EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
@@ -774,7 +952,7 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 		Emit4(Constant4() & vm->dataMask);
 #else
 		EmitString("B8");				// mov eax, 0x12345678
-		EmitPtr(vm->dataBase + (Constant4() & vm->dataMask));
+		EmitRelocPtr(VMR_DATA, vm->dataBase + (Constant4() & vm->dataMask), 0);
 		EmitString("0F B6 00");				// movzx eax, byte ptr [eax]
 #endif
 		EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
@@ -784,13 +962,13 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 		return qtrue;
 
 	case OP_STORE4:
-		EmitMovEAXStack(vm, (vm->dataMask & ~3));
+		EmitMovEAXStack(vm, (addrMask & ~3));
 #if idx64
 		EmitRexString(0x41, "C7 04 01");		// mov dword ptr [r9 + eax], 0x12345678
 		Emit4(Constant4());
 #else
 		EmitString("C7 80");				// mov dword ptr [eax + 0x12345678], 0x12345678
-		Emit4((intptr_t) vm->dataBase);
+		EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 		Emit4(Constant4());
 #endif
 		EmitCommand(LAST_COMMAND_SUB_BL_1);		// sub bl, 1
@@ -799,14 +977,14 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 		return qtrue;
 
 	case OP_STORE2:
-		EmitMovEAXStack(vm, (vm->dataMask & ~1));
+		EmitMovEAXStack(vm, (addrMask & ~1));
 #if idx64
 		Emit1(0x66);					// mov word ptr [r9 + eax], 0x1234
 		EmitRexString(0x41, "C7 04 01");
 		Emit2(Constant4());
 #else
 		EmitString("66 C7 80");				// mov word ptr [eax + 0x12345678], 0x1234
-		Emit4((intptr_t) vm->dataBase);
+		EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 		Emit2(Constant4());
 #endif
 		EmitCommand(LAST_COMMAND_SUB_BL_1);		// sub bl, 1
@@ -816,13 +994,13 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 		return qtrue;
 
 	case OP_STORE1:
-		EmitMovEAXStack(vm, vm->dataMask);
+		EmitMovEAXStack(vm, addrMask);
 #if idx64
 		EmitRexString(0x41, "C6 04 01");		// mov byte [r9 + eax], 0x12
 		Emit1(Constant4());
 #else
 		EmitString("C6 80");				// mov byte ptr [eax + 0x12345678], 0x12
-		Emit4((intptr_t) vm->dataBase);
+		EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 		Emit1(Constant4());
 #endif
 		EmitCommand(LAST_COMMAND_SUB_BL_1);		// sub bl, 1
@@ -1056,6 +1234,47 @@ qboolean ConstOptimize(vm_t *vm, int callProcOfsSyscall)
 	return qfalse;
 }
 
+/*
+=================
+VM_AllocCode
+Writable memory for the final code, VM_ProtectCode makes it executable
+=================
+*/
+static void VM_AllocCode(vm_t *vm, int length)
+{
+	vm->codeLength = length;
+#ifdef VM_X86_MMAP
+	vm->codeBase = mmap(NULL, length, PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+	if(vm->codeBase == MAP_FAILED)
+		Com_Error(ERR_FATAL, "VM_CompileX86: can't mmap memory");
+#elif _WIN32
+	// allocate memory with EXECUTE permissions under windows.
+	vm->codeBase = VirtualAlloc(NULL, length, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+	if(!vm->codeBase)
+		Com_Error(ERR_FATAL, "VM_CompileX86: VirtualAlloc failed");
+#else
+	vm->codeBase = malloc(length);
+	if(!vm->codeBase)
+	        Com_Error(ERR_FATAL, "VM_CompileX86: malloc failed");
+#endif
+}
+
+static void VM_ProtectCode(vm_t *vm)
+{
+#ifdef VM_X86_MMAP
+	if(mprotect(vm->codeBase, vm->codeLength, PROT_READ|PROT_EXEC))
+		Com_Error(ERR_FATAL, "VM_CompileX86: mprotect failed");
+#elif _WIN32
+	{
+		DWORD oldProtect = 0;
+		
+		// remove write permissions.
+		if(!VirtualProtect(vm->codeBase, vm->codeLength, PAGE_EXECUTE_READ, &oldProtect))
+			Com_Error(ERR_FATAL, "VM_CompileX86: VirtualProtect failed");
+	}
+#endif
+}
+
 /*
 =================
 VM_Compile
@@ -1068,6 +1287,41 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 	int		v;
 	int		i;
         int		callProcOfsSyscall, callProcOfs, callDoSyscallOfs;
+	int		numProcRelocs;
+
+	inlineSyscalls = Cvar_VariableIntegerValue("vm_inlineSyscalls");
+
+	imports[IMPORT_DOSYSCALL] = (void *) DoSyscall;
+	imports[IMPORT_SYSCALLNUM] = &vm_syscallNum;
+	imports[IMPORT_PROGRAMSTACK] = &vm_programStack;
+	imports[IMPORT_OPSTACKOFS] = &vm_opStackOfs;
+	imports[IMPORT_OPSTACKBASE] = &vm_opStackBase;
+	imports[IMPORT_ARG] = &vm_arg;
+	imports[IMPORT_FTOL] = (void *) Q_VMftol;
+
+	// the 4 GiB guard region makes runtime address masking unnecessary
+	if(vm->dataGuarded)
+		addrMask = 0;
+	else
+		addrMask = vm->dataMask;
+
+	backend.options = inlineSyscalls | (vm->dataGuarded << 1);
+
+	// reuse the code from the last time this image was compiled
+	v = VM_FindCachedCode(vm, header, &backend);
+	if(v)
+	{
+		VM_AllocCode(vm, v);
+		VM_LinkCachedCode(vm, &backend);
+		VM_ProtectCode(vm);
+
+		vm->destroy = VM_Destroy_Compiled;
+
+		for ( i = 0 ; i < header->instructionCount ; i++ ) {
+			vm->instructionPointers[i] += (intptr_t) vm->codeBase;
+		}
+		return;
+	}
 
 	jusedSize = header->instructionCount + 2;
 
@@ -1094,11 +1348,13 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 
 	// Start buffer with x86-VM specific procedures
 	compiledOfs = 0;
+	VM_TruncateRelocs(0);
 
 	callDoSyscallOfs = compiledOfs;
 	callProcOfs = EmitCallDoSyscall(vm);
 	callProcOfsSyscall = EmitCallProcedure(vm, callDoSyscallOfs);
 	vm->entryOfs = compiledOfs;
+	numProcRelocs = VM_NumRelocs();
 
 	for(pass=0; pass < 3; pass++) {
 	oc0 = -23423;
@@ -1113,6 +1369,8 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 	compiledOfs = vm->entryOfs;
 
 	LastCommand = LAST_COMMAND_NONE;
+	numInlined = 0;
+	VM_TruncateRelocs(numProcRelocs);
 
 	while(instruction < header->instructionCount)
 	{
@@ -1142,6 +1400,15 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 		switch ( op ) {
 		case 0:
 			break;
+		case OP_IGNORE:
+			// emits nothing and mustn't take part in the peepholes
+			// across a jump target
+			if(jlabel)
+			{
+				LastCommand = LAST_COMMAND_NONE;
+				pop0 = pop1 = -1;
+			}
+			continue;
 		case OP_BREAK:
 			EmitString("CC");				// int 3
 			break;
@@ -1175,12 +1442,12 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 			EmitString("8B D6");				// mov edx, esi
 			EmitString("81 C2");				// add edx, 0x12345678
 			Emit4((Constant1() & 0xFF));
-			MASK_REG("E2", vm->dataMask);			// and edx, 0x12345678
+			MASK_REG("E2", addrMask);			// and edx, 0x12345678
 #if idx64
 			EmitRexString(0x41, "89 04 11");		// mov dword ptr [r9 + edx], eax
 #else
 			EmitString("89 82");				// mov dword ptr [edx + 0x12345678], eax
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_SUB_BL_1);		// sub bl, 1
 			break;
@@ -1211,14 +1478,14 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 				pc++;				// OP_CONST
 				v = Constant4();
 
-				EmitMovEDXStack(vm, vm->dataMask);
+				EmitMovEDXStack(vm, addrMask);
 				if(v == 1 && oc0 == oc1 && pop0 == OP_LOCAL && pop1 == OP_LOCAL)
 				{
 #if idx64
 					EmitRexString(0x41, "FF 04 11");	// inc dword ptr [r9 + edx]
 #else
 					EmitString("FF 82");			// inc dword ptr [edx + 0x12345678]
-					Emit4((intptr_t) vm->dataBase);
+					EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 				}
 				else
@@ -1227,7 +1494,7 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 					EmitRexString(0x41, "8B 04 11");	// mov eax, dword ptr [r9 + edx]
 #else
 					EmitString("8B 82");			// mov eax, dword ptr [edx + 0x12345678]
-					Emit4((intptr_t) vm->dataBase);
+					EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 					EmitString("05");			// add eax, v
 					Emit4(v);
@@ -1238,19 +1505,19 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 						EmitRexString(0x41, "89 04 11");	// mov dword ptr [r9 + edx], eax
 #else
 						EmitString("89 82");			// mov dword ptr [edx + 0x12345678], eax
-						Emit4((intptr_t) vm->dataBase);
+						EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 					}
 					else
 					{
 						EmitCommand(LAST_COMMAND_SUB_BL_1);	// sub bl, 1
 						EmitString("8B 14 9F");			// mov edx, dword ptr [edi + ebx * 4]
-						MASK_REG("E2", vm->dataMask);		// and edx, 0x12345678
+						MASK_REG("E2", addrMask);		// and edx, 0x12345678
 #if idx64
 						EmitRexString(0x41, "89 04 11");	// mov dword ptr [r9 + edx], eax
 #else
 						EmitString("89 82");			// mov dword ptr [edx + 0x12345678], eax
-						Emit4((intptr_t) vm->dataBase);
+						EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 					}
 				}
@@ -1273,14 +1540,14 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 				pc++;					// OP_CONST
 				v = Constant4();
 
-				EmitMovEDXStack(vm, vm->dataMask);
+				EmitMovEDXStack(vm, addrMask);
 				if(v == 1 && oc0 == oc1 && pop0 == OP_LOCAL && pop1 == OP_LOCAL)
 				{
 #if idx64
 					EmitRexString(0x41, "FF 0C 11");	// dec dword ptr [r9 + edx]
 #else
 					EmitString("FF 8A");			// dec dword ptr [edx + 0x12345678]
-					Emit4((intptr_t) vm->dataBase);
+					EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 				}
 				else
@@ -1289,7 +1556,7 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 					EmitRexString(0x41, "8B 04 11");	// mov eax, dword ptr [r9 + edx]
 #else
 					EmitString("8B 82");			// mov eax, dword ptr [edx + 0x12345678]
-					Emit4((intptr_t) vm->dataBase);
+					EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 					EmitString("2D");			// sub eax, v
 					Emit4(v);
@@ -1300,19 +1567,19 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 						EmitRexString(0x41, "89 04 11");	// mov dword ptr [r9 + edx], eax
 #else
 						EmitString("89 82");			// mov dword ptr [edx + 0x12345678], eax
-						Emit4((intptr_t) vm->dataBase);
+						EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 					}
 					else
 					{
 						EmitCommand(LAST_COMMAND_SUB_BL_1);	// sub bl, 1
 						EmitString("8B 14 9F");			// mov edx, dword ptr [edi + ebx * 4]
-						MASK_REG("E2", vm->dataMask);		// and edx, 0x12345678
+						MASK_REG("E2", addrMask);		// and edx, 0x12345678
 #if idx64
 						EmitRexString(0x41, "89 04 11");	// mov dword ptr [r9 + edx], eax
 #else
 						EmitString("89 82");			// mov dword ptr [edx + 0x12345678], eax
-						Emit4((intptr_t) vm->dataBase);
+						EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 					}
 				}
@@ -1327,80 +1594,80 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 			{
 				compiledOfs -= 3;
 				vm->instructionPointers[instruction - 1] = compiledOfs;
-				MASK_REG("E0", vm->dataMask);			// and eax, 0x12345678
+				MASK_REG("E0", addrMask);			// and eax, 0x12345678
 #if idx64
 				EmitRexString(0x41, "8B 04 01");		// mov eax, dword ptr [r9 + eax]
 #else
 				EmitString("8B 80");				// mov eax, dword ptr [eax + 0x1234567]
-				Emit4((intptr_t) vm->dataBase);
+				EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 				EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
 				break;
 			}
 			
-			EmitMovEAXStack(vm, vm->dataMask);
+			EmitMovEAXStack(vm, addrMask);
 #if idx64
 			EmitRexString(0x41, "8B 04 01");		// mov eax, dword ptr [r9 + eax]
 #else
 			EmitString("8B 80");				// mov eax, dword ptr [eax + 0x12345678]
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
 			break;
 		case OP_LOAD2:
-			EmitMovEAXStack(vm, vm->dataMask);
+			EmitMovEAXStack(vm, addrMask);
 #if idx64
 			EmitRexString(0x41, "0F B7 04 01");		// movzx eax, word ptr [r9 + eax]
 #else
 			EmitString("0F B7 80");				// movzx eax, word ptr [eax + 0x12345678]
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
 			break;
 		case OP_LOAD1:
-			EmitMovEAXStack(vm, vm->dataMask);
+			EmitMovEAXStack(vm, addrMask);
 #if idx64
 			EmitRexString(0x41, "0F B6 04 01");		// movzx eax, byte ptr [r9 + eax]
 #else
 			EmitString("0F B6 80");				// movzx eax, byte ptr [eax + 0x12345678]
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
 			break;
 		case OP_STORE4:
 			EmitMovEAXStack(vm, 0);	
 			EmitString("8B 54 9F FC");			// mov edx, dword ptr -4[edi + ebx * 4]
-			MASK_REG("E2", vm->dataMask & ~3);		// and edx, 0x12345678
+			MASK_REG("E2", addrMask & ~3);			// and edx, 0x12345678
 #if idx64
 			EmitRexString(0x41, "89 04 11");		// mov dword ptr [r9 + edx], eax
 #else
 			EmitString("89 82");				// mov dword ptr [edx + 0x12345678], eax
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_SUB_BL_2);		// sub bl, 2
 			break;
 		case OP_STORE2:
 			EmitMovEAXStack(vm, 0);	
 			EmitString("8B 54 9F FC");			// mov edx, dword ptr -4[edi + ebx * 4]
-			MASK_REG("E2", vm->dataMask & ~1);		// and edx, 0x12345678
+			MASK_REG("E2", addrMask & ~1);			// and edx, 0x12345678
 #if idx64
 			Emit1(0x66);					// mov word ptr [r9 + edx], eax
 			EmitRexString(0x41, "89 04 11");
 #else
 			EmitString("66 89 82");				// mov word ptr [edx + 0x12345678], eax
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_SUB_BL_2);		// sub bl, 2
 			break;
 		case OP_STORE1:
 			EmitMovEAXStack(vm, 0);	
 			EmitString("8B 54 9F FC");			// mov edx, dword ptr -4[edi + ebx * 4]
-			MASK_REG("E2", vm->dataMask);			// and edx, 0x12345678
+			MASK_REG("E2", addrMask);			// and edx, 0x12345678
 #if idx64
 			EmitRexString(0x41, "88 04 11");		// mov byte ptr [r9 + edx], eax
 #else
 			EmitString("88 82");				// mov byte ptr [edx + 0x12345678], eax
-			Emit4((intptr_t) vm->dataBase);
+			EmitRelocPtr(VMR_DATA, vm->dataBase, 0);
 #endif
 			EmitCommand(LAST_COMMAND_SUB_BL_2);		// sub bl, 2
 			break;
@@ -1589,8 +1856,10 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 #else // FTOL_PTR
 			// call the library conversion function
 			EmitRexString(0x48, "BA");			// mov edx, Q_VMftol
-			EmitPtr(Q_VMftol);
+			EmitImport(IMPORT_FTOL);
 			EmitRexString(0x48, "FF D2");			// call edx
+			if(!addrMask)
+				EmitString("89 C0");			// mov eax, eax, the result may end up as an unmasked address
 			EmitCommand(LAST_COMMAND_MOV_STACK_EAX);	// mov dword ptr [edi + ebx * 4], eax
 #endif
 			break;
@@ -1625,7 +1894,7 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 #else
 			EmitString("73 07");			// jae +7
 			EmitString("FF 24 85");			// jmp dword ptr [instructionPointers + eax * 4]
-			Emit4((intptr_t) vm->instructionPointers);
+			EmitRelocPtr(VMR_INSTRUCTIONS, vm->instructionPointers, 0);
 #endif
 			EmitCallErrJump(vm, callDoSyscallOfs);
 			break;
@@ -1639,41 +1908,17 @@ void VM_Compile(vm_t *vm, vmHeader_t *header)
 	}
 
 	// copy to an exact sized buffer with the appropriate permission bits
-	vm->codeLength = compiledOfs;
-#ifdef VM_X86_MMAP
-	vm->codeBase = mmap(NULL, compiledOfs, PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
-	if(vm->codeBase == MAP_FAILED)
-		Com_Error(ERR_FATAL, "VM_CompileX86: can't mmap memory");
-#elif _WIN32
-	// allocate memory with EXECUTE permissions under windows.
-	vm->codeBase = VirtualAlloc(NULL, compiledOfs, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
-	if(!vm->codeBase)
-		Com_Error(ERR_FATAL, "VM_CompileX86: VirtualAlloc failed");
-#else
-	vm->codeBase = malloc(compiledOfs);
-	if(!vm->codeBase)
-	        Com_Error(ERR_FATAL, "VM_CompileX86: malloc failed");
-#endif
-
+	VM_AllocCode(vm, compiledOfs);
 	Com_Memcpy( vm->codeBase, buf, compiledOfs );
-
-#ifdef VM_X86_MMAP
-	if(mprotect(vm->codeBase, compiledOfs, PROT_READ|PROT_EXEC))
-		Com_Error(ERR_FATAL, "VM_CompileX86: mprotect failed");
-#elif _WIN32
-	{
-		DWORD oldProtect = 0;
-		
-		// remove write permissions.
-		if(!VirtualProtect(vm->codeBase, compiledOfs, PAGE_EXECUTE_READ, &oldProtect))
-			Com_Error(ERR_FATAL, "VM_CompileX86: VirtualProtect failed");
-	}
-#endif
+	VM_StoreCachedCode(vm, header, &backend);
+	VM_ProtectCode(vm);
 
 	Z_Free( code );
 	Z_Free( buf );
 	Z_Free( jused );
 	Com_Printf( "VM file %s compiled to %i bytes of code\n", vm->name, compiledOfs );
+	if(numInlined)
+		Com_Printf( "%i syscalls compiled inline\n", numInlined );
 
 	vm->destroy = VM_Destroy_Compiled;
 
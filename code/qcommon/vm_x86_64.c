@@ -54,13 +54,6 @@ static FILE* qdasmout;
 #define Dfprintf(args...)
 #endif
 
-#define VM_FREEBUFFERS(vm) do {assembler_init(0); VM_Destroy_Compiled(vm);} while(0)
-
-void assembler_set_output(char* buf);
-size_t assembler_get_code_size(void);
-void assembler_init(int pass);
-void assemble_line(const char* input, size_t len);
-
 static void VM_Destroy_Compiled(vm_t* self);
 
 /*
@@ -229,151 +222,353 @@ static unsigned char op_argsize[256] =
 	[OP_BLOCK_COPY] = 4,
 };
 
-static __attribute__ ((format (printf, 1, 2))) void emit(const char* fmt, ...)
+// register numbers as used in ModRM encodings
+#define R_EAX	0
+#define R_ECX	1
+#define R_EDX	2
+#define R_EBX	3
+#define R_ESI	6
+#define R_EDI	7
+
+// worst case size of the code emitted for a single QVM instruction
+#define VM_MAX_OPLEN	256
+
+// jumps to the start of the next instruction are resolved when it is reached
+#define MAX_NEXTJUMPS	4
+
+typedef struct {
+	int			ofs;			// offset of the address in buf
+	int			instruction;	// instruction whose code address goes there
+	qboolean	relative;		// rel32 of a jump or call instead of an absolute address
+} codeFixup_t;
+
+static	byte		*jused = NULL;		// instruction starts a basic block, see MarkLeaders
+
+#define VMFREE_BUFFERS() do {Z_Free(buf); Z_Free(codeFixups); buf = NULL; codeFixups = NULL; \
+	if(jused) {Z_Free(jused); jused = NULL;}} while(0)
+static	byte		*buf = NULL;
+static	int			bufSize = 0;
+static	int			compiledOfs = 0;
+static	codeFixup_t	*codeFixups = NULL;
+static	int			numCodeFixups = 0;
+static	int			nextJumpOfs[MAX_NEXTJUMPS];
+static	int			nextJumpSize[MAX_NEXTJUMPS];
+static	int			numNextJumps = 0;
+
+static int iss8(int64_t v)
+{
+	return (SCHAR_MIN <= v && v <= SCHAR_MAX);
+}
+
+static void Emit1( int v )
+{
+	buf[ compiledOfs ] = v;
+	compiledOfs++;
+}
+
+static void Emit4( int v )
+{
+	Emit1(v & 0xFF);
+	Emit1((v >> 8) & 0xFF);
+	Emit1((v >> 16) & 0xFF);
+	Emit1((v >> 24) & 0xFF);
+}
+
+static void Emit8( uint64_t v )
+{
+	Emit4(v & 0xFFFFFFFF);
+	Emit4((v >> 32) & 0xFFFFFFFF);
+}
+
+static void EmitPtr( void *ptr )
 {
-	va_list ap;
-	char line[4096];
-	va_start(ap, fmt);
-	Q_vsnprintf(line, sizeof(line), fmt, ap);
-	va_end(ap);
-	assemble_line(line, strlen(line));
+	Emit8((intptr_t) ptr);
+}
+
+// an address the code cache has to fix up when it moves the code
+static void EmitRelocPtr( vmRelocType_t type, void *ptr, int import )
+{
+	VM_AddReloc(compiledOfs, type, import);
+	EmitPtr(ptr);
+}
+
+static void Patch4( int ofs, int v )
+{
+	buf[ofs] = v & 0xFF;
+	buf[ofs + 1] = (v >> 8) & 0xFF;
+	buf[ofs + 2] = (v >> 16) & 0xFF;
+	buf[ofs + 3] = (v >> 24) & 0xFF;
+}
+
+static int Hex( int c ) {
+	if ( c >= 'a' && c <= 'f' ) {
+		return 10 + c - 'a';
+	}
+	if ( c >= 'A' && c <= 'F' ) {
+		return 10 + c - 'A';
+	}
+	if ( c >= '0' && c <= '9' ) {
+		return c - '0';
+	}
+
+	VMFREE_BUFFERS();
+	Com_Error( ERR_DROP, "Hex: bad char '%c'", c );
+
+	return 0;
 }
 
+static void EmitString( const char *string ) {
+	int		c1, c2;
+	int		v;
+
+	while ( 1 ) {
+		c1 = string[0];
+		c2 = string[1];
+
+		v = ( Hex( c1 ) << 4 ) | Hex( c2 );
+		Emit1( v );
+
+		if ( !string[2] ) {
+			break;
+		}
+		string += 3;
+	}
+}
+
+/*
+=================
+EmitRegImm
+
+Group 1 ALU operation (add, or, and, sub, xor, cmp selected by subcode)
+on a 32 bit register with an immediate, using the short form if it fits
+=================
+*/
+static void EmitRegImm( int subcode, int reg, int64_t imm )
+{
+	if(reg & 8)
+		Emit1(0x41);
+
+	if(iss8(imm))
+	{
+		Emit1(0x83);
+		Emit1(0xC0 | (subcode << 3) | (reg & 7));
+		Emit1(imm);
+	}
+	else
+	{
+		Emit1(0x81);
+		Emit1(0xC0 | (subcode << 3) | (reg & 7));
+		Emit4(imm);
+	}
+}
+
+/*
+=================
+EmitCodeAddress
+
+movq $address, %rax for the code of an instruction. The address is only
+known once the code has been copied to its final place, so leave a fixup.
+=================
+*/
+static void EmitCodeAddress( int instruction )
+{
+	EmitString("48 B8");		// movq $address, %rax
+	codeFixups[numCodeFixups].ofs = compiledOfs;
+	codeFixups[numCodeFixups].instruction = instruction;
+	codeFixups[numCodeFixups].relative = qfalse;
+	numCodeFixups++;
+	VM_AddReloc(compiledOfs, VMR_CODE, 0);
+	Emit8(0);
+}
+
+/*
+=================
+EmitJumpNext
+
+Jump to the start of the next instruction with an 8 or 32 bit displacement
+=================
+*/
+static void EmitJumpNext( const char *jmpop, int size )
+{
+	EmitString(jmpop);
+	nextJumpOfs[numNextJumps] = compiledOfs;
+	nextJumpSize[numNextJumps] = size;
+	numNextJumps++;
+	compiledOfs += size;
+}
+
+static void SetJumpsNext( void )
+{
+	int i, disp;
+
+	for(i = 0; i < numNextJumps; i++)
+	{
+		disp = compiledOfs - (nextJumpOfs[i] + nextJumpSize[i]);
+
+		if(nextJumpSize[i] == 4)
+			Patch4(nextJumpOfs[i], disp);
+		else if(disp <= SCHAR_MAX)
+			buf[nextJumpOfs[i]] = disp;
+		else
+		{
+			VMFREE_BUFFERS();
+			Com_Error(ERR_DROP, "VM_CompileX86_64: jump to next instruction too far (%d)", disp);
+		}
+	}
+
+	numNextJumps = 0;
+}
+
+#define SET_JMPOFS(x) do { buf[(x)] = compiledOfs - ((x) + 1); } while(0)
+
+// call an engine function, clobbers rax
+#define CALL_NATIVE(func) \
+	EmitString("48 B8");		/* movq $func, %rax */ \
+	EmitImport((void *) (func)); \
+	EmitString("FF D0")			/* callq *%rax */
+
 #ifdef DEBUG_VM
 #define RANGECHECK(reg, bytes) \
-	emit("movl %%" #reg ", %%ecx"); \
-	emit("andl $0x%x, %%ecx", vm->dataMask &~(bytes-1)); \
-	emit("cmpl %%" #reg ", %%ecx"); \
-	emit("jz rc_ok_i_%08x", instruction); \
-	emit("movq $%"PRIu64", %%rax", (intptr_t) memviolation); \
-	emit("callq *%%rax"); \
-	emit("rc_ok_i_%08x:", instruction)
+	do { \
+		int jmpOk; \
+		Emit1(0x89); Emit1(0xC0 | ((reg) << 3) | R_ECX);	/* movl %reg, %ecx */ \
+		EmitRegImm(4, R_ECX, (unsigned) (vm->dataMask &~(bytes-1)));	/* andl $mask, %ecx */ \
+		Emit1(0x39); Emit1(0xC0 | ((reg) << 3) | R_ECX);	/* cmpl %reg, %ecx */ \
+		EmitString("74");		/* jz rc_ok */ \
+		jmpOk = compiledOfs++; \
+		CALL_NATIVE(memviolation); \
+		SET_JMPOFS(jmpOk);		/* rc_ok: */ \
+	} while(0)
 #elif 1
 // check is too expensive, so just confine memory access
 #define RANGECHECK(reg, bytes) \
-	emit("andl $0x%x, %%" #reg, vm->dataMask &~(bytes-1))
+	EmitRegImm(4, reg, (unsigned) (vm->dataMask &~(bytes-1)))	// andl $mask, %reg
 #else
 #define RANGECHECK(reg, bytes)
 #endif
 
 #define STACK_PUSH(bytes) \
-	emit("addb $0x%x, %%bl", bytes >> 2); \
+	EmitString("80 C3");		/* addb $x, %bl */ \
+	Emit1((bytes) >> 2)
 
 #define STACK_POP(bytes) \
-	emit("subb $0x%x, %%bl", bytes >> 2); \
-
-#define CHECK_INSTR_REG(reg) \
-	emit("cmpl $%u, %%"#reg, header->instructionCount); \
-	emit("jb jmp_ok_i_%08x", instruction); \
-	emit("movq $%"PRIu64", %%rax", (intptr_t)jmpviolation); \
-	emit("callq *%%rax"); \
-	emit("jmp_ok_i_%08x:", instruction)
-
-#define PREPARE_JMP(reg) \
-	CHECK_INSTR_REG(reg); \
-	emit("movq $%"PRIu64", %%rsi", (intptr_t)vm->instructionPointers); \
-	emit("movl (%%rsi, %%rax, 8), %%eax"); \
-	emit("addq %%r10, %%rax")
+	EmitString("80 EB");		/* subb $x, %bl */ \
+	Emit1((bytes) >> 2)
+
+// instruction number in eax
+#define CHECK_INSTR_REG() \
+	do { \
+		int jmpOk; \
+		EmitRegImm(7, R_EAX, (unsigned) header->instructionCount);	/* cmpl $count, %eax */ \
+		EmitString("72");		/* jb jmp_ok */ \
+		jmpOk = compiledOfs++; \
+		CALL_NATIVE(jmpviolation); \
+		SET_JMPOFS(jmpOk);		/* jmp_ok: */ \
+	} while(0)
+
+// turns the instruction number in eax into its code address
+#define PREPARE_JMP() \
+	CHECK_INSTR_REG(); \
+	EmitString("48 BE");		/* movq $instructionPointers, %rsi */ \
+	EmitRelocPtr(VMR_INSTRUCTIONS, vm->instructionPointers, 0); \
+	EmitString("8B 04 C6");		/* movl (%rsi, %rax, 8), %eax */ \
+	EmitString("4C 01 D0")		/* addq %r10, %rax */
 
 #define CHECK_INSTR(nr) \
 	do { if(nr < 0 || nr >= header->instructionCount) { \
-		VM_FREEBUFFERS(vm); \
+		VMFREE_BUFFERS(); \
 		Com_Error( ERR_DROP, \
 			"%s: jump target 0x%x out of range at offset %d", __func__, nr, pc ); \
 	} } while(0)
 
 #define JMPIARG() \
 	CHECK_INSTR(iarg); \
-	emit("movq $%"PRIu64", %%rax", vm->codeBase+vm->instructionPointers[iarg]); \
-	emit("jmpq *%%rax")
- 
+	EmitCodeAddress(iarg);		/* movq $address, %rax */ \
+	EmitString("FF E0")			/* jmpq *%rax */
+
+// keep the stack 16 byte aligned around calls into the engine
+#define SAVE_REGS() \
+	EmitString("57");			/* push %rdi */ \
+	EmitString("41 50");		/* push %r8 */ \
+	EmitString("41 51");		/* push %r9 */ \
+	EmitString("41 52");		/* push %r10 */ \
+	EmitString("48 89 E6");		/* movq %rsp, %rsi */ \
+	EmitString("48 83 EE 08");	/* subq $8, %rsi */ \
+	EmitString("48 83 E6 7F");	/* andq $127, %rsi */ \
+	EmitString("48 29 F4");		/* subq %rsi, %rsp */ \
+	EmitString("56")			/* push %rsi */
+
+#define RESTORE_REGS() \
+	EmitString("5E");			/* pop %rsi */ \
+	EmitString("48 01 F4");		/* addq %rsi, %rsp */ \
+	EmitString("41 5A");		/* pop %r10 */ \
+	EmitString("41 59");		/* pop %r9 */ \
+	EmitString("41 58");		/* pop %r8 */ \
+	EmitString("5F")			/* pop %rdi */
+
 #define CONST_OPTIMIZE
 #ifdef CONST_OPTIMIZE
 #define MAYBE_EMIT_CONST() \
 	if (got_const) \
 	{ \
 		got_const = 0; \
-		vm->instructionPointers[instruction-1] = assembler_get_code_size(); \
+		vm->instructionPointers[instruction-1] = compiledOfs; \
 		STACK_PUSH(4); \
-		emit("movl $%d, (%%r9, %%rbx, 4)", const_value); \
+		EmitString("41 C7 04 99");	/* movl $x, (%r9, %rbx, 4) */ \
+		Emit4(const_value); \
 	}
 #else
 #define MAYBE_EMIT_CONST()
 #endif
 
-// integer compare and jump
-#define IJ(op) \
-	MAYBE_EMIT_CONST(); \
-	STACK_POP(8); \
-	emit("movl 4(%%r9, %%rbx, 4), %%eax"); \
-	emit("cmpl 8(%%r9, %%rbx, 4), %%eax"); \
-	emit(op " i_%08x", instruction+1); \
-	JMPIARG(); \
-	neednilabel = 1
-
-#ifdef USE_X87
-#define FJ(bits, op) \
+// integer compare and jump, jcc is the inverted condition
+#define IJ(jcc) \
 	MAYBE_EMIT_CONST(); \
 	STACK_POP(8); \
-	emit("flds 4(%%r9, %%rbx, 4)");\
-	emit("fcomps 8(%%r9, %%rbx, 4)");\
-	emit("fnstsw %%ax");\
-	emit("testb $" #bits ", %%ah");\
-	emit(op " i_%08x", instruction+1);\
-	JMPIARG(); \
-	neednilabel = 1
-#define XJ(x)
-#else
-#define FJ(x, y)
-#define XJ(op) \
+	EmitString("41 8B 44 99 04");	/* movl 4(%r9, %rbx, 4), %eax */ \
+	EmitString("41 3B 44 99 08");	/* cmpl 8(%r9, %rbx, 4), %eax */ \
+	EmitJumpNext(jcc, 1); \
+	JMPIARG()
+
+#define XJ(jcc) \
 	MAYBE_EMIT_CONST(); \
 	STACK_POP(8); \
-	emit("movss 4(%%r9, %%rbx, 4), %%xmm0");\
-	emit("ucomiss 8(%%r9, %%rbx, 4), %%xmm0");\
-	emit("jp i_%08x", instruction+1);\
-	emit(op " i_%08x", instruction+1);\
-	JMPIARG(); \
-	neednilabel = 1
-#endif
+	EmitString("F3 41 0F 10 44 99 04");	/* movss 4(%r9, %rbx, 4), %xmm0 */ \
+	EmitString("41 0F 2E 44 99 08");	/* ucomiss 8(%r9, %rbx, 4), %xmm0 */ \
+	EmitJumpNext("7A", 1);				/* jp next */ \
+	EmitJumpNext(jcc, 1); \
+	JMPIARG()
 
+// op %eax, (%r9, %rbx, 4)
 #define SIMPLE(op) \
 	MAYBE_EMIT_CONST(); \
-	emit("movl (%%r9, %%rbx, 4), %%eax"); \
+	EmitString("41 8B 04 99");	/* movl (%r9, %rbx, 4), %eax */ \
 	STACK_POP(4); \
-	emit(op " %%eax, (%%r9, %%rbx, 4)")
+	EmitString("41 " op " 04 99")
 
-#ifdef USE_X87
-#define FSIMPLE(op) \
-	MAYBE_EMIT_CONST(); \
-	STACK_POP(4); \
-	emit("flds (%%r9, %%rbx, 4)"); \
-	emit(op " 4(%%r9, %%rbx, 4)"); \
-	emit("fstps (%%r9, %%rbx, 4)")
-#define XSIMPLE(op)
-#else
-#define FSIMPLE(op)
+// op 4(%r9, %rbx, 4), %xmm0
 #define XSIMPLE(op) \
 	MAYBE_EMIT_CONST(); \
 	STACK_POP(4); \
-	emit("movss (%%r9, %%rbx, 4), %%xmm0"); \
-	emit(op " 4(%%r9, %%rbx, 4), %%xmm0"); \
-	emit("movss %%xmm0, (%%r9, %%rbx, 4)")
-#endif
+	EmitString("F3 41 0F 10 04 99");	/* movss (%r9, %rbx, 4), %xmm0 */ \
+	EmitString("F3 41 0F " op " 44 99 04"); \
+	EmitString("F3 41 0F 11 04 99")		/* movss %xmm0, (%r9, %rbx, 4) */
 
+// op %cl, %eax
 #define SHIFT(op) \
 	MAYBE_EMIT_CONST(); \
 	STACK_POP(4); \
-	emit("movl 4(%%r9, %%rbx, 4), %%ecx"); \
-	emit("movl (%%r9, %%rbx, 4), %%eax"); \
-	emit(op " %%cl, %%eax"); \
-	emit("movl %%eax, (%%r9, %%rbx, 4)")
+	EmitString("41 8B 4C 99 04");	/* movl 4(%r9, %rbx, 4), %ecx */ \
+	EmitString("41 8B 04 99");		/* movl (%r9, %rbx, 4), %eax */ \
+	EmitString("D3 " op); \
+	EmitString("41 89 04 99")		/* movl %eax, (%r9, %rbx, 4) */
 
 #ifdef DEBUG_VM
 #define NOTIMPL(x) \
-	do { Com_Error(ERR_DROP, "instruction not implemented: %s", opnames[x]); } while(0)
+	do { VMFREE_BUFFERS(); Com_Error(ERR_DROP, "instruction not implemented: %s", opnames[x]); } while(0)
 #else
 #define NOTIMPL(x) \
-	do { Com_Printf(S_COLOR_RED "instruction not implemented: %x\n", x); vm->compiled = qfalse; return; } while(0)
+	do { Com_Printf(S_COLOR_RED "instruction not implemented: %x\n", x); VMFREE_BUFFERS(); vm->compiled = qfalse; return; } while(0)
 #endif
 
 static void* getentrypoint(vm_t* vm)
@@ -407,9 +602,1153 @@ static __attribute__ ((noreturn)) void CROSSCALL opstackviolation(void)
 }
 #endif
 
+/*
+=================
+EmitImport
+
+Engine functions are called through this table, the code cache finds them
+again by index when the engine has moved
+=================
+*/
+static void *imports[] = {
+	(void *) callAsmCall,
+	(void *) VM_BlockCopy,
+	(void *) eop,
+	(void *) jmpviolation,
+#ifdef DEBUG_VM
+	(void *) memviolation,
+	(void *) opstackviolation,
+#endif
+};
+
+static vmBackend_t backend = { "vm_x86_64 " __DATE__ " " __TIME__, 0, imports, ARRAY_LEN(imports) };
+
+static void EmitImport( void *func )
+{
+	int i;
+
+	for(i = 0; i < ARRAY_LEN(imports); i++)
+	{
+		if(imports[i] == func)
+		{
+			EmitRelocPtr(VMR_IMPORT, func, i);
+			return;
+		}
+	}
+
+	VMFREE_BUFFERS();
+	Com_Error(ERR_DROP, "VM_CompileX86_64: %p is not in the import table", func);
+}
+
+/*
+==============================================================================
+
+INLINE SYSCALLS
+
+The sqrt and memory traps shared by all modules are compiled to native code
+instead of going through callAsmCall. sin and cos stay syscalls, the x87
+fsin/fcos are slower than libm. The result is pushed to the opStack
+in memory, so the caller has to flush the register cache first. Blocks that
+don't fit in the data segment still go to the module, which decides what
+happens to them.
+
+==============================================================================
+*/
+
+static	qboolean	inlineSyscalls;
+static	int			numInlined;
+
+static qboolean InlineSyscall( int callnum )
+{
+	if(!inlineSyscalls)
+		return qfalse;
+
+	switch(callnum)
+	{
+		case TRAP_MEMSET:
+		case TRAP_MEMCPY:
+		case TRAP_SQRT:
+			return qtrue;
+		default:
+			return qfalse;
+	}
+}
+
+// opcode reg, 4+4*arg(%r8, %rdi, 1) - syscall arguments follow the return address
+static void EmitSyscallArg( const char *opcode, int reg, int arg )
+{
+	EmitString(opcode);
+	Emit1(0x44 | (reg << 3));
+	Emit1(0x38);
+	Emit1(4 + 4 * arg);
+}
+
+static void EmitInlineSyscall( vm_t *vm, int callnum )
+{
+	int jmpSyscall[3], numJmpSyscall = 0, jmpDone;
+	int size = vm->dataMask + 1;
+	int i;
+
+	numInlined++;
+
+	switch(callnum)
+	{
+		case TRAP_SQRT:
+			EmitSyscallArg("F3 41 0F 51", 0, 1);	// sqrtss arg1, %xmm0
+			STACK_PUSH(4);
+			EmitString("F3 41 0F 11 04 99");	// movss %xmm0, (%r9, %rbx, 4)
+			return;
+	}
+
+	EmitSyscallArg("41 8B", R_ECX, 3);		// movl arg3, %ecx - count
+	EmitSyscallArg("41 8B", R_EAX, 2);		// movl arg2, %eax - value or source
+	EmitSyscallArg("41 8B", R_EDX, 1);		// movl arg1, %edx - destination
+
+	// count <= size and dest + count <= size, the first keeps the sum from wrapping
+	EmitRegImm(7, R_ECX, size);		// cmpl $size, %ecx
+	EmitString("77");			// ja syscall
+	jmpSyscall[numJmpSyscall++] = compiledOfs++;
+
+	EmitRegImm(4, R_EDX, vm->dataMask);	// andl $mask, %edx
+	EmitString("01 CA");			// addl %ecx, %edx
+	EmitRegImm(7, R_EDX, size);		// cmpl $size, %edx
+	EmitString("77");			// ja syscall
+	jmpSyscall[numJmpSyscall++] = compiledOfs++;
+	EmitString("29 CA");			// subl %ecx, %edx
+
+	if(callnum == TRAP_MEMCPY)
+	{
+		EmitRegImm(4, R_EAX, vm->dataMask);	// andl $mask, %eax
+		EmitString("01 C8");		// addl %ecx, %eax
+		EmitRegImm(7, R_EAX, size);	// cmpl $size, %eax
+		EmitString("77");		// ja syscall
+		jmpSyscall[numJmpSyscall++] = compiledOfs++;
+		EmitString("29 C8");		// subl %ecx, %eax
+	}
+
+	EmitString("57");			// push %rdi
+	EmitString("49 8D 3C 10");		// leaq (%r8, %rdx, 1), %rdi
+	if(callnum == TRAP_MEMCPY)
+	{
+		EmitString("49 8D 34 00");	// leaq (%r8, %rax, 1), %rsi
+		EmitString("F3 A4");		// rep movsb
+	}
+	else
+		EmitString("F3 AA");		// rep stosb
+	EmitString("5F");			// pop %rdi
+
+	// the modules return 0 from both
+	STACK_PUSH(4);
+	EmitString("41 C7 04 99");		// movl $0, (%r9, %rbx, 4)
+	Emit4(0);
+	EmitString("EB");			// jmp done
+	jmpDone = compiledOfs++;
+
+	// syscall:
+	for(i = 0; i < numJmpSyscall; i++)
+		SET_JMPOFS(jmpSyscall[i]);
+
+	SAVE_REGS();
+	EmitString("48 BE");			// movq $x, %rsi - second argument in rsi
+	Emit8(callnum);
+	CALL_NATIVE(callAsmCall);
+	RESTORE_REGS();
+	STACK_PUSH(4);
+	EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
+
+	// done:
+	SET_JMPOFS(jmpDone);
+}
+
+/*
+==============================================================================
+
+REGISTER CACHED TRANSLATION
+
+With vm_jitOptimize set, the top of the opStack is kept in registers and
+constants are folded into the instructions that use them, instead of moving
+every operand through (%r9, %rbx, 4). The cached slots sit on top of the part
+of the opStack that is in memory and are written back at basic block leaders,
+before calls and computed jumps and whenever a register is needed. Compare
+and jump pairs become a single cmp and jcc straight to the target.
+
+Memory accesses are masked with the data mask and the opStack index stays in
+bl exactly as in the plain translation, so both guards are unchanged.
+
+==============================================================================
+*/
+
+#define R_R11	11
+#define R_R12	12
+#define R_R13	13
+#define R_R14	14
+#define R_R15	15
+
+// at most this many opStack slots are cached, flushing them writes up to
+// 4*MAX_CACHED bytes above bl which still lies within the padded opStack
+#define MAX_CACHED	8
+
+// operand flags for EmitModRM
+#define RM_BYTE		1		// 8 bit register operand, sil and dil need a REX prefix
+
+typedef enum {
+	RM_REG,			// %rm
+	RM_OPSTACK,		// disp(%r9, %rbx, 4)
+	RM_DATA,		// (%r8, %rm, 1)
+	RM_DATADISP,	// disp(%r8)
+	RM_FRAME		// disp(%rdi)
+} rmMode_t;
+
+typedef enum {
+	CS_CONST,
+	CS_REG
+} cacheType_t;
+
+typedef struct {
+	cacheType_t	type;
+	int			value;		// constant or register number
+} cacheSlot_t;
+
+// eax, ecx and edx are left free as scratch for division, shifts and calls
+static const int cacheRegs[] = { R_ESI, R_R11, R_R12, R_R13, R_R14, R_R15 };
+
+static	cacheSlot_t	cache[MAX_CACHED];
+static	int			numCached = 0;
+static	qboolean	regBusy[16];
+
+/*
+=================
+EmitModRM
+
+[prefix] [REX] opcode ModRM [SIB] [disp], reg goes into the ModRM reg field
+and the r/m operand is described by mode. Opcodes above 0xFF are 0F xx.
+=================
+*/
+static void EmitModRM( int prefix, int flags, int opcode, int reg, rmMode_t mode, int rm, int disp )
+{
+	int rex = 0;
+
+	if(reg & 8)
+		rex |= 4;
+	if((flags & RM_BYTE) && ((reg >= 4 && reg < 8) || (mode == RM_REG && rm >= 4 && rm < 8)))
+		rex |= 0x40;
+
+	switch(mode)
+	{
+		case RM_REG:
+			if(rm & 8)
+				rex |= 1;
+			break;
+		case RM_DATA:
+			if(rm & 8)
+				rex |= 2;
+			// fall through
+		case RM_OPSTACK:
+		case RM_DATADISP:
+			rex |= 1;		// r8 or r9 as base
+			break;
+		case RM_FRAME:
+			break;
+	}
+
+	if(prefix)
+		Emit1(prefix);
+	if(rex)
+		Emit1(0x40 | (rex & 0x0F));
+	if(opcode > 0xFF)
+		Emit1(opcode >> 8);
+	Emit1(opcode & 0xFF);
+
+	reg = (reg & 7) << 3;
+
+	switch(mode)
+	{
+		case RM_REG:
+			Emit1(0xC0 | reg | (rm & 7));
+			break;
+		case RM_OPSTACK:
+			if(!disp)
+			{
+				Emit1(0x04 | reg);
+				Emit1(0x99);		// SIB: %r9 + %rbx * 4
+			}
+			else if(iss8(disp))
+			{
+				Emit1(0x44 | reg);
+				Emit1(0x99);
+				Emit1(disp);
+			}
+			else
+			{
+				Emit1(0x84 | reg);
+				Emit1(0x99);
+				Emit4(disp);
+			}
+			break;
+		case RM_DATA:
+			Emit1(0x04 | reg);
+			Emit1((rm & 7) << 3);	// SIB: %r8 + %rm * 1
+			break;
+		case RM_DATADISP:
+			Emit1(0x80 | reg);
+			Emit4(disp);
+			break;
+		case RM_FRAME:
+			if(iss8(disp))
+			{
+				Emit1(0x47 | reg);
+				Emit1(disp);
+			}
+			else
+			{
+				Emit1(0x87 | reg);
+				Emit4(disp);
+			}
+			break;
+	}
+}
+
+static void EmitMovRegImm( int reg, int imm )
+{
+	if(reg & 8)
+		Emit1(0x41);
+	Emit1(0xB8 | (reg & 7));		// movl $imm, %reg
+	Emit4(imm);
+}
+
+static void EmitMovRegReg( int dst, int src )
+{
+	EmitModRM(0, 0, 0x89, src, RM_REG, dst, 0);	// movl %src, %dst
+}
+
+/*
+=================
+EmitJumpTarget
+
+rel32 of a jmp, jcc or call to another instruction. Targets ahead are not
+known yet, so all of them are patched after translation.
+=================
+*/
+static void EmitJumpTarget( int instruction )
+{
+	codeFixups[numCodeFixups].ofs = compiledOfs;
+	codeFixups[numCodeFixups].instruction = instruction;
+	codeFixups[numCodeFixups].relative = qtrue;
+	numCodeFixups++;
+	Emit4(0);
+}
+
+static int AllocReg( void );
+
+static void StoreSlot( cacheSlot_t *slot, int disp )
+{
+	if(slot->type == CS_CONST)
+	{
+		EmitModRM(0, 0, 0xC7, 0, RM_OPSTACK, 0, disp);	// movl $x, disp(%r9, %rbx, 4)
+		Emit4(slot->value);
+	}
+	else
+	{
+		EmitModRM(0, 0, 0x89, slot->value, RM_OPSTACK, 0, disp);	// movl %reg, disp(%r9, %rbx, 4)
+		regBusy[slot->value] = qfalse;
+	}
+}
+
+/*
+=================
+FlushCache
+
+Write all cached slots to the opStack in memory
+=================
+*/
+static void FlushCache( void )
+{
+	int i;
+
+	if(!numCached)
+		return;
+
+	for(i = 0; i < numCached; i++)
+		StoreSlot(&cache[i], 4 * (i + 1));
+
+	STACK_PUSH(4 * numCached);
+	numCached = 0;
+}
+
+// write the deepest cached slot to memory to make room
+static void SpillBottom( void )
+{
+	StoreSlot(&cache[0], 4);
+	STACK_PUSH(4);
+	numCached--;
+	memmove(cache, cache + 1, numCached * sizeof(*cache));
+}
+
+static int AllocReg( void )
+{
+	int i;
+
+	while(1)
+	{
+		for(i = 0; i < (int) ARRAY_LEN(cacheRegs); i++)
+		{
+			if(!regBusy[cacheRegs[i]])
+			{
+				regBusy[cacheRegs[i]] = qtrue;
+				return cacheRegs[i];
+			}
+		}
+
+		if(!numCached)
+		{
+			VMFREE_BUFFERS();
+			Com_Error(ERR_DROP, "VM_CompileX86_64: out of registers");
+		}
+
+		SpillBottom();
+	}
+}
+
+static void FreeSlot( cacheSlot_t *slot )
+{
+	if(slot->type == CS_REG)
+		regBusy[slot->value] = qfalse;
+}
+
+static void PushSlot( cacheType_t type, int value )
+{
+	if(numCached == MAX_CACHED)
+		SpillBottom();
+
+	cache[numCached].type = type;
+	cache[numCached].value = value;
+	numCached++;
+}
+
+#define PushConst(x)	PushSlot(CS_CONST, (x))
+#define PushReg(r)		PushSlot(CS_REG, (r))
+
+// take the top of the opStack, the caller owns the register it may be in
+static cacheSlot_t PopSlot( void )
+{
+	cacheSlot_t slot;
+
+	if(numCached)
+		return cache[--numCached];
+
+	slot.type = CS_REG;
+	slot.value = AllocReg();
+	EmitModRM(0, 0, 0x8B, slot.value, RM_OPSTACK, 0, 0);	// movl (%r9, %rbx, 4), %reg
+	STACK_POP(4);
+
+	return slot;
+}
+
+// make sure a popped slot is in a register
+static int SlotReg( cacheSlot_t *slot )
+{
+	if(slot->type == CS_CONST)
+	{
+		int reg = AllocReg();
+
+		EmitMovRegImm(reg, slot->value);
+		slot->type = CS_REG;
+		slot->value = reg;
+	}
+
+	return slot->value;
+}
+
+// copy a popped slot into one of the scratch registers and release it
+static void SlotToScratch( cacheSlot_t *slot, int reg )
+{
+	if(slot->type == CS_CONST)
+		EmitMovRegImm(reg, slot->value);
+	else
+	{
+		EmitMovRegReg(reg, slot->value);
+		regBusy[slot->value] = qfalse;
+	}
+}
+
+/*
+=================
+MarkLeaders
+
+Find all instructions that can be reached other than from the instruction
+before them. The opStack must be in memory when they are entered.
+=================
+*/
+static void MarkLeaders( vm_t *vm, vmHeader_t *header )
+{
+	byte *code = (byte *) header + header->codeOffset;
+	int pc = 0, lastConst = -1;
+	int i, op, iarg;
+
+	for(i = 0; i < header->instructionCount; i++)
+	{
+		op = code[pc++];
+		iarg = 0;
+
+		if(op_argsize[op] == 4)
+		{
+			iarg = *(int *) (code + pc);
+			pc += 4;
+		}
+		else
+			pc += op_argsize[op];
+
+		if(op == OP_ENTER)
+			jused[i] = 1;
+		else if(op >= OP_EQ && op <= OP_GEF)
+		{
+			if(iarg >= 0 && iarg < header->instructionCount)
+				jused[iarg] = 1;
+		}
+		else if((op == OP_JUMP || op == OP_CALL) && lastConst >= 0 && lastConst < header->instructionCount)
+			jused[lastConst] = 1;
+
+		lastConst = (op == OP_CONST) ? iarg : -1;
+	}
+
+	for(i = 0; i < vm->numJumpTableTargets; i++)
+	{
+		int target = ((int *) vm->jumpTableTargets)[i];
+
+		if(target >= 0 && target < header->instructionCount)
+			jused[target] = 1;
+	}
+
+	jused[0] = 1;
+}
+
+/*
+=================
+EmitCachedOp
+
+Translate one instruction with the opStack cache, returns qfalse for
+instructions that can't be compiled
+=================
+*/
+static qboolean EmitCachedOp( vm_t *vm, vmHeader_t *header, int op, int iarg, int barg, int instruction, int pc )
+{
+	cacheSlot_t a, b;
+	int ra, rb, mask;
+
+	switch(op)
+	{
+		case OP_UNDEF:
+			return qfalse;
+		case OP_IGNORE:
+			break;
+		case OP_BREAK:
+			FlushCache();
+			EmitString("CC");		// int3
+			break;
+		case OP_ENTER:
+			FlushCache();
+			EmitRegImm(5, R_EDI, iarg);	// subl $iarg, %edi
+			break;
+		case OP_LEAVE:
+			FlushCache();
+			EmitRegImm(0, R_EDI, iarg);	// addl $iarg, %edi
+			EmitString("C3");		// ret
+			break;
+		case OP_CALL:
+			a = PopSlot();
+
+			if(a.type == CS_CONST && a.value >= 0)
+			{
+				CHECK_INSTR(a.value);
+				FlushCache();
+				RANGECHECK(R_EDI, 4);
+				EmitString("41 C7 04 38");	// movl $x, (%r8, %rdi, 1) - save next instruction
+				Emit4(instruction + 1);
+				EmitString("E8");			// call target
+				EmitJumpTarget(a.value);
+			}
+			else if(a.type == CS_CONST && InlineSyscall(-1 - a.value))
+			{
+				FlushCache();
+				RANGECHECK(R_EDI, 4);
+				EmitString("41 C7 04 38");	// movl $x, (%r8, %rdi, 1) - save next instruction
+				Emit4(instruction + 1);
+				EmitInlineSyscall(vm, -1 - a.value);
+			}
+			else if(a.type == CS_CONST)
+			{
+				FlushCache();
+				RANGECHECK(R_EDI, 4);
+				EmitString("41 C7 04 38");
+				Emit4(instruction + 1);
+				SAVE_REGS();
+				EmitString("48 BE");		// movq $x, %rsi - second argument in rsi
+				Emit8((unsigned) (-1 - a.value));
+				CALL_NATIVE(callAsmCall);
+				RESTORE_REGS();
+				ra = AllocReg();
+				EmitMovRegReg(ra, R_EAX);	// keep the return value cached
+				PushReg(ra);
+			}
+			else
+			{
+				int jmpSyscall, jmpDone;
+
+				SlotToScratch(&a, R_EAX);
+				FlushCache();
+				RANGECHECK(R_EDI, 4);
+				EmitString("41 C7 04 38");
+				Emit4(instruction + 1);
+
+				EmitString("09 C0");		// orl %eax, %eax
+				EmitString("7C");			// jl callSyscall
+				jmpSyscall = compiledOfs++;
+
+				PREPARE_JMP();
+				EmitString("FF D0");		// callq *%rax
+				EmitString("EB");			// jmp done
+				jmpDone = compiledOfs++;
+
+				SET_JMPOFS(jmpSyscall);		// callSyscall:
+				SAVE_REGS();
+				EmitString("F7 D0");		// notl %eax
+				EmitString("48 89 C6");		// movq %rax, %rsi
+				CALL_NATIVE(callAsmCall);
+				RESTORE_REGS();
+				STACK_PUSH(4);
+				EmitString("41 89 04 99");	// movl %eax, (%r9, %rbx, 4)
+				SET_JMPOFS(jmpDone);		// done:
+			}
+			break;
+		case OP_PUSH:
+			PushConst(0);
+			break;
+		case OP_POP:
+			if(numCached)
+				FreeSlot(&cache[--numCached]);
+			else
+			{
+				STACK_POP(4);
+			}
+			break;
+		case OP_CONST:
+			PushConst(iarg);
+			break;
+		case OP_LOCAL:
+			ra = AllocReg();
+			EmitModRM(0, 0, 0x8D, ra, RM_FRAME, 0, iarg);	// leal iarg(%rdi), %reg
+			PushReg(ra);
+			break;
+		case OP_JUMP:
+			a = PopSlot();
+
+			if(a.type == CS_CONST)
+			{
+				CHECK_INSTR(a.value);
+				FlushCache();
+				EmitString("E9");			// jmp target
+				EmitJumpTarget(a.value);
+			}
+			else
+			{
+				SlotToScratch(&a, R_EAX);
+				FlushCache();
+				PREPARE_JMP();
+				EmitString("FF E0");		// jmpq *%rax
+			}
+			break;
+		case OP_EQ:
+		case OP_NE:
+		case OP_LTI:
+		case OP_LEI:
+		case OP_GTI:
+		case OP_GEI:
+		case OP_LTU:
+		case OP_LEU:
+		case OP_GTU:
+		case OP_GEU:
+		{
+			static const byte jcc[] = {
+				0x84, 0x85, 0x8C, 0x8E, 0x8F, 0x8D, 0x82, 0x86, 0x87, 0x83
+			};
+
+			CHECK_INSTR(iarg);
+			b = PopSlot();
+			a = PopSlot();
+			ra = SlotReg(&a);
+			FlushCache();
+
+			if(b.type == CS_CONST)
+				EmitRegImm(7, ra, b.value);	// cmpl $b, %a
+			else
+			{
+				EmitModRM(0, 0, 0x39, b.value, RM_REG, ra, 0);	// cmpl %b, %a
+				FreeSlot(&b);
+			}
+			FreeSlot(&a);
+
+			Emit1(0x0F);
+			Emit1(jcc[op - OP_EQ]);
+			EmitJumpTarget(iarg);
+			break;
+		}
+		case OP_EQF:
+		case OP_NEF:
+		case OP_LTF:
+		case OP_LEF:
+		case OP_GTF:
+		case OP_GEF:
+			CHECK_INSTR(iarg);
+			b = PopSlot();
+			a = PopSlot();
+			rb = SlotReg(&b);
+			ra = SlotReg(&a);
+			FlushCache();
+			EmitModRM(0x66, 0, 0x0F6E, 0, RM_REG, ra, 0);	// movd %a, %xmm0
+			EmitModRM(0x66, 0, 0x0F6E, 1, RM_REG, rb, 0);	// movd %b, %xmm1
+			EmitString("0F 2E C1");		// ucomiss %xmm1, %xmm0
+			FreeSlot(&a);
+			FreeSlot(&b);
+
+			switch(op)
+			{
+				case OP_EQF:
+					EmitString("7A 06 0F 84");	// jp skip; je target
+					break;
+				case OP_NEF:
+					EmitString("0F 8A");		// jp target
+					EmitJumpTarget(iarg);
+					EmitString("0F 85");		// jne target
+					break;
+				case OP_LTF:
+					EmitString("7A 06 0F 82");	// jp skip; jb target
+					break;
+				case OP_LEF:
+					EmitString("7A 06 0F 86");	// jp skip; jbe target
+					break;
+				case OP_GTF:
+					EmitString("0F 87");		// ja target
+					break;
+				case OP_GEF:
+					EmitString("0F 83");		// jae target
+					break;
+			}
+			EmitJumpTarget(iarg);
+			break;
+		case OP_LOAD1:
+		case OP_LOAD2:
+		case OP_LOAD4:
+		{
+			int opcode = (op == OP_LOAD4) ? 0x8B : ((op == OP_LOAD2) ? 0x0FB7 : 0x0FB6);
+
+			mask = vm->dataMask & ~((op == OP_LOAD4) ? 3 : ((op == OP_LOAD2) ? 1 : 0));
+			a = PopSlot();
+
+			if(a.type == CS_CONST)
+			{
+				ra = AllocReg();
+				EmitModRM(0, 0, opcode, ra, RM_DATADISP, 0, a.value & mask);	// mov[zx] addr(%r8), %reg
+			}
+			else
+			{
+				ra = a.value;
+				EmitRegImm(4, ra, (unsigned) mask);		// andl $mask, %reg
+				EmitModRM(0, 0, opcode, ra, RM_DATA, ra, 0);	// mov[zx] (%r8, %reg, 1), %reg
+			}
+			PushReg(ra);
+			break;
+		}
+		case OP_STORE1:
+		case OP_STORE2:
+		case OP_STORE4:
+		{
+			rmMode_t mode;
+			int disp = 0;
+
+			mask = vm->dataMask & ~((op == OP_STORE4) ? 3 : ((op == OP_STORE2) ? 1 : 0));
+			b = PopSlot();
+			a = PopSlot();
+
+			if(a.type == CS_CONST)
+			{
+				mode = RM_DATADISP;
+				disp = a.value & mask;
+			}
+			else
+			{
+				mode = RM_DATA;
+				EmitRegImm(4, a.value, (unsigned) mask);	// andl $mask, %reg
+			}
+
+			if(b.type == CS_CONST)
+			{
+				if(op == OP_STORE1)
+				{
+					EmitModRM(0, 0, 0xC6, 0, mode, a.value, disp);	// movb $x, mem
+					Emit1(b.value);
+				}
+				else if(op == OP_STORE2)
+				{
+					EmitModRM(0x66, 0, 0xC7, 0, mode, a.value, disp);	// movw $x, mem
+					Emit1(b.value);
+					Emit1(b.value >> 8);
+				}
+				else
+				{
+					EmitModRM(0, 0, 0xC7, 0, mode, a.value, disp);	// movl $x, mem
+					Emit4(b.value);
+				}
+			}
+			else
+			{
+				if(op == OP_STORE1)
+					EmitModRM(0, RM_BYTE, 0x88, b.value, mode, a.value, disp);	// movb %reg, mem
+				else if(op == OP_STORE2)
+					EmitModRM(0x66, 0, 0x89, b.value, mode, a.value, disp);	// movw %reg, mem
+				else
+					EmitModRM(0, 0, 0x89, b.value, mode, a.value, disp);	// movl %reg, mem
+			}
+
+			FreeSlot(&a);
+			FreeSlot(&b);
+			break;
+		}
+		case OP_ARG:
+			a = PopSlot();
+			EmitModRM(0, 0, 0x8D, R_EAX, RM_FRAME, 0, barg);	// leal barg(%rdi), %eax
+			RANGECHECK(R_EAX, 4);
+
+			if(a.type == CS_CONST)
+			{
+				EmitModRM(0, 0, 0xC7, 0, RM_DATA, R_EAX, 0);	// movl $x, (%r8, %rax, 1)
+				Emit4(a.value);
+			}
+			else
+			{
+				EmitModRM(0, 0, 0x89, a.value, RM_DATA, R_EAX, 0);	// movl %reg, (%r8, %rax, 1)
+				FreeSlot(&a);
+			}
+			break;
+		case OP_BLOCK_COPY:
+			b = PopSlot();
+			a = PopSlot();
+			SlotToScratch(&b, R_EDX);
+			SlotToScratch(&a, R_ECX);
+			FlushCache();
+			SAVE_REGS();
+			EmitString("89 CF");			// movl %ecx, %edi - 1st argument dest
+			EmitString("89 D6");			// movl %edx, %esi - 2nd argument src
+			EmitString("BA");				// movl $iarg, %edx - 3rd argument count
+			Emit4(iarg);
+			CALL_NATIVE(VM_BlockCopy);
+			RESTORE_REGS();
+			break;
+		case OP_SEX8:
+		case OP_SEX16:
+			a = PopSlot();
+
+			if(a.type == CS_CONST)
+			{
+				PushConst((op == OP_SEX8) ? (signed char) a.value : (short) a.value);
+				break;
+			}
+
+			EmitModRM(0, RM_BYTE, (op == OP_SEX8) ? 0x0FBE : 0x0FBF, a.value, RM_REG, a.value, 0);	// movs[bw]l
+			PushReg(a.value);
+			break;
+		case OP_NEGI:
+		case OP_BCOM:
+			a = PopSlot();
+
+			if(a.type == CS_CONST)
+			{
+				PushConst((op == OP_NEGI) ? (int) -(unsigned) a.value : ~a.value);
+				break;
+			}
+
+			EmitModRM(0, 0, 0xF7, (op == OP_NEGI) ? 3 : 2, RM_REG, a.value, 0);	// negl / notl
+			PushReg(a.value);
+			break;
+		case OP_NEGF:
+			a = PopSlot();
+
+			if(a.type == CS_CONST)
+			{
+				PushConst(a.value ^ 0x80000000);
+				break;
+			}
+
+			EmitRegImm(6, a.value, (int) 0x80000000);	// xorl $0x80000000, %reg
+			PushReg(a.value);
+			break;
+		case OP_ADD:
+		case OP_SUB:
+		case OP_BAND:
+		case OP_BOR:
+		case OP_BXOR:
+		{
+			int subcode, opcode;
+
+			b = PopSlot();
+			a = PopSlot();
+
+			switch(op)
+			{
+				case OP_ADD: subcode = 0; opcode = 0x01; break;
+				case OP_SUB: subcode = 5; opcode = 0x29; break;
+				case OP_BAND: subcode = 4; opcode = 0x21; break;
+				case OP_BOR: subcode = 1; opcode = 0x09; break;
+				default: subcode = 6; opcode = 0x31; break;
+			}
+
+			if(a.type == CS_CONST && b.type == CS_CONST)
+			{
+				unsigned x = a.value, y = b.value;
+
+				switch(op)
+				{
+					case OP_ADD: x += y; break;
+					case OP_SUB: x -= y; break;
+					case OP_BAND: x &= y; break;
+					case OP_BOR: x |= y; break;
+					default: x ^= y; break;
+				}
+				PushConst(x);
+				break;
+			}
+
+			if(a.type == CS_CONST && op != OP_SUB)
+			{
+				cacheSlot_t t = a;
+
+				a = b;
+				b = t;
+			}
+
+			ra = SlotReg(&a);
+
+			if(b.type == CS_CONST)
+				EmitRegImm(subcode, ra, b.value);	// op $b, %a
+			else
+			{
+				EmitModRM(0, 0, opcode, b.value, RM_REG, ra, 0);	// op %b, %a
+				FreeSlot(&b);
+			}
+			PushReg(ra);
+			break;
+		}
+		case OP_MULI:
+		case OP_MULU:
+			b = PopSlot();
+			a = PopSlot();
+
+			if(a.type == CS_CONST && b.type == CS_CONST)
+			{
+				PushConst((unsigned) a.value * (unsigned) b.value);
+				break;
+			}
+
+			if(a.type == CS_CONST)
+			{
+				cacheSlot_t t = a;
+
+				a = b;
+				b = t;
+			}
+
+			// the low 32 bits are the same for signed and unsigned
+			ra = SlotReg(&a);
+
+			if(b.type == CS_CONST)
+			{
+				if(iss8(b.value))
+				{
+					EmitModRM(0, 0, 0x6B, ra, RM_REG, ra, 0);	// imull $b, %a, %a
+					Emit1(b.value);
+				}
+				else
+				{
+					EmitModRM(0, 0, 0x69, ra, RM_REG, ra, 0);
+					Emit4(b.value);
+				}
+			}
+			else
+			{
+				EmitModRM(0, 0, 0x0FAF, ra, RM_REG, b.value, 0);	// imull %b, %a
+				FreeSlot(&b);
+			}
+			PushReg(ra);
+			break;
+		case OP_DIVI:
+		case OP_DIVU:
+		case OP_MODI:
+		case OP_MODU:
+			b = PopSlot();
+			a = PopSlot();
+
+			if(a.type == CS_CONST && b.type == CS_CONST && b.value != 0
+				&& !((op == OP_DIVI || op == OP_MODI) && a.value == INT_MIN && b.value == -1))
+			{
+				switch(op)
+				{
+					case OP_DIVI: PushConst(a.value / b.value); break;
+					case OP_DIVU: PushConst((unsigned) a.value / (unsigned) b.value); break;
+					case OP_MODI: PushConst(a.value % b.value); break;
+					default: PushConst((unsigned) a.value % (unsigned) b.value); break;
+				}
+				break;
+			}
+
+			ra = (a.type == CS_REG) ? a.value : AllocReg();
+			SlotToScratch(&a, R_EAX);
+
+			if(op == OP_DIVI || op == OP_MODI)
+				EmitString("99");			// cdq
+			else
+				EmitString("31 D2");		// xorl %edx, %edx
+
+			if(b.type == CS_CONST)
+			{
+				EmitMovRegImm(R_ECX, b.value);
+				rb = R_ECX;
+			}
+			else
+				rb = b.value;
+
+			EmitModRM(0, 0, 0xF7, (op == OP_DIVI || op == OP_MODI) ? 7 : 6, RM_REG, rb, 0);	// idivl / divl
+			FreeSlot(&b);
+
+			regBusy[ra] = qtrue;
+			EmitMovRegReg(ra, (op == OP_DIVI || op == OP_DIVU) ? R_EAX : R_EDX);
+			PushReg(ra);
+			break;
+		case OP_LSH:
+		case OP_RSHI:
+		case OP_RSHU:
+		{
+			int subcode = (op == OP_LSH) ? 4 : ((op == OP_RSHI) ? 7 : 5);
+
+			b = PopSlot();
+			a = PopSlot();
+
+			if(a.type == CS_CONST && b.type == CS_CONST)
+			{
+				int n = b.value & 31;
+
+				if(op == OP_LSH)
+					PushConst((unsigned) a.value << n);
+				else if(op == OP_RSHI)
+					PushConst(a.value >> n);
+				else
+					PushConst((unsigned) a.value >> n);
+				break;
+			}
+
+			ra = SlotReg(&a);
+
+			if(b.type == CS_CONST)
+			{
+				EmitModRM(0, 0, 0xC1, subcode, RM_REG, ra, 0);	// shift $b, %a
+				Emit1(b.value & 31);
+			}
+			else
+			{
+				SlotToScratch(&b, R_ECX);
+				EmitModRM(0, 0, 0xD3, subcode, RM_REG, ra, 0);	// shift %cl, %a
+			}
+			PushReg(ra);
+			break;
+		}
+		case OP_ADDF:
+		case OP_SUBF:
+		case OP_MULF:
+		case OP_DIVF:
+		{
+			int opcode = (op == OP_ADDF) ? 0x0F58 : ((op == OP_SUBF) ? 0x0F5C : ((op == OP_MULF) ? 0x0F59 : 0x0F5E));
+
+			b = PopSlot();
+			a = PopSlot();
+			rb = SlotReg(&b);
+			ra = SlotReg(&a);
+			EmitModRM(0x66, 0, 0x0F6E, 0, RM_REG, ra, 0);	// movd %a, %xmm0
+			EmitModRM(0x66, 0, 0x0F6E, 1, RM_REG, rb, 0);	// movd %b, %xmm1
+			EmitModRM(0xF3, 0, opcode, 0, RM_REG, 1, 0);	// op %xmm1, %xmm0
+			EmitModRM(0x66, 0, 0x0F7E, 0, RM_REG, ra, 0);	// movd %xmm0, %a
+			FreeSlot(&b);
+			PushReg(ra);
+			break;
+		}
+		case OP_CVIF:
+			a = PopSlot();
+			ra = SlotReg(&a);
+			EmitModRM(0xF3, 0, 0x0F2A, 0, RM_REG, ra, 0);	// cvtsi2ss %a, %xmm0
+			EmitModRM(0x66, 0, 0x0F7E, 0, RM_REG, ra, 0);	// movd %xmm0, %a
+			PushReg(ra);
+			break;
+		case OP_CVFI:
+			a = PopSlot();
+			ra = SlotReg(&a);
+			EmitModRM(0x66, 0, 0x0F6E, 0, RM_REG, ra, 0);	// movd %a, %xmm0
+			EmitModRM(0xF3, 0, 0x0F2C, ra, RM_REG, 0, 0);	// cvttss2si %xmm0, %a
+			PushReg(ra);
+			break;
+		default:
+			return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+=================
+VM_AllocCode
+
+Writable memory for the final code, VM_ProtectCode makes it executable
+=================
+*/
+static void VM_AllocCode( vm_t *vm, int length )
+{
+	vm->codeLength = length;
+
+	#ifdef VM_X86_64_MMAP
+		vm->codeBase = mmap(NULL, length, PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+		if(vm->codeBase == MAP_FAILED)
+			Com_Error(ERR_FATAL, "VM_CompileX86_64: can't mmap memory");
+	#elif __WIN64__
+		// allocate memory with write permissions under windows.
+		vm->codeBase = VirtualAlloc(NULL, length, MEM_RESERVE|MEM_COMMIT, PAGE_READWRITE);
+		if(!vm->codeBase)
+			Com_Error(ERR_FATAL, "VM_CompileX86_64: VirtualAlloc failed");
+	#else
+		vm->codeBase = malloc(length);
+		if(!vm->codeBase)
+			Com_Error(ERR_FATAL, "VM_CompileX86_64: Failed to allocate memory");
+	#endif
+}
+
+static void VM_ProtectCode( vm_t *vm )
+{
+	#ifdef VM_X86_64_MMAP
+		if(mprotect(vm->codeBase, vm->codeLength, PROT_READ|PROT_EXEC))
+			Com_Error(ERR_FATAL, "VM_CompileX86_64: mprotect failed");
+	#elif __WIN64__
+		{
+			DWORD oldProtect = 0;
+
+			// remove write permissions; give exec permision
+			if(!VirtualProtect(vm->codeBase, vm->codeLength, PAGE_EXECUTE_READ, &oldProtect))
+				Com_Error(ERR_FATAL, "VM_CompileX86_64: VirtualProtect failed");
+		}
+	#endif
+}
+
 /*
 =================
 VM_Compile
+
+Machine code is emitted in a single pass. Jumps inside an instruction and to
+the next one are backpatched, absolute addresses of other instructions are
+fixed up after the code has been copied to executable memory.
 =================
 */
 void VM_Compile( vm_t *vm, vmHeader_t *header ) {
@@ -419,48 +1758,52 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 	char* code;
 	unsigned iarg = 0;
 	unsigned char barg = 0;
-	int neednilabel = 0;
+	int i;
+	qboolean optimize;
 	struct timeval tvstart =  {0, 0};
 #ifdef DEBUG_VM
 	char fn_d[MAX_QPATH]; // disassembled
 #endif
 
-	int pass;
-	size_t compiledOfs = 0;
-
 	// const optimization
 	unsigned got_const = 0, const_value = 0;
-	
+
 	vm->codeBase = NULL;
 
 	gettimeofday(&tvstart, NULL);
 
-	for (pass = 0; pass < 2; ++pass) {
+	// register caching needs to know all targets of computed jumps
+	optimize = Cvar_VariableIntegerValue("vm_jitOptimize") && vm->jumpTableTargets;
+	inlineSyscalls = Cvar_VariableIntegerValue("vm_inlineSyscalls");
+	numInlined = 0;
 
-	if(pass)
+	// reuse the code from the last time this image was compiled
+	backend.options = optimize | (inlineSyscalls << 1);
+	i = VM_FindCachedCode(vm, header, &backend);
+	if(i)
 	{
-		compiledOfs = assembler_get_code_size();
-		vm->codeLength = compiledOfs;
-
-		#ifdef VM_X86_64_MMAP
-			vm->codeBase = mmap(NULL, compiledOfs, PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
-			if(vm->codeBase == MAP_FAILED)
-				Com_Error(ERR_FATAL, "VM_CompileX86_64: can't mmap memory");
-		#elif __WIN64__
-			// allocate memory with write permissions under windows.
-			vm->codeBase = VirtualAlloc(NULL, compiledOfs, MEM_RESERVE|MEM_COMMIT, PAGE_READWRITE);
-			if(!vm->codeBase)
-				Com_Error(ERR_FATAL, "VM_CompileX86_64: VirtualAlloc failed");
-		#else
-			vm->codeBase = malloc(compiledOfs);
-			if(!vm_codeBase)
-				Com_Error(ERR_FATAL, "VM_CompileX86_64: Failed to allocate memory");
-		#endif
-
-		assembler_set_output((char*)vm->codeBase);
+		VM_AllocCode(vm, i);
+		VM_LinkCachedCode(vm, &backend);
+		VM_ProtectCode(vm);
+		vm->destroy = VM_Destroy_Compiled;
+		return;
 	}
 
-	assembler_init(pass);
+	bufSize = header->codeLength * 8 + VM_MAX_OPLEN;
+	buf = Z_Malloc(bufSize);
+	codeFixups = Z_Malloc(2 * header->instructionCount * sizeof(*codeFixups));
+	compiledOfs = 0;
+	numCodeFixups = 0;
+	numNextJumps = 0;
+	VM_TruncateRelocs(0);
+
+	if(optimize)
+	{
+		jused = Z_Malloc(header->instructionCount);
+		MarkLeaders(vm, header);
+		numCached = 0;
+		Com_Memset(regBusy, 0, sizeof(regBusy));
+	}
 
 #ifdef DEBUG_VM
 	strcpy(fn_d,vm->name);
@@ -475,16 +1818,28 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 
 	for ( instruction = 0; instruction < header->instructionCount; ++instruction )
 	{
+		if(compiledOfs > bufSize - VM_MAX_OPLEN)
+		{
+			byte *newBuf;
+
+			bufSize *= 2;
+			newBuf = Z_Malloc(bufSize);
+			Com_Memcpy(newBuf, buf, compiledOfs);
+			Z_Free(buf);
+			buf = newBuf;
+		}
+
 		op = code[ pc ];
 		++pc;
 
-		vm->instructionPointers[instruction] = assembler_get_code_size();
+		vm->instructionPointers[instruction] = compiledOfs;
 
 		/* store current instruction number in r15 for debugging */
 #if DEBUG_VM0
-		emit("nop");
-		emit("movq $%d, %%r15", instruction);
-		emit("nop");
+		EmitString("90");		// nop
+		EmitString("49 BF");	// movq $instruction, %r15
+		Emit8(instruction);
+		EmitString("90");		// nop
 #endif
 
 		if(op_argsize[op] == 4)
@@ -503,12 +1858,22 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 			Dfprintf(qdasmout, "%s\n", opnames[op]);
 		}
 
-		if(neednilabel)
+		if(optimize)
 		{
-			emit("i_%08x:", instruction);
-			neednilabel = 0;
+			if(jused[instruction])
+			{
+				FlushCache();
+				vm->instructionPointers[instruction] = compiledOfs;
+			}
+
+			if(!EmitCachedOp(vm, header, op, iarg, barg, instruction, pc))
+				NOTIMPL(op);
+
+			continue;
 		}
 
+		SetJumpsNext();
+
 		switch ( op )
 		{
 			case OP_UNDEF:
@@ -516,82 +1881,77 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 				break;
 			case OP_IGNORE:
 				MAYBE_EMIT_CONST();
-				emit("nop");
 				break;
 			case OP_BREAK:
 				MAYBE_EMIT_CONST();
-				emit("int3");
+				EmitString("CC");		// int3
 				break;
 			case OP_ENTER:
 				MAYBE_EMIT_CONST();
-				emit("subl $%d, %%edi", iarg);
+				EmitRegImm(5, R_EDI, (int) iarg);	// subl $iarg, %edi
 				break;
 			case OP_LEAVE:
 				MAYBE_EMIT_CONST();
-				emit("addl $%d, %%edi", iarg);          // get rid of stack frame
-				emit("ret");
+				EmitRegImm(0, R_EDI, (int) iarg);	// addl $iarg, %edi - get rid of stack frame
+				EmitString("C3");		// ret
 				break;
 			case OP_CALL:
-				RANGECHECK(edi, 4);
-				emit("movl $%d, (%%r8, %%rdi, 1)", instruction+1);  // save next instruction
+				RANGECHECK(R_EDI, 4);
+				EmitString("41 C7 04 38");		// movl $x, (%r8, %rdi, 1) - save next instruction
+				Emit4(instruction+1);
+
+				// the arguments are read from behind the return address
+				if(got_const && (int) const_value < 0 && InlineSyscall(-1 - const_value))
+				{
+					got_const = 0;
+					EmitInlineSyscall(vm, -1 - const_value);
+					break;
+				}
 
 				if(got_const)
 				{
 					if ((int) const_value >= 0)
 					{
 						CHECK_INSTR(const_value);
-						emit("movq $%"PRIu64", %%rax", vm->codeBase+vm->instructionPointers[const_value]);
-						emit("callq *%%rax");
+						EmitCodeAddress(const_value);	// movq $address, %rax
+						EmitString("FF D0");			// callq *%rax
 						got_const = 0;
 						break;
 					}
 				}
 				else
 				{
+					int jmpSyscall;
+
 					MAYBE_EMIT_CONST();
-					emit("movl (%%r9, %%rbx, 4), %%eax");  // get instr from stack
+					EmitString("41 8B 04 99");	// movl (%r9, %rbx, 4), %eax - get instr from stack
 					STACK_POP(4);
 
-					emit("orl %%eax, %%eax");
-					emit("jl callSyscall%d", instruction);
+					EmitString("09 C0");		// orl %eax, %eax
+					EmitString("7C");			// jl callSyscall
+					jmpSyscall = compiledOfs++;
 
-					PREPARE_JMP(eax);
-					emit("callq *%%rax");
+					PREPARE_JMP();
+					EmitString("FF D0");		// callq *%rax
 
-					emit("jmp i_%08x", instruction+1);
-					emit("callSyscall%d:", instruction);
+					EmitJumpNext("E9", 4);		// jmp next
+					SET_JMPOFS(jmpSyscall);		// callSyscall:
 				}
 
-//				emit("fnsave 4(%%r9, %%rsi, 1)");
-				emit("push %%rdi");
-				emit("push %%r8");
-				emit("push %%r9");
-				emit("push %%r10");
-				emit("movq %%rsp, %%rsi"); // we need to align the stack pointer
-				emit("subq $8, %%rsi");    //   |
-				emit("andq $127, %%rsi");  //   |
-				emit("subq %%rsi, %%rsp"); // <-+
-				emit("push %%rsi");
+				SAVE_REGS();
 				if(got_const) {
 					got_const = 0;
-					emit("movq $%u, %%rsi", -1-const_value); // second argument in rsi
+					EmitString("48 BE");		// movq $x, %rsi - second argument in rsi
+					Emit8((unsigned) (-1-const_value));
 				} else {
-					emit("notl %%eax");        // convert to actual number
+					EmitString("F7 D0");		// notl %eax - convert to actual number
 					// first argument already in rdi
-					emit("movq %%rax, %%rsi"); // second argument in rsi
+					EmitString("48 89 C6");		// movq %rax, %rsi - second argument in rsi
 				}
-				emit("movq $%"PRIu64", %%rax", (intptr_t) callAsmCall);
-				emit("callq *%%rax");
-				emit("pop %%rsi");
-				emit("addq %%rsi, %%rsp");
-				emit("pop %%r10");
-				emit("pop %%r9");
-				emit("pop %%r8");
-				emit("pop %%rdi");
-//				emit("frstor 4(%%r9, %%rsi, 1)");
+				CALL_NATIVE(callAsmCall);
+				RESTORE_REGS();
 				STACK_PUSH(4);
-				emit("movl %%eax, (%%r9, %%rbx, 4)"); // store return value
-				neednilabel = 1;
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4) - store return value
 				break;
 			case OP_PUSH:
 				MAYBE_EMIT_CONST();
@@ -608,15 +1968,16 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 				const_value = iarg;
 #else
 				STACK_PUSH(4);
-				emit("movl $%d, (%%r9, %%rbx, 4)", iarg);
+				EmitString("41 C7 04 99");		// movl $x, (%r9, %rbx, 4)
+				Emit4(iarg);
 #endif
 				break;
 			case OP_LOCAL:
 				MAYBE_EMIT_CONST();
-				emit("movl %%edi, %%esi");
-				emit("addl $%d,%%esi", iarg);
+				EmitString("89 FE");			// movl %edi, %esi
+				EmitRegImm(0, R_ESI, (int) iarg);	// addl $iarg, %esi
 				STACK_PUSH(4);
-				emit("movl %%esi, (%%r9, %%rbx, 4)");
+				EmitString("41 89 34 99");		// movl %esi, (%r9, %rbx, 4)
 				break;
 			case OP_JUMP:
 				if(got_const) {
@@ -624,304 +1985,262 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 					got_const = 0;
 					JMPIARG();
 				} else {
-					emit("movl (%%r9, %%rbx, 4), %%eax"); // get instr from stack
+					EmitString("41 8B 04 99");	// movl (%r9, %rbx, 4), %eax - get instr from stack
 					STACK_POP(4);
 
-					PREPARE_JMP(eax);
-					emit("jmp *%%rax");
+					PREPARE_JMP();
+					EmitString("FF E0");		// jmpq *%rax
 				}
 				break;
 			case OP_EQ:
-				IJ("jne");
+				IJ("75");		// jne
 				break;
 			case OP_NE:
-				IJ("je");
+				IJ("74");		// je
 				break;
 			case OP_LTI:
-				IJ("jnl");
+				IJ("7D");		// jnl
 				break;
 			case OP_LEI:
-				IJ("jnle");
+				IJ("7F");		// jnle
 				break;
 			case OP_GTI:
-				IJ("jng");
+				IJ("7E");		// jng
 				break;
 			case OP_GEI:
-				IJ("jnge");
+				IJ("7C");		// jnge
 				break;
 			case OP_LTU:
-				IJ("jnb");
+				IJ("73");		// jnb
 				break;
 			case OP_LEU:
-				IJ("jnbe");
+				IJ("77");		// jnbe
 				break;
 			case OP_GTU:
-				IJ("jna");
+				IJ("76");		// jna
 				break;
 			case OP_GEU:
-				IJ("jnae");
+				IJ("72");		// jnae
 				break;
 			case OP_EQF:
-				FJ(0x40, "jz");
-				XJ("jnz");
+				XJ("75");		// jnz
 				break;
 			case OP_NEF:
-				FJ(0x40, "jnz");
-#ifndef USE_X87
+			{
+				int jmpDoJump;
+
 				MAYBE_EMIT_CONST();
 				STACK_POP(8);
-				emit("movss 4(%%r9, %%rbx, 4), %%xmm0");
-				emit("ucomiss 8(%%r9, %%rbx, 4), %%xmm0");
-				emit("jp dojump_i_%08x", instruction);
-				emit("jz i_%08x", instruction+1);
-				emit("dojump_i_%08x:", instruction);
+				EmitString("F3 41 0F 10 44 99 04");	// movss 4(%r9, %rbx, 4), %xmm0
+				EmitString("41 0F 2E 44 99 08");	// ucomiss 8(%r9, %rbx, 4), %xmm0
+				EmitString("7A");					// jp dojump
+				jmpDoJump = compiledOfs++;
+				EmitJumpNext("74", 1);				// jz next
+				SET_JMPOFS(jmpDoJump);				// dojump:
 				JMPIARG();
-				neednilabel = 1;
-#endif
 				break;
+			}
 			case OP_LTF:
-				FJ(0x01, "jz");
-				XJ("jnc");
+				XJ("73");		// jnc
 				break;
 			case OP_LEF:
-				FJ(0x41, "jz");
-				XJ("ja");
+				XJ("77");		// ja
 				break;
 			case OP_GTF:
-				FJ(0x41, "jnz");
-				XJ("jbe");
+				XJ("76");		// jbe
 				break;
 			case OP_GEF:
-				FJ(0x01, "jnz");
-				XJ("jb");
+				XJ("72");		// jb
 				break;
 			case OP_LOAD1:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
-				RANGECHECK(eax, 1);
-				emit("movb (%%r8, %%rax, 1), %%al"); // deref into eax
-				emit("andq $255, %%rax");
-				emit("movl %%eax, (%%r9, %%rbx, 4)"); // store on stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
+				RANGECHECK(R_EAX, 1);
+				EmitString("41 8A 04 00");		// movb (%r8, %rax, 1), %al - deref into eax
+				EmitString("48 81 E0 FF 00 00 00");	// andq $255, %rax
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4) - store on stack
 				break;
 			case OP_LOAD2:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
-				RANGECHECK(eax, 2);
-				emit("movw (%%r8, %%rax, 1), %%ax"); // deref into eax
-				emit("movl %%eax, (%%r9, %%rbx, 4)"); // store on stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
+				RANGECHECK(R_EAX, 2);
+				EmitString("66 41 8B 04 00");	// movw (%r8, %rax, 1), %ax - deref into eax
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4) - store on stack
 				break;
 			case OP_LOAD4:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
-				RANGECHECK(eax, 4); // not a pointer!?
-				emit("movl (%%r8, %%rax, 1), %%eax"); // deref into eax
-				emit("movl %%eax, (%%r9, %%rbx, 4)"); // store on stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
+				RANGECHECK(R_EAX, 4); // not a pointer!?
+				EmitString("41 8B 04 00");		// movl (%r8, %rax, 1), %eax - deref into eax
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4) - store on stack
 				break;
 			case OP_STORE1:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
 				STACK_POP(8);
-				emit("andq $255, %%rax");
-				emit("movl 4(%%r9, %%rbx, 4), %%esi"); // get pointer from stack
-				RANGECHECK(esi, 1);
-				emit("movb %%al, (%%r8, %%rsi, 1)"); // store in memory
+				EmitString("48 81 E0 FF 00 00 00");	// andq $255, %rax
+				EmitString("41 8B 74 99 04");	// movl 4(%r9, %rbx, 4), %esi - get pointer from stack
+				RANGECHECK(R_ESI, 1);
+				EmitString("41 88 04 30");		// movb %al, (%r8, %rsi, 1) - store in memory
 				break;
 			case OP_STORE2:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
 				STACK_POP(8);
-				emit("movl 4(%%r9, %%rbx, 4), %%esi"); // get pointer from stack
-				RANGECHECK(esi, 2);
-				emit("movw %%ax, (%%r8, %%rsi, 1)"); // store in memory
+				EmitString("41 8B 74 99 04");	// movl 4(%r9, %rbx, 4), %esi - get pointer from stack
+				RANGECHECK(R_ESI, 2);
+				EmitString("66 41 89 04 30");	// movw %ax, (%r8, %rsi, 1) - store in memory
 				break;
 			case OP_STORE4:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
 				STACK_POP(8);
-				emit("movl 4(%%r9, %%rbx, 4), %%esi"); // get pointer from stack
-				RANGECHECK(esi, 4);
-				emit("movl %%eax, (%%r8, %%rsi, 1)"); // store in memory
+				EmitString("41 8B 74 99 04");	// movl 4(%r9, %rbx, 4), %esi - get pointer from stack
+				RANGECHECK(R_ESI, 4);
+				EmitString("41 89 04 30");		// movl %eax, (%r8, %rsi, 1) - store in memory
 				break;
 			case OP_ARG:
 				MAYBE_EMIT_CONST();
-				emit("movl (%%r9, %%rbx, 4), %%eax"); // get value from stack
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax - get value from stack
 				STACK_POP(4);
-				emit("movl $0x%hx, %%esi", barg);
-				emit("addl %%edi, %%esi");
-				RANGECHECK(esi, 4);
-				emit("movl %%eax, (%%r8,%%rsi, 1)"); // store in args space
+				EmitString("BE");				// movl $barg, %esi
+				Emit4(barg);
+				EmitString("01 FE");			// addl %edi, %esi
+				RANGECHECK(R_ESI, 4);
+				EmitString("41 89 04 30");		// movl %eax, (%r8, %rsi, 1) - store in args space
 				break;
 			case OP_BLOCK_COPY:
-
 				MAYBE_EMIT_CONST();
 				STACK_POP(8);
-				emit("push %%rdi");
-				emit("push %%r8");
-				emit("push %%r9");
-				emit("push %%r10");
-				emit("movq %%rsp, %%rsi"); // we need to align the stack pointer
-				emit("subq $8, %%rsi");    //   |
-				emit("andq $127, %%rsi");  //   |
-				emit("subq %%rsi, %%rsp"); // <-+
-				emit("push %%rsi");
-				emit("movl 4(%%r9, %%rbx, 4), %%edi");  // 1st argument dest
-				emit("movl 8(%%r9, %%rbx, 4), %%rsi");  // 2nd argument src
-				emit("movl $%d, %%edx", iarg); // 3rd argument count
-				emit("movq $%"PRIu64", %%rax", (intptr_t) VM_BlockCopy);
-				emit("callq *%%rax");
-				emit("pop %%rsi");
-				emit("addq %%rsi, %%rsp");
-				emit("pop %%r10");
-				emit("pop %%r9");
-				emit("pop %%r8");
-				emit("pop %%rdi");
-
+				SAVE_REGS();
+				EmitString("41 8B 7C 99 04");	// movl 4(%r9, %rbx, 4), %edi - 1st argument dest
+				EmitString("49 8B 74 99 08");	// movq 8(%r9, %rbx, 4), %rsi - 2nd argument src
+				EmitString("BA");				// movl $iarg, %edx - 3rd argument count
+				Emit4(iarg);
+				CALL_NATIVE(VM_BlockCopy);
+				RESTORE_REGS();
 				break;
 			case OP_SEX8:
 				MAYBE_EMIT_CONST();
-				emit("movw (%%r9, %%rbx, 4), %%ax");
-				emit("andq $255, %%rax");
-				emit("cbw");
-				emit("cwde");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
+				EmitString("66 41 8B 04 99");	// movw (%r9, %rbx, 4), %ax
+				EmitString("48 81 E0 FF 00 00 00");	// andq $255, %rax
+				EmitString("66 98");			// cbw
+				EmitString("98");				// cwde
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_SEX16:
 				MAYBE_EMIT_CONST();
-				emit("movw (%%r9, %%rbx, 4), %%ax");
-				emit("cwde");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
+				EmitString("66 41 8B 04 99");	// movw (%r9, %rbx, 4), %ax
+				EmitString("98");				// cwde
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_NEGI:
 				MAYBE_EMIT_CONST();
-				emit("negl (%%r9, %%rbx, 4)");
+				EmitString("41 F7 1C 99");		// negl (%r9, %rbx, 4)
 				break;
 			case OP_ADD:
-				SIMPLE("addl");
+				SIMPLE("01");		// addl
 				break;
 			case OP_SUB:
-				SIMPLE("subl");
+				SIMPLE("29");		// subl
 				break;
 			case OP_DIVI:
 				MAYBE_EMIT_CONST();
 				STACK_POP(4);
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("cdq");
-				emit("idivl 4(%%r9, %%rbx, 4)");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("99");				// cdq
+				EmitString("41 F7 7C 99 04");	// idivl 4(%r9, %rbx, 4)
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_DIVU:
 				MAYBE_EMIT_CONST();
 				STACK_POP(4);
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("xorq %%rdx, %%rdx");
-				emit("divl 4(%%r9, %%rbx, 4)");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("48 31 D2");			// xorq %rdx, %rdx
+				EmitString("41 F7 74 99 04");	// divl 4(%r9, %rbx, 4)
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_MODI:
 				MAYBE_EMIT_CONST();
 				STACK_POP(4);
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("xorl %%edx, %%edx");
-				emit("cdq");
-				emit("idivl 4(%%r9, %%rbx, 4)");
-				emit("movl %%edx, (%%r9, %%rbx, 4)");
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("31 D2");			// xorl %edx, %edx
+				EmitString("99");				// cdq
+				EmitString("41 F7 7C 99 04");	// idivl 4(%r9, %rbx, 4)
+				EmitString("41 89 14 99");		// movl %edx, (%r9, %rbx, 4)
 				break;
 			case OP_MODU:
 				MAYBE_EMIT_CONST();
 				STACK_POP(4);
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("xorl %%edx, %%edx");
-				emit("divl 4(%%r9, %%rbx, 4)");
-				emit("movl %%edx, (%%r9, %%rbx, 4)");
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("31 D2");			// xorl %edx, %edx
+				EmitString("41 F7 74 99 04");	// divl 4(%r9, %rbx, 4)
+				EmitString("41 89 14 99");		// movl %edx, (%r9, %rbx, 4)
 				break;
 			case OP_MULI:
 				MAYBE_EMIT_CONST();
 				STACK_POP(4);
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("imull 4(%%r9, %%rbx, 4)");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("41 F7 6C 99 04");	// imull 4(%r9, %rbx, 4)
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_MULU:
 				MAYBE_EMIT_CONST();
 				STACK_POP(4);
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("mull 4(%%r9, %%rbx, 4)");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("41 F7 64 99 04");	// mull 4(%r9, %rbx, 4)
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_BAND:
-				SIMPLE("andl");
+				SIMPLE("21");		// andl
 				break;
 			case OP_BOR:
-				SIMPLE("orl");
+				SIMPLE("09");		// orl
 				break;
 			case OP_BXOR:
-				SIMPLE("xorl");
+				SIMPLE("31");		// xorl
 				break;
 			case OP_BCOM:
 				MAYBE_EMIT_CONST();
-				emit("notl (%%r9, %%rbx, 4)");
+				EmitString("41 F7 14 99");		// notl (%r9, %rbx, 4)
 				break;
 			case OP_LSH:
-				SHIFT("shl");
+				SHIFT("E0");		// shl
 				break;
 			case OP_RSHI:
-				SHIFT("sarl");
+				SHIFT("F8");		// sarl
 				break;
 			case OP_RSHU:
-				SHIFT("shrl");
+				SHIFT("E8");		// shrl
 				break;
 			case OP_NEGF:
 				MAYBE_EMIT_CONST();
-#ifdef USE_X87
-				emit("flds (%%r9, %%rbx, 4)");
-				emit("fchs");
-				emit("fstps (%%r9, %%rbx, 4)");
-#else
-				emit("movl $0x80000000, %%eax");
-				emit("xorl %%eax, (%%r9, %%rbx, 4)");
-#endif
+				EmitString("B8 00 00 00 80");	// movl $0x80000000, %eax
+				EmitString("41 31 04 99");		// xorl %eax, (%r9, %rbx, 4)
 				break;
 			case OP_ADDF:
-				FSIMPLE("fadds");
-				XSIMPLE("addss");
+				XSIMPLE("58");		// addss
 				break;
 			case OP_SUBF:
-				FSIMPLE("fsubs");
-				XSIMPLE("subss");
+				XSIMPLE("5C");		// subss
 				break;
 			case OP_DIVF:
-				FSIMPLE("fdivs");
-				XSIMPLE("divss");
+				XSIMPLE("5E");		// divss
 				break;
 			case OP_MULF:
-				FSIMPLE("fmuls");
-				XSIMPLE("mulss");
+				XSIMPLE("59");		// mulss
 				break;
 			case OP_CVIF:
 				MAYBE_EMIT_CONST();
-#ifdef USE_X87
-				emit("filds (%%r9, %%rbx, 4)");
-				emit("fstps (%%r9, %%rbx, 4)");
-#else
-				emit("movl (%%r9, %%rbx, 4), %%eax");
-				emit("cvtsi2ss %%eax, %%xmm0");
-				emit("movss %%xmm0, (%%r9, %%rbx, 4)");
-#endif
+				EmitString("41 8B 04 99");		// movl (%r9, %rbx, 4), %eax
+				EmitString("F3 0F 2A C0");		// cvtsi2ss %eax, %xmm0
+				EmitString("F3 41 0F 11 04 99");	// movss %xmm0, (%r9, %rbx, 4)
 				break;
 			case OP_CVFI:
 				MAYBE_EMIT_CONST();
-#ifdef USE_X87
-				emit("flds (%%r9, %%rbx, 4)");
-				emit("fnstcw 4(%%r9, %%rbx, 4)");
-				emit("movw $0x0F7F, 8(%%r9, %%rbx, 4)"); // round toward zero
-				emit("fldcw 8(%%r9, %%rbx, 4)");
-				emit("fistpl (%%r9, %%rbx, 4)");
-				emit("fldcw 4(%%r9, %%rbx, 4)");
-#else
-				emit("movss (%%r9, %%rbx, 4), %%xmm0");
-				emit("cvttss2si %%xmm0, %%eax");
-				emit("movl %%eax, (%%r9, %%rbx, 4)");
-#endif
+				EmitString("F3 41 0F 10 04 99");	// movss (%r9, %rbx, 4), %xmm0
+				EmitString("F3 0F 2C C0");		// cvttss2si %xmm0, %eax
+				EmitString("41 89 04 99");		// movl %eax, (%r9, %rbx, 4)
 				break;
 			default:
 				NOTIMPL(op);
@@ -933,29 +2252,44 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 
 	if(got_const)
 	{
-		VM_FREEBUFFERS(vm);
+		VMFREE_BUFFERS();
 		Com_Error(ERR_DROP, "leftover const");
 	}
 
-	emit("movq $%"PRIu64", %%rax", (intptr_t) eop);
-	emit("callq *%%rax");
-
-	} // pass loop
+	SetJumpsNext();
+	CALL_NATIVE(eop);
 
-	assembler_init(0);
+	vm->codeLength = compiledOfs;
 
-	#ifdef VM_X86_64_MMAP
-		if(mprotect(vm->codeBase, compiledOfs, PROT_READ|PROT_EXEC))
-			Com_Error(ERR_FATAL, "VM_CompileX86_64: mprotect failed");
-	#elif __WIN64__
+	// relative jumps don't depend on where the code ends up
+	for(i = 0; i < numCodeFixups; i++)
+	{
+		if(codeFixups[i].relative)
 		{
-			DWORD oldProtect = 0;
-			
-			// remove write permissions; give exec permision
-			if(!VirtualProtect(vm->codeBase, compiledOfs, PAGE_EXECUTE_READ, &oldProtect))
-				Com_Error(ERR_FATAL, "VM_CompileX86_64: VirtualProtect failed");
+			int ofs = codeFixups[i].ofs;
+
+			Patch4(ofs, vm->instructionPointers[codeFixups[i].instruction] - (ofs + 4));
 		}
-	#endif
+	}
+
+	VM_AllocCode(vm, compiledOfs);
+	Com_Memcpy(vm->codeBase, buf, compiledOfs);
+
+	// now that the code has its final place, fill in absolute jump and call targets
+	for(i = 0; i < numCodeFixups; i++)
+	{
+		intptr_t target = (intptr_t) (vm->codeBase + vm->instructionPointers[codeFixups[i].instruction]);
+
+		if(codeFixups[i].relative)
+			continue;
+
+		Com_Memcpy(vm->codeBase + codeFixups[i].ofs, &target, sizeof(target));
+	}
+
+	VMFREE_BUFFERS();
+
+	VM_StoreCachedCode(vm, header, &backend);
+	VM_ProtectCode(vm);
 
 	vm->destroy = VM_Destroy_Compiled;
 
@@ -973,6 +2307,9 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 #endif
 #endif
 
+	if(vm->compiled && numInlined)
+		Com_Printf( "%i syscalls compiled inline\n", numInlined );
+
 	#ifndef __WIN64__ //timersub and gettimeofday
 		if(vm->compiled)
 		{
@@ -988,6 +2325,7 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 }
 
 
+
 void VM_Destroy_Compiled(vm_t* self)
 {
 	if(self && self->codeBase)
@@ -1079,7 +2417,7 @@ int VM_CallCompiled(vm_t *vm, int *args)
 		"	pop %%r15		\r\n"
 		: "+D" (programStack), "+b" (opStackRet)
 		: "g" (entryPoint), "g" (opStack), "g" (vm->dataBase), "g" (programStack)
-		: "%rsi", "%rax", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11", "%xmm0"
+		: "%rsi", "%rax", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11", "%xmm0", "%xmm1"
 	);
 
 	if(opStackRet != 1 || *opStack != 0xDEADBEEF)
@@ -55,13 +55,13 @@ typedef struct voipServerPacket_s
 typedef struct svEntity_s {
 	struct worldSector_s *worldSector;
 	struct svEntity_s *nextEntityInWorldSector;
+	struct svEntity_s *prevEntityInWorldSector;
 	
 	entityState_t	baseline;		// for delta compression of initial sighting
 	int			numClusters;		// if -1, use headnode instead
 	int			clusternums[MAX_ENT_CLUSTERS];
 	int			lastCluster;		// if all the clusters don't fit in clusternums
 	int			areanum, areanum2;
-	int			snapshotCounter;	// used to prevent double adding from portal views
 } svEntity_t;
 
 typedef enum {
@@ -79,7 +79,6 @@ typedef struct {
 	// https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=475
 	// the serverId associated with the current checksumFeed (always <= serverId)
 	int       checksumFeedServerId;	
-	int				snapshotCounter;	// incremented for each snapshot built
 	int				timeResidual;		// <= 1000 / sv_frame->value
 	int				nextFrameTime;		// when time > nextFrameTime, process world
 	struct cmodel_s	*models[MAX_MODELS];
@@ -98,6 +97,14 @@ typedef struct {
 
 	int				restartTime;
 	int				time;
+
+	// configstrings and baselines as SV_SendClientGameState encodes them,
+	// cleared by SV_SetConfigstring and SV_CreateBaseline
+	qboolean		gamestateValid;
+	int				gamestateBits;
+	byte			gamestateData[MAX_MSGLEN];
+
+	int				spawnTime;			// Sys_Milliseconds when the map change started
 } server_t;
 
 
@@ -302,6 +309,12 @@ extern	cvar_t	*sv_strictAuth;
 #endif
 extern	cvar_t	*sv_public;
 extern	cvar_t	*sv_banFile;
+extern	cvar_t	*sv_snapshotThreads;
+extern	cvar_t	*sv_deltaEntityCache;
+extern	cvar_t	*sv_profile;
+extern	cvar_t	*sv_profileLog;
+extern	cvar_t	*sv_profileLogInterval;
+extern	cvar_t	*sv_sectorSize;
 
 extern	serverBan_t serverBans[SERVER_MAXBANS];
 extern	int serverBansCount;
@@ -326,6 +339,7 @@ void SV_RemoveOperatorCommands (void);
 
 void SV_MasterShutdown (void);
 int SV_RateMsec(client_t *client);
+void SV_FrameProfile_f( void );
 
 
 
@@ -363,6 +377,7 @@ void SV_ExecuteClientMessage( client_t *cl, msg_t *msg );
 void SV_UserinfoChanged( client_t *cl );
 
 void SV_ClientEnterWorld( client_t *client, usercmd_t *cmd );
+void SV_CheckMapChangeTime( void );
 void SV_FreeClient(client_t *client);
 void SV_DropClient( client_t *drop, const char *reason );
 
@@ -388,6 +403,10 @@ void SV_WriteFrameToClient (client_t *client, msg_t *msg);
 void SV_SendMessageToClient( msg_t *msg, client_t *client );
 void SV_SendClientMessages( void );
 void SV_SendClientSnapshot( client_t *client );
+void SV_SnapshotBench_f( void );
+void SV_AllocSnapshotVisIndex( void );
+void SV_AllocDeltaCache( void );
+void SV_DeltaCacheStats_f( void );
 
 //
 // sv_game.c
@@ -400,6 +419,7 @@ sharedEntity_t *SV_GEntityForSvEntity( svEntity_t *svEnt );
 void		SV_InitGameProgs ( void );
 void		SV_ShutdownGameProgs ( void );
 void		SV_RestartGameProgs( void );
+void		SV_VMBench_f( void );
 qboolean	SV_inPVS (const vec3_t p1, const vec3_t p2);
 
 //
@@ -414,6 +434,8 @@ int			SV_BotLibSetup( void );
 int			SV_BotLibShutdown( void );
 int			SV_BotGetSnapshotEntity( int client, int ent );
 int			SV_BotGetConsoleMessage( int client, char *buf, int size );
+void		SV_BotReadAAS( const char *mapname );
+void		SV_BotFreeAAS( void );
 
 int BotImport_DebugPolygonCreate(int color, int numPoints, vec3_t *points);
 void BotImport_DebugPolygonDelete(int id);
@@ -444,6 +466,7 @@ clipHandle_t SV_ClipHandleForEntity( const sharedEntity_t *ent );
 
 
 void SV_SectorList_f( void );
+void SV_SectorBench_f( void );
 
 
 int SV_AreaEntities( const vec3_t mins, const vec3_t maxs, int *entityList, int maxcount );
@@ -471,6 +494,11 @@ void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, c
 // passEntityNum is explicitly excluded from clipping checks (normally ENTITYNUM_NONE)
 
 
+void SV_TraceBatch( trace_t *results, const traceRequest_t *requests, int numRequests );
+// runs every request as SV_Trace would, sharing the area entity
+// gathers between requests that lie close together
+
+
 void SV_ClipToEntity( trace_t *trace, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int entityNum, int contentmask, int capsule );
 // clip to a specific entity
 
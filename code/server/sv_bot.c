@@ -33,6 +33,13 @@ typedef struct bot_debugpoly_s
 } bot_debugpoly_t;
 
 static bot_debugpoly_t *debugpolygons;
+
+// the area file read ahead for the map being loaded
+static int		sv_botAASRequest;
+static char		sv_botAASName[MAX_QPATH];
+static void		*sv_botAASBuffer;
+static long		sv_botAASLength;
+
 int bot_maxdebugpolys;
 
 extern botlib_export_t	*botlib_export;
@@ -309,6 +316,68 @@ static void *BotImport_HunkAlloc( int size ) {
 	return Hunk_Alloc( size, h_high );
 }
 
+/*
+==================
+SV_BotAASRead
+==================
+*/
+static void SV_BotAASRead( const char *qpath, void *buffer, long length, void *data ) {
+	sv_botAASBuffer = buffer;
+	sv_botAASLength = length;
+}
+
+/*
+==================
+SV_BotReadAAS
+
+SV_SpawnServer queues the area file on the read threads before the
+collision map loads.  The game has the bots load it while it starts,
+which by then only has to wait for whatever is left of the read.
+==================
+*/
+void SV_BotReadAAS( const char *mapname ) {
+	sv_botAASBuffer = NULL;
+	Com_sprintf( sv_botAASName, sizeof( sv_botAASName ), "maps/%s.aas", mapname );
+	sv_botAASRequest = FS_ReadFileAsync( sv_botAASName, SV_BotAASRead, NULL );
+}
+
+/*
+==================
+SV_BotFreeAAS
+
+Drops the area file if the game didn't load it
+==================
+*/
+void SV_BotFreeAAS( void ) {
+	if ( sv_botAASRequest ) {
+		FS_WaitForRead( sv_botAASRequest );
+		sv_botAASRequest = 0;
+	}
+	if ( sv_botAASBuffer ) {
+		FS_FreeFile( sv_botAASBuffer );
+		sv_botAASBuffer = NULL;
+	}
+}
+
+/*
+==================
+BotImport_FS_ReadFile
+==================
+*/
+static int BotImport_FS_ReadFile( const char *qpath, void **buffer ) {
+	if ( sv_botAASRequest && !Q_stricmp( qpath, sv_botAASName ) ) {
+		FS_WaitForRead( sv_botAASRequest );
+		sv_botAASRequest = 0;
+		if ( sv_botAASBuffer ) {
+			*buffer = sv_botAASBuffer;
+			sv_botAASBuffer = NULL;
+			return sv_botAASLength;
+		}
+	}
+
+	return FS_ReadFile( qpath, buffer );
+}
+
 /*
 ==================
 BotImport_DebugPolygonCreate
@@ -543,6 +612,8 @@ void SV_BotInitBotLib(void) {
 	botlib_import.FS_Write = FS_Write;
 	botlib_import.FS_FCloseFile = FS_FCloseFile;
 	botlib_import.FS_Seek = FS_Seek;
+	botlib_import.FS_ReadFile = BotImport_FS_ReadFile;
+	botlib_import.FS_FreeFile = FS_FreeFile;
 
 	//debug lines
 	botlib_import.DebugLineCreate = BotImport_DebugLineCreate;
@@ -1430,6 +1430,11 @@ void SV_AddOperatorCommands( void ) {
 	Cmd_AddCommand ("dumpuser", SV_DumpUser_f);
 	Cmd_AddCommand ("map_restart", SV_MapRestart_f);
 	Cmd_AddCommand ("sectorlist", SV_SectorList_f);
+	Cmd_AddCommand ("sectorbench", SV_SectorBench_f);
+	Cmd_AddCommand ("snapshotbench", SV_SnapshotBench_f);
+	Cmd_AddCommand ("deltacachestats", SV_DeltaCacheStats_f);
+	Cmd_AddCommand ("frameprofile", SV_FrameProfile_f);
+	Cmd_AddCommand ("vmbench", SV_VMBench_f);
 	Cmd_AddCommand ("map", SV_Map_f);
 	Cmd_SetCommandCompletionFunc( "map", SV_CompleteMapName );
 #ifndef PRE_RELEASE_DEMO
@@ -1477,6 +1482,10 @@ void SV_RemoveOperatorCommands( void ) {
 	Cmd_RemoveCommand ("dumpuser");
 	Cmd_RemoveCommand ("map_restart");
 	Cmd_RemoveCommand ("sectorlist");
+	Cmd_RemoveCommand ("sectorbench");
+	Cmd_RemoveCommand ("snapshotbench");
+	Cmd_RemoveCommand ("deltacachestats");
+	Cmd_RemoveCommand ("frameprofile");
 	Cmd_RemoveCommand ("say");
 #endif
 }
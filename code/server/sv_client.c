@@ -761,6 +761,9 @@ void SV_DropClient( client_t *drop, const char *reason ) {
 		drop->state = CS_ZOMBIE;		// become free in a few seconds
 	}
 
+	// the map change may have been waiting on this client
+	SV_CheckMapChangeTime();
+
 	// if this was the last client on the server, send a heartbeat
 	// to the master so it is known the server is empty
 	// send a heartbeat now so the master will get up to date info
@@ -775,6 +778,106 @@ void SV_DropClient( client_t *drop, const char *reason ) {
 	}
 }
 
+/*
+================
+SV_WriteGamestateEntries
+
+Writes every configstring and baseline, followed by svc_EOF
+================
+*/
+static void SV_WriteGamestateEntries( msg_t *msg ) {
+	int			start;
+	entityState_t	*base, nullstate;
+
+	// write the configstrings
+	for ( start = 0 ; start < MAX_CONFIGSTRINGS ; start++ ) {
+		if (sv.configstrings[start][0]) {
+			MSG_WriteByte( msg, svc_configstring );
+			MSG_WriteShort( msg, start );
+			MSG_WriteBigString( msg, sv.configstrings[start] );
+		}
+	}
+
+	// write the baselines
+	Com_Memset( &nullstate, 0, sizeof( nullstate ) );
+	for ( start = 0 ; start < MAX_GENTITIES; start++ ) {
+		base = &sv.svEntities[start].baseline;
+		if ( !base->number ) {
+			continue;
+		}
+		MSG_WriteByte( msg, svc_baseline );
+		MSG_WriteDeltaEntity( msg, &nullstate, base, qtrue );
+	}
+
+	MSG_WriteByte( msg, svc_EOF );
+}
+
+/*
+================
+SV_WriteGamestate
+
+The configstrings and baselines are the same for every client, so they
+are encoded once and the bits are copied into each gamestate message
+until SV_SetConfigstring or SV_CreateBaseline changes something.
+================
+*/
+static void SV_WriteGamestate( msg_t *msg ) {
+	msg_t		cache;
+
+	if ( !sv.gamestateValid ) {
+		MSG_Init( &cache, sv.gamestateData, sizeof( sv.gamestateData ) );
+		SV_WriteGamestateEntries( &cache );
+
+		if ( cache.overflowed ) {
+			// can't be cached, let the real message overflow the same way
+			SV_WriteGamestateEntries( msg );
+			return;
+		}
+
+		sv.gamestateBits = cache.bit;
+		sv.gamestateValid = qtrue;
+	}
+
+	MSG_WriteEncodedBits( msg, sv.gamestateData, sv.gamestateBits );
+}
+
+/*
+================
+SV_CheckMapChangeTime
+
+Once every client that was connected across a map change is back in the
+world, prints how long it took
+================
+*/
+void SV_CheckMapChangeTime( void ) {
+	int			i, count;
+	client_t	*cl;
+
+	if ( !sv.spawnTime ) {
+		return;
+	}
+
+	count = 0;
+	for ( i = 0, cl = svs.clients ; i < sv_maxclients->integer ; i++, cl++ ) {
+		if ( cl->state == CS_FREE || cl->state == CS_ZOMBIE ) {
+			continue;
+		}
+		if ( cl->state != CS_ACTIVE ) {
+			return;		// still loading
+		}
+		if ( cl->netchan.remoteAddress.type != NA_BOT ) {
+			count++;
+		}
+	}
+
+	if ( count ) {
+		Com_Printf( "%i clients entered the world %i msec after the map change\n",
+			count, Sys_Milliseconds() - sv.spawnTime );
+	}
+
+	sv.spawnTime = 0;
+}
+
 /*
 ================
 SV_SendClientGameState
@@ -787,8 +890,6 @@ the wrong gamestate.
 ================
 */
 static void SV_SendClientGameState( client_t *client ) {
-	int			start;
-	entityState_t	*base, nullstate;
 	msg_t		msg;
 	byte		msgBuffer[MAX_MSGLEN];
 
@@ -819,27 +920,8 @@ static void SV_SendClientGameState( client_t *client ) {
 	MSG_WriteByte( &msg, svc_gamestate );
 	MSG_WriteLong( &msg, client->reliableSequence );
 
-	// write the configstrings
-	for ( start = 0 ; start < MAX_CONFIGSTRINGS ; start++ ) {
-		if (sv.configstrings[start][0]) {
-			MSG_WriteByte( &msg, svc_configstring );
-			MSG_WriteShort( &msg, start );
-			MSG_WriteBigString( &msg, sv.configstrings[start] );
-		}
-	}
-
-	// write the baselines
-	Com_Memset( &nullstate, 0, sizeof( nullstate ) );
-	for ( start = 0 ; start < MAX_GENTITIES; start++ ) {
-		base = &sv.svEntities[start].baseline;
-		if ( !base->number ) {
-			continue;
-		}
-		MSG_WriteByte( &msg, svc_baseline );
-		MSG_WriteDeltaEntity( &msg, &nullstate, base, qtrue );
-	}
-
-	MSG_WriteByte( &msg, svc_EOF );
+	// write the configstrings and baselines
+	SV_WriteGamestate( &msg );
 
 	MSG_WriteLong( &msg, client - svs.clients);
 
@@ -883,6 +965,8 @@ void SV_ClientEnterWorld( client_t *client, usercmd_t *cmd ) {
 
 	// call the game begin function
 	VM_Call( gvm, GAME_CLIENT_BEGIN, client - svs.clients );
+
+	SV_CheckMapChangeTime();
 }
 
 /*
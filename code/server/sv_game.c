@@ -338,6 +338,11 @@ intptr_t SV_GameSystemCalls( intptr_t *args ) {
 	case G_FS_SEEK:
 		return FS_Seek( args[1], args[2], args[3] );
 
+	case G_TRACE_BATCH:
+		SV_TraceBatch( VM_ArgArray( args[1], sizeof( trace_t ), args[3] ),
+			VM_ArgArray( args[2], sizeof( traceRequest_t ), args[3] ), args[3] );
+		return 0;
+
 	case G_LOCATE_GAME_DATA:
 		SV_LocateGameData( VMA(1), args[2], args[3], VMA(4), args[5] );
 		return 0;
@@ -955,3 +960,98 @@ qboolean SV_GameCommand( void ) {
 	return VM_Call( gvm, GAME_CONSOLE_COMMAND );
 }
 
+
+
+/*
+====================
+SV_VMBench_f
+
+Runs the game for a number of server frames once for every way the game
+module can be executed: interpreted through the switch or with threaded
+dispatch, compiled, compiled with register caching and as a native
+library.  The bytecode backends also run once with vm_optimize 0 to show
+what the bytecode optimizer gains.  The map is spawned again before each
+run so they all start from the same state, bots included.
+====================
+*/
+void SV_VMBench_f( void ) {
+	static const struct {
+		const char		*name;
+		vmInterpret_t	interpret;
+		int				jitOptimize;
+		int				threaded;
+		int				optimize;
+	} runs[] = {
+		{ "interpreted", VMI_BYTECODE, 0, 0, 1 },
+		{ "interpreted-noopt", VMI_BYTECODE, 0, 0, 0 },
+		{ "threaded", VMI_BYTECODE, 0, 1, 1 },
+		{ "threaded-noopt", VMI_BYTECODE, 0, 1, 0 },
+		{ "compiled", VMI_COMPILED, 0, 0, 1 },
+		{ "compiled-noopt", VMI_COMPILED, 0, 0, 0 },
+		{ "compiled+regcache", VMI_COMPILED, 1, 0, 1 },
+		{ "native", VMI_NATIVE, 0, 0, 1 }
+	};
+	static const char *backends[] = { "native", "interpreted", "compiled" };
+	char			mapname[MAX_QPATH];
+	char			vmGame[16], jitOptimize[16], threaded[16], optimize[16];
+	unsigned int	usec[ARRAY_LEN( runs )];
+	vmInterpret_t	backend[ARRAY_LEN( runs )];
+	unsigned int	start;
+	int				frames, frameMsec;
+	int				i, j;
+
+	if ( !com_sv_running->integer || sv.state != SS_GAME ) {
+		Com_Printf( "Server is not running.\n" );
+		return;
+	}
+
+	frames = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 1000;
+	if ( frames < 1 ) {
+		frames = 1;
+	}
+
+	frameMsec = sv_fps->integer > 0 ? 1000 / sv_fps->integer : 50;
+	if ( frameMsec < 1 ) {
+		frameMsec = 1;
+	}
+
+	Q_strncpyz( mapname, sv_mapname->string, sizeof( mapname ) );
+	Cvar_VariableStringBuffer( "vm_game", vmGame, sizeof( vmGame ) );
+	Cvar_VariableStringBuffer( "vm_jitOptimize", jitOptimize, sizeof( jitOptimize ) );
+	Cvar_VariableStringBuffer( "vm_threaded", threaded, sizeof( threaded ) );
+	Cvar_VariableStringBuffer( "vm_optimize", optimize, sizeof( optimize ) );
+
+	for ( i = 0 ; i < ARRAY_LEN( runs ) ; i++ ) {
+		Cvar_Set( "vm_game", va( "%i", runs[i].interpret ) );
+		Cvar_Set( "vm_jitOptimize", va( "%i", runs[i].jitOptimize ) );
+		Cvar_Set( "vm_threaded", va( "%i", runs[i].threaded ) );
+		Cvar_Set( "vm_optimize", va( "%i", runs[i].optimize ) );
+		SV_SpawnServer( mapname, qfalse );
+		backend[i] = VM_Backend( gvm );
+
+		start = Sys_Microseconds();
+		for ( j = 0 ; j < frames ; j++ ) {
+			SV_BotFrame( sv.time );
+			sv.time += frameMsec;
+			svs.time += frameMsec;
+			VM_Call( gvm, GAME_RUN_FRAME, sv.time );
+		}
+		usec[i] = Sys_Microseconds() - start;
+	}
+
+	Cvar_Set( "vm_game", vmGame );
+	Cvar_Set( "vm_jitOptimize", jitOptimize );
+	Cvar_Set( "vm_threaded", threaded );
+	Cvar_Set( "vm_optimize", optimize );
+	SV_SpawnServer( mapname, qfalse );
+
+	Com_Printf( "%d frames of %s, %d msec each:\n", frames, mapname, frameMsec );
+	for ( i = 0 ; i < ARRAY_LEN( runs ) ; i++ ) {
+		Com_Printf( "%-18s %9.1f usec/frame %7.2fx", runs[i].name,
+			(float)usec[i] / frames, usec[i] ? (float)usec[0] / usec[i] : 0.0f );
+		if ( backend[i] != runs[i].interpret ) {
+			Com_Printf( " (ran %s)", backends[backend[i]] );
+		}
+		Com_Printf( "\n" );
+	}
+}
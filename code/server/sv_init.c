@@ -123,6 +123,7 @@ void SV_SetConfigstring (int index, const char *val) {
 	// change the string in sv
 	Z_Free( sv.configstrings[index] );
 	sv.configstrings[index] = CopyString( val );
+	sv.gamestateValid = qfalse;
 
 	// send it to all the clients if we aren't
 	// spawning a new server
@@ -230,6 +231,8 @@ static void SV_CreateBaseline( void ) {
 		//
 		sv.svEntities[entnum].baseline = svent->s;
 	}
+
+	sv.gamestateValid = qfalse;
 }
 
 
@@ -405,6 +408,9 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	qboolean	isBot;
 	char		systemInfo[16384];
 	const char	*p;
+	int			spawnTime;
+
+	spawnTime = Sys_Milliseconds();
 
 	// shut down the existing game if it is running
 	SV_ShutdownGameProgs();
@@ -465,6 +471,7 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 
 	// wipe the entire per-level structure
 	SV_ClearServer();
+	sv.spawnTime = spawnTime;
 	for ( i = 0 ; i < MAX_CONFIGSTRINGS ; i++ ) {
 		sv.configstrings[i] = CopyString("");
 	}
@@ -476,6 +483,12 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	sv.checksumFeed = ( ((int) rand() << 16) ^ rand() ) ^ Com_Milliseconds();
 	FS_Restart( sv.checksumFeed );
 
+	// the bots load the area file once the game is up, let it be read
+	// while the collision map loads
+	if ( Cvar_VariableIntegerValue( "bot_enable" ) ) {
+		SV_BotReadAAS( server );
+	}
+
 	CM_LoadMap( va("maps/%s.bsp", server), qfalse, &checksum );
 
 	// set serverinfo visible name
@@ -491,6 +504,10 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 
 	// clear physics interaction links
 	SV_ClearWorld ();
+
+	// per frame entity visibility lookups for snapshots
+	SV_AllocSnapshotVisIndex ();
+	SV_AllocDeltaCache ();
 	
 	// media configstring setting should be done during
 	// the loading stage, so connected clients don't have
@@ -499,6 +516,7 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 
 	// load and spawn all other entities
 	SV_InitGameProgs();
+	SV_BotFreeAAS();
 
 	// don't allow a map_restart if game is modified
 	sv_gametype->modified = qfalse;
@@ -612,6 +630,9 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	// send a heartbeat now so the master will get up to date info
 	SV_Heartbeat_f();
 
+	// nobody to wait for if only bots were connected
+	SV_CheckMapChangeTime();
+
 	Hunk_SetMark();
 
 	Com_Printf ("-----------------------------------\n");
@@ -692,6 +713,14 @@ void SV_Init (void)
 #endif
 	sv_public = Cvar_Get( "sv_public", "1", CVAR_ARCHIVE );
 	sv_banFile = Cvar_Get("sv_banFile", "serverbans.dat", CVAR_ARCHIVE);
+	sv_snapshotThreads = Cvar_Get("sv_snapshotThreads", "0", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_snapshotThreads, 0, 32, qtrue);
+	sv_deltaEntityCache = Cvar_Get("sv_deltaEntityCache", "1", CVAR_ARCHIVE);
+	sv_profile = Cvar_Get("sv_profile", "1", CVAR_ARCHIVE);
+	sv_profileLog = Cvar_Get("sv_profileLog", "", CVAR_ARCHIVE);
+	sv_profileLogInterval = Cvar_Get("sv_profileLogInterval", "10", CVAR_ARCHIVE);
+	Cvar_CheckRange(sv_profileLogInterval, 1, 3600, qtrue);
+	sv_sectorSize = Cvar_Get("sv_sectorSize", "1024", CVAR_ARCHIVE);
 
 	// initialize bot cvars so they are listed and can be set before loading the botlib
 	SV_BotInitCvars();
@@ -733,6 +762,8 @@ void SV_FinalMessage( char *message ) {
 			}
 		}
 	}
+
+	Sys_FlushPackets();
 }
 
 
@@ -63,6 +63,12 @@ cvar_t	*sv_strictAuth;
 #endif
 cvar_t	*sv_public;
 cvar_t	*sv_banFile;
+cvar_t	*sv_snapshotThreads;	// threads used to build client snapshots
+cvar_t	*sv_deltaEntityCache;	// share encoded entity deltas between clients
+cvar_t	*sv_profile;			// time each phase of the server frame
+cvar_t	*sv_profileLog;			// file the frame profile is appended to
+cvar_t	*sv_profileLogInterval;	// seconds between frame profile log entries
+cvar_t	*sv_sectorSize;			// target size of the entity sector tree leafs
 
 serverBan_t serverBans[SERVER_MAXBANS];
 int serverBansCount = 0;
@@ -851,14 +857,283 @@ static void SV_ConnectionlessPacket( netadr_t from, msg_t *msg, int sockid ) {
 	}
 }
 
+/*
+=============================================================================
+
+FRAME PROFILER
+
+Every server tick records how long each phase took, in microseconds, into
+a rolling window.  Packets and downloads are handled between calls to
+SV_Frame and are charged to the next tick.
+
+=============================================================================
+*/
+
+typedef enum {
+	SVP_PACKETS,		// SV_PacketEvent
+	SVP_DOWNLOADS,		// SV_SendQueuedPackets
+	SVP_PINGS,			// SV_CalcPings
+	SVP_BOTS,			// SV_BotFrame
+	SVP_GAME,			// GAME_RUN_FRAME
+	SVP_SNAPSHOTS,		// SV_SendClientMessages
+	SVP_OTHER,			// the rest of SV_Frame
+	SVP_TOTAL,
+
+	SVP_NUM_PHASES
+} svProfilePhase_t;
+
+static const char *svProfilePhaseNames[SVP_NUM_PHASES] = {
+	"packets", "downloads", "pings", "bots", "game", "snapshots", "other", "total"
+};
+
+#define	PROFILE_FRAMES		1024	// size of the rolling window, power of two
+
+typedef struct {
+	int				p50, p99, max;
+} svProfileStats_t;
+
+typedef struct {
+	int				samples[SVP_NUM_PHASES][PROFILE_FRAMES];
+	int				pending[SVP_NUM_PHASES];	// tick in progress
+	int				numFrames;
+	int				overruns;		// ticks that took longer than their budget
+	int				budget;			// usec per tick at the current sv_fps
+
+	int				lastLogTime;
+	int				lastLogFrames;
+	int				lastLogOverruns;
+	fileHandle_t	logFile;
+	char			logName[MAX_QPATH];
+} svProfile_t;
+
+static svProfile_t	sv_prof;
+
+/*
+==================
+SV_ProfileTime
+==================
+*/
+static unsigned int SV_ProfileTime( void ) {
+	return sv_profile->integer ? Sys_Microseconds() : 0;
+}
+
+/*
+==================
+SV_ProfileAdd
+
+Charges the time since start to a phase of the tick in progress
+==================
+*/
+static unsigned int SV_ProfileAdd( svProfilePhase_t phase, unsigned int start ) {
+	unsigned int	now;
+
+	if ( !sv_profile->integer ) {
+		return 0;
+	}
+
+	now = Sys_Microseconds();
+	sv_prof.pending[phase] += (int)( now - start );
+
+	return now;
+}
+
+/*
+==================
+SV_ProfileEndFrame
+
+Moves the tick in progress into the rolling window
+==================
+*/
+static void SV_ProfileEndFrame( int frameMsec ) {
+	int		i, slot, total;
+
+	if ( !sv_profile->integer ) {
+		return;
+	}
+
+	total = 0;
+	for ( i = 0 ; i < SVP_TOTAL ; i++ ) {
+		total += sv_prof.pending[i];
+	}
+	sv_prof.pending[SVP_TOTAL] = total;
+
+	sv_prof.budget = frameMsec * 1000;
+	if ( total > sv_prof.budget ) {
+		sv_prof.overruns++;
+	}
+
+	slot = sv_prof.numFrames & ( PROFILE_FRAMES - 1 );
+	for ( i = 0 ; i < SVP_NUM_PHASES ; i++ ) {
+		sv_prof.samples[i][slot] = sv_prof.pending[i];
+		sv_prof.pending[i] = 0;
+	}
+	sv_prof.numFrames++;
+}
+
+/*
+==================
+SV_ProfileCompare
+==================
+*/
+static int QDECL SV_ProfileCompare( const void *a, const void *b ) {
+	return *(const int *)a - *(const int *)b;
+}
+
+/*
+==================
+SV_ProfileStats
+
+Percentiles of every phase over the rolling window, returns the number
+of ticks in the window
+==================
+*/
+static int SV_ProfileStats( svProfileStats_t *stats ) {
+	int		sorted[PROFILE_FRAMES];
+	int		i, count;
+
+	count = sv_prof.numFrames;
+	if ( count > PROFILE_FRAMES ) {
+		count = PROFILE_FRAMES;
+	}
+
+	for ( i = 0 ; i < SVP_NUM_PHASES ; i++ ) {
+		if ( !count ) {
+			stats[i].p50 = stats[i].p99 = stats[i].max = 0;
+			continue;
+		}
+
+		Com_Memcpy( sorted, sv_prof.samples[i], count * sizeof( sorted[0] ) );
+		qsort( sorted, count, sizeof( sorted[0] ), SV_ProfileCompare );
+
+		stats[i].p50 = sorted[( count - 1 ) * 50 / 100];
+		stats[i].p99 = sorted[( count - 1 ) * 99 / 100];
+		stats[i].max = sorted[count - 1];
+	}
+
+	return count;
+}
+
+/*
+==================
+SV_ProfileLog
+
+Appends one JSON object per line to sv_profileLog every
+sv_profileLogInterval seconds
+==================
+*/
+static void SV_ProfileLog( void ) {
+	svProfileStats_t	stats[SVP_NUM_PHASES];
+	char				line[2048];
+	int					i, now, count, clients;
+
+	if ( !sv_profile->integer || !sv_profileLog->string[0] ) {
+		if ( sv_prof.logFile ) {
+			FS_FCloseFile( sv_prof.logFile );
+			sv_prof.logFile = 0;
+		}
+		sv_prof.logName[0] = '\0';
+		return;
+	}
+
+	now = Sys_Milliseconds();
+	if ( sv_prof.logFile && now - sv_prof.lastLogTime < sv_profileLogInterval->integer * 1000 ) {
+		return;
+	}
+
+	if ( Q_stricmp( sv_prof.logName, sv_profileLog->string ) ) {
+		if ( sv_prof.logFile ) {
+			FS_FCloseFile( sv_prof.logFile );
+		}
+
+		Q_strncpyz( sv_prof.logName, sv_profileLog->string, sizeof( sv_prof.logName ) );
+		sv_prof.logFile = FS_FOpenFileAppend( sv_prof.logName );
+		sv_prof.lastLogTime = now;
+		sv_prof.lastLogFrames = sv_prof.numFrames;
+		sv_prof.lastLogOverruns = sv_prof.overruns;
+
+		if ( !sv_prof.logFile ) {
+			Com_Printf( "WARNING: couldn't open frame profile log %s\n", sv_prof.logName );
+		}
+		return;
+	}
+
+	if ( !sv_prof.logFile ) {
+		return;
+	}
+
+	count = SV_ProfileStats( stats );
+
+	clients = 0;
+	for ( i = 0 ; i < sv_maxclients->integer ; i++ ) {
+		if ( svs.clients[i].state >= CS_CONNECTED ) {
+			clients++;
+		}
+	}
+
+	Com_sprintf( line, sizeof( line ),
+		"{\"time\":%i,\"map\":\"%s\",\"clients\":%i,\"ticks\":%i,\"overruns\":%i,\"window\":%i,\"budget_us\":%i",
+		Com_RealTime( NULL ), sv_mapname->string, clients,
+		sv_prof.numFrames - sv_prof.lastLogFrames, sv_prof.overruns - sv_prof.lastLogOverruns,
+		count, sv_prof.budget );
+
+	for ( i = 0 ; i < SVP_NUM_PHASES ; i++ ) {
+		Q_strcat( line, sizeof( line ), va( ",\"%s\":{\"p50\":%i,\"p99\":%i,\"max\":%i}",
+			svProfilePhaseNames[i], stats[i].p50, stats[i].p99, stats[i].max ) );
+	}
+	Q_strcat( line, sizeof( line ), "}\n" );
+
+	FS_Write( line, strlen( line ), sv_prof.logFile );
+	FS_Flush( sv_prof.logFile );
+
+	sv_prof.lastLogTime = now;
+	sv_prof.lastLogFrames = sv_prof.numFrames;
+	sv_prof.lastLogOverruns = sv_prof.overruns;
+}
+
+/*
+==================
+SV_FrameProfile_f
+
+Prints the rolling frame profile, "frameprofile reset" clears it
+==================
+*/
+void SV_FrameProfile_f( void ) {
+	svProfileStats_t	stats[SVP_NUM_PHASES];
+	int					i, count;
+
+	if ( !Q_stricmp( Cmd_Argv( 1 ), "reset" ) ) {
+		Com_Memset( sv_prof.samples, 0, sizeof( sv_prof.samples ) );
+		Com_Memset( sv_prof.pending, 0, sizeof( sv_prof.pending ) );
+		sv_prof.numFrames = sv_prof.lastLogFrames = 0;
+		sv_prof.overruns = sv_prof.lastLogOverruns = 0;
+		return;
+	}
+
+	if ( !sv_profile->integer ) {
+		Com_Printf( "Frame profiling is disabled, set sv_profile 1\n" );
+		return;
+	}
+
+	count = SV_ProfileStats( stats );
+
+	Com_Printf( "last %i of %i ticks, %i over the %i usec budget\n",
+		count, sv_prof.numFrames, sv_prof.overruns, sv_prof.budget );
+	Com_Printf( "phase          p50      p99      max (usec)\n" );
+	Com_Printf( "---------- -------- -------- --------\n" );
+	for ( i = 0 ; i < SVP_NUM_PHASES ; i++ ) {
+		Com_Printf( "%-10s %8i %8i %8i\n", svProfilePhaseNames[i],
+			stats[i].p50, stats[i].p99, stats[i].max );
+	}
+}
+
 //============================================================================
 
 /*
 =================
-SV_PacketEvent
+SV_ProcessPacket
 =================
 */
-void SV_PacketEvent( netadr_t from, msg_t *msg, int sockid ) {
+static void SV_ProcessPacket( netadr_t from, msg_t *msg, int sockid ) {
 	int			i;
 	client_t	*cl;
 	int			qport;
@@ -911,6 +1186,19 @@ void SV_PacketEvent( netadr_t from, msg_t *msg, int sockid ) {
 	}
 }
 
+/*
+=================
+SV_PacketEvent
+=================
+*/
+void SV_PacketEvent( netadr_t from, msg_t *msg, int sockid ) {
+	unsigned int	start;
+
+	start = SV_ProfileTime();
+	SV_ProcessPacket( from, msg, sockid );
+	SV_ProfileAdd( SVP_PACKETS, start );
+}
+
 
 /*
 ===================
@@ -1083,6 +1371,8 @@ happen before SV_Frame is called
 void SV_Frame( int msec ) {
 	int		frameMsec;
 	int		startTime;
+	int		gameFrames;
+	unsigned int	profileTime;
 
 	// the menu kills the server with this cvar
 	if ( sv_killserver->integer ) {
@@ -1122,7 +1412,12 @@ void SV_Frame( int msec ) {
 
 	sv.timeResidual += msec;
 
-	if (!com_dedicated->integer) SV_BotFrame (sv.time + sv.timeResidual);
+	profileTime = SV_ProfileTime();
+
+	if (!com_dedicated->integer) {
+		SV_BotFrame (sv.time + sv.timeResidual);
+		profileTime = SV_ProfileAdd( SVP_BOTS, profileTime );
+	}
 
 	// if time is about to hit the 32nd bit, kick all clients
 	// and clear sv.time, rather
@@ -1162,12 +1457,20 @@ void SV_Frame( int msec ) {
 		startTime = 0;	// quite a compiler warning
 	}
 
+	profileTime = SV_ProfileAdd( SVP_OTHER, profileTime );
+
 	// update ping based on the all received frames
 	SV_CalcPings();
 
-	if (com_dedicated->integer) SV_BotFrame (sv.time);
+	profileTime = SV_ProfileAdd( SVP_PINGS, profileTime );
+
+	if (com_dedicated->integer) {
+		SV_BotFrame (sv.time);
+		profileTime = SV_ProfileAdd( SVP_BOTS, profileTime );
+	}
 
 	// run the game simulation in chunks
+	gameFrames = 0;
 	while ( sv.timeResidual >= frameMsec ) {
 		sv.timeResidual -= frameMsec;
 		svs.time += frameMsec;
@@ -1175,8 +1478,11 @@ void SV_Frame( int msec ) {
 
 		// let everything in the world think and move
 		VM_Call (gvm, GAME_RUN_FRAME, sv.time);
+		gameFrames++;
 	}
 
+	profileTime = SV_ProfileAdd( SVP_GAME, profileTime );
+
 	if ( com_speeds->integer ) {
 		time_game = Sys_Milliseconds () - startTime;
 	}
@@ -1184,11 +1490,23 @@ void SV_Frame( int msec ) {
 	// check timeouts
 	SV_CheckTimeouts();
 
+	profileTime = SV_ProfileAdd( SVP_OTHER, profileTime );
+
 	// send messages back to the clients
 	SV_SendClientMessages();
 
+	profileTime = SV_ProfileAdd( SVP_SNAPSHOTS, profileTime );
+
 	// send a heartbeat to the master if needed
 	SV_MasterHeartbeat(HEARTBEAT_FOR_MASTER);
+
+	SV_ProfileAdd( SVP_OTHER, profileTime );
+
+	// everything since the last tick is charged to the one that just ran
+	if ( gameFrames ) {
+		SV_ProfileEndFrame( gameFrames * frameMsec );
+		SV_ProfileLog();
+	}
 }
 
 /*
@@ -1257,6 +1575,7 @@ int SV_SendQueuedPackets()
 	int dlStart, deltaT, delayT;
 	static int dlNextRound = 0;
 	int timeVal = INT_MAX;
+	unsigned int profileStart = SV_ProfileTime();
 
 	// Send out fragmented packets now that we're idle
 	delayT = SV_SendQueuedMessages();
@@ -1318,5 +1637,7 @@ int SV_SendQueuedPackets()
 			timeVal = 0;
 	}
 
+	SV_ProfileAdd(SVP_DOWNLOADS, profileStart);
+
 	return timeVal;
 }
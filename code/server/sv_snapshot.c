@@ -45,6 +45,188 @@ A normal server packet will look like:
 =============================================================================
 */
 
+/*
+=============================================================================
+
+Delta entity cache
+
+Clients seeing the same entity usually delta it from the same old state,
+and every client gets new entities from the same baseline.  While
+SV_SendClientMessages runs, the encoded bits of each delta are kept, keyed
+by entity number and both states, and copied straight into the next
+message that needs the same delta.
+
+=============================================================================
+*/
+
+#define	DELTA_CACHE_ENTRIES		2048
+#define	DELTA_CACHE_BYTES		0x40000
+#define	MAX_DELTA_BYTES			1024		// encoding scratch space
+
+typedef struct deltaCacheEntry_s {
+	int				hash;
+	qboolean		force;
+	entityState_t	from;
+	entityState_t	to;
+	int				bits;
+	int				offset;				// into the cache data
+	struct deltaCacheEntry_s	*next;
+} deltaCacheEntry_t;
+
+typedef struct {
+	qboolean			active;			// only while sending client messages
+	deltaCacheEntry_t	*heads[MAX_GENTITIES];
+	deltaCacheEntry_t	*entries;
+	int					numEntries;
+	byte				*data;
+	int					dataUsed;
+
+	int					lookups;
+	int					hits;
+	int					bytesReused;
+
+	void				*lock;			// looked up and filled in from job workers
+} deltaCache_t;
+
+static deltaCache_t		sv_deltaCache;
+
+/*
+===============
+SV_AllocDeltaCache
+
+Called when a new level is loaded.
+===============
+*/
+void SV_AllocDeltaCache( void ) {
+	sv_deltaCache.active = qfalse;
+	sv_deltaCache.entries = Hunk_Alloc( DELTA_CACHE_ENTRIES * sizeof( deltaCacheEntry_t ), h_high );
+	sv_deltaCache.data = Hunk_Alloc( DELTA_CACHE_BYTES, h_high );
+
+	if ( !sv_deltaCache.lock ) {
+		sv_deltaCache.lock = Sys_CreateMutex();
+	}
+}
+
+/*
+===============
+SV_BeginDeltaCache
+===============
+*/
+static void SV_BeginDeltaCache( void ) {
+	sv_deltaCache.active = ( sv_deltaCache.entries && sv_deltaEntityCache->integer );
+	if ( !sv_deltaCache.active ) {
+		return;
+	}
+
+	Com_Memset( sv_deltaCache.heads, 0, sizeof( sv_deltaCache.heads ) );
+	sv_deltaCache.numEntries = 0;
+	sv_deltaCache.dataUsed = 0;
+}
+
+/*
+===============
+SV_HashEntityState
+===============
+*/
+static int SV_HashEntityState( const entityState_t *s, int hash ) {
+	const int	*p = (const int *)s;
+	int			i;
+
+	for ( i = 0 ; i < sizeof( *s ) / sizeof( int ) ; i++ ) {
+		hash = hash * 31 + p[i];
+	}
+	return hash;
+}
+
+/*
+===============
+SV_WriteDeltaEntity
+
+MSG_WriteDeltaEntity through the delta entity cache.
+===============
+*/
+static void SV_WriteDeltaEntity( msg_t *msg, entityState_t *from, entityState_t *to, qboolean force ) {
+	deltaCacheEntry_t	*entry;
+	byte				buf[MAX_DELTA_BYTES];
+	msg_t				delta;
+	int					hash, num, bytes;
+
+	if ( !sv_deltaCache.active ) {
+		MSG_WriteDeltaEntity( msg, from, to, force );
+		return;
+	}
+
+	num = to->number;
+	hash = SV_HashEntityState( to, SV_HashEntityState( from, force ) );
+
+	Sys_LockMutex( sv_deltaCache.lock );
+	sv_deltaCache.lookups++;
+	for ( entry = sv_deltaCache.heads[num] ; entry ; entry = entry->next ) {
+		if ( entry->hash == hash && entry->force == force
+			&& !memcmp( &entry->from, from, sizeof( *from ) )
+			&& !memcmp( &entry->to, to, sizeof( *to ) ) ) {
+			break;
+		}
+	}
+	if ( entry ) {
+		sv_deltaCache.hits++;
+		sv_deltaCache.bytesReused += ( entry->bits + 7 ) >> 3;
+	}
+	Sys_UnlockMutex( sv_deltaCache.lock );
+
+	// entries are never changed once they are linked in
+	if ( entry ) {
+		MSG_WriteEncodedBits( msg, sv_deltaCache.data + entry->offset, entry->bits );
+		return;
+	}
+
+	MSG_Init( &delta, buf, sizeof( buf ) );
+	MSG_WriteDeltaEntity( &delta, from, to, force );
+	if ( delta.overflowed ) {
+		MSG_WriteDeltaEntity( msg, from, to, force );
+		return;
+	}
+	MSG_WriteEncodedBits( msg, buf, delta.bit );
+
+	bytes = ( delta.bit + 7 ) >> 3;
+
+	Sys_LockMutex( sv_deltaCache.lock );
+	if ( sv_deltaCache.numEntries < DELTA_CACHE_ENTRIES
+		&& sv_deltaCache.dataUsed + bytes <= DELTA_CACHE_BYTES ) {
+		entry = &sv_deltaCache.entries[sv_deltaCache.numEntries++];
+		entry->hash = hash;
+		entry->force = force;
+		entry->from = *from;
+		entry->to = *to;
+		entry->bits = delta.bit;
+		entry->offset = sv_deltaCache.dataUsed;
+		Com_Memcpy( sv_deltaCache.data + entry->offset, buf, bytes );
+		sv_deltaCache.dataUsed += bytes;
+
+		entry->next = sv_deltaCache.heads[num];
+		sv_deltaCache.heads[num] = entry;
+	}
+	Sys_UnlockMutex( sv_deltaCache.lock );
+}
+
+/*
+===============
+SV_DeltaCacheStats_f
+===============
+*/
+void SV_DeltaCacheStats_f( void ) {
+	Com_Printf( "%d delta entity lookups, %d hits (%.1f%%), %d bytes reused\n",
+		sv_deltaCache.lookups, sv_deltaCache.hits,
+		sv_deltaCache.lookups ? 100.0f * sv_deltaCache.hits / sv_deltaCache.lookups : 0.0f,
+		sv_deltaCache.bytesReused );
+
+	if ( Cmd_Argc() > 1 && !Q_stricmp( Cmd_Argv( 1 ), "reset" ) ) {
+		sv_deltaCache.lookups = 0;
+		sv_deltaCache.hits = 0;
+		sv_deltaCache.bytesReused = 0;
+	}
+}
+
 /*
 =============
 SV_EmitPacketEntities
@@ -88,7 +270,7 @@ static void SV_EmitPacketEntities( clientSnapshot_t *from, clientSnapshot_t *to,
 			// delta update from old position
 			// because the force parm is qfalse, this will not result
 			// in any bytes being emited if the entity has not changed at all
-			MSG_WriteDeltaEntity (msg, oldent, newent, qfalse );
+			SV_WriteDeltaEntity (msg, oldent, newent, qfalse );
 			oldindex++;
 			newindex++;
 			continue;
@@ -96,7 +278,7 @@ static void SV_EmitPacketEntities( clientSnapshot_t *from, clientSnapshot_t *to,
 
 		if ( newnum < oldnum ) {
 			// this is a new entity, send it from the baseline
-			MSG_WriteDeltaEntity (msg, &sv.svEntities[newnum].baseline, newent, qtrue );
+			SV_WriteDeltaEntity (msg, &sv.svEntities[newnum].baseline, newent, qtrue );
 			newindex++;
 			continue;
 		}
@@ -116,42 +298,58 @@ static void SV_EmitPacketEntities( clientSnapshot_t *from, clientSnapshot_t *to,
 
 /*
 ==================
-SV_WriteSnapshotToClient
+SV_DeltaSnapshotFrame
+
+Picks the previous frame the new snapshot will be delta compressed from,
+or NULL if a full snapshot has to be sent.
 ==================
 */
-static void SV_WriteSnapshotToClient( client_t *client, msg_t *msg ) {
-	clientSnapshot_t	*frame, *oldframe;
-	int					lastframe;
-	int					i;
-	int					snapFlags;
-
-	// this is the snapshot we are creating
-	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+static clientSnapshot_t *SV_DeltaSnapshotFrame( client_t *client, int *lastframe ) {
+	clientSnapshot_t	*oldframe;
 
 	// try to use a previous frame as the source for delta compressing the snapshot
 	if ( client->deltaMessage <= 0 || client->state != CS_ACTIVE ) {
 		// client is asking for a retransmit
 		oldframe = NULL;
-		lastframe = 0;
+		*lastframe = 0;
 	} else if ( client->netchan.outgoingSequence - client->deltaMessage 
 		>= (PACKET_BACKUP - 3) ) {
 		// client hasn't gotten a good message through in a long time
 		Com_DPrintf ("%s: Delta request from out of date packet.\n", client->name);
 		oldframe = NULL;
-		lastframe = 0;
+		*lastframe = 0;
 	} else {
 		// we have a valid snapshot to delta from
 		oldframe = &client->frames[ client->deltaMessage & PACKET_MASK ];
-		lastframe = client->netchan.outgoingSequence - client->deltaMessage;
+		*lastframe = client->netchan.outgoingSequence - client->deltaMessage;
 
 		// the snapshot's entities may still have rolled off the buffer, though
 		if ( oldframe->first_entity <= svs.nextSnapshotEntities - svs.numSnapshotEntities ) {
 			Com_DPrintf ("%s: Delta request from out of date entities.\n", client->name);
 			oldframe = NULL;
-			lastframe = 0;
+			*lastframe = 0;
 		}
 	}
 
+	return oldframe;
+}
+
+/*
+==================
+SV_WriteSnapshotToClient
+
+Doesn't touch anything shared between clients, so snapshots for
+several clients can be written at once.
+==================
+*/
+static void SV_WriteSnapshotToClient( client_t *client, clientSnapshot_t *oldframe, int lastframe, msg_t *msg ) {
+	clientSnapshot_t	*frame;
+	int					i;
+	int					snapFlags;
+
+	// this is the snapshot we are creating
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
+
 	MSG_WriteByte (msg, svc_snapshot);
 
 	// NOTE, MRE: now sent at the start of every message from server to client
@@ -239,6 +437,7 @@ Build a client snapshot structure
 typedef struct {
 	int		numSnapshotEntities;
 	int		snapshotEntities[MAX_SNAPSHOT_ENTITIES];	
+	byte	added[MAX_GENTITIES/8];		// used to prevent double adding from portal views
 } snapshotEntityNumbers_t;
 
 /*
@@ -270,11 +469,13 @@ SV_AddEntToSnapshot
 ===============
 */
 static void SV_AddEntToSnapshot( svEntity_t *svEnt, sharedEntity_t *gEnt, snapshotEntityNumbers_t *eNums ) {
+	int		num = gEnt->s.number;
+
 	// if we have already added this entity to this snapshot, don't add again
-	if ( svEnt->snapshotCounter == sv.snapshotCounter ) {
+	if ( eNums->added[num >> 3] & (1 << (num & 7)) ) {
 		return;
 	}
-	svEnt->snapshotCounter = sv.snapshotCounter;
+	eNums->added[num >> 3] |= 1 << (num & 7);
 
 	// if we are full, silently discard entities
 	if ( eNums->numSnapshotEntities == MAX_SNAPSHOT_ENTITIES ) {
@@ -285,151 +486,452 @@ static void SV_AddEntToSnapshot( svEntity_t *svEnt, sharedEntity_t *gEnt, snapsh
 	eNums->numSnapshotEntities++;
 }
 
+/*
+=============================================================================
+
+Visibility index
+
+Inside SV_SendClientMessages nothing can move, link or unlink entities,
+so the cluster and area each linked entity touches are gathered once per
+frame.  The set of entities potentially visible from a cluster, and the
+set in areas connected to an area, are then worked out the first time a
+viewpoint needs them and shared by every other client looking from the
+same place.  Those sets only narrow down the candidates; every candidate
+still goes through the full per entity checks.
+
+=============================================================================
+*/
+
+#define	VIS_WORDS	(MAX_GENTITIES/32)
+
+typedef struct {
+	qboolean		valid;				// only while sending client messages
+	int				frame;				// bumped each build to expire the cached sets
+	int				numWords;			// words used for sv.num_entities
+
+	int				numClusters;
+	int				*clusterFirst;		// [numClusters+1] offsets into clusterEnts
+	int				*clusterEnts;
+	int				rangeEnts[MAX_GENTITIES];	// entities with a lastCluster range
+	int				numRangeEnts;
+
+	int				numAreas;
+	int				*areaFirst;			// [numAreas+1] offsets into areaEnts
+	int				*areaEnts;
+
+	unsigned int	linked[VIS_WORDS];
+	unsigned int	broadcast[VIS_WORDS];
+
+	int				*clusterVisFrame;	// [numClusters+1], the last slot for outside the map
+	unsigned int	*clusterVis;
+	int				*areaVisFrame;		// [numAreas+1], the last slot for outside any area
+	unsigned int	*areaVis;
+
+	void			*lock;				// the cached sets are filled in from job workers
+} snapshotVisIndex_t;
+
+static snapshotVisIndex_t	sv_visIndex;
+
 /*
 ===============
-SV_AddEntitiesVisibleFromPoint
+SV_AllocSnapshotVisIndex
+
+Called after the collision map for a new level is loaded.
 ===============
 */
-static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *frame, 
-									snapshotEntityNumbers_t *eNums, qboolean portal ) {
-	int		e, i;
-	sharedEntity_t *ent;
-	svEntity_t	*svEnt;
-	int		l;
-	int		clientarea, clientcluster;
-	int		leafnum;
-	byte	*clientpvs;
-	byte	*bitvector;
+void SV_AllocSnapshotVisIndex( void ) {
+	snapshotVisIndex_t	*vi = &sv_visIndex;
 
-	// during an error shutdown message we may need to transmit
-	// the shutdown message after the server has shutdown, so
-	// specfically check for it
-	if ( !sv.state ) {
-		return;
+	vi->valid = qfalse;
+	vi->numClusters = CM_NumClusters();
+	vi->numAreas = CM_NumAreas();
+
+	vi->clusterFirst = Hunk_Alloc( ( vi->numClusters + 1 ) * sizeof( int ), h_high );
+	vi->clusterEnts = Hunk_Alloc( MAX_GENTITIES * MAX_ENT_CLUSTERS * sizeof( int ), h_high );
+	vi->areaFirst = Hunk_Alloc( ( vi->numAreas + 1 ) * sizeof( int ), h_high );
+	vi->areaEnts = Hunk_Alloc( MAX_GENTITIES * 2 * sizeof( int ), h_high );
+
+	vi->clusterVisFrame = Hunk_Alloc( ( vi->numClusters + 1 ) * sizeof( int ), h_high );
+	vi->clusterVis = Hunk_Alloc( ( vi->numClusters + 1 ) * VIS_WORDS * sizeof( int ), h_high );
+	vi->areaVisFrame = Hunk_Alloc( ( vi->numAreas + 1 ) * sizeof( int ), h_high );
+	vi->areaVis = Hunk_Alloc( ( vi->numAreas + 1 ) * VIS_WORDS * sizeof( int ), h_high );
+
+	// the cached sets are stamped with a frame number, never match them
+	// against the zeroed frame stamps
+	vi->frame = 1;
+
+	if ( !vi->lock ) {
+		vi->lock = Sys_CreateMutex();
 	}
+}
 
-	leafnum = CM_PointLeafnum (origin);
-	clientarea = CM_LeafArea (leafnum);
-	clientcluster = CM_LeafCluster (leafnum);
+/*
+===============
+SV_BuildSnapshotVisIndex
+===============
+*/
+static void SV_BuildSnapshotVisIndex( void ) {
+	snapshotVisIndex_t	*vi = &sv_visIndex;
+	sharedEntity_t		*ent;
+	svEntity_t			*svEnt;
+	int					e, i, c, total;
 
-	// calculate the visible areas
-	frame->areabytes = CM_WriteAreaBits( frame->areabits, clientarea );
+	vi->valid = qfalse;
 
-	clientpvs = CM_ClusterPVS (clientcluster);
+	// the map changed underneath us, or no map at all
+	if ( !vi->clusterFirst || vi->numClusters != CM_NumClusters() || vi->numAreas != CM_NumAreas() ) {
+		return;
+	}
 
-	for ( e = 0 ; e < sv.num_entities ; e++ ) {
-		ent = SV_GentityNum(e);
+	vi->frame++;
+	vi->numWords = ( sv.num_entities + 31 ) >> 5;
+	vi->numRangeEnts = 0;
+	Com_Memset( vi->linked, 0, sizeof( vi->linked ) );
+	Com_Memset( vi->broadcast, 0, sizeof( vi->broadcast ) );
+	Com_Memset( vi->clusterFirst, 0, ( vi->numClusters + 1 ) * sizeof( int ) );
+	Com_Memset( vi->areaFirst, 0, ( vi->numAreas + 1 ) * sizeof( int ) );
 
-		// never send entities that aren't linked in
+	// count the entities in each cluster and area
+	for ( e = 0 ; e < sv.num_entities ; e++ ) {
+		ent = SV_GentityNum( e );
 		if ( !ent->r.linked ) {
 			continue;
 		}
+		svEnt = &sv.svEntities[e];
 
-		if (ent->s.number != e) {
-			Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
-			ent->s.number = e;
+		vi->linked[e >> 5] |= 1u << ( e & 31 );
+		if ( ent->r.svFlags & SVF_BROADCAST ) {
+			vi->broadcast[e >> 5] |= 1u << ( e & 31 );
 		}
 
-		// entities can be flagged to explicitly not be sent to the client
-		if ( ent->r.svFlags & SVF_NOCLIENT ) {
-			continue;
+		for ( i = 0 ; i < svEnt->numClusters ; i++ ) {
+			vi->clusterFirst[svEnt->clusternums[i]]++;
 		}
-
-		// entities can be flagged to be sent to only one client
-		if ( ent->r.svFlags & SVF_SINGLECLIENT ) {
-			if ( ent->r.singleClient != frame->ps.clientNum ) {
-				continue;
-			}
+		if ( svEnt->numClusters && svEnt->lastCluster ) {
+			vi->rangeEnts[vi->numRangeEnts++] = e;
 		}
-		// entities can be flagged to be sent to everyone but one client
-		if ( ent->r.svFlags & SVF_NOTSINGLECLIENT ) {
-			if ( ent->r.singleClient == frame->ps.clientNum ) {
-				continue;
-			}
+
+		if ( svEnt->areanum >= 0 ) {
+			vi->areaFirst[svEnt->areanum]++;
 		}
-		// entities can be flagged to be sent to a given mask of clients
-		if ( ent->r.svFlags & SVF_CLIENTMASK ) {
-			if (frame->ps.clientNum >= 32)
-				Com_Error( ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32" );
-			if (~ent->r.singleClient & (1 << frame->ps.clientNum))
-				continue;
+		if ( svEnt->areanum2 >= 0 && svEnt->areanum2 != svEnt->areanum ) {
+			vi->areaFirst[svEnt->areanum2]++;
 		}
+	}
 
-		svEnt = SV_SvEntityForGentity( ent );
+	// turn the counts into end offsets, filling in below moves
+	// each one back to the start of its cluster or area
+	for ( c = 0, total = 0 ; c <= vi->numClusters ; c++ ) {
+		total += vi->clusterFirst[c];
+		vi->clusterFirst[c] = total;
+	}
+	for ( c = 0, total = 0 ; c <= vi->numAreas ; c++ ) {
+		total += vi->areaFirst[c];
+		vi->areaFirst[c] = total;
+	}
 
-		// don't double add an entity through portals
-		if ( svEnt->snapshotCounter == sv.snapshotCounter ) {
+	for ( e = sv.num_entities - 1 ; e >= 0 ; e-- ) {
+		if ( !( vi->linked[e >> 5] & ( 1u << ( e & 31 ) ) ) ) {
 			continue;
 		}
+		svEnt = &sv.svEntities[e];
 
-		// broadcast entities are always sent
-		if ( ent->r.svFlags & SVF_BROADCAST ) {
-			SV_AddEntToSnapshot( svEnt, ent, eNums );
-			continue;
+		for ( i = 0 ; i < svEnt->numClusters ; i++ ) {
+			vi->clusterEnts[--vi->clusterFirst[svEnt->clusternums[i]]] = e;
 		}
 
-		// ignore if not touching a PV leaf
-		// check area
-		if ( !CM_AreasConnected( clientarea, svEnt->areanum ) ) {
-			// doors can legally straddle two areas, so
-			// we may need to check another one
-			if ( !CM_AreasConnected( clientarea, svEnt->areanum2 ) ) {
-				continue;		// blocked by a door
-			}
+		if ( svEnt->areanum >= 0 ) {
+			vi->areaEnts[--vi->areaFirst[svEnt->areanum]] = e;
+		}
+		if ( svEnt->areanum2 >= 0 && svEnt->areanum2 != svEnt->areanum ) {
+			vi->areaEnts[--vi->areaFirst[svEnt->areanum2]] = e;
 		}
+	}
 
-		bitvector = clientpvs;
+	vi->valid = qtrue;
+}
 
-		// check individual leafs
-		if ( !svEnt->numClusters ) {
-			continue;
+/*
+===============
+SV_ClusterVisibleEntities
+
+Entities touching a cluster in the PVS of the given cluster.
+===============
+*/
+static const unsigned int *SV_ClusterVisibleEntities( int cluster ) {
+	snapshotVisIndex_t	*vi = &sv_visIndex;
+	unsigned int		*bits;
+	byte				*pvs;
+	svEntity_t			*svEnt;
+	int					slot, c, i, e, l;
+
+	slot = ( cluster < 0 || cluster >= vi->numClusters ) ? vi->numClusters : cluster;
+	bits = vi->clusterVis + slot * VIS_WORDS;
+
+	Sys_LockMutex( vi->lock );
+
+	if ( vi->clusterVisFrame[slot] != vi->frame ) {
+		Com_Memset( bits, 0, vi->numWords * sizeof( *bits ) );
+		pvs = CM_ClusterPVS( cluster );
+
+		for ( c = 0 ; c < vi->numClusters ; c++ ) {
+			if ( !pvs[c >> 3] ) {
+				c |= 7;
+				continue;
+			}
+			if ( !( pvs[c >> 3] & ( 1 << ( c & 7 ) ) ) ) {
+				continue;
+			}
+			for ( i = vi->clusterFirst[c] ; i < vi->clusterFirst[c + 1] ; i++ ) {
+				e = vi->clusterEnts[i];
+				bits[e >> 5] |= 1u << ( e & 31 );
+			}
 		}
-		l = 0;
-		for ( i=0 ; i < svEnt->numClusters ; i++ ) {
-			l = svEnt->clusternums[i];
-			if ( bitvector[l >> 3] & (1 << (l&7) ) ) {
-				break;
+
+		// overflow clusters that couldn't be stored, tested the
+		// same way SV_AddEntitiesVisibleFromPoint does
+		for ( i = 0 ; i < vi->numRangeEnts ; i++ ) {
+			e = vi->rangeEnts[i];
+			svEnt = &sv.svEntities[e];
+
+			for ( l = svEnt->clusternums[svEnt->numClusters - 1] ; l <= svEnt->lastCluster ; l++ ) {
+				if ( pvs[l >> 3] & ( 1 << ( l & 7 ) ) ) {
+					break;
+				}
+			}
+			if ( l != svEnt->lastCluster ) {
+				bits[e >> 5] |= 1u << ( e & 31 );
 			}
 		}
 
-		// if we haven't found it to be visible,
-		// check overflow clusters that coudln't be stored
-		if ( i == svEnt->numClusters ) {
-			if ( svEnt->lastCluster ) {
-				for ( ; l <= svEnt->lastCluster ; l++ ) {
-					if ( bitvector[l >> 3] & (1 << (l&7) ) ) {
-						break;
-					}
+		vi->clusterVisFrame[slot] = vi->frame;
+	}
+
+	Sys_UnlockMutex( vi->lock );
+
+	return bits;
+}
+
+/*
+===============
+SV_AreaConnectedEntities
+
+Entities in an area connected to the given area.
+===============
+*/
+static const unsigned int *SV_AreaConnectedEntities( int area ) {
+	snapshotVisIndex_t	*vi = &sv_visIndex;
+	unsigned int		*bits;
+	int					slot, a, i, e;
+
+	slot = ( area < 0 || area >= vi->numAreas ) ? vi->numAreas : area;
+	bits = vi->areaVis + slot * VIS_WORDS;
+
+	Sys_LockMutex( vi->lock );
+
+	if ( vi->areaVisFrame[slot] != vi->frame ) {
+		if ( CM_AreasConnected( -1, -1 ) ) {
+			// cm_noAreas connects everything, even entities outside any area
+			Com_Memcpy( bits, vi->linked, vi->numWords * sizeof( *bits ) );
+		} else {
+			Com_Memset( bits, 0, vi->numWords * sizeof( *bits ) );
+
+			for ( a = 0 ; a < vi->numAreas && slot != vi->numAreas ; a++ ) {
+				if ( !CM_AreasConnected( area, a ) ) {
+					continue;
 				}
-				if ( l == svEnt->lastCluster ) {
-					continue;	// not visible
+				for ( i = vi->areaFirst[a] ; i < vi->areaFirst[a + 1] ; i++ ) {
+					e = vi->areaEnts[i];
+					bits[e >> 5] |= 1u << ( e & 31 );
 				}
-			} else {
-				continue;
 			}
 		}
 
-		// add it
+		vi->areaVisFrame[slot] = vi->frame;
+	}
+
+	Sys_UnlockMutex( vi->lock );
+
+	return bits;
+}
+
+static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *frame, 
+									snapshotEntityNumbers_t *eNums, qboolean portal );
+
+/*
+===============
+SV_AddEntityIfVisible
+===============
+*/
+static void SV_AddEntityIfVisible( int e, vec3_t origin, clientSnapshot_t *frame, 
+									snapshotEntityNumbers_t *eNums, int clientarea, byte *clientpvs ) {
+	int		i;
+	sharedEntity_t *ent;
+	svEntity_t	*svEnt;
+	int		l;
+	byte	*bitvector;
+
+	ent = SV_GentityNum(e);
+
+	// never send entities that aren't linked in
+	if ( !ent->r.linked ) {
+		return;
+	}
+
+	if (ent->s.number != e) {
+		Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
+		ent->s.number = e;
+	}
+
+	// entities can be flagged to explicitly not be sent to the client
+	if ( ent->r.svFlags & SVF_NOCLIENT ) {
+		return;
+	}
+
+	// entities can be flagged to be sent to only one client
+	if ( ent->r.svFlags & SVF_SINGLECLIENT ) {
+		if ( ent->r.singleClient != frame->ps.clientNum ) {
+			return;
+		}
+	}
+	// entities can be flagged to be sent to everyone but one client
+	if ( ent->r.svFlags & SVF_NOTSINGLECLIENT ) {
+		if ( ent->r.singleClient == frame->ps.clientNum ) {
+			return;
+		}
+	}
+	// entities can be flagged to be sent to a given mask of clients
+	if ( ent->r.svFlags & SVF_CLIENTMASK ) {
+		if (frame->ps.clientNum >= 32)
+			Com_Error( ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32" );
+		if (~ent->r.singleClient & (1 << frame->ps.clientNum))
+			return;
+	}
+
+	svEnt = SV_SvEntityForGentity( ent );
+
+	// don't double add an entity through portals
+	if ( eNums->added[e >> 3] & (1 << (e & 7)) ) {
+		return;
+	}
+
+	// broadcast entities are always sent
+	if ( ent->r.svFlags & SVF_BROADCAST ) {
 		SV_AddEntToSnapshot( svEnt, ent, eNums );
+		return;
+	}
 
-		// if it's a portal entity, add everything visible from its camera position
-		if ( ent->r.svFlags & SVF_PORTAL ) {
-			if ( ent->s.generic1 ) {
-				vec3_t dir;
-				VectorSubtract(ent->s.origin, origin, dir);
-				if ( VectorLengthSquared(dir) > (float) ent->s.generic1 * ent->s.generic1 ) {
-					continue;
+	// ignore if not touching a PV leaf
+	// check area
+	if ( !CM_AreasConnected( clientarea, svEnt->areanum ) ) {
+		// doors can legally straddle two areas, so
+		// we may need to check another one
+		if ( !CM_AreasConnected( clientarea, svEnt->areanum2 ) ) {
+			return;		// blocked by a door
+		}
+	}
+
+	bitvector = clientpvs;
+
+	// check individual leafs
+	if ( !svEnt->numClusters ) {
+		return;
+	}
+	l = 0;
+	for ( i=0 ; i < svEnt->numClusters ; i++ ) {
+		l = svEnt->clusternums[i];
+		if ( bitvector[l >> 3] & (1 << (l&7) ) ) {
+			break;
+		}
+	}
+
+	// if we haven't found it to be visible,
+	// check overflow clusters that coudln't be stored
+	if ( i == svEnt->numClusters ) {
+		if ( svEnt->lastCluster ) {
+			for ( ; l <= svEnt->lastCluster ; l++ ) {
+				if ( bitvector[l >> 3] & (1 << (l&7) ) ) {
+					break;
 				}
 			}
-			SV_AddEntitiesVisibleFromPoint( ent->s.origin2, frame, eNums, qtrue );
+			if ( l == svEnt->lastCluster ) {
+				return;	// not visible
+			}
+		} else {
+			return;
 		}
+	}
+
+	// add it
+	SV_AddEntToSnapshot( svEnt, ent, eNums );
 
+	// if it's a portal entity, add everything visible from its camera position
+	if ( ent->r.svFlags & SVF_PORTAL ) {
+		if ( ent->s.generic1 ) {
+			vec3_t dir;
+			VectorSubtract(ent->s.origin, origin, dir);
+			if ( VectorLengthSquared(dir) > (float) ent->s.generic1 * ent->s.generic1 ) {
+				return;
+			}
+		}
+		SV_AddEntitiesVisibleFromPoint( ent->s.origin2, frame, eNums, qtrue );
+	}
+}
+
+/*
+===============
+SV_AddEntitiesVisibleFromPoint
+===============
+*/
+static void SV_AddEntitiesVisibleFromPoint( vec3_t origin, clientSnapshot_t *frame, 
+									snapshotEntityNumbers_t *eNums, qboolean portal ) {
+	int		e, w;
+	int		clientarea, clientcluster;
+	int		leafnum;
+	byte	*clientpvs;
+	const unsigned int	*clusterBits, *areaBits;
+	unsigned int		bits;
+
+	// during an error shutdown message we may need to transmit
+	// the shutdown message after the server has shutdown, so
+	// specfically check for it
+	if ( !sv.state ) {
+		return;
+	}
+
+	leafnum = CM_PointLeafnum (origin);
+	clientarea = CM_LeafArea (leafnum);
+	clientcluster = CM_LeafCluster (leafnum);
+
+	// calculate the visible areas
+	frame->areabytes = CM_WriteAreaBits( frame->areabits, clientarea );
+
+	clientpvs = CM_ClusterPVS (clientcluster);
+
+	if ( !sv_visIndex.valid ) {
+		for ( e = 0 ; e < sv.num_entities ; e++ ) {
+			SV_AddEntityIfVisible( e, origin, frame, eNums, clientarea, clientpvs );
+		}
+		return;
+	}
+
+	clusterBits = SV_ClusterVisibleEntities( clientcluster );
+	areaBits = SV_AreaConnectedEntities( clientarea );
+
+	for ( w = 0 ; w < sv_visIndex.numWords ; w++ ) {
+		bits = ( clusterBits[w] & areaBits[w] ) | sv_visIndex.broadcast[w];
+
+		for ( e = w << 5 ; bits ; e++, bits >>= 1 ) {
+			if ( bits & 1 ) {
+				SV_AddEntityIfVisible( e, origin, frame, eNums, clientarea, clientpvs );
+			}
+		}
 	}
 }
 
 /*
 =============
-SV_BuildClientSnapshot
+SV_SelectSnapshotEntities
 
 Decides which entities are going to be visible to the client, and
 copies off the playerstate and areabits.
@@ -438,28 +940,25 @@ This properly handles multiple recursive portals, but the render
 currently doesn't.
 
 For viewing through other player's eyes, clent can be something other than client->gentity
+
+Only the client's own frame is written, so this can run for several
+clients at once.
 =============
 */
-static void SV_BuildClientSnapshot( client_t *client ) {
+static void SV_SelectSnapshotEntities( client_t *client, snapshotEntityNumbers_t *entityNumbers ) {
 	vec3_t						org;
 	clientSnapshot_t			*frame;
-	snapshotEntityNumbers_t		entityNumbers;
 	int							i;
-	sharedEntity_t				*ent;
-	entityState_t				*state;
-	svEntity_t					*svEnt;
 	sharedEntity_t				*clent;
 	int							clientNum;
 	playerState_t				*ps;
 
-	// bump the counter used to prevent double adding
-	sv.snapshotCounter++;
-
 	// this is the frame we are creating
 	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
 	// clear everything in this snapshot
-	entityNumbers.numSnapshotEntities = 0;
+	entityNumbers->numSnapshotEntities = 0;
+	Com_Memset( entityNumbers->added, 0, sizeof( entityNumbers->added ) );
 	Com_Memset( frame->areabits, 0, sizeof( frame->areabits ) );
 
   // https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=62
@@ -480,9 +979,7 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 	if ( clientNum < 0 || clientNum >= MAX_GENTITIES ) {
 		Com_Error( ERR_DROP, "SV_SvEntityForGentity: bad gEnt" );
 	}
-	svEnt = &sv.svEntities[ clientNum ];
-
-	svEnt->snapshotCounter = sv.snapshotCounter;
+	entityNumbers->added[clientNum >> 3] |= 1 << (clientNum & 7);
 
 	// find the client's viewpoint
 	VectorCopy( ps->origin, org );
@@ -490,26 +987,42 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 
 	// add all the entities directly visible to the eye, which
 	// may include portal entities that merge other viewpoints
-	SV_AddEntitiesVisibleFromPoint( org, frame, &entityNumbers, qfalse );
+	SV_AddEntitiesVisibleFromPoint( org, frame, entityNumbers, qfalse );
 
 	// if there were portals visible, there may be out of order entities
 	// in the list which will need to be resorted for the delta compression
 	// to work correctly.  This also catches the error condition
 	// of an entity being included twice.
-	qsort( entityNumbers.snapshotEntities, entityNumbers.numSnapshotEntities, 
-		sizeof( entityNumbers.snapshotEntities[0] ), SV_QsortEntityNumbers );
+	qsort( entityNumbers->snapshotEntities, entityNumbers->numSnapshotEntities, 
+		sizeof( entityNumbers->snapshotEntities[0] ), SV_QsortEntityNumbers );
 
 	// now that all viewpoint's areabits have been OR'd together, invert
 	// all of them to make it a mask vector, which is what the renderer wants
 	for ( i = 0 ; i < MAX_MAP_AREA_BYTES/4 ; i++ ) {
 		((int *)frame->areabits)[i] = ((int *)frame->areabits)[i] ^ -1;
 	}
+}
+
+/*
+=============
+SV_StoreSnapshotEntities
+
+Copies the selected entity states into the shared snapshot entity ring.
+=============
+*/
+static void SV_StoreSnapshotEntities( client_t *client, snapshotEntityNumbers_t *entityNumbers ) {
+	clientSnapshot_t			*frame;
+	int							i;
+	sharedEntity_t				*ent;
+	entityState_t				*state;
+
+	frame = &client->frames[ client->netchan.outgoingSequence & PACKET_MASK ];
 
 	// copy the entity states out
 	frame->num_entities = 0;
 	frame->first_entity = svs.nextSnapshotEntities;
-	for ( i = 0 ; i < entityNumbers.numSnapshotEntities ; i++ ) {
-		ent = SV_GentityNum(entityNumbers.snapshotEntities[i]);
+	for ( i = 0 ; i < entityNumbers->numSnapshotEntities ; i++ ) {
+		ent = SV_GentityNum(entityNumbers->snapshotEntities[i]);
 		state = &svs.snapshotEntities[svs.nextSnapshotEntities % svs.numSnapshotEntities];
 		*state = ent->s;
 		svs.nextSnapshotEntities++;
@@ -521,6 +1034,18 @@ static void SV_BuildClientSnapshot( client_t *client ) {
 	}
 }
 
+/*
+=============
+SV_BuildClientSnapshot
+=============
+*/
+static void SV_BuildClientSnapshot( client_t *client ) {
+	snapshotEntityNumbers_t		entityNumbers;
+
+	SV_SelectSnapshotEntities( client, &entityNumbers );
+	SV_StoreSnapshotEntities( client, &entityNumbers );
+}
+
 #ifdef USE_VOIP
 /*
 ==================
@@ -598,6 +1123,8 @@ Also called by SV_FinalMessage
 void SV_SendClientSnapshot( client_t *client ) {
 	byte		msg_buf[MAX_MSGLEN];
 	msg_t		msg;
+	clientSnapshot_t	*oldframe;
+	int			lastframe;
 
 	// build the snapshot
 	SV_BuildClientSnapshot( client );
@@ -620,7 +1147,8 @@ void SV_SendClientSnapshot( client_t *client ) {
 
 	// send over all the relevant entityState_t
 	// and the playerState_t
-	SV_WriteSnapshotToClient( client, &msg );
+	oldframe = SV_DeltaSnapshotFrame( client, &lastframe );
+	SV_WriteSnapshotToClient( client, oldframe, lastframe, &msg );
 
 #ifdef USE_VOIP
 	SV_WriteVoipToClient( client, &msg );
@@ -635,6 +1163,232 @@ void SV_SendClientSnapshot( client_t *client ) {
 	SV_SendMessageToClient( &msg, client );
 }
 
+/*
+=============================================================================
+
+Threaded snapshot generation
+
+With sv_snapshotThreads > 1 the entity selection and delta encoding for
+all clients due a snapshot this frame are spread over the job workers.
+Everything that touches state shared between clients (the snapshot entity
+ring, VoIP queues, console output and the netchan) stays on the main
+thread and is done in client order.
+
+=============================================================================
+*/
+
+typedef struct {
+	client_t				*client;
+	qboolean				write;			// bots only need their snapshot built
+	snapshotEntityNumbers_t	entityNumbers;
+	clientSnapshot_t		*oldframe;
+	int						lastframe;
+	msg_t					msg;
+	byte					msgBuf[MAX_MSGLEN];
+} snapshotJob_t;
+
+static snapshotJob_t	sv_snapshotJobs[MAX_CLIENTS];
+
+/*
+=======================
+SV_SelectSnapshotJob
+=======================
+*/
+static void SV_SelectSnapshotJob( void *data, int index ) {
+	snapshotJob_t	*job = &((snapshotJob_t *)data)[index];
+
+	SV_SelectSnapshotEntities( job->client, &job->entityNumbers );
+}
+
+/*
+=======================
+SV_WriteSnapshotJob
+=======================
+*/
+static void SV_WriteSnapshotJob( void *data, int index ) {
+	snapshotJob_t	*job = &((snapshotJob_t *)data)[index];
+
+	if ( !job->write ) {
+		return;
+	}
+
+	MSG_Init( &job->msg, job->msgBuf, sizeof( job->msgBuf ) );
+	job->msg.allowoverflow = qtrue;
+
+	MSG_WriteLong( &job->msg, job->client->lastClientCommand );
+	SV_UpdateServerCommandsToClient( job->client, &job->msg );
+	SV_WriteSnapshotToClient( job->client, job->oldframe, job->lastframe, &job->msg );
+}
+
+/*
+=======================
+SV_BuildSnapshotJobs
+
+Builds and encodes the snapshots for all queued jobs, leaving the
+messages ready to be transmitted.
+=======================
+*/
+static void SV_BuildSnapshotJobs( snapshotJob_t *jobs, int numJobs ) {
+	sharedEntity_t	*ent;
+	qboolean		clientMask;
+	int				i, clientNum;
+
+	// the workers must not print or raise errors, so do the fixups and
+	// checks SV_SelectSnapshotEntities would otherwise run into up front
+	clientMask = qfalse;
+	for ( i = 0 ; i < sv.num_entities ; i++ ) {
+		ent = SV_GentityNum( i );
+		if ( !ent->r.linked ) {
+			continue;
+		}
+		if ( ent->s.number != i ) {
+			Com_DPrintf ("FIXING ENT->S.NUMBER!!!\n");
+			ent->s.number = i;
+		}
+		if ( ( ent->r.svFlags & ( SVF_CLIENTMASK | SVF_NOCLIENT ) ) == SVF_CLIENTMASK ) {
+			clientMask = qtrue;
+		}
+	}
+
+	for ( i = 0 ; i < numJobs ; i++ ) {
+		if ( !jobs[i].client->gentity || jobs[i].client->state == CS_ZOMBIE ) {
+			continue;
+		}
+		clientNum = SV_GameClientNum( jobs[i].client - svs.clients )->clientNum;
+		if ( clientNum < 0 || clientNum >= MAX_GENTITIES ) {
+			Com_Error( ERR_DROP, "SV_SvEntityForGentity: bad gEnt" );
+		}
+		if ( clientMask && clientNum >= 32 ) {
+			Com_Error( ERR_DROP, "SVF_CLIENTMASK: clientNum >= 32" );
+		}
+	}
+
+	Sys_RunJobs( SV_SelectSnapshotJob, jobs, numJobs );
+
+	for ( i = 0 ; i < numJobs ; i++ ) {
+		SV_StoreSnapshotEntities( jobs[i].client, &jobs[i].entityNumbers );
+	}
+
+	// the delta source can only be checked once the ring is up to date
+	for ( i = 0 ; i < numJobs ; i++ ) {
+		if ( jobs[i].write ) {
+			jobs[i].oldframe = SV_DeltaSnapshotFrame( jobs[i].client, &jobs[i].lastframe );
+		}
+	}
+
+	Sys_RunJobs( SV_WriteSnapshotJob, jobs, numJobs );
+}
+
+/*
+=======================
+SV_SendSnapshotJobs
+=======================
+*/
+static void SV_SendSnapshotJobs( snapshotJob_t *jobs, int numJobs ) {
+	snapshotJob_t	*job;
+	int				i;
+
+	SV_BuildSnapshotJobs( jobs, numJobs );
+
+	for ( i = 0, job = jobs ; i < numJobs ; i++, job++ ) {
+		if ( job->write ) {
+#ifdef USE_VOIP
+			SV_WriteVoipToClient( job->client, &job->msg );
+#endif
+
+			if ( job->msg.overflowed ) {
+				Com_Printf ("WARNING: msg overflowed for %s\n", job->client->name);
+				MSG_Clear (&job->msg);
+			}
+
+			SV_SendMessageToClient( &job->msg, job->client );
+		}
+
+		job->client->lastSnapshotTime = svs.time;
+		job->client->rateDelayed = qfalse;
+	}
+}
+
+/*
+=======================
+SV_UpdateSnapshotThreads
+=======================
+*/
+static void SV_UpdateSnapshotThreads( void ) {
+	if ( !sv_snapshotThreads->modified ) {
+		return;
+	}
+	sv_snapshotThreads->modified = qfalse;
+
+	Sys_SetJobWorkers( sv_snapshotThreads->integer - 1 );
+}
+
+/*
+=======================
+SV_SnapshotBench_f
+
+Times snapshot generation for every connected client, bots included,
+without transmitting anything.  Delta compression for real clients
+restarts from a full snapshot afterwards, as the bench runs through
+the snapshot entity ring.
+=======================
+*/
+void SV_SnapshotBench_f( void ) {
+	int			frames, numJobs;
+	int			i, j, start, msec;
+	client_t	*c;
+	int			reliableSent[MAX_CLIENTS];
+
+	if ( !com_sv_running->integer || sv.state != SS_GAME ) {
+		Com_Printf( "Server is not running.\n" );
+		return;
+	}
+
+	frames = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 100;
+	if ( frames < 1 ) {
+		frames = 1;
+	}
+
+	SV_UpdateSnapshotThreads();
+	SV_BuildSnapshotVisIndex();
+	SV_BeginDeltaCache();
+
+	for ( j = 0, c = svs.clients ; j < sv_maxclients->integer ; j++, c++ ) {
+		reliableSent[j] = c->reliableSent;
+	}
+
+	start = Sys_Milliseconds();
+	numJobs = 0;
+	for ( i = 0 ; i < frames ; i++ ) {
+		numJobs = 0;
+		for ( j = 0, c = svs.clients ; j < sv_maxclients->integer ; j++, c++ ) {
+			if ( c->state < CS_PRIMED ) {
+				continue;
+			}
+			sv_snapshotJobs[numJobs].client = c;
+			sv_snapshotJobs[numJobs].write = qtrue;
+			sv_snapshotJobs[numJobs].oldframe = NULL;
+			sv_snapshotJobs[numJobs].lastframe = 0;
+			numJobs++;
+		}
+
+		SV_BuildSnapshotJobs( sv_snapshotJobs, numJobs );
+	}
+	msec = Sys_Milliseconds() - start;
+
+	sv_visIndex.valid = qfalse;
+	sv_deltaCache.active = qfalse;
+
+	// nothing was actually transmitted
+	for ( j = 0, c = svs.clients ; j < sv_maxclients->integer ; j++, c++ ) {
+		c->reliableSent = reliableSent[j];
+	}
+
+	Com_Printf( "%d frames, %d clients, %d threads: %.3f msec/frame, %.3f msec/client\n",
+		frames, numJobs, Sys_JobWorkers() + 1, (float)msec / frames,
+		numJobs ? (float)msec / ( frames * numJobs ) : 0.0f );
+}
+
 
 /*
 =======================
@@ -645,6 +1399,15 @@ void SV_SendClientMessages(void)
 {
 	int		i;
 	client_t	*c;
+	int		numJobs;
+	qboolean	threaded;
+
+	SV_UpdateSnapshotThreads();
+	threaded = ( Sys_JobWorkers() > 0 );
+	numJobs = 0;
+
+	SV_BuildSnapshotVisIndex();
+	SV_BeginDeltaCache();
 
 	// send a message to each connected client
 	for(i=0; i < sv_maxclients->integer; i++)
@@ -679,9 +1442,24 @@ void SV_SendClientMessages(void)
 			}
 		}
 
+		if(threaded)
+		{
+			// generated and sent below along with everyone else's
+			sv_snapshotJobs[numJobs].client = c;
+			sv_snapshotJobs[numJobs].write = !(c->gentity && (c->gentity->r.svFlags & SVF_BOT));
+			numJobs++;
+			continue;
+		}
+
 		// generate and send a new message
 		SV_SendClientSnapshot(c);
 		c->lastSnapshotTime = svs.time;
 		c->rateDelayed = qfalse;
 	}
+
+	if(numJobs)
+		SV_SendSnapshotJobs(sv_snapshotJobs, numJobs);
+
+	sv_visIndex.valid = qfalse;
+	sv_deltaCache.active = qfalse;
 }
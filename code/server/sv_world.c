@@ -58,22 +58,48 @@ the world is carved up with an evenly spaced, axially aligned bsp tree.  Entitie
 are kept in chains either at the final leafs, or at the first node that splits
 them, which prevents having to deal with multiple fragments of a single entity.
 
+The depth of the tree follows the size of the map, so that leafs end up about
+sv_sectorSize units across.  Each split is loose: the children overlap by a
+quarter of their size, up to AREA_MAX_MARGIN, so small entities sitting on a
+split plane still go down into a child instead of piling up on the interior
+nodes.  A child only
+covers a half-space of its parent along the split axis, so a query descends
+into it as long as the query box reaches past the overlap.
+
+sv_sectorSize 0 gives the original fixed four level tree without overlap.
+
 ===============================================================================
 */
 
 typedef struct worldSector_s {
 	int		axis;		// -1 = leaf node
 	float	dist;
+	float	margin;		// how far each child reaches past dist
 	struct worldSector_s	*children[2];
 	svEntity_t	*entities;
 } worldSector_t;
 
-#define	AREA_DEPTH	4
-#define	AREA_NODES	64
+#define	AREA_DEPTH		4		// used when sv_sectorSize is 0
+#define	AREA_MAX_DEPTH	10
+#define	AREA_NODES		(2 << AREA_MAX_DEPTH)
+#define	AREA_LOOSE		0.25f	// child overlap as a fraction of the child size
+#define	AREA_MAX_MARGIN	64		// but no more than this, long traces pay for it
 
 worldSector_t	sv_worldSectors[AREA_NODES];
 int			sv_numworldSectors;
 
+static int		sv_worldDepth;
+static qboolean	sv_worldLoose;
+
+typedef struct {
+	double		queries;
+	double		nodes;			// sectors visited
+	double		checked;		// entity bounds tested
+	double		found;			// entities returned
+} worldStats_t;
+
+static worldStats_t	sv_worldStats;
+
 
 /*
 ===============
@@ -81,18 +107,44 @@ SV_SectorList_f
 ===============
 */
 void SV_SectorList_f( void ) {
-	int				i, c;
+	int				i, c, total, interior, largest;
 	worldSector_t	*sec;
 	svEntity_t		*ent;
+	worldStats_t	*ws = &sv_worldStats;
 
-	for ( i = 0 ; i < AREA_NODES ; i++ ) {
+	if ( !Q_stricmp( Cmd_Argv( 1 ), "reset" ) ) {
+		Com_Memset( ws, 0, sizeof( *ws ) );
+		return;
+	}
+
+	total = interior = largest = 0;
+	for ( i = 0 ; i < sv_numworldSectors ; i++ ) {
 		sec = &sv_worldSectors[i];
 
 		c = 0;
 		for ( ent = sec->entities ; ent ; ent = ent->nextEntityInWorldSector ) {
 			c++;
 		}
+		if ( !c ) {
+			continue;
+		}
 		Com_Printf( "sector %i: %i entities\n", i, c );
+
+		total += c;
+		if ( sec->axis != -1 ) {
+			interior += c;
+		}
+		if ( c > largest ) {
+			largest = c;
+		}
+	}
+
+	Com_Printf( "%i sectors, depth %i: %i entities, %i on interior sectors, at most %i in one sector\n",
+		sv_numworldSectors, sv_worldDepth, total, interior, largest );
+
+	if ( ws->queries ) {
+		Com_Printf( "%.0f area queries: %.1f sectors, %.1f entities checked, %.1f found per query\n",
+			ws->queries, ws->nodes / ws->queries, ws->checked / ws->queries, ws->found / ws->queries );
 	}
 }
 
@@ -111,7 +163,7 @@ static worldSector_t *SV_CreateworldSector( int depth, vec3_t mins, vec3_t maxs
 	anode = &sv_worldSectors[sv_numworldSectors];
 	sv_numworldSectors++;
 
-	if (depth == AREA_DEPTH) {
+	if (depth == sv_worldDepth) {
 		anode->axis = -1;
 		anode->children[0] = anode->children[1] = NULL;
 		return anode;
@@ -123,8 +175,16 @@ static worldSector_t *SV_CreateworldSector( int depth, vec3_t mins, vec3_t maxs
 	} else {
 		anode->axis = 1;
 	}
+	if (sv_worldLoose && size[2] > size[anode->axis]) {
+		anode->axis = 2;
+	}
 
 	anode->dist = 0.5 * (maxs[anode->axis] + mins[anode->axis]);
+	if (sv_worldLoose) {
+		anode->margin = AREA_LOOSE * 0.5 * size[anode->axis];
+		if (anode->margin > AREA_MAX_MARGIN)
+			anode->margin = AREA_MAX_MARGIN;
+	}
 	VectorCopy (mins, mins1);	
 	VectorCopy (mins, mins2);	
 	VectorCopy (maxs, maxs1);	
@@ -140,11 +200,39 @@ static worldSector_t *SV_CreateworldSector( int depth, vec3_t mins, vec3_t maxs
 
 /*
 ===============
-SV_ClearWorld
+SV_WorldDepth
 
+Number of splits needed to get leafs of about sectorSize units
 ===============
 */
-void SV_ClearWorld( void ) {
+static int SV_WorldDepth( const vec3_t mins, const vec3_t maxs, int sectorSize ) {
+	float	cells;
+	int		i, depth;
+
+	if ( sectorSize <= 0 ) {
+		return AREA_DEPTH;
+	}
+
+	cells = 1;
+	for ( i = 0 ; i < 3 ; i++ ) {
+		cells *= ceil( ( maxs[i] - mins[i] ) / sectorSize );
+	}
+
+	for ( depth = 1 ; depth < AREA_MAX_DEPTH ; depth++ ) {
+		if ( ( 1 << depth ) >= cells ) {
+			break;
+		}
+	}
+
+	return depth;
+}
+
+/*
+===============
+SV_CreateWorld
+===============
+*/
+static void SV_CreateWorld( int sectorSize ) {
 	clipHandle_t	h;
 	vec3_t			mins, maxs;
 
@@ -154,9 +242,22 @@ void SV_ClearWorld( void ) {
 	// get world map bounds
 	h = CM_InlineModel( 0 );
 	CM_ModelBounds( h, mins, maxs );
+
+	sv_worldDepth = SV_WorldDepth( mins, maxs, sectorSize );
+	sv_worldLoose = sectorSize > 0;
 	SV_CreateworldSector( 0, mins, maxs );
 }
 
+/*
+===============
+SV_ClearWorld
+
+===============
+*/
+void SV_ClearWorld( void ) {
+	SV_CreateWorld( sv_sectorSize->integer );
+}
+
 
 /*
 ===============
@@ -166,7 +267,6 @@ SV_UnlinkEntity
 */
 void SV_UnlinkEntity( sharedEntity_t *gEnt ) {
 	svEntity_t		*ent;
-	svEntity_t		*scan;
 	worldSector_t	*ws;
 
 	ent = SV_SvEntityForGentity( gEnt );
@@ -179,19 +279,16 @@ void SV_UnlinkEntity( sharedEntity_t *gEnt ) {
 	}
 	ent->worldSector = NULL;
 
-	if ( ws->entities == ent ) {
+	if ( ent->prevEntityInWorldSector ) {
+		ent->prevEntityInWorldSector->nextEntityInWorldSector = ent->nextEntityInWorldSector;
+	} else {
 		ws->entities = ent->nextEntityInWorldSector;
-		return;
 	}
-
-	for ( scan = ws->entities ; scan ; scan = scan->nextEntityInWorldSector ) {
-		if ( scan->nextEntityInWorldSector == ent ) {
-			scan->nextEntityInWorldSector = ent->nextEntityInWorldSector;
-			return;
-		}
+	if ( ent->nextEntityInWorldSector ) {
+		ent->nextEntityInWorldSector->prevEntityInWorldSector = ent->prevEntityInWorldSector;
 	}
 
-	Com_Printf( "WARNING: SV_UnlinkEntity: not found in worldSector\n" );
+	ent->nextEntityInWorldSector = ent->prevEntityInWorldSector = NULL;
 }
 
 
@@ -337,11 +434,25 @@ void SV_LinkEntity( sharedEntity_t *gEnt ) {
 	node = sv_worldSectors;
 	while (1)
 	{
+		qboolean	above, below;
+
 		if (node->axis == -1)
 			break;
-		if ( gEnt->r.absmin[node->axis] > node->dist)
+
+		// with loose nodes a box near the split fits either child
+		above = gEnt->r.absmin[node->axis] > node->dist - node->margin;
+		below = gEnt->r.absmax[node->axis] < node->dist + node->margin;
+
+		if ( above && below ) {
+			if ( gEnt->r.absmin[node->axis] + gEnt->r.absmax[node->axis] > 2 * node->dist )
+				below = qfalse;
+			else
+				above = qfalse;
+		}
+
+		if ( above )
 			node = node->children[0];
-		else if ( gEnt->r.absmax[node->axis] < node->dist)
+		else if ( below )
 			node = node->children[1];
 		else
 			break;		// crosses the node
@@ -350,6 +461,10 @@ void SV_LinkEntity( sharedEntity_t *gEnt ) {
 	// link it in
 	ent->worldSector = node;
 	ent->nextEntityInWorldSector = node->entities;
+	ent->prevEntityInWorldSector = NULL;
+	if ( node->entities ) {
+		node->entities->prevEntityInWorldSector = ent;
+	}
 	node->entities = ent;
 
 	gEnt->r.linked = qtrue;
@@ -370,6 +485,7 @@ typedef struct {
 	const float	*maxs;
 	int			*list;
 	int			count, maxcount;
+	int			nodes, checked;
 } areaParms_t;
 
 
@@ -383,10 +499,13 @@ static void SV_AreaEntities_r( worldSector_t *node, areaParms_t *ap ) {
 	svEntity_t	*check, *next;
 	sharedEntity_t *gcheck;
 
+	ap->nodes++;
+
 	for ( check = node->entities  ; check ; check = next ) {
 		next = check->nextEntityInWorldSector;
 
 		gcheck = SV_GEntityForSvEntity( check );
+		ap->checked++;
 
 		if ( gcheck->r.absmin[0] > ap->maxs[0]
 		|| gcheck->r.absmin[1] > ap->maxs[1]
@@ -411,10 +530,10 @@ static void SV_AreaEntities_r( worldSector_t *node, areaParms_t *ap ) {
 	}
 
 	// recurse down both sides
-	if ( ap->maxs[node->axis] > node->dist ) {
+	if ( ap->maxs[node->axis] > node->dist - node->margin ) {
 		SV_AreaEntities_r ( node->children[0], ap );
 	}
-	if ( ap->mins[node->axis] < node->dist ) {
+	if ( ap->mins[node->axis] < node->dist + node->margin ) {
 		SV_AreaEntities_r ( node->children[1], ap );
 	}
 }
@@ -432,9 +551,15 @@ int SV_AreaEntities( const vec3_t mins, const vec3_t maxs, int *entityList, int
 	ap.list = entityList;
 	ap.count = 0;
 	ap.maxcount = maxcount;
+	ap.nodes = ap.checked = 0;
 
 	SV_AreaEntities_r( sv_worldSectors, &ap );
 
+	sv_worldStats.queries++;
+	sv_worldStats.nodes += ap.nodes;
+	sv_worldStats.checked += ap.checked;
+	sv_worldStats.found += ap.count;
+
 	return ap.count;
 }
 
@@ -504,17 +629,14 @@ SV_ClipMoveToEntities
 
 ====================
 */
-static void SV_ClipMoveToEntities( moveclip_t *clip ) {
-	int			i, num;
-	int			touchlist[MAX_GENTITIES];
+static void SV_ClipMoveToEntities( moveclip_t *clip, const int *touchlist, int num ) {
+	int			i;
 	sharedEntity_t *touch;
 	int			passOwnerNum;
 	trace_t		trace;
 	clipHandle_t	clipHandle;
 	float		*origin, *angles;
 
-	num = SV_AreaEntities( clip->boxmins, clip->boxmaxs, touchlist, MAX_GENTITIES);
-
 	if ( clip->passEntityNum != ENTITYNUM_NONE ) {
 		passOwnerNum = ( SV_GentityNum( clip->passEntityNum ) )->r.ownerNum;
 		if ( passOwnerNum == ENTITYNUM_NONE ) {
@@ -586,6 +708,54 @@ static void SV_ClipMoveToEntities( moveclip_t *clip ) {
 }
 
 
+/*
+==================
+SV_SetupMoveClip
+
+Clips the move against the world and fills in the bounding box of the move.
+Returns qfalse if the world blocked it immediately, so there is nothing
+left to clip against entities.
+==================
+*/
+static qboolean SV_SetupMoveClip( moveclip_t *clip, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule ) {
+	int			i;
+
+	Com_Memset ( clip, 0, sizeof ( moveclip_t ) );
+
+	// clip to world
+	CM_BoxTrace( &clip->trace, start, end, (float *)mins, (float *)maxs, 0, contentmask, capsule );
+	clip->trace.entityNum = clip->trace.fraction != 1.0 ? ENTITYNUM_WORLD : ENTITYNUM_NONE;
+	if ( clip->trace.fraction == 0 ) {
+		return qfalse;		// blocked immediately by the world
+	}
+
+	clip->contentmask = contentmask;
+	clip->start = start;
+//	VectorCopy( clip->trace.endpos, clip->end );
+	VectorCopy( end, clip->end );
+	clip->mins = mins;
+	clip->maxs = maxs;
+	clip->passEntityNum = passEntityNum;
+	clip->capsule = capsule;
+
+	// create the bounding box of the entire move
+	// we can limit it to the part of the move not
+	// already clipped off by the world, which can be
+	// a significant savings for line of sight and shot traces
+	for ( i=0 ; i<3 ; i++ ) {
+		if ( end[i] > start[i] ) {
+			clip->boxmins[i] = clip->start[i] + clip->mins[i] - 1;
+			clip->boxmaxs[i] = clip->end[i] + clip->maxs[i] + 1;
+		} else {
+			clip->boxmins[i] = clip->end[i] + clip->mins[i] - 1;
+			clip->boxmaxs[i] = clip->start[i] + clip->maxs[i] + 1;
+		}
+	}
+
+	return qtrue;
+}
+
+
 /*
 ==================
 SV_Trace
@@ -596,7 +766,8 @@ passEntityNum and entities owned by passEntityNum are explicitly not checked.
 */
 void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, const vec3_t end, int passEntityNum, int contentmask, int capsule ) {
 	moveclip_t	clip;
-	int			i;
+	int			touchlist[MAX_GENTITIES];
+	int			num;
 
 	if ( !mins ) {
 		mins = vec3_origin;
@@ -605,43 +776,124 @@ void SV_Trace( trace_t *results, const vec3_t start, vec3_t mins, vec3_t maxs, c
 		maxs = vec3_origin;
 	}
 
-	Com_Memset ( &clip, 0, sizeof ( moveclip_t ) );
+	if ( SV_SetupMoveClip( &clip, start, mins, maxs, end, passEntityNum, contentmask, capsule ) ) {
+		// clip to other solid entities
+		num = SV_AreaEntities( clip.boxmins, clip.boxmaxs, touchlist, MAX_GENTITIES );
+		SV_ClipMoveToEntities( &clip, touchlist, num );
+	}
 
-	// clip to world
-	CM_BoxTrace( &clip.trace, start, end, mins, maxs, 0, contentmask, capsule );
-	clip.trace.entityNum = clip.trace.fraction != 1.0 ? ENTITYNUM_WORLD : ENTITYNUM_NONE;
-	if ( clip.trace.fraction == 0 ) {
-		*results = clip.trace;
-		return;		// blocked immediately by the world
-	}
-
-	clip.contentmask = contentmask;
-	clip.start = start;
-//	VectorCopy( clip.trace.endpos, clip.end );
-	VectorCopy( end, clip.end );
-	clip.mins = mins;
-	clip.maxs = maxs;
-	clip.passEntityNum = passEntityNum;
-	clip.capsule = capsule;
+	*results = clip.trace;
+}
+
+
+/*
+==================
+SV_TraceBatchBounds
+
+The box SV_SetupMoveClip would build for a request, without tracing it.
+==================
+*/
+static void SV_TraceBatchBounds( const traceRequest_t *req, vec3_t boxmins, vec3_t boxmaxs ) {
+	int		i;
 
-	// create the bounding box of the entire move
-	// we can limit it to the part of the move not
-	// already clipped off by the world, which can be
-	// a significant savings for line of sight and shot traces
 	for ( i=0 ; i<3 ; i++ ) {
-		if ( end[i] > start[i] ) {
-			clip.boxmins[i] = clip.start[i] + clip.mins[i] - 1;
-			clip.boxmaxs[i] = clip.end[i] + clip.maxs[i] + 1;
+		if ( req->end[i] > req->start[i] ) {
+			boxmins[i] = req->start[i] + req->mins[i] - 1;
+			boxmaxs[i] = req->end[i] + req->maxs[i] + 1;
 		} else {
-			clip.boxmins[i] = clip.end[i] + clip.mins[i] - 1;
-			clip.boxmaxs[i] = clip.start[i] + clip.maxs[i] + 1;
+			boxmins[i] = req->end[i] + req->mins[i] - 1;
+			boxmaxs[i] = req->start[i] + req->maxs[i] + 1;
 		}
 	}
+}
 
-	// clip to other solid entities
-	SV_ClipMoveToEntities ( &clip );
+static float SV_BoxVolume( const vec3_t mins, const vec3_t maxs ) {
+	return ( maxs[0] - mins[0] ) * ( maxs[1] - mins[1] ) * ( maxs[2] - mins[2] );
+}
 
-	*results = clip.trace;
+/*
+==================
+SV_TraceBatch
+
+Runs numRequests traces, writing each result to the matching slot of results.
+Consecutive requests whose move boxes lie close together share a single
+SV_AreaEntities walk over their combined box; each trace then only clips
+against the entities of that list that touch its own box.  The tree is
+walked in the same order either way, so the results are identical to
+calling SV_Trace for every request.
+==================
+*/
+#define	TRACE_BATCH_SLACK	2.0f	// max union volume relative to the summed boxes
+
+void SV_TraceBatch( trace_t *results, const traceRequest_t *requests, int numRequests ) {
+	moveclip_t	clip;
+	int			gatherlist[MAX_GENTITIES];
+	int			touchlist[MAX_GENTITIES];
+	vec3_t		gathermins, gathermaxs;
+	vec3_t		boxmins, boxmaxs, unionmins, unionmaxs;
+	const traceRequest_t *req;
+	sharedEntity_t *gcheck;
+	float		volume;
+	int			numGather, groupEnd;
+	int			i, j, k, num;
+
+	numGather = 0;
+	groupEnd = 0;
+
+	for ( i=0 ; i<numRequests ; i++ ) {
+		req = &requests[i];
+
+		if ( !SV_SetupMoveClip( &clip, req->start, req->mins, req->maxs, req->end,
+			req->passEntityNum, req->contentmask, req->capsule ) ) {
+			results[i] = clip.trace;
+			continue;
+		}
+
+		if ( i >= groupEnd ) {
+			// start a new group, growing it over the following requests
+			// for as long as their combined box stays reasonably tight
+			VectorCopy( clip.boxmins, gathermins );
+			VectorCopy( clip.boxmaxs, gathermaxs );
+			volume = SV_BoxVolume( gathermins, gathermaxs );
+
+			for ( j=i+1 ; j<numRequests ; j++ ) {
+				SV_TraceBatchBounds( &requests[j], boxmins, boxmaxs );
+				for ( k=0 ; k<3 ; k++ ) {
+					unionmins[k] = MIN( gathermins[k], boxmins[k] );
+					unionmaxs[k] = MAX( gathermaxs[k], boxmaxs[k] );
+				}
+				volume += SV_BoxVolume( boxmins, boxmaxs );
+				if ( SV_BoxVolume( unionmins, unionmaxs ) > volume * TRACE_BATCH_SLACK ) {
+					break;
+				}
+				VectorCopy( unionmins, gathermins );
+				VectorCopy( unionmaxs, gathermaxs );
+			}
+
+			groupEnd = j;
+			numGather = SV_AreaEntities( gathermins, gathermaxs, gatherlist, MAX_GENTITIES );
+		}
+
+		// keep the shared entities that touch this move
+		num = 0;
+		for ( j=0 ; j<numGather ; j++ ) {
+			gcheck = SV_GentityNum( gatherlist[j] );
+			if ( gcheck->r.absmin[0] > clip.boxmaxs[0]
+			|| gcheck->r.absmin[1] > clip.boxmaxs[1]
+			|| gcheck->r.absmin[2] > clip.boxmaxs[2]
+			|| gcheck->r.absmax[0] < clip.boxmins[0]
+			|| gcheck->r.absmax[1] < clip.boxmins[1]
+			|| gcheck->r.absmax[2] < clip.boxmins[2]) {
+				continue;
+			}
+			touchlist[num++] = gatherlist[j];
+		}
+
+		// clip to other solid entities
+		SV_ClipMoveToEntities( &clip, touchlist, num );
+
+		results[i] = clip.trace;
+	}
 }
 
 
@@ -686,3 +938,106 @@ int SV_PointContents( const vec3_t p, int passEntityNum ) {
 }
 
 
+/*
+===============
+SV_RelinkWorld
+
+Rebuilds the sector tree and links every linked entity into it again
+===============
+*/
+static void SV_RelinkWorld( int sectorSize ) {
+	static qboolean	relink[MAX_GENTITIES];
+	sharedEntity_t	*gEnt;
+	int				i, linkcount;
+
+	for ( i = 0 ; i < sv.num_entities ; i++ ) {
+		gEnt = SV_GentityNum( i );
+		relink[i] = gEnt->r.linked;
+		if ( relink[i] ) {
+			SV_UnlinkEntity( gEnt );
+		}
+	}
+
+	SV_CreateWorld( sectorSize );
+
+	for ( i = 0 ; i < sv.num_entities ; i++ ) {
+		if ( relink[i] ) {
+			gEnt = SV_GentityNum( i );
+			linkcount = gEnt->r.linkcount;
+			SV_LinkEntity( gEnt );
+			gEnt->r.linkcount = linkcount;
+		}
+	}
+}
+
+/*
+===============
+SV_SectorBench_f
+
+Traces player sized boxes from every linked entity towards random points,
+first through the fixed sector tree and then through the one sized by
+sv_sectorSize, and compares what the area queries had to look at
+===============
+*/
+void SV_SectorBench_f( void ) {
+	static vec3_t	starts[MAX_GENTITIES];
+	vec3_t			mins = { -15, -15, -24 }, maxs = { 15, 15, 32 };
+	vec3_t			worldMins, worldMaxs, end;
+	trace_t			trace;
+	worldStats_t	saved;
+	sharedEntity_t	*gEnt;
+	unsigned int	start, seed;
+	int				i, j, numStarts, traces, pass;
+
+	if ( !com_sv_running->integer ) {
+		Com_Printf( "Server is not running.\n" );
+		return;
+	}
+
+	traces = Cmd_Argc() > 1 ? atoi( Cmd_Argv( 1 ) ) : 100000;
+	if ( traces < 1 ) {
+		traces = 1;
+	}
+
+	numStarts = 0;
+	for ( i = 0 ; i < sv.num_entities ; i++ ) {
+		gEnt = SV_GentityNum( i );
+		if ( gEnt->r.linked ) {
+			VectorAdd( gEnt->r.absmin, gEnt->r.absmax, starts[numStarts] );
+			VectorScale( starts[numStarts], 0.5f, starts[numStarts] );
+			numStarts++;
+		}
+	}
+	if ( !numStarts ) {
+		Com_Printf( "No linked entities.\n" );
+		return;
+	}
+
+	CM_ModelBounds( CM_InlineModel( 0 ), worldMins, worldMaxs );
+
+	saved = sv_worldStats;
+
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		SV_RelinkWorld( pass ? sv_sectorSize->integer : 0 );
+
+		Com_Memset( &sv_worldStats, 0, sizeof( sv_worldStats ) );
+		seed = 0x1234567;
+
+		start = Sys_Microseconds();
+		for ( i = 0 ; i < traces ; i++ ) {
+			for ( j = 0 ; j < 3 ; j++ ) {
+				seed = seed * 1103515245 + 12345;
+				end[j] = worldMins[j] + ( worldMaxs[j] - worldMins[j] ) * ( ( seed >> 8 ) & 0xffff ) / 65535.0f;
+			}
+			SV_Trace( &trace, starts[i % numStarts], mins, maxs, end, ENTITYNUM_NONE, MASK_PLAYERSOLID, qfalse );
+		}
+		start = Sys_Microseconds() - start;
+
+		Com_Printf( "%-8s %i sectors: %.2f usec per trace, %.1f sectors, %.1f entities checked, %.1f found per query\n",
+			pass ? "adaptive" : "fixed", sv_numworldSectors, (float)start / traces,
+			sv_worldStats.nodes / sv_worldStats.queries, sv_worldStats.checked / sv_worldStats.queries,
+			sv_worldStats.found / sv_worldStats.queries );
+	}
+
+	sv_worldStats = saved;
+}
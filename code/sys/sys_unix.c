@@ -33,11 +33,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/time.h>
+#include <time.h>
 #include <pwd.h>
 #include <libgen.h>
 #include <fcntl.h>
 #include <fenv.h>
 #include <sys/wait.h>
+#include <pthread.h>
 
 qboolean stdinIsATTY;
 
@@ -110,6 +112,21 @@ int Sys_Milliseconds (void)
 	return curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+unsigned int Sys_Microseconds (void)
+{
+	struct timespec tp;
+
+	// monotonic so timings don't jump when the wall clock is adjusted
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+
+	return (unsigned int)tp.tv_sec * 1000000u + tp.tv_nsec / 1000;
+}
+
 /*
 ==================
 Sys_RandomBytes
@@ -237,6 +254,50 @@ FILE *Sys_Mkfifo( const char *ospath )
 	return fifo;
 }
 
+/*
+==================
+Sys_MapFile
+
+Maps length bytes of a file starting at offset read only, or returns
+NULL.  The offset need not be page aligned.
+==================
+*/
+void *Sys_MapFile( const char *ospath, long offset, long length )
+{
+	long	page;
+	int		fd;
+	byte	*base;
+
+	if( length <= 0 )
+		return NULL;
+
+	fd = open( ospath, O_RDONLY );
+	if( fd == -1 )
+		return NULL;
+
+	page = offset & ~( sysconf( _SC_PAGESIZE ) - 1 );
+	base = mmap( NULL, length + offset - page, PROT_READ, MAP_PRIVATE, fd, page );
+	close( fd );
+
+	if( base == MAP_FAILED )
+		return NULL;
+
+	return base + offset - page;
+}
+
+/*
+==================
+Sys_UnmapFile
+==================
+*/
+void Sys_UnmapFile( void *buffer, long length )
+{
+	long	skip;
+
+	skip = (intptr_t)buffer & ( sysconf( _SC_PAGESIZE ) - 1 );
+	munmap( (byte *)buffer - skip, length + skip );
+}
+
 /*
 ==================
 Sys_Cwd
@@ -823,6 +884,8 @@ void Sys_PlatformInit( void )
 #endif
 }
 
+static void Sys_StopJobWorkers( void );
+
 /*
 ==============
 Sys_PlatformExit
@@ -832,6 +895,7 @@ Unix specific deinitialisation
 */
 void Sys_PlatformExit( void )
 {
+	Sys_StopJobWorkers( );
 }
 
 /*
@@ -869,3 +933,404 @@ qboolean Sys_PIDIsRunning( int pid )
 {
 	return kill( pid, 0 ) == 0;
 }
+
+/*
+==============================================================================
+
+JOB WORKERS
+
+A small pool of threads that Sys_RunJobs spreads independent work items
+over.  The calling thread always takes part, so with no workers active the
+jobs simply run inline.  Threads are started the first time they are asked
+for and then kept, lowering the count only parks them.
+==============================================================================
+*/
+
+#define MAX_JOB_WORKERS 32
+
+/*
+==================
+Sys_BlockThreadSignals
+
+ITIMER_PROF sends SIGPROF to any thread that doesn't block it, the vm
+profiler only knows how to charge samples taken on the main thread
+==================
+*/
+static void Sys_BlockThreadSignals( void )
+{
+	sigset_t set;
+
+	sigemptyset( &set );
+	sigaddset( &set, SIGPROF );
+	pthread_sigmask( SIG_BLOCK, &set, NULL );
+}
+
+static struct
+{
+	pthread_mutex_t	lock;
+	pthread_cond_t	workCond;
+	pthread_cond_t	doneCond;
+	pthread_t		threads[ MAX_JOB_WORKERS ];
+	int				numWorkers;
+	int				active;		// workers with a lower index take jobs
+	qboolean		quit;
+
+	int				generation;
+	sysJobFunc_t	func;
+	void			*data;
+	int				count;
+	int				next;
+	int				done;
+} sys_jobs = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+/*
+==================
+Sys_ClaimJobs
+
+Runs queued jobs until there are none left to claim.
+Must be called with the lock held.
+==================
+*/
+static void Sys_ClaimJobs( void )
+{
+	int index;
+
+	while( sys_jobs.next < sys_jobs.count )
+	{
+		index = sys_jobs.next++;
+
+		pthread_mutex_unlock( &sys_jobs.lock );
+		sys_jobs.func( sys_jobs.data, index );
+		pthread_mutex_lock( &sys_jobs.lock );
+
+		if( ++sys_jobs.done == sys_jobs.count )
+			pthread_cond_signal( &sys_jobs.doneCond );
+	}
+}
+
+/*
+==================
+Sys_JobWorker
+==================
+*/
+static void *Sys_JobWorker( void *arg )
+{
+	int index = (intptr_t)arg;
+	int seen;
+
+	Sys_BlockThreadSignals( );
+
+	pthread_mutex_lock( &sys_jobs.lock );
+	seen = sys_jobs.generation;
+
+	while( !sys_jobs.quit )
+	{
+		if( sys_jobs.generation == seen )
+		{
+			pthread_cond_wait( &sys_jobs.workCond, &sys_jobs.lock );
+			continue;
+		}
+
+		seen = sys_jobs.generation;
+		if( index < sys_jobs.active )
+			Sys_ClaimJobs( );
+	}
+
+	pthread_mutex_unlock( &sys_jobs.lock );
+
+	return NULL;
+}
+
+/*
+==================
+Sys_StopJobWorkers
+==================
+*/
+static void Sys_StopJobWorkers( void )
+{
+	int i;
+
+	if( !sys_jobs.numWorkers )
+		return;
+
+	pthread_mutex_lock( &sys_jobs.lock );
+	sys_jobs.quit = qtrue;
+	pthread_cond_broadcast( &sys_jobs.workCond );
+	pthread_mutex_unlock( &sys_jobs.lock );
+
+	for( i = 0; i < sys_jobs.numWorkers; i++ )
+		pthread_join( sys_jobs.threads[ i ], NULL );
+
+	sys_jobs.numWorkers = 0;
+	sys_jobs.active = 0;
+	sys_jobs.quit = qfalse;
+}
+
+/*
+==================
+Sys_SetJobWorkers
+
+Lets count workers take jobs, starting the threads that don't exist yet.
+Returns the number of workers actually taking jobs.
+==================
+*/
+int Sys_SetJobWorkers( int count )
+{
+	if( count < 0 )
+		count = 0;
+	else if( count > MAX_JOB_WORKERS )
+		count = MAX_JOB_WORKERS;
+
+	while( sys_jobs.numWorkers < count )
+	{
+		if( pthread_create( &sys_jobs.threads[ sys_jobs.numWorkers ], NULL,
+			Sys_JobWorker, (void *)(intptr_t)sys_jobs.numWorkers ) )
+		{
+			Com_Printf( "WARNING: could only start %d of %d job workers\n",
+				sys_jobs.numWorkers, count );
+			break;
+		}
+
+		sys_jobs.numWorkers++;
+	}
+
+	pthread_mutex_lock( &sys_jobs.lock );
+	sys_jobs.active = MIN( count, sys_jobs.numWorkers );
+	pthread_mutex_unlock( &sys_jobs.lock );
+
+	return sys_jobs.active;
+}
+
+/*
+==================
+Sys_JobWorkers
+==================
+*/
+int Sys_JobWorkers( void )
+{
+	return sys_jobs.active;
+}
+
+/*
+==================
+Sys_RunJobs
+
+Calls func( data, i ) for i in [0, count) spread over the job workers and
+the calling thread, and returns once all of them have finished.
+==================
+*/
+void Sys_RunJobs( sysJobFunc_t func, void *data, int count )
+{
+	int i;
+
+	if( count <= 0 )
+		return;
+
+	if( !sys_jobs.active || count == 1 )
+	{
+		for( i = 0; i < count; i++ )
+			func( data, i );
+
+		return;
+	}
+
+	pthread_mutex_lock( &sys_jobs.lock );
+
+	sys_jobs.func = func;
+	sys_jobs.data = data;
+	sys_jobs.count = count;
+	sys_jobs.next = 0;
+	sys_jobs.done = 0;
+	sys_jobs.generation++;
+	pthread_cond_broadcast( &sys_jobs.workCond );
+
+	Sys_ClaimJobs( );
+
+	while( sys_jobs.done < sys_jobs.count )
+		pthread_cond_wait( &sys_jobs.doneCond, &sys_jobs.lock );
+
+	pthread_mutex_unlock( &sys_jobs.lock );
+}
+
+/*
+==================
+Sys_CreateMutex
+==================
+*/
+void *Sys_CreateMutex( void )
+{
+	pthread_mutex_t *mutex = malloc( sizeof( *mutex ) );
+
+	if( !mutex )
+		Com_Error( ERR_FATAL, "Sys_CreateMutex: out of memory" );
+
+	pthread_mutex_init( mutex, NULL );
+
+	return mutex;
+}
+
+/*
+==================
+Sys_DestroyMutex
+==================
+*/
+void Sys_DestroyMutex( void *mutex )
+{
+	if( !mutex )
+		return;
+
+	pthread_mutex_destroy( mutex );
+	free( mutex );
+}
+
+/*
+==================
+Sys_LockMutex
+==================
+*/
+void Sys_LockMutex( void *mutex )
+{
+	pthread_mutex_lock( mutex );
+}
+
+/*
+==================
+Sys_UnlockMutex
+==================
+*/
+void Sys_UnlockMutex( void *mutex )
+{
+	pthread_mutex_unlock( mutex );
+}
+
+/*
+==================
+Sys_CreateThread
+
+Starts a thread running func( data, index ), returns NULL if it couldn't
+==================
+*/
+typedef struct
+{
+	pthread_t		thread;
+	sysJobFunc_t	func;
+	void			*data;
+	int				index;
+} sysThread_t;
+
+static void *Sys_ThreadMain( void *arg )
+{
+	sysThread_t *thread = arg;
+
+	Sys_BlockThreadSignals( );
+	thread->func( thread->data, thread->index );
+
+	return NULL;
+}
+
+void *Sys_CreateThread( sysJobFunc_t func, void *data, int index )
+{
+	sysThread_t *thread = malloc( sizeof( *thread ) );
+
+	if( !thread )
+		return NULL;
+
+	thread->func = func;
+	thread->data = data;
+	thread->index = index;
+
+	if( pthread_create( &thread->thread, NULL, Sys_ThreadMain, thread ) )
+	{
+		free( thread );
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+==================
+Sys_JoinThread
+
+Waits for a thread to return and releases it
+==================
+*/
+void Sys_JoinThread( void *thread )
+{
+	pthread_join( ( (sysThread_t *)thread )->thread, NULL );
+	free( thread );
+}
+
+/*
+==================
+Sys_CreateSemaphore
+==================
+*/
+typedef struct
+{
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	int				count;
+} sysSemaphore_t;
+
+void *Sys_CreateSemaphore( void )
+{
+	sysSemaphore_t *sem = malloc( sizeof( *sem ) );
+
+	if( !sem )
+		Com_Error( ERR_FATAL, "Sys_CreateSemaphore: out of memory" );
+
+	pthread_mutex_init( &sem->lock, NULL );
+	pthread_cond_init( &sem->cond, NULL );
+	sem->count = 0;
+
+	return sem;
+}
+
+/*
+==================
+Sys_DestroySemaphore
+==================
+*/
+void Sys_DestroySemaphore( void *sem )
+{
+	sysSemaphore_t *s = sem;
+
+	if( !s )
+		return;
+
+	pthread_cond_destroy( &s->cond );
+	pthread_mutex_destroy( &s->lock );
+	free( s );
+}
+
+/*
+==================
+Sys_PostSemaphore
+==================
+*/
+void Sys_PostSemaphore( void *sem )
+{
+	sysSemaphore_t *s = sem;
+
+	pthread_mutex_lock( &s->lock );
+	s->count++;
+	pthread_cond_signal( &s->cond );
+	pthread_mutex_unlock( &s->lock );
+}
+
+/*
+==================
+Sys_WaitSemaphore
+==================
+*/
+void Sys_WaitSemaphore( void *sem )
+{
+	sysSemaphore_t *s = sem;
+
+	pthread_mutex_lock( &s->lock );
+	while( !s->count )
+		pthread_cond_wait( &s->cond, &s->lock );
+	s->count--;
+	pthread_mutex_unlock( &s->lock );
+}
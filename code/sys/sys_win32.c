@@ -147,6 +147,25 @@ int Sys_Milliseconds (void)
 	return sys_curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+unsigned int Sys_Microseconds (void)
+{
+	static LARGE_INTEGER	frequency;
+	LARGE_INTEGER			count;
+
+	if (!frequency.QuadPart)
+		QueryPerformanceFrequency(&frequency);
+
+	QueryPerformanceCounter(&count);
+
+	return (unsigned int)(count.QuadPart / frequency.QuadPart) * 1000000u +
+		(unsigned int)(count.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart);
+}
+
 /*
 ================
 Sys_RandomBytes
@@ -310,6 +329,58 @@ FILE *Sys_Mkfifo( const char *ospath )
 	return NULL;
 }
 
+/*
+==================
+Sys_MapFile
+
+Maps length bytes of a file starting at offset read only, or returns
+NULL.  The offset need not be aligned.
+==================
+*/
+void *Sys_MapFile( const char *ospath, long offset, long length )
+{
+	SYSTEM_INFO	info;
+	HANDLE		file, mapping;
+	long		start;
+	byte		*base;
+
+	if( length <= 0 )
+		return NULL;
+
+	file = CreateFile( ospath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if( file == INVALID_HANDLE_VALUE )
+		return NULL;
+
+	mapping = CreateFileMapping( file, NULL, PAGE_READONLY, 0, 0, NULL );
+	CloseHandle( file );
+	if( !mapping )
+		return NULL;
+
+	// views start on the allocation granularity, not the page size
+	GetSystemInfo( &info );
+	start = offset - offset % info.dwAllocationGranularity;
+	base = MapViewOfFile( mapping, FILE_MAP_READ, 0, start, length + offset - start );
+	CloseHandle( mapping );
+
+	if( !base )
+		return NULL;
+
+	return base + offset - start;
+}
+
+/*
+==================
+Sys_UnmapFile
+==================
+*/
+void Sys_UnmapFile( void *buffer, long length )
+{
+	SYSTEM_INFO	info;
+
+	GetSystemInfo( &info );
+	UnmapViewOfFile( (byte *)buffer - (intptr_t)buffer % info.dwAllocationGranularity );
+}
+
 /*
 ==============
 Sys_Cwd
@@ -730,6 +801,8 @@ void Sys_PlatformInit( void )
 #endif
 }
 
+static void Sys_StopJobWorkers( void );
+
 /*
 ==============
 Sys_PlatformExit
@@ -739,6 +812,8 @@ Windows specific initialisation
 */
 void Sys_PlatformExit( void )
 {
+	Sys_StopJobWorkers( );
+
 #ifndef DEDICATED
 	if(timerResolution)
 		timeEndPeriod(timerResolution);
@@ -795,3 +870,389 @@ qboolean Sys_PIDIsRunning( int pid )
 
 	return qfalse;
 }
+
+/*
+==============================================================================
+
+JOB WORKERS
+
+A small pool of threads that Sys_RunJobs spreads independent work items
+over.  The calling thread always takes part, so with no workers active the
+jobs simply run inline.  Threads are started the first time they are asked
+for and then kept, lowering the count only parks them.
+==============================================================================
+*/
+
+#define MAX_JOB_WORKERS 32
+
+static struct
+{
+	CRITICAL_SECTION	lock;
+	qboolean			lockInitialized;
+	HANDLE				workEvent;	// manual reset, set while a batch is open
+	HANDLE				doneEvent;	// auto reset, set when the last job finishes
+	HANDLE				threads[ MAX_JOB_WORKERS ];
+	int					numWorkers;
+	int					active;		// workers with a lower index take jobs
+	qboolean			quit;
+
+	int					generation;
+	sysJobFunc_t		func;
+	void				*data;
+	int					count;
+	int					next;
+	int					done;
+} sys_jobs;
+
+/*
+==================
+Sys_ClaimJobs
+
+Runs queued jobs until there are none left to claim.
+Must be called with the lock held.
+==================
+*/
+static void Sys_ClaimJobs( void )
+{
+	int index;
+
+	while( sys_jobs.next < sys_jobs.count )
+	{
+		index = sys_jobs.next++;
+
+		LeaveCriticalSection( &sys_jobs.lock );
+		sys_jobs.func( sys_jobs.data, index );
+		EnterCriticalSection( &sys_jobs.lock );
+
+		if( ++sys_jobs.done == sys_jobs.count )
+			SetEvent( sys_jobs.doneEvent );
+	}
+}
+
+/*
+==================
+Sys_JobWorker
+==================
+*/
+static DWORD WINAPI Sys_JobWorker( LPVOID arg )
+{
+	int index = (intptr_t)arg;
+	int seen;
+
+	EnterCriticalSection( &sys_jobs.lock );
+	seen = sys_jobs.generation;
+
+	while( !sys_jobs.quit )
+	{
+		if( sys_jobs.generation == seen )
+		{
+			LeaveCriticalSection( &sys_jobs.lock );
+			WaitForSingleObject( sys_jobs.workEvent, INFINITE );
+			EnterCriticalSection( &sys_jobs.lock );
+			continue;
+		}
+
+		seen = sys_jobs.generation;
+		if( index < sys_jobs.active )
+			Sys_ClaimJobs( );
+	}
+
+	LeaveCriticalSection( &sys_jobs.lock );
+
+	return 0;
+}
+
+/*
+==================
+Sys_InitJobs
+==================
+*/
+static void Sys_InitJobs( void )
+{
+	if( sys_jobs.lockInitialized )
+		return;
+
+	InitializeCriticalSection( &sys_jobs.lock );
+	sys_jobs.workEvent = CreateEvent( NULL, TRUE, FALSE, NULL );
+	sys_jobs.doneEvent = CreateEvent( NULL, FALSE, FALSE, NULL );
+	sys_jobs.lockInitialized = qtrue;
+}
+
+/*
+==================
+Sys_StopJobWorkers
+==================
+*/
+static void Sys_StopJobWorkers( void )
+{
+	int i;
+
+	if( !sys_jobs.numWorkers )
+		return;
+
+	EnterCriticalSection( &sys_jobs.lock );
+	sys_jobs.quit = qtrue;
+	SetEvent( sys_jobs.workEvent );
+	LeaveCriticalSection( &sys_jobs.lock );
+
+	WaitForMultipleObjects( sys_jobs.numWorkers, sys_jobs.threads, TRUE, INFINITE );
+
+	for( i = 0; i < sys_jobs.numWorkers; i++ )
+		CloseHandle( sys_jobs.threads[ i ] );
+
+	ResetEvent( sys_jobs.workEvent );
+	sys_jobs.numWorkers = 0;
+	sys_jobs.active = 0;
+	sys_jobs.quit = qfalse;
+}
+
+/*
+==================
+Sys_SetJobWorkers
+
+Lets count workers take jobs, starting the threads that don't exist yet.
+Returns the number of workers actually taking jobs.
+==================
+*/
+int Sys_SetJobWorkers( int count )
+{
+	if( count < 0 )
+		count = 0;
+	else if( count > MAX_JOB_WORKERS )
+		count = MAX_JOB_WORKERS;
+
+	Sys_InitJobs( );
+
+	while( sys_jobs.numWorkers < count )
+	{
+		sys_jobs.threads[ sys_jobs.numWorkers ] = CreateThread( NULL, 0, Sys_JobWorker,
+			(LPVOID)(intptr_t)sys_jobs.numWorkers, 0, NULL );
+
+		if( !sys_jobs.threads[ sys_jobs.numWorkers ] )
+		{
+			Com_Printf( "WARNING: could only start %d of %d job workers\n",
+				sys_jobs.numWorkers, count );
+			break;
+		}
+
+		sys_jobs.numWorkers++;
+	}
+
+	EnterCriticalSection( &sys_jobs.lock );
+	sys_jobs.active = MIN( count, sys_jobs.numWorkers );
+	LeaveCriticalSection( &sys_jobs.lock );
+
+	return sys_jobs.active;
+}
+
+/*
+==================
+Sys_JobWorkers
+==================
+*/
+int Sys_JobWorkers( void )
+{
+	return sys_jobs.active;
+}
+
+/*
+==================
+Sys_RunJobs
+
+Calls func( data, i ) for i in [0, count) spread over the job workers and
+the calling thread, and returns once all of them have finished.
+==================
+*/
+void Sys_RunJobs( sysJobFunc_t func, void *data, int count )
+{
+	int i;
+
+	if( count <= 0 )
+		return;
+
+	if( !sys_jobs.active || count == 1 )
+	{
+		for( i = 0; i < count; i++ )
+			func( data, i );
+
+		return;
+	}
+
+	EnterCriticalSection( &sys_jobs.lock );
+
+	sys_jobs.func = func;
+	sys_jobs.data = data;
+	sys_jobs.count = count;
+	sys_jobs.next = 0;
+	sys_jobs.done = 0;
+	sys_jobs.generation++;
+	SetEvent( sys_jobs.workEvent );
+
+	Sys_ClaimJobs( );
+
+	while( sys_jobs.done < sys_jobs.count )
+	{
+		LeaveCriticalSection( &sys_jobs.lock );
+		WaitForSingleObject( sys_jobs.doneEvent, INFINITE );
+		EnterCriticalSection( &sys_jobs.lock );
+	}
+
+	ResetEvent( sys_jobs.workEvent );
+	LeaveCriticalSection( &sys_jobs.lock );
+}
+
+/*
+==================
+Sys_CreateMutex
+==================
+*/
+void *Sys_CreateMutex( void )
+{
+	CRITICAL_SECTION *mutex = malloc( sizeof( *mutex ) );
+
+	if( !mutex )
+		Com_Error( ERR_FATAL, "Sys_CreateMutex: out of memory" );
+
+	InitializeCriticalSection( mutex );
+
+	return mutex;
+}
+
+/*
+==================
+Sys_DestroyMutex
+==================
+*/
+void Sys_DestroyMutex( void *mutex )
+{
+	if( !mutex )
+		return;
+
+	DeleteCriticalSection( mutex );
+	free( mutex );
+}
+
+/*
+==================
+Sys_LockMutex
+==================
+*/
+void Sys_LockMutex( void *mutex )
+{
+	EnterCriticalSection( mutex );
+}
+
+/*
+==================
+Sys_UnlockMutex
+==================
+*/
+void Sys_UnlockMutex( void *mutex )
+{
+	LeaveCriticalSection( mutex );
+}
+
+/*
+==================
+Sys_CreateThread
+
+Starts a thread running func( data, index ), returns NULL if it couldn't
+==================
+*/
+typedef struct
+{
+	HANDLE			thread;
+	sysJobFunc_t	func;
+	void			*data;
+	int				index;
+} sysThread_t;
+
+static DWORD WINAPI Sys_ThreadMain( LPVOID arg )
+{
+	sysThread_t *thread = arg;
+
+	thread->func( thread->data, thread->index );
+
+	return 0;
+}
+
+void *Sys_CreateThread( sysJobFunc_t func, void *data, int index )
+{
+	sysThread_t *thread = malloc( sizeof( *thread ) );
+
+	if( !thread )
+		return NULL;
+
+	thread->func = func;
+	thread->data = data;
+	thread->index = index;
+	thread->thread = CreateThread( NULL, 0, Sys_ThreadMain, thread, 0, NULL );
+
+	if( !thread->thread )
+	{
+		free( thread );
+		return NULL;
+	}
+
+	return thread;
+}
+
+/*
+==================
+Sys_JoinThread
+
+Waits for a thread to return and releases it
+==================
+*/
+void Sys_JoinThread( void *thread )
+{
+	WaitForSingleObject( ( (sysThread_t *)thread )->thread, INFINITE );
+	CloseHandle( ( (sysThread_t *)thread )->thread );
+	free( thread );
+}
+
+/*
+==================
+Sys_CreateSemaphore
+==================
+*/
+void *Sys_CreateSemaphore( void )
+{
+	HANDLE sem = CreateSemaphore( NULL, 0, 0x7fffffff, NULL );
+
+	if( !sem )
+		Com_Error( ERR_FATAL, "Sys_CreateSemaphore: failed" );
+
+	return sem;
+}
+
+/*
+==================
+Sys_DestroySemaphore
+==================
+*/
+void Sys_DestroySemaphore( void *sem )
+{
+	if( sem )
+		CloseHandle( sem );
+}
+
+/*
+==================
+Sys_PostSemaphore
+==================
+*/
+void Sys_PostSemaphore( void *sem )
+{
+	ReleaseSemaphore( sem, 1, NULL );
+}
+
+/*
+==================
+Sys_WaitSemaphore
+==================
+*/
+void Sys_WaitSemaphore( void *sem )
+{
+	WaitForSingleObject( sem, INFINITE );
+}